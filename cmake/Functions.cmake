@@ -226,6 +226,12 @@ macro(dune_probe_functions)
     "sys/mman.h;sys/types.h"
     DUNE_SYS_HAS_MMAP64)
 
+  dune_test_function(epoll_create1
+    "int"
+    "int"
+    "sys/epoll.h"
+    DUNE_SYS_HAS_EPOLL_CREATE1)
+
   dune_test_function(mlockall
     "int"
     "int"
@@ -718,6 +724,12 @@ macro(dune_probe_functions)
     "sys/mman.h;sys/stat.h;fcntl.h"
     DUNE_SYS_HAS_SHM_OPEN)
 
+  dune_test_function(fallocate
+    "int"
+    "int;int;off_t;off_t"
+    "fcntl.h"
+    DUNE_SYS_HAS_FALLOCATE)
+
   dune_test_function(gettext
     "char*"
     "char*"
@@ -130,6 +130,7 @@ macro(dune_probe_headers)
   dune_test_header(sys/vfs.h)
   dune_test_header(sys/statvfs.h)
   dune_test_header(sys/syscall.h)
+  dune_test_header(sys/epoll.h)
   dune_test_header(termios.h)
   dune_test_header(unistd.h)
   dune_test_header(windows.h)
@@ -0,0 +1,147 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+using namespace DUNE;
+
+//! Default number of iterations per message.
+static const unsigned c_iterations = 20000;
+
+//! Benchmark result of a message.
+struct Result
+{
+  //! Message name.
+  std::string name;
+  //! Serialized size.
+  unsigned size;
+  //! True if the payload has a fixed size.
+  bool fixed;
+  //! Serialization time (ns).
+  double serialize;
+  //! Deserialization time (ns).
+  double deserialize;
+};
+
+static void
+benchmark(IMC::Message* msg, unsigned iterations, Result& result)
+{
+  uint8_t bfr[65535];
+  uint16_t size = IMC::Packet::serialize(msg, bfr, sizeof(bfr));
+
+  uint64_t start = Time::Clock::getNsec();
+  for (unsigned i = 0; i < iterations; ++i)
+    IMC::Packet::serialize(msg, bfr, sizeof(bfr));
+  uint64_t middle = Time::Clock::getNsec();
+  for (unsigned i = 0; i < iterations; ++i)
+    IMC::Packet::deserialize(bfr, size, msg);
+  uint64_t end = Time::Clock::getNsec();
+
+  result.name = msg->getName();
+  result.size = size;
+  result.fixed = IMC::Schema::find(msg->getId())->fixed;
+  result.serialize = (middle - start) / (double)iterations;
+  result.deserialize = (end - middle) / (double)iterations;
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned iterations = c_iterations;
+  const char* filter = NULL;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      iterations = std::atoi(argv[++i]);
+    else if (std::strcmp(argv[i], "-h") == 0)
+    {
+      std::fprintf(stderr, "Usage: %s [-n ITERATIONS] [MESSAGE]\n", argv[0]);
+      return 1;
+    }
+    else
+      filter = argv[i];
+  }
+
+  std::vector<uint32_t> ids;
+  IMC::Factory::getIds(ids);
+
+  std::vector<Result> results;
+  for (unsigned i = 0; i < ids.size(); ++i)
+  {
+    IMC::Message* msg = IMC::Factory::produce(ids[i]);
+    if (msg == NULL)
+      continue;
+
+    if (filter == NULL || std::strcmp(filter, msg->getName()) == 0)
+    {
+      msg->setTimeStamp(1.0);
+      Result result;
+      benchmark(msg, iterations, result);
+      results.push_back(result);
+    }
+
+    delete msg;
+  }
+
+  double total_ser[2] = {0, 0};
+  double total_des[2] = {0, 0};
+  unsigned count[2] = {0, 0};
+
+  std::printf("%-32s %6s %5s %12s %12s\n", "Message", "Size", "Fixed", "Ser. (ns)", "Des. (ns)");
+  for (unsigned i = 0; i < results.size(); ++i)
+  {
+    const Result& r = results[i];
+    std::printf("%-32s %6u %5s %12.1f %12.1f\n", r.name.c_str(), r.size,
+                r.fixed ? "yes" : "no", r.serialize, r.deserialize);
+    total_ser[r.fixed] += r.serialize;
+    total_des[r.fixed] += r.deserialize;
+    ++count[r.fixed];
+  }
+
+  for (unsigned i = 0; i < 2; ++i)
+  {
+    if (count[i] == 0)
+      continue;
+
+    std::printf("Average (%s, %u messages): serialize %.1f ns, deserialize %.1f ns\n",
+                i ? "fixed" : "variable", count[i],
+                total_ser[i] / count[i], total_des[i] / count[i]);
+  }
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Math/QPSolver.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+using namespace DUNE;
+using Math::Matrix;
+using Math::QPSolver;
+
+//! Default number of control ticks.
+static const unsigned c_iterations = 20000;
+//! Number of thrusters.
+static const int c_thrusters = 6;
+//! Maximum thrust of each thruster (N).
+static const double c_max_thrust = 40.0;
+
+//! Thrust allocation problem: minimize the weighted thrust effort
+//! subject to B u = tau and |u| <= c_max_thrust, for a slowly
+//! varying tau.
+struct Problem
+{
+  Matrix H;
+  Matrix f;
+  Matrix Aeq;
+  Matrix beq;
+  Matrix A;
+  Matrix b;
+
+  Problem(void):
+    H(c_thrusters),
+    f(c_thrusters, 1, 0.0),
+    Aeq(3, c_thrusters),
+    beq(3, 1),
+    A(2 * c_thrusters, c_thrusters, 0.0),
+    b(2 * c_thrusters, 1, c_max_thrust)
+  {
+    for (int i = 0; i < c_thrusters; ++i)
+    {
+      double angle = i * 2.0 * M_PI / c_thrusters + 0.3;
+      H(i, i) = 1.0 + i;
+      Aeq(0, i) = std::cos(angle);
+      Aeq(1, i) = std::sin(angle);
+      Aeq(2, i) = 0.5 * (i % 2 ? 1.0 : -1.0);
+      A(2 * i, i) = 1.0;
+      A(2 * i + 1, i) = -1.0;
+    }
+  }
+
+  //! Set demanded forces for a given control tick.
+  void
+  update(unsigned tick)
+  {
+    double t = tick * 0.01;
+    beq(0) = -85.0 * std::sin(0.3 * t);
+    beq(1) = -70.0 * std::cos(0.2 * t);
+    beq(2) = -12.0 * std::sin(0.5 * t);
+  }
+};
+
+int
+main(int argc, char** argv)
+{
+  unsigned iterations = c_iterations;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+    {
+      iterations = std::atoi(argv[++i]);
+    }
+    else
+    {
+      std::fprintf(stderr, "Usage: %s [-n ITERATIONS]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  Problem problem;
+  Matrix x;
+  double checksum[3] = {0, 0, 0};
+  unsigned iters[3] = {0, 0, 0};
+  double elapsed[3];
+
+  QPSolver cold(c_thrusters, 3, 2 * c_thrusters);
+  QPSolver warm(c_thrusters, 3, 2 * c_thrusters);
+  cold.setWarmStart(false);
+
+  // Warm up caches and allocator.
+  for (unsigned i = 0; i < iterations / 10; ++i)
+  {
+    problem.update(i);
+    QPSolver::solve(problem.H, problem.f, problem.Aeq, problem.beq, problem.A, problem.b, x);
+  }
+
+  for (unsigned mode = 0; mode < 3; ++mode)
+  {
+    uint64_t start = Time::Clock::getNsec();
+
+    for (unsigned i = 0; i < iterations; ++i)
+    {
+      problem.update(i);
+
+      if (mode == 0)
+      {
+        checksum[mode] += QPSolver::solve(problem.H, problem.f, problem.Aeq, problem.beq,
+                                          problem.A, problem.b, x);
+        continue;
+      }
+
+      QPSolver& solver = (mode == 1) ? cold : warm;
+      checksum[mode] += solver.minimize(problem.H, problem.f, problem.Aeq, problem.beq,
+                                        problem.A, problem.b, x);
+      iters[mode] += solver.getIterations();
+    }
+
+    elapsed[mode] = (Time::Clock::getNsec() - start) / (double)iterations;
+  }
+
+  const char* names[] = {"QPSolver::solve()", "minimize() (cold)", "minimize() (warm)"};
+
+  std::printf("%-24s %12s %12s\n", "Method", "Time (ns)", "Iterations");
+  for (unsigned i = 0; i < 3; ++i)
+  {
+    if (i == 0)
+      std::printf("%-24s %12.1f %12s\n", names[i], elapsed[i], "-");
+    else
+      std::printf("%-24s %12.1f %12.2f\n", names[i], elapsed[i], iters[i] / (double)iterations);
+  }
+
+  if (std::fabs(checksum[0] - checksum[1]) > 1e-6 * std::fabs(checksum[0])
+      || std::fabs(checksum[0] - checksum[2]) > 1e-6 * std::fabs(checksum[0]))
+  {
+    std::fprintf(stderr, "ERROR: solutions differ\n");
+    return 1;
+  }
+
+  return 0;
+}
@@ -73,156 +73,187 @@ const float c_max_speed = 6.0;
 // Timestep
 const float c_timestep = 0.5;
 
-int
-main(int32_t argc, char** argv)
+//! Integrate the distance travelled in each log.
+class DistanceTravelled: public IMC::LogReader::Handler
 {
-  if (argc <= 1)
-  {
-    std::cerr << "Usage: " << argv[0] << " <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
-              << std::endl;
-    return 1;
-  }
-
+public:
   std::map<std::string, Vehicle> vehicles;
 
-  for (int32_t i = 1; i < argc; ++i)
+  void
+  onBegin(unsigned stream, const std::string& path)
   {
-    std::istream* is = 0;
-    Compression::Methods method = Compression::Factory::detect(argv[i]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[i], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[i], method);
-
-    IMC::Message* msg = NULL;
-
-    uint16_t curr_rpm = 0;
-
-    bool got_state = false;
-    IMC::EstimatedState estate;
-    double last_lat;
-    double last_lon;
-
-    // Accumulated travelled distance
-    double distance = 0.0;
-    // Accumulated travelled time
-    double duration = 0.0;
-
-    bool got_name = false;
-    std::string log_name = "unknown";
+    (void)stream;
+    (void)path;
+
+    m_curr_rpm = 0;
+    m_got_state = false;
+    m_estate = IMC::EstimatedState();
+    m_distance = 0.0;
+    m_duration = 0.0;
+    m_got_name = false;
+    m_log_name = "unknown";
+    m_ignore = false;
+    m_sys_id = 0xffff;
+    m_sys_name.clear();
+  }
 
-    bool ignore = false;
-    uint16_t sys_id = 0xffff;
-    std::string sys_name;
+  bool
+  onMessages(unsigned stream, std::vector<IMC::Message*>& msgs)
+  {
+    (void)stream;
 
-    try
+    for (unsigned i = 0; i < msgs.size(); ++i)
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      IMC::Message* msg = msgs[i];
+
+      if (msg->getId() == DUNE_IMC_ANNOUNCE)
+      {
+        IMC::Announce* ptr = static_cast<IMC::Announce*>(msg);
+        if (m_sys_id == ptr->getSource())
+        {
+          m_sys_name = ptr->sys_name;
+        }
+      }
+      else if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
       {
-        if (msg->getId() == DUNE_IMC_ANNOUNCE)
+        if (!m_got_name)
         {
-          IMC::Announce* ptr = static_cast<IMC::Announce*>(msg);
-          if (sys_id == ptr->getSource())
+          IMC::LoggingControl* ptr = static_cast<IMC::LoggingControl*>(msg);
+
+          if (ptr->op == IMC::LoggingControl::COP_STARTED)
           {
-            sys_name = ptr->sys_name;
+            m_sys_id = ptr->getSource();
+            m_log_name = ptr->name;
+            m_got_name = true;
           }
         }
-        else if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
+      }
+      else if (msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
+      {
+        if (msg->getTimeStamp() - m_estate.getTimeStamp() > c_timestep)
         {
-          if (!got_name)
+          IMC::EstimatedState* ptr = static_cast<IMC::EstimatedState*>(msg);
+
+          if (!m_got_state)
           {
-            IMC::LoggingControl* ptr = static_cast<IMC::LoggingControl*>(msg);
+            m_estate = *ptr;
+            Coordinates::toWGS84(*ptr, m_last_lat, m_last_lon);
 
-            if (ptr->op == IMC::LoggingControl::COP_STARTED)
-            {
-              sys_id = ptr->getSource();
-              log_name = ptr->name;
-              got_name = true;
-            }
+            m_got_state = true;
           }
-        }
-        else if (msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
-        {
-          if (msg->getTimeStamp() - estate.getTimeStamp() > c_timestep)
+          else if (m_curr_rpm > c_min_rpm)
           {
-            IMC::EstimatedState* ptr = static_cast<IMC::EstimatedState*>(msg);
+            double lat, lon;
+            Coordinates::toWGS84(*ptr, lat, lon);
 
-            if (!got_state)
-            {
-              estate = *ptr;
-              Coordinates::toWGS84(*ptr, last_lat, last_lon);
+            double dist = Coordinates::WGS84::distance(m_last_lat, m_last_lon, 0.0,
+                                                       lat, lon, 0.0);
 
-              got_state = true;
-            }
-            else if (curr_rpm > c_min_rpm)
+            // Not faster than maximum considered speed
+            if (dist / (ptr->getTimeStamp() - m_estate.getTimeStamp()) < c_max_speed)
             {
-              double lat, lon;
-              Coordinates::toWGS84(*ptr, lat, lon);
-
-              double dist = Coordinates::WGS84::distance(last_lat, last_lon, 0.0,
-                                                         lat, lon, 0.0);
-
-              // Not faster than maximum considered speed
-              if (dist / (ptr->getTimeStamp() - estate.getTimeStamp()) < c_max_speed)
-              {
-                distance += dist;
-                duration += msg->getTimeStamp() - estate.getTimeStamp();
-              }
-
-              estate = *ptr;
-              last_lat = lat;
-              last_lon = lon;
+              m_distance += dist;
+              m_duration += msg->getTimeStamp() - m_estate.getTimeStamp();
             }
+
+            m_estate = *ptr;
+            m_last_lat = lat;
+            m_last_lon = lon;
           }
         }
-        else if (msg->getId() == DUNE_IMC_RPM)
-        {
-          IMC::Rpm* ptr = static_cast<IMC::Rpm*>(msg);
-          curr_rpm = ptr->value;
-        }
-        else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
-        {
-          // since it has simulated state let us ignore this log
-          ignore = true;
-          delete msg;
-          std::cerr << "this is a simulated log";
-          break;
-        }
-
-        delete msg;
+      }
+      else if (msg->getId() == DUNE_IMC_RPM)
+      {
+        IMC::Rpm* ptr = static_cast<IMC::Rpm*>(msg);
+        m_curr_rpm = ptr->value;
+      }
+      else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
+      {
+        // since it has simulated state let us ignore this log
+        m_ignore = true;
+        std::cerr << "this is a simulated log";
+        return false;
+      }
 
-        // ignore idles
-        // either has the string _idle or has only the time.
-        if (log_name.find("_idle") != std::string::npos ||
-            log_name.size() == 15)
-        {
-          ignore = true;
-          std::cerr << "this is an idle log";
-          break;
-        }
+      // ignore idles
+      // either has the string _idle or has only the time.
+      if (m_log_name.find("_idle") != std::string::npos ||
+          m_log_name.size() == 15)
+      {
+        m_ignore = true;
+        std::cerr << "this is an idle log";
+        return false;
       }
     }
-    catch (std::runtime_error& e)
-    {
-      std::cerr << "ERROR: " << e.what() << std::endl;
-    }
 
-    delete is;
+    return true;
+  }
+
+  void
+  onEnd(unsigned stream, const std::string& error)
+  {
+    (void)stream;
+
+    if (!error.empty())
+      std::cerr << "ERROR: " << error << std::endl;
 
-    if (ignore)
+    if (m_ignore)
     {
       std::cerr << "... ignoring" << std::endl;
-      continue;
+      return;
     }
 
-    if (distance > 0)
+    if (m_distance > 0)
     {
-      vehicles[sys_name].duration += duration;
-      vehicles[sys_name].distance += distance;
-      vehicles[sys_name].logs.push_back(Log(log_name, distance, duration));
+      vehicles[m_sys_name].duration += m_duration;
+      vehicles[m_sys_name].distance += m_distance;
+      vehicles[m_sys_name].logs.push_back(Log(m_log_name, m_distance, m_duration));
     }
   }
 
+private:
+  uint16_t m_curr_rpm;
+  bool m_got_state;
+  IMC::EstimatedState m_estate;
+  double m_last_lat;
+  double m_last_lon;
+  // Accumulated travelled distance
+  double m_distance;
+  // Accumulated travelled time
+  double m_duration;
+  bool m_got_name;
+  std::string m_log_name;
+  bool m_ignore;
+  uint16_t m_sys_id;
+  std::string m_sys_name;
+};
+
+int
+main(int32_t argc, char** argv)
+{
+  if (argc <= 1)
+  {
+    std::cerr << "Usage: " << argv[0] << " <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
+              << std::endl;
+    return 1;
+  }
+
+  std::set<uint16_t> ids;
+  ids.insert(DUNE_IMC_ANNOUNCE);
+  ids.insert(DUNE_IMC_LOGGINGCONTROL);
+  ids.insert(DUNE_IMC_ESTIMATEDSTATE);
+  ids.insert(DUNE_IMC_RPM);
+  ids.insert(DUNE_IMC_SIMULATEDSTATE);
+
+  IMC::LogReader reader;
+  reader.setFilter(ids);
+  for (int32_t i = 1; i < argc; ++i)
+    reader.add(argv[i]);
+
+  DistanceTravelled handler;
+  reader.run(handler);
+  const std::map<std::string, Vehicle>& vehicles = handler.vehicles;
+
   double total_distance = 0;
   double total_duration = 0;
 
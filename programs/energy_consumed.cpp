@@ -50,185 +50,237 @@ const unsigned c_samples = 7;
 // Minimum number of samples before starting to count energy
 const unsigned c_min_samples = 20;
 
-int
-main(int32_t argc, char** argv)
+//! Integrate the energy consumed in each log.
+class EnergyConsumed: public DUNE::IMC::LogReader::Handler
 {
-  if (argc <= 1)
+public:
+  // Total of energy spent
+  double total_accum;
+  // Total energy spent while the motor was on
+  double motor_total_accum;
+
+  EnergyConsumed(const std::string& volt_label, const std::string& curr_label):
+    total_accum(0.0),
+    motor_total_accum(0.0),
+    m_volt_label(volt_label),
+    m_curr_label(curr_label),
+    m_bdata(NULL)
   {
-    std::cerr << "Usage: " << argv[0] << " <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
-              << std::endl;
-    std::cerr << "Or: " << argv[0] << "-e <Voltage Entity Label> <Current Entity Label> <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
-              << std::endl;
-    return 1;
+    // Moving average window sizes
+    for (unsigned k = 0; k < Monitors::FuelLevel::BatteryData::BM_TOTAL; k++)
+      m_wsizes[k] = c_samples;
   }
 
-  std::string volt_label;
-  std::string curr_label;
-
-  unsigned start_index = 1;
-
-  if (strcmp(argv[1], "-e") == 0)
+  ~EnergyConsumed(void)
   {
-    if (argc < 5)
-    {
-      std::cerr << "Too few arguments" << std::endl;
-      return 1;
-    }
-
-    volt_label = argv[2];
-    curr_label = argv[3];
-
-    start_index = 4;
-  }
-  else
-  {
-    volt_label = c_label;
-    curr_label = c_label;
+    delete m_bdata;
   }
 
-  // Total of energy spent
-  double total_accum = 0.0;
-  // Total energy spent while the motor was on
-  double motor_total_accum = 0.0;
+  void
+  onBegin(unsigned stream, const std::string& path)
+  {
+    (void)stream;
+    (void)path;
 
-  // Moving average window sizes
-  unsigned wsizes[Monitors::FuelLevel::BatteryData::BM_TOTAL];
+    m_got_name = false;
+    m_log_name = "unknown";
 
-  for (unsigned k = 0; k < Monitors::FuelLevel::BatteryData::BM_TOTAL; k++)
-    wsizes[k] = c_samples;
+    // Energy computation related data
+    delete m_bdata;
+    m_bdata = new Monitors::FuelLevel::BatteryData(m_wsizes);
+    m_volt_entity_set = false;
+    m_curr_entity_set = false;
+    m_entities_set = false;
+    for (unsigned k = 0; k < Monitors::FuelLevel::BatteryData::BM_TOTAL; k++)
+      m_eids[k] = 0;
+    m_samples = 0;
+    m_last_timestamp = 0.0;
+    m_accum = 0.0;
+    m_rpm = 0.0;
+    m_ignore = false;
+  }
 
-  for (int32_t i = start_index; i < argc; ++i)
+  bool
+  onMessages(unsigned stream, std::vector<DUNE::IMC::Message*>& msgs)
   {
-    std::istream* is = 0;
-    DUNE::Compression::Methods method = DUNE::Compression::Factory::detect(argv[i]);
-    if (method == DUNE::Compression::METHOD_UNKNOWN)
-      is = new std::ifstream(argv[i], std::ios::binary);
-    else
-      is = new DUNE::Compression::FileInput(argv[i], method);
-
-    DUNE::IMC::Message* msg = NULL;
+    (void)stream;
 
-    bool got_name = false;
-    std::string log_name = "unknown";
-
-    // Energy computation related data
-    Monitors::FuelLevel::BatteryData bdata(wsizes);
-    bool volt_entity_set = false;
-    bool curr_entity_set = false;
-    bool entities_set = false;
-    unsigned eids[Monitors::FuelLevel::BatteryData::BM_TOTAL] = {0};
-    unsigned samples = 0;
-    double last_timestamp = 0.0;
-    double accum = 0.0;
-
-    // Current rpm value
-    float rpm = 0.0;
-
-    // Ignore some logs
-    bool ignore = false;
-
-    try
+    for (unsigned i = 0; i < msgs.size(); ++i)
     {
-      while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
-      {
+      DUNE::IMC::Message* msg = msgs[i];
 
-        if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
-        {
-          if (!got_name)
-          {
-            DUNE::IMC::LoggingControl* ptr = static_cast<DUNE::IMC::LoggingControl*>(msg);
-
-            if (ptr->op == DUNE::IMC::LoggingControl::COP_STARTED)
-            {
-              log_name = ptr->name;
-              got_name = true;
-            }
-          }
-        }
-        else if (msg->getId() == DUNE_IMC_ENTITYINFO)
+      if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
+      {
+        if (!m_got_name)
         {
-          DUNE::IMC::EntityInfo* ptr = static_cast<DUNE::IMC::EntityInfo*>(msg);
-
-          if (ptr->label.compare(volt_label) == 0)
-          {
-            eids[Monitors::FuelLevel::BatteryData::BM_VOLTAGE] = ptr->id;
-            volt_entity_set = true;
-          }
+          DUNE::IMC::LoggingControl* ptr = static_cast<DUNE::IMC::LoggingControl*>(msg);
 
-          if (ptr->label.compare(curr_label) == 0)
+          if (ptr->op == DUNE::IMC::LoggingControl::COP_STARTED)
           {
-            eids[Monitors::FuelLevel::BatteryData::BM_CURRENT] = ptr->id;
-            curr_entity_set = true;
+            m_log_name = ptr->name;
+            m_got_name = true;
           }
+        }
+      }
+      else if (msg->getId() == DUNE_IMC_ENTITYINFO)
+      {
+        DUNE::IMC::EntityInfo* ptr = static_cast<DUNE::IMC::EntityInfo*>(msg);
 
-          if (!entities_set && volt_entity_set && curr_entity_set)
-          {
-            bdata.setEntities(eids);
-            entities_set = true;
-          }
+        if (ptr->label.compare(m_volt_label) == 0)
+        {
+          m_eids[Monitors::FuelLevel::BatteryData::BM_VOLTAGE] = ptr->id;
+          m_volt_entity_set = true;
         }
-        else if (msg->getId() == DUNE_IMC_VOLTAGE)
+
+        if (ptr->label.compare(m_curr_label) == 0)
         {
-          if (entities_set)
-          {
-            DUNE::IMC::Voltage* ptr = static_cast<DUNE::IMC::Voltage*>(msg);
-            bdata.update(ptr);
-            ++samples;
-
-            if (samples > c_min_samples)
-            {
-              float drop = bdata.getEnergyDrop(msg->getTimeStamp() - last_timestamp);
-              accum += drop;
-
-              if (rpm > c_min_rpm)
-                motor_total_accum += drop;
-            }
-          }
+          m_eids[Monitors::FuelLevel::BatteryData::BM_CURRENT] = ptr->id;
+          m_curr_entity_set = true;
+        }
 
-          last_timestamp = msg->getTimeStamp();
+        if (!m_entities_set && m_volt_entity_set && m_curr_entity_set)
+        {
+          m_bdata->setEntities(m_eids);
+          m_entities_set = true;
         }
-        else if (msg->getId() == DUNE_IMC_CURRENT)
+      }
+      else if (msg->getId() == DUNE_IMC_VOLTAGE)
+      {
+        if (m_entities_set)
         {
-          if (entities_set)
+          DUNE::IMC::Voltage* ptr = static_cast<DUNE::IMC::Voltage*>(msg);
+          m_bdata->update(ptr);
+          ++m_samples;
+
+          if (m_samples > c_min_samples)
           {
-            DUNE::IMC::Current* ptr = static_cast<DUNE::IMC::Current*>(msg);
-            bdata.update(ptr);
+            float drop = m_bdata->getEnergyDrop(msg->getTimeStamp() - m_last_timestamp);
+            m_accum += drop;
+
+            if (m_rpm > c_min_rpm)
+              motor_total_accum += drop;
           }
         }
-        else if (msg->getId() == DUNE_IMC_RPM)
-        {
-          DUNE::IMC::Rpm* ptr = static_cast<DUNE::IMC::Rpm*>(msg);
-          rpm = ptr->value;
-        }
-        else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
+
+        m_last_timestamp = msg->getTimeStamp();
+      }
+      else if (msg->getId() == DUNE_IMC_CURRENT)
+      {
+        if (m_entities_set)
         {
-          // since it has simulated state let us ignore this log
-          ignore = true;
-          delete msg;
-          std::cerr << "this is a simulated log";
-          break;
+          DUNE::IMC::Current* ptr = static_cast<DUNE::IMC::Current*>(msg);
+          m_bdata->update(ptr);
         }
-
-        delete msg;
+      }
+      else if (msg->getId() == DUNE_IMC_RPM)
+      {
+        DUNE::IMC::Rpm* ptr = static_cast<DUNE::IMC::Rpm*>(msg);
+        m_rpm = ptr->value;
+      }
+      else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
+      {
+        // since it has simulated state let us ignore this log
+        m_ignore = true;
+        std::cerr << "this is a simulated log";
+        return false;
       }
     }
-    catch (std::runtime_error& e)
+
+    return true;
+  }
+
+  void
+  onEnd(unsigned stream, const std::string& error)
+  {
+    (void)stream;
+
+    if (!error.empty())
+      std::cerr << "ERROR: " << error << std::endl;
+
+    if (m_ignore)
     {
-      std::cerr << "ERROR: " << e.what() << std::endl;
+      std::cerr << "... ignoring" << std::endl;
+      return;
     }
 
-    delete is;
+    std::cerr << "Consumed " << m_accum << " in " << m_log_name << "." << std::endl;
+
+    total_accum += m_accum;
+  }
+
+private:
+  std::string m_volt_label;
+  std::string m_curr_label;
+  unsigned m_wsizes[Monitors::FuelLevel::BatteryData::BM_TOTAL];
+  bool m_got_name;
+  std::string m_log_name;
+  Monitors::FuelLevel::BatteryData* m_bdata;
+  bool m_volt_entity_set;
+  bool m_curr_entity_set;
+  bool m_entities_set;
+  unsigned m_eids[Monitors::FuelLevel::BatteryData::BM_TOTAL];
+  unsigned m_samples;
+  double m_last_timestamp;
+  double m_accum;
+  // Current rpm value
+  float m_rpm;
+  // Ignore some logs
+  bool m_ignore;
+};
+
+int
+main(int32_t argc, char** argv)
+{
+  if (argc <= 1)
+  {
+    std::cerr << "Usage: " << argv[0] << " <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
+              << std::endl;
+    std::cerr << "Or: " << argv[0] << "-e <Voltage Entity Label> <Current Entity Label> <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
+              << std::endl;
+    return 1;
+  }
+
+  std::string volt_label;
+  std::string curr_label;
+
+  unsigned start_index = 1;
 
-    if (ignore)
+  if (strcmp(argv[1], "-e") == 0)
+  {
+    if (argc < 5)
     {
-      std::cerr << "... ignoring" << std::endl;
-      continue;
+      std::cerr << "Too few arguments" << std::endl;
+      return 1;
     }
 
-    std::cerr << "Consumed " << accum << " in " << log_name << "." << std::endl;
+    volt_label = argv[2];
+    curr_label = argv[3];
 
-    total_accum += accum;
+    start_index = 4;
   }
+  else
+  {
+    volt_label = c_label;
+    curr_label = c_label;
+  }
+
+  std::set<uint16_t> ids;
+  ids.insert(DUNE_IMC_LOGGINGCONTROL);
+  ids.insert(DUNE_IMC_ENTITYINFO);
+  ids.insert(DUNE_IMC_VOLTAGE);
+  ids.insert(DUNE_IMC_CURRENT);
+  ids.insert(DUNE_IMC_RPM);
+  ids.insert(DUNE_IMC_SIMULATEDSTATE);
+
+  DUNE::IMC::LogReader reader;
+  reader.setFilter(ids);
+  for (int32_t i = start_index; i < argc; ++i)
+    reader.add(argv[i]);
+
+  EnergyConsumed handler(volt_label, curr_label);
+  reader.run(handler);
+  double total_accum = handler.total_accum;
+  double motor_total_accum = handler.motor_total_accum;
 
   std::cerr << "Total energy consumed is " << total_accum << "Wh" << std::endl
             << "The amount of " << motor_total_accum
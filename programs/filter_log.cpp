@@ -41,6 +41,101 @@
 
 using DUNE_NAMESPACES;
 
+//! Write selected messages to a new log.
+class Filter: public IMC::LogReader::Handler
+{
+public:
+  Filter(const char* fname, const std::set<uint16_t>& ids,
+         const std::vector<std::string>& files):
+    m_lsf(fname, std::ios::binary),
+    m_ids(ids),
+    m_files(files),
+    m_count(0),
+    m_accum(0),
+    m_done_first(false),
+    m_failed(false)
+  { }
+
+  void
+  onBegin(unsigned stream, const std::string& path)
+  {
+    (void)stream;
+    (void)path;
+    m_count = 0;
+  }
+
+  bool
+  onMessages(unsigned stream, std::vector<IMC::Message*>& msgs)
+  {
+    (void)stream;
+
+    if (m_failed)
+      return false;
+
+    for (unsigned i = 0; i < msgs.size(); ++i)
+    {
+      if (!m_done_first)
+      {
+        // place an empty estimatedstate message in the log
+        IMC::EstimatedState state;
+        state.setTimeStamp(msgs[i]->getTimeStamp());
+        IMC::Packet::serialize(&state, m_buffer);
+        m_lsf.write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        m_done_first = true;
+      }
+
+      // The first message of each log is delivered even if not selected.
+      if (m_ids.find(msgs[i]->getId()) == m_ids.end())
+        continue;
+
+      IMC::Packet::serialize(msgs[i], m_buffer);
+      m_lsf.write(m_buffer.getBufferSigned(), m_buffer.getSize());
+      ++m_count;
+    }
+
+    return true;
+  }
+
+  void
+  onEnd(unsigned stream, const std::string& error)
+  {
+    if (m_failed)
+      return;
+
+    if (!error.empty())
+    {
+      std::cerr << "ERROR: " << error << std::endl;
+      m_failed = true;
+      return;
+    }
+
+    std::cerr << m_count << " messages in " << m_files[stream] << std::endl;
+    m_accum += m_count;
+  }
+
+  bool
+  failed(void) const
+  {
+    return m_failed;
+  }
+
+  uint32_t
+  getTotal(void) const
+  {
+    return m_accum;
+  }
+
+private:
+  ByteBuffer m_buffer;
+  std::ofstream m_lsf;
+  std::set<uint16_t> m_ids;
+  std::vector<std::string> m_files;
+  uint32_t m_count;
+  uint32_t m_accum;
+  bool m_done_first;
+  bool m_failed;
+};
+
 int
 main(int32_t argc, char** argv)
 {
@@ -55,16 +150,7 @@ main(int32_t argc, char** argv)
     return 1;
   }
 
-  ByteBuffer buffer;
-  std::ofstream lsf("FilteredData.lsf", std::ios::binary);
-
-  IMC::Message* msg;
-
-  uint32_t accum = 0;
-
-  bool done_first = false;
-
-  std::set<uint32_t> ids;
+  std::set<uint16_t> ids;
   std::vector<std::string> msgs;
   Utils::String::split(argv[1], ",", msgs);
 
@@ -74,60 +160,21 @@ main(int32_t argc, char** argv)
     ids.insert(got);
   }
 
-  for (uint32_t j = 2; j < (uint32_t)argc; ++j)
-  {
-    std::istream* is = 0;
-    Compression::Methods method = Compression::Factory::detect(argv[j]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[j], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[j], method);
+  std::vector<std::string> files(argv + 2, argv + argc);
 
-    uint32_t i = 0;
+  IMC::LogReader reader;
+  reader.setFilter(ids);
+  reader.setKeepFirst(true);
+  for (unsigned j = 0; j < files.size(); ++j)
+    reader.add(files[j]);
 
-    try
-    {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
-      {
-        if (!done_first)
-        {
-          // place an empty estimatedstate message in the log
-          IMC::EstimatedState state;
-          state.setTimeStamp(msg->getTimeStamp());
-          IMC::Packet::serialize(&state, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
-          done_first = true;
-        }
-
-        std::set<uint32_t>::const_iterator it;
-        it = ids.find(msg->getId());
-
-        if (it != ids.end())
-        {
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
-
-          ++i;
-        }
-
-        delete msg;
-      }
-    }
-    catch (std::runtime_error& e)
-    {
-      std::cerr << "ERROR: " << e.what() << std::endl;
-      return -1;
-    }
-
-    std::cerr << i << " messages in " << argv[j] << std::endl;
-    accum += i;
-
-    delete is;
-  }
+  Filter filter("FilteredData.lsf", ids, files);
+  reader.run(filter);
 
-  lsf.close();
+  if (filter.failed())
+    return -1;
 
-  std::cerr << "Total of " << accum << " " << argv[1] << " messages." << std::endl;
+  std::cerr << "Total of " << filter.getTotal() << " " << argv[1] << " messages." << std::endl;
 
   return 0;
 }
@@ -35,12 +35,26 @@ from imc.deps import *
 
 CONST_NULL_ID = 65535
 
-def get_cxx_type(field_node):
+# Raw data fields stored in shared, copy-on-write buffers (message
+# abbreviation, field abbreviation).
+SHARED_RAWDATA = [
+    ('SonarData', 'data'),
+    ('MessagePart', 'data'),
+    ('UamTxFrame', 'data')
+]
+
+def is_shared_rawdata(msg_node, field_node):
+    return field_node.get('type') == 'rawdata' and \
+           (msg_node.get('abbrev'), field_node.get('abbrev')) in SHARED_RAWDATA
+
+def get_cxx_type(msg_node, field_node):
     type = field_node.get('type')
     msg_type = field_node.get('message-type', 'Message')
     if type == 'plaintext':
         return 'std::string'
     elif type == 'rawdata':
+        if is_shared_rawdata(msg_node, field_node):
+            return 'RawData'
         return 'std::vector<char>'
     elif type == 'message':
         return 'InlineMessage<%s>' % msg_type
@@ -91,6 +105,7 @@ class Message:
 
         public = []
         protected = []
+        fixed = self.is_fixed()
 
         # getIdStatic()
         f = Function('getIdStatic', 'uint16_t', static = True, inline = True)
@@ -100,6 +115,8 @@ class Message:
         # Constructor.
         f = Function(node.get('abbrev'))
         f.add_body('m_header.mgid = ' + node.get('id') + ';')
+        if fixed:
+            f.add_body('m_fixed_payload_size = c_payload_size;')
         f.add_body('clear();')
         for field in node.findall("field[@type='message']"):
             f.add_body(get_name(field) + '.setParent(this);')
@@ -143,7 +160,11 @@ class Message:
 
         # serializeFields()
         f = Function('serializeFields', 'uint8_t*', [Var('bfr__', 'uint8_t*')], const = True)
-        if self.has_fields():
+        if fixed and self.has_fields():
+            for field, offset in self.get_field_offsets():
+                f.add_body('IMC::serialize(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return bfr__ + c_payload_size;')
+        elif self.has_fields():
             f.add_body('uint8_t* ptr__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -155,9 +176,29 @@ class Message:
             f.add_body('return bfr__;')
         public.append(f)
 
+        # serializeFieldsHead()
+        fields = node.findall('field')
+        if len(fields) > 0 and is_shared_rawdata(node, fields[-1]):
+            f = Function('serializeFieldsHead', 'uint8_t*', [Var('bfr__', 'uint8_t*'), Var('tail__', 'const RawData*&')], const = True)
+            f.add_body('uint8_t* ptr__ = bfr__;')
+            for field in fields[:-1]:
+                if field.get('type').startswith('message'):
+                    f.add_body('ptr__ += %s.serialize(ptr__);' % get_name(field))
+                else:
+                    f.add_body('ptr__ += IMC::serialize(%s, ptr__);' % get_name(field))
+            f.add_body('ptr__ += IMC::serialize((uint16_t){0}.size(), ptr__);'.format(get_name(fields[-1])))
+            f.add_body('tail__ = &{0};'.format(get_name(fields[-1])))
+            f.add_body('return ptr__;')
+            public.append(f)
+
         # deserializeFields()
         f = Function('deserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if fixed and self.has_fields():
+            f.add_body('if (size__ < c_payload_size) throw BufferTooShort();')
+            for field, offset in self.get_field_offsets():
+                f.add_body('IMC::load(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return c_payload_size;')
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -172,7 +213,15 @@ class Message:
 
         # reverseDeserializeFields()
         f = Function('reverseDeserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if fixed and self.has_fields():
+            f.add_body('if (size__ < c_payload_size) throw BufferTooShort();')
+            for field, offset in self.get_field_offsets():
+                if consts['sizes'][field.get('type')] == 1:
+                    f.add_body('IMC::load(%s, bfr__ + %d);' % (get_name(field), offset))
+                else:
+                    f.add_body('IMC::reverseLoad(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return c_payload_size;')
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if consts['sizes'][field.get('type')] == 1:
@@ -288,8 +337,11 @@ class Message:
 
         for f in node.findall('field'):
             type = f.get('message-type')
-            v = Var(get_name(f), get_cxx_type(f), desc = f.get('name'))
+            v = Var(get_name(f), get_cxx_type(node, f), desc = f.get('name'))
             hpp.append(v.as_decl())
+        if fixed:
+            hpp.append(comment('Serialized payload size') + \
+                       'static const uint16_t c_payload_size = %d;' % self.get_fixed_size())
         hpp.append('')
 
         for function in public:
@@ -309,6 +361,8 @@ class Message:
         hpp.append('};\n')
 
         # CPP.
+        if fixed:
+            cpp.append('const uint16_t %s::c_payload_size;\n' % node.get('abbrev'))
         for function in public + protected:
             if not function.is_inline():
                 function.set_class(node.get('abbrev'))
@@ -358,6 +412,22 @@ class Message:
                 ret.append(get_name(field))
         return ret
 
+    # Retrieve a list of (field, offset) pairs of a fixed size message.
+    def get_field_offsets(self):
+        ret = []
+        offset = 0
+        for field in self._node.findall('field'):
+            ret.append((field, offset))
+            offset += self._consts['sizes'][field.get('type')]
+        return ret
+
+    # True if all fields have a fixed size.
+    def is_fixed(self):
+        for field in self._node.findall('field'):
+            if field.get('type') in self._consts['variable_types']:
+                return False
+        return True
+
     def has_fields(self):
         return len(self._node.findall('field')) > 0
 
@@ -519,6 +589,29 @@ for msg in root.findall('message'):
 f.append('#undef MESSAGE')
 f.write()
 
+################################################################################
+# Schema.def                                                                   #
+################################################################################
+SCHEMA_TYPES = {
+    'uint8_t': 'TYPE_UINT8', 'int8_t': 'TYPE_INT8',
+    'uint16_t': 'TYPE_UINT16', 'int16_t': 'TYPE_INT16',
+    'uint32_t': 'TYPE_UINT32', 'int32_t': 'TYPE_INT32',
+    'int64_t': 'TYPE_INT64', 'fp32_t': 'TYPE_FP32', 'fp64_t': 'TYPE_FP64',
+    'rawdata': 'TYPE_RAWDATA', 'plaintext': 'TYPE_PLAINTEXT',
+    'message': 'TYPE_MESSAGE', 'message-list': 'TYPE_MESSAGE_LIST'
+}
+
+f = File('Schema.def', dest_folder, ns = False, md5 = xml_md5)
+for msg in root.findall('message'):
+    f.append('SCHEMA_MESSAGE(%(id)s, %(abbrev)s)' % msg.attrib)
+    for field in msg.findall('field'):
+        f.append('SCHEMA_FIELD(%s, %s, %s, "%s")' % (msg.get('abbrev'), field.get('abbrev'),
+                                                  SCHEMA_TYPES[field.get('type')],
+                                                  field.get('unit', '')))
+f.append('#undef SCHEMA_MESSAGE')
+f.append('#undef SCHEMA_FIELD')
+f.write()
+
 ################################################################################
 # SuperTypes.hpp                                                               #
 ################################################################################
@@ -537,6 +630,7 @@ hpp = File('Definitions.hpp', dest_folder, md5 = xml_md5)
 hpp.add_isoc_headers('ostream', 'string', 'vector')
 hpp.add_dune_headers('Config.hpp', 'IMC/Message.hpp',
                      'IMC/InlineMessage.hpp', 'IMC/MessageList.hpp',
+                     'IMC/RawData.hpp',
                      'IMC/Enumerations.hpp', 'IMC/Bitfields.hpp',
                      'IMC/SuperTypes.hpp', 'IMC/JSON.hpp')
 
@@ -44,70 +44,99 @@
 
 using DUNE_NAMESPACES;
 
-int
-main(int32_t argc, char** argv)
+//! Write accurate GPS fixes to a new log.
+class SurfacePositions: public IMC::LogReader::Handler
 {
-  if (argc != 2)
+public:
+  SurfacePositions(const char* fname):
+    m_lsf(fname, std::ios::binary),
+    m_count(0),
+    m_timestamp(-1.0)
   {
-    std::cerr << "Usage: " << argv[0] << " Data.lsf[.gz]"
-              << std::endl;
-    return 1;
+    IMC::EstimatedState state;
+    IMC::Packet::serialize(&state, m_buffer);
+    m_lsf.write(m_buffer.getBufferSigned(), m_buffer.getSize());
   }
 
-  std::istream* is = 0;
-  Compression::Methods method = Compression::Factory::detect(argv[1]);
-  if (method == METHOD_UNKNOWN)
-    is = new std::ifstream(argv[1], std::ios::binary);
-  else
-    is = new Compression::FileInput(argv[1], method);
+  bool
+  onMessages(unsigned stream, std::vector<IMC::Message*>& msgs)
+  {
+    (void)stream;
+
+    for (unsigned i = 0; i < msgs.size(); ++i)
+    {
+      IMC::GpsFix* fix = static_cast<IMC::GpsFix*>(msgs[i]);
 
-  ByteBuffer buffer;
-  std::ofstream lsf("SurfaceData.lsf", std::ios::binary);
+      if ((fix->hacc <= MIN_HACC) &&
+          (fix->validity & IMC::GpsFix::GFV_VALID_POS) &&
+          (fix->getTimeStamp() >= m_timestamp))
+      {
+        m_timestamp = fix->getTimeStamp();
 
-  IMC::Message* msg;
+        IMC::Packet::serialize(fix, m_buffer);
+        m_lsf.write(m_buffer.getBufferSigned(), m_buffer.getSize());
 
-  unsigned i = 0;
+        ++m_count;
+      }
+    }
 
-  IMC::EstimatedState state;
-  IMC::Packet::serialize(&state, buffer);
-  lsf.write(buffer.getBufferSigned(), buffer.getSize());
-  double timestamp = -1.0;
+    return true;
+  }
 
-  try
+  void
+  onEnd(unsigned stream, const std::string& error)
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
-    {
-      if (msg->getId() == DUNE_IMC_GPSFIX)
-      {
-        IMC::GpsFix* fix = static_cast<IMC::GpsFix*>(msg);
+    (void)stream;
+    m_error = error;
+  }
 
-        if ((fix->hacc <= MIN_HACC) &&
-            (fix->validity & IMC::GpsFix::GFV_VALID_POS) &&
-            (fix->getTimeStamp() >= timestamp))
-        {
-          timestamp = fix->getTimeStamp();
+  const std::string&
+  getError(void) const
+  {
+    return m_error;
+  }
 
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
+  unsigned
+  getCount(void) const
+  {
+    return m_count;
+  }
 
-          ++i;
-        }
-      }
+private:
+  ByteBuffer m_buffer;
+  std::ofstream m_lsf;
+  unsigned m_count;
+  double m_timestamp;
+  std::string m_error;
+};
 
-      delete msg;
-    }
-  }
-  catch (std::runtime_error& e)
+int
+main(int32_t argc, char** argv)
+{
+  if (argc != 2)
   {
-    std::cerr << "ERROR: " << e.what() << std::endl;
-    return -1;
+    std::cerr << "Usage: " << argv[0] << " Data.lsf[.gz]"
+              << std::endl;
+    return 1;
   }
 
-  lsf.close();
+  std::set<uint16_t> ids;
+  ids.insert(DUNE_IMC_GPSFIX);
+
+  IMC::LogReader reader;
+  reader.setFilter(ids);
+  reader.add(argv[1]);
 
-  delete is;
+  SurfacePositions handler("SurfaceData.lsf");
+  reader.run(handler);
+
+  if (!handler.getError().empty())
+  {
+    std::cerr << "ERROR: " << handler.getError() << std::endl;
+    return -1;
+  }
 
-  std::cerr << "Got " << i << " GpsFix messages." << std::endl;
+  std::cerr << "Got " << handler.getCount() << " GpsFix messages." << std::endl;
 
   return 0;
 }
@@ -0,0 +1,196 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdarg>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Minimal bus recipient counting received messages.
+class Sink: public Tasks::AbstractTask
+{
+public:
+  Sink(void):
+    received(0)
+  { }
+
+  unsigned received;
+
+  void
+  receive(const IMC::Message* msg)
+  {
+    (void)msg;
+    ++received;
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "Sink";
+  }
+
+  void
+  inf(const char*, ...)
+  { }
+
+  void
+  war(const char*, ...)
+  { }
+
+  void
+  err(const char*, ...)
+  { }
+
+  void
+  cri(const char*, ...)
+  { }
+
+  void
+  debug(const char*, ...)
+  { }
+
+  void
+  trace(const char*, ...)
+  { }
+
+  void
+  spew(const char*, ...)
+  { }
+
+private:
+  void
+  run(void)
+  { }
+};
+
+static IMC::Temperature
+makeTemperature(unsigned src, unsigned src_ent, double stamp)
+{
+  IMC::Temperature msg;
+  msg.setSource(src);
+  msg.setSourceEntity(src_ent);
+  msg.setDestination(0x10);
+  msg.setTimeStamp(stamp);
+  return msg;
+}
+
+int
+main(void)
+{
+  Test test("IMC::BusPredicate");
+
+  {
+    IMC::BusPredicate pred;
+    IMC::Temperature msg = makeTemperature(1, 2, 0.0);
+    test.boolean("empty predicate matches", pred.match(&msg));
+  }
+
+  {
+    IMC::BusPredicate pred;
+    pred.source(5).source(1).sourceEntity(2);
+    IMC::Temperature a = makeTemperature(1, 2, 0.0);
+    IMC::Temperature b = makeTemperature(3, 2, 0.0);
+    IMC::Temperature c = makeTemperature(5, 7, 0.0);
+    test.boolean("source and entity match", pred.match(&a));
+    test.boolean("source mismatch", !pred.match(&b));
+    test.boolean("entity mismatch", !pred.match(&c));
+    test.boolean("hits", pred.getHits() == 1);
+    test.boolean("misses", pred.getMisses() == 2);
+  }
+
+  {
+    IMC::BusPredicate pred;
+    pred.destination(0x10);
+    IMC::Temperature a = makeTemperature(1, 2, 0.0);
+    IMC::Temperature b = makeTemperature(1, 2, 0.0);
+    b.setDestination(0x20);
+    test.boolean("destination match", pred.match(&a));
+    test.boolean("destination mismatch", !pred.match(&b));
+  }
+
+  {
+    IMC::BusPredicate pred;
+    pred.rate(2.0);
+    unsigned accepted = 0;
+    for (unsigned i = 0; i < 32; ++i)
+    {
+      IMC::Temperature msg = makeTemperature(1, 2, i * 0.125);
+      if (pred.match(&msg))
+        ++accepted;
+    }
+    IMC::Temperature other = makeTemperature(1, 3, 3.95);
+    test.boolean("rate limit", accepted == 8);
+    test.boolean("rate limit per source entity", pred.match(&other));
+  }
+
+  {
+    IMC::BusPredicate pred;
+    pred.source(1).rate(1.0);
+    IMC::Temperature msg = makeTemperature(1, 2, 0.0);
+    pred.match(&msg);
+    IMC::BusPredicate copy(pred);
+    test.boolean("copy keeps criteria", copy == pred);
+    test.boolean("copy clears counters", copy.getHits() == 0 && copy.getMisses() == 0);
+    test.boolean("different criteria", !(copy == IMC::BusPredicate()));
+  }
+
+  {
+    IMC::Bus bus;
+    Sink all;
+    Sink filtered;
+    IMC::BusPredicate pred;
+    pred.sourceEntity(2);
+
+    bus.registerRecipient(&all, IMC::Temperature::getIdStatic());
+    bus.registerRecipient(&filtered, IMC::Temperature::getIdStatic(), &pred);
+
+    for (unsigned i = 0; i < 10; ++i)
+    {
+      IMC::Temperature msg = makeTemperature(1, i % 5, i);
+      bus.dispatch(&msg);
+    }
+
+    test.boolean("bus delivers unfiltered", all.received == 10);
+    test.boolean("bus filters before delivery", filtered.received == 2);
+    test.boolean("bus predicate counters", pred.getHits() == 2 && pred.getMisses() == 8);
+
+    bus.unregisterRecipient(&filtered, IMC::Temperature::getIdStatic());
+    IMC::Temperature msg = makeTemperature(1, 2, 20.0);
+    bus.dispatch(&msg);
+    test.boolean("unregister filtered", filtered.received == 2 && all.received == 11);
+  }
+
+  return test.getReturnValue();
+}
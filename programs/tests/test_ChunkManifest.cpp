@@ -0,0 +1,160 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Algorithms::XXHash;
+using DUNE::FileSystem::ChunkManifest;
+using DUNE::FileSystem::Path;
+
+//! Write a file with pseudo-random contents.
+static std::vector<uint8_t>
+writeFile(const Path& path, unsigned size, unsigned seed)
+{
+  std::vector<uint8_t> data(size);
+  uint32_t state = seed;
+  for (unsigned i = 0; i < size; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    data[i] = (uint8_t)(state >> 16);
+  }
+
+  std::ofstream ofs(path.c_str(), std::ios::binary);
+  if (size > 0)
+    ofs.write((const char*)&data[0], size);
+  return data;
+}
+
+int
+main(void)
+{
+  Test test("FileSystem::ChunkManifest");
+
+  {
+    const uint8_t* abc = (const uint8_t*)"abc";
+    test.boolean("xxhash empty", XXHash::compute(abc, 0) == 0x02cc5d05);
+    test.boolean("xxhash abc", XXHash::compute(abc, 3) == 0x32d153ff);
+    test.boolean("xxhash seed", XXHash::compute(abc, 3, 1) != XXHash::compute(abc, 3));
+    test.boolean("xxhash 64-bit", (uint32_t)XXHash::compute64(abc, 3) == 0x32d153ff);
+  }
+
+  Path root("/tmp/dune-test-ChunkManifest");
+  if (root.exists())
+    root.remove(Path::MODE_RECURSIVE);
+  root.create();
+
+  {
+    Path path = root / "file.dat";
+    std::vector<uint8_t> data = writeFile(path, 10000, 1);
+
+    ChunkManifest manifest(4096);
+    manifest.compute(path.str());
+    test.boolean("size", manifest.getSize() == 10000);
+    test.boolean("chunk count", manifest.getChunkCount() == 3);
+    test.boolean("last chunk length", manifest.getChunkLength(2) == 10000 - 8192);
+    test.boolean("chunk hash", manifest.getHash(1) == ChunkManifest::hash(&data[4096], 4096));
+
+    ChunkManifest copy;
+    test.boolean("parse", copy.parse(manifest.serialize()) && copy == manifest);
+    test.boolean("parse invalid", !copy.parse("10000 4096 2\n0123456789abcdef\n0123456789abcdef\n"));
+    test.boolean("parse truncated", !copy.parse("10000 4096 3\n0123456789abcdef\n"));
+
+    std::vector<unsigned> missing;
+    manifest.getMissing(manifest, missing);
+    test.boolean("identical copies", missing.empty());
+
+    ChunkManifest empty(4096);
+    manifest.getMissing(empty, missing);
+    test.boolean("missing copy", missing.size() == 3);
+
+    // Partial copy, as left by an interrupted transfer.
+    Path partial = root / "partial.dat";
+    {
+      std::ofstream ofs(partial.c_str(), std::ios::binary);
+      ofs.write((const char*)&data[0], 6000);
+    }
+
+    ChunkManifest local(4096);
+    local.compute(partial.str());
+    manifest.getMissing(local, missing);
+    test.boolean("partial copy", missing.size() == 2 && missing[0] == 1 && missing[1] == 2);
+
+    // Single modified byte.
+    data[5000] ^= 0xff;
+    {
+      std::ofstream ofs(partial.c_str(), std::ios::binary);
+      ofs.write((const char*)&data[0], data.size());
+    }
+
+    local.compute(partial.str());
+    manifest.getMissing(local, missing);
+    test.boolean("modified chunk", missing.size() == 1 && missing[0] == 1);
+
+    ChunkManifest other(1024);
+    other.compute(path.str());
+    manifest.getMissing(other, missing);
+    test.boolean("different chunk size", missing.size() == 3);
+  }
+
+  {
+    Path path = root / "empty.dat";
+    writeFile(path, 0, 0);
+    ChunkManifest manifest(4096);
+    manifest.compute(path.str());
+    ChunkManifest copy;
+    test.boolean("empty file", manifest.getChunkCount() == 0
+                 && copy.parse(manifest.serialize()) && copy.getSize() == 0);
+  }
+
+  {
+    ChunkManifest manifest;
+    bool thrown = false;
+    try
+    {
+      manifest.compute((root / "none.dat").str());
+    }
+    catch (std::runtime_error&)
+    {
+      thrown = true;
+    }
+    test.boolean("missing file", thrown);
+  }
+
+  root.remove(Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,215 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+#include <DUNE/FileSystem.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Number of rows, enough for more than one chunk.
+static const unsigned c_rows = IMC::ColumnStore::c_chunk_rows + 1000;
+
+static void
+populate(IMC::ColumnWriter& writer)
+{
+  for (unsigned i = 0; i < c_rows; ++i)
+  {
+    IMC::EstimatedState es;
+    es.setTimeStamp(1000.0 + i * 0.1);
+    es.setSource(0x2000 + (i % 3));
+    es.setSourceEntity(i % 7);
+    es.x = i * 0.5f;
+    es.depth = 10.0f;
+    es.lat = 0.7 + i * 1e-9;
+    writer.write(&es);
+
+    if (i % 100 == 0)
+    {
+      IMC::Rpm rpm;
+      rpm.setTimeStamp(1000.0 + i * 0.1);
+      rpm.value = -(int)(i / 100);
+      writer.write(&rpm);
+    }
+  }
+
+  // Not selected.
+  IMC::Heartbeat hb;
+  writer.write(&hb);
+}
+
+static bool
+verify(const IMC::ColumnReader& reader)
+{
+  const IMC::ColumnStore::Table* es = reader.findTable("EstimatedState");
+  const IMC::ColumnStore::Table* rpm = reader.findTable("Rpm");
+  if (es == NULL || rpm == NULL || reader.findTable("Heartbeat") != NULL)
+    return false;
+
+  if (es->rows != c_rows || rpm->rows != (c_rows + 99) / 100)
+    return false;
+
+  std::vector<double> ts, src, ent, x, depth, lat, value;
+  reader.read(*IMC::ColumnReader::findColumn(*es, "timestamp"), ts);
+  reader.read(*IMC::ColumnReader::findColumn(*es, "src"), src);
+  reader.read(*IMC::ColumnReader::findColumn(*es, "src_ent"), ent);
+  reader.read(*IMC::ColumnReader::findColumn(*es, "x"), x);
+  reader.read(*IMC::ColumnReader::findColumn(*es, "depth"), depth);
+  reader.read(*IMC::ColumnReader::findColumn(*es, "lat"), lat);
+  reader.read(*IMC::ColumnReader::findColumn(*rpm, "value"), value);
+
+  for (unsigned i = 0; i < c_rows; ++i)
+  {
+    if (ts[i] != 1000.0 + i * 0.1 || src[i] != 0x2000 + (i % 3) || ent[i] != i % 7
+        || x[i] != (float)(i * 0.5f) || depth[i] != 10.0f || lat[i] != 0.7 + i * 1e-9)
+      return false;
+  }
+
+  for (unsigned i = 0; i < value.size(); ++i)
+  {
+    if (value[i] != -(int)i)
+      return false;
+  }
+
+  return ts.size() == c_rows && value.size() == rpm->rows;
+}
+
+int
+main(void)
+{
+  Test test("IMC::ColumnStore");
+
+  FileSystem::Path root("/tmp/dune-test-ColumnStore");
+  if (root.exists())
+    root.remove(FileSystem::Path::MODE_RECURSIVE);
+  root.create();
+
+  std::string path_raw = (root / "raw.col").str();
+  std::string path_zip = (root / "zip.col").str();
+
+  {
+    IMC::ColumnWriter raw(path_raw, false);
+    IMC::ColumnWriter zip(path_zip, true);
+
+    raw.select("EstimatedState");
+    zip.select("EstimatedState");
+    raw.select("Rpm.value");
+    zip.select("Rpm.value");
+    zip.select("Rpm.value");
+
+    test.boolean("selection", zip.getSelection().size() == 2);
+
+    bool rejected = false;
+    try
+    {
+      zip.select("Announce.sys_name");
+    }
+    catch (std::runtime_error&)
+    {
+      rejected = true;
+    }
+    test.boolean("variable size fields are rejected", rejected);
+
+    rejected = false;
+    try
+    {
+      zip.select("EstimatedState.nothing");
+    }
+    catch (std::runtime_error&)
+    {
+      rejected = true;
+    }
+    test.boolean("unknown fields are rejected", rejected);
+
+    populate(raw);
+    populate(zip);
+
+    rejected = false;
+    try
+    {
+      zip.select("Rpm");
+    }
+    catch (std::runtime_error&)
+    {
+      rejected = true;
+    }
+    test.boolean("selection is fixed after writing", rejected);
+
+    raw.close();
+  }
+
+  IMC::ColumnReader raw(path_raw);
+  IMC::ColumnReader zip(path_zip);
+
+  const IMC::ColumnStore::Table* es = raw.findTable("EstimatedState");
+  const IMC::ColumnStore::Column* x = IMC::ColumnReader::findColumn(*es, "x");
+  test.boolean("header and fixed size columns",
+               es->columns.size() == 3 + IMC::Schema::find("EstimatedState")->fields.size()
+               && IMC::ColumnReader::findColumn(*es, "src") != NULL);
+  test.boolean("multiple chunks", x->chunks.size() == 2 && x->chunks[1].rows == 1000);
+
+  std::vector<uint8_t> scratch;
+  fp32_t x_second = 0.5f;
+  const void* chunk = raw.getChunk(*x, 0, scratch);
+  test.boolean("raw chunks are mapped in place",
+               scratch.empty() && ((size_t)chunk % 8) == 0
+               && std::memcmp((const fp32_t*)chunk + 1, &x_second, sizeof(x_second)) == 0);
+
+  test.boolean("raw round trip", verify(raw));
+  test.boolean("compressed round trip", verify(zip));
+
+  const IMC::ColumnStore::Column* depth = IMC::ColumnReader::findColumn(*zip.findTable("EstimatedState"), "depth");
+  test.boolean("constant columns are compressed",
+               depth->chunks[0].coding == IMC::ColumnStore::CODING_SHUFFLE_ZLIB
+               && depth->chunks[0].size < 1024);
+  test.boolean("compressed file is smaller",
+               FileSystem::Path(path_zip).size() < FileSystem::Path(path_raw).size());
+
+  bool rejected = false;
+  try
+  {
+    IMC::ColumnReader bad((root / "raw.col").str() + ".missing");
+  }
+  catch (std::runtime_error&)
+  {
+    rejected = true;
+  }
+  test.boolean("missing file", rejected);
+
+  return test.getReturnValue();
+}
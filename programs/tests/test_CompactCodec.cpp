@@ -0,0 +1,210 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+#include <DUNE/IMC/CompactCodec.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+static bool
+near(double a, double b, double tolerance)
+{
+  return std::fabs(a - b) <= tolerance;
+}
+
+int
+main(void)
+{
+  Test test("IMC::CompactCodec");
+
+  IMC::CompactCodec enc;
+  IMC::CompactCodec dec;
+  std::vector<uint8_t> frame;
+
+  IMC::EstimatedState es;
+  es.setTimeStamp(1500000000.25);
+  es.setSource(0x2001);
+  es.setSourceEntity(7);
+  es.lat = 0.7188016469;
+  es.lon = -0.1527495873;
+  es.x = 123.4567f;
+  es.y = -98.7654f;
+  es.z = 2.5f;
+  es.psi = 1.234567f;
+  es.u = 1.2f;
+  es.depth = 2.5f;
+
+  enc.encode(&es, frame);
+  unsigned key_size = frame.size();
+  IMC::EstimatedState* out = static_cast<IMC::EstimatedState*>(dec.decode(&frame[0], frame.size()));
+  test.boolean("key header round trip",
+               out->getTimeStamp() == es.getTimeStamp()
+               && out->getSource() == es.getSource()
+               && out->getSourceEntity() == es.getSourceEntity());
+  test.boolean("fp64 fields are lossless", out->lat == es.lat && out->lon == es.lon);
+  test.boolean("fp32 fields are lossless by default",
+               out->x == es.x && out->y == es.y && out->psi == es.psi && out->phi == 0);
+  delete out;
+
+  Utils::ByteBuffer packet;
+  IMC::Packet::serialize(&es, packet);
+  test.boolean("smaller than a packet", key_size < packet.getSize());
+
+  es.setTimeStamp(es.getTimeStamp() + 0.2);
+  es.setDestination(0x0015);
+  enc.encode(&es, frame);
+  test.boolean("delta header is smaller", frame.size() < key_size);
+  out = static_cast<IMC::EstimatedState*>(dec.decode(&frame[0], frame.size()));
+  test.boolean("delta header round trip",
+               near(out->getTimeStamp(), es.getTimeStamp(), 1e-3)
+               && out->getDestination() == 0x0015
+               && out->getSourceEntity() == 7);
+  delete out;
+
+  IMC::CompactCodec late;
+  bool thrown = false;
+  try
+  {
+    late.decode(&frame[0], frame.size());
+  }
+  catch (IMC::MissingKeyHeader&)
+  {
+    thrown = true;
+  }
+  test.boolean("delta without key throws", thrown);
+
+  unsigned lossless_size = frame.size();
+  enc.setPrecision(IMC::EstimatedState::getIdStatic(), "x", 1e-3);
+  enc.setPrecision(IMC::EstimatedState::getIdStatic(), "psi", 1e-5);
+  dec.setPrecision(IMC::EstimatedState::getIdStatic(), "x", 1e-3);
+  dec.setPrecision(IMC::EstimatedState::getIdStatic(), "psi", 1e-5);
+  enc.encode(&es, frame);
+  test.boolean("quantized frame is smaller", frame.size() < lossless_size);
+  out = static_cast<IMC::EstimatedState*>(dec.decode(&frame[0], frame.size()));
+  test.boolean("setPrecision() quantizes",
+               near(out->x, es.x, 5e-4) && near(out->psi, es.psi, 5e-6)
+               && out->y == es.y);
+  delete out;
+
+  dec.setPrecision(IMC::EstimatedState::getIdStatic(), "psi", 1e-4);
+  thrown = false;
+  try
+  {
+    dec.decode(&frame[0], frame.size());
+  }
+  catch (IMC::PrecisionMismatch&)
+  {
+    thrown = true;
+  }
+  test.boolean("precision mismatch throws", thrown);
+
+  enc.setPrecision(IMC::EstimatedState::getIdStatic(), "x", 0);
+  enc.setPrecision(IMC::EstimatedState::getIdStatic(), "psi", 0);
+  enc.encode(&es, frame);
+  thrown = false;
+  try
+  {
+    dec.decode(&frame[0], frame.size());
+  }
+  catch (IMC::PrecisionMismatch&)
+  {
+    thrown = true;
+  }
+  test.boolean("lossless frame with quantizing decoder throws", thrown);
+
+  dec.setPrecision(IMC::EstimatedState::getIdStatic(), "x", 0);
+  dec.setPrecision(IMC::EstimatedState::getIdStatic(), "psi", 0);
+  out = static_cast<IMC::EstimatedState*>(dec.decode(&frame[0], frame.size()));
+  test.boolean("setPrecision() lossless", out->x == es.x && out->psi == es.psi);
+  delete out;
+
+  IMC::Goto man;
+  man.lat = 0.71;
+  man.lon = -0.15;
+  man.z = 2;
+  man.speed = 1.5;
+  man.custom = "key=value";
+
+  IMC::PlanManeuver pman;
+  pman.maneuver_id = "1";
+  pman.data.set(man);
+
+  IMC::PlanSpecification spec;
+  spec.plan_id = "test";
+  spec.start_man_id = "1";
+  spec.maneuvers.push_back(pman);
+  spec.maneuvers.push_back(pman);
+
+  IMC::PlanControl pc;
+  pc.setTimeStamp(10);
+  pc.type = IMC::PlanControl::PC_REQUEST;
+  pc.op = IMC::PlanControl::PC_LOAD;
+  pc.plan_id = "test";
+  pc.arg.set(spec);
+
+  enc.encode(&pc, frame);
+  IMC::Message* msg = dec.decode(&frame[0], frame.size());
+  test.boolean("nested messages round trip", *msg == pc);
+  delete msg;
+
+  enc.setFieldMask(false);
+  enc.encode(&pc, frame);
+  msg = dec.decode(&frame[0], frame.size());
+  test.boolean("round trip without field masks", *msg == pc);
+  delete msg;
+
+  enc.setKeyInterval(1);
+  enc.encode(&pc, frame);
+  msg = late.decode(&frame[0], frame.size());
+  test.boolean("key interval", msg->getTimeStamp() == 10);
+  delete msg;
+
+  thrown = false;
+  try
+  {
+    dec.decode(&frame[0], frame.size() / 2);
+  }
+  catch (IMC::BufferTooShort&)
+  {
+    thrown = true;
+  }
+  test.boolean("truncated frame throws", thrown);
+
+  return test.getReturnValue();
+}
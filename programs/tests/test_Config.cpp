@@ -0,0 +1,131 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Parsers::Config;
+
+//! Thread reading and writing options of a shared configuration.
+class Accessor: public DUNE::Concurrency::Thread
+{
+public:
+  Accessor(Config& cfg, unsigned id):
+    m_cfg(cfg),
+    m_id(id),
+    m_errors(0)
+  { }
+
+  unsigned
+  getErrors(void) const
+  {
+    return m_errors;
+  }
+
+private:
+  Config& m_cfg;
+  unsigned m_id;
+  unsigned m_errors;
+
+  void
+  run(void)
+  {
+    std::string section = DUNE::Utils::String::str("Task/%u", m_id);
+
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+      std::string option = DUNE::Utils::String::str("Option %u", i % 10);
+      std::string value = DUNE::Utils::String::str("%u", i);
+      m_cfg.set(section, option, value);
+
+      unsigned rv = 0;
+      m_cfg.get(section, option, "0", rv);
+      if (rv != i)
+        ++m_errors;
+
+      if (m_cfg.get("General", "Vehicle") != "test")
+        ++m_errors;
+    }
+  }
+};
+
+int
+main(void)
+{
+  Test test("Parsers::Config");
+
+  {
+    Config cfg;
+    cfg.set("General", "Vehicle", "test");
+
+    test.boolean("get existing option", cfg.get("General", "Vehicle") == "test");
+    test.boolean("get missing option", cfg.get("General", "Missing").empty());
+    test.boolean("get missing section", cfg.get("Missing", "Missing").empty());
+    test.boolean("getSection missing section", cfg.getSection("Other").empty());
+    test.boolean("lookups do not create entries",
+                 cfg.sections().size() == 1 && cfg.options("General").size() == 1);
+
+    double value = 0;
+    cfg.get("General", "Depth", "1.5", value);
+    test.boolean("default value", value == 1.5);
+    test.boolean("default value is stored", cfg.get("General", "Depth") == "1.5");
+  }
+
+  {
+    Config cfg;
+    cfg.set("General", "Vehicle", "test");
+
+    std::vector<Accessor*> threads;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+      threads.push_back(new Accessor(cfg, i));
+      threads.back()->start();
+    }
+
+    unsigned errors = 0;
+    for (unsigned i = 0; i < threads.size(); ++i)
+    {
+      threads[i]->join();
+      errors += threads[i]->getErrors();
+      delete threads[i];
+    }
+
+    test.boolean("concurrent access", errors == 0);
+    test.boolean("concurrent sections", cfg.sections().size() == 5);
+  }
+
+  return test.getReturnValue();
+}
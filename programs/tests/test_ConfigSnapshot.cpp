@@ -0,0 +1,206 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+// Test program for DUNE::Parsers::ConfigSnapshot.                          *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::FileSystem::Path;
+using DUNE::Parsers::Config;
+using DUNE::Parsers::ConfigSnapshot;
+
+//! Write a text file.
+static void
+writeFile(const Path& path, const std::string& text)
+{
+  std::ofstream ofs(path.c_str());
+  ofs << text;
+}
+
+//! Test if two configurations hold the same options.
+static bool
+equal(Config& a, Config& b)
+{
+  std::vector<std::string> sections = a.sections();
+  if (sections != b.sections())
+    return false;
+
+  for (unsigned i = 0; i < sections.size(); ++i)
+  {
+    if (a.getSection(sections[i]) != b.getSection(sections[i]))
+      return false;
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Parsers::ConfigSnapshot");
+
+  Path root("/tmp/dune-test-ConfigSnapshot");
+  if (root.exists())
+    root.remove(Path::MODE_RECURSIVE);
+  root.create();
+
+  Path main = root / "main.ini";
+  Path common = root / "common.ini";
+  Path snap = root / "main.snap";
+
+  writeFile(common,
+            "[General]\n"
+            "Vehicle = test\n"
+            "Speed = 1.5\n"
+            "\n"
+            "[Task/A]\n"
+            "Enabled = Always\n"
+            "Entity Label = A\n");
+
+  writeFile(main,
+            "[Require common.ini]\n"
+            "[Include optional.ini]\n"
+            "\n"
+            "[Task/A]\n"
+            "Targets = 1, 2\n"
+            "Targets+ = 3\n"
+            "Label Copy = $(General, Vehicle)\n"
+            "\n"
+            "[Task/B]\n"
+            "Empty =\n");
+
+  Config cfg(main.c_str());
+  ConfigSnapshot::write(cfg, snap.str());
+
+  {
+    ConfigSnapshot snapshot(snap.str());
+    test.boolean("option count", snapshot.getOptionCount() == 7);
+    test.boolean("sources", snapshot.getSources().size() == 2
+                 && snapshot.getSources().back() == main.str());
+    test.boolean("is current", snapshot.isCurrent());
+
+    const char* value = snapshot.find("General", "Speed");
+    test.boolean("find option", value != NULL && std::string(value) == "1.5");
+    value = snapshot.find("Task/A", "Targets");
+    test.boolean("find appended option", value != NULL && std::string(value) == "1, 2, 3");
+    value = snapshot.find("Task/A", "Label Copy");
+    test.boolean("find reference", value != NULL && std::string(value) == "test");
+    value = snapshot.find("Task/B", "Empty");
+    test.boolean("find empty option", value != NULL && value[0] == '\0');
+    test.boolean("find missing option", snapshot.find("Task/B", "Missing") == NULL);
+    test.boolean("find missing section", snapshot.find("Task/C", "Empty") == NULL);
+
+    Config loaded;
+    snapshot.load(loaded);
+    test.boolean("load", equal(cfg, loaded));
+    test.boolean("load sources", loaded.files() == cfg.files());
+
+    Path copy = root / "copy.snap";
+    ConfigSnapshot::write(loaded, copy.str());
+    ConfigSnapshot recompiled(copy.str());
+    test.boolean("recompile", recompiled.getOptionCount() == snapshot.getOptionCount());
+  }
+
+  {
+    // Creating a missing optional include invalidates the snapshot.
+    writeFile(root / "optional.ini", "[Task/C]\nValue = 1\n");
+    ConfigSnapshot snapshot(snap.str());
+    test.boolean("stale after new include", !snapshot.isCurrent());
+    (root / "optional.ini").remove();
+    test.boolean("current after include removal", snapshot.isCurrent());
+
+    // Changing a source invalidates the snapshot.
+    writeFile(common, "[General]\nVehicle = other\n");
+    test.boolean("stale after change", !snapshot.isCurrent());
+  }
+
+  {
+    std::vector<char> data;
+    {
+      std::ifstream ifs(snap.c_str(), std::ios::binary);
+      data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    Path bad = root / "bad.snap";
+    data[data.size() / 2] ^= 0x40;
+    {
+      std::ofstream ofs(bad.c_str(), std::ios::binary);
+      ofs.write(&data[0], data.size());
+    }
+
+    bool thrown = false;
+    try
+    {
+      ConfigSnapshot snapshot(bad.str());
+    }
+    catch (DUNE::Parsers::InvalidSnapshot&)
+    {
+      thrown = true;
+    }
+    test.boolean("corrupted snapshot", thrown);
+
+    thrown = false;
+    writeFile(bad, "[General]\n");
+    try
+    {
+      ConfigSnapshot snapshot(bad.str());
+    }
+    catch (DUNE::Parsers::InvalidSnapshot&)
+    {
+      thrown = true;
+    }
+    test.boolean("not a snapshot", thrown);
+  }
+
+  {
+    Config a;
+    a.set("General", "Vehicle", "test");
+    Path first = root / "first.ini";
+    Path second = root / "second.ini";
+    a.writeToFile(first.c_str());
+    a.set("General", "Vehicle", "other");
+    a.writeToFile(second.c_str());
+
+    Config b(second.c_str());
+    test.boolean("write after change", b.get("General", "Vehicle") == "other");
+  }
+
+  root.remove(Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
@@ -31,6 +31,8 @@
 // ISO C++ headers
 #include <iostream>
 #include <sstream>
+#include <cstdio>
+#include <vector>
 #include "Test.hpp"
 
 // DUNE headers
@@ -287,5 +289,158 @@ main(int argc, char** argv)
 
   test.boolean("Connection -- Row count", passed);
 
+
+  // Statement cache test.
+  passed = false;
+  try
+  {
+    Statement& insertion = db.prepare("INSERT INTO TEST VALUES(?,?,?,?)");
+    insertion << 1 << 0.1 << "NAME1" << Null();
+    insertion.execute();
+
+    // Left with bound arguments and a pending row.
+    Statement& query = db.prepare("SELECT NAME FROM TEST WHERE ID = ?");
+    query << 1;
+    query.execute();
+
+    Statement& again = db.prepare("SELECT NAME FROM TEST WHERE ID = ?");
+    again << 1;
+    std::string name;
+    if (&again == &query && &insertion == &db.prepare("INSERT INTO TEST VALUES(?,?,?,?)")
+        && again.execute())
+    {
+      again >> name;
+      passed = name == "NAME1";
+    }
+    again.reset();
+  }
+  catch (std::runtime_error& e)
+  {
+    std::cerr << e.what() << std::endl;
+  }
+  test.boolean("Connection::prepare()", passed);
+
+  // Failed statements can be executed again.
+  passed = false;
+  try
+  {
+    Statement& insertion = db.prepare("INSERT INTO TEST VALUES(?,?,?,?)");
+    try
+    {
+      insertion << 1 << 0.1 << "NAME1" << Null();
+      insertion.execute();
+    }
+    catch (Error& e)
+    {
+      (void)e;
+      insertion << 2 << 0.2 << "NAME2" << Null();
+      insertion.execute();
+      passed = true;
+    }
+  }
+  catch (std::runtime_error& e)
+  {
+    std::cerr << e.what() << std::endl;
+  }
+  test.boolean("Statement -- execute after error", passed);
+
+  // Scoped transaction test.
+  passed = false;
+  try
+  {
+    int count = 0;
+    {
+      Transaction transaction(db);
+      db.execute("DELETE FROM TEST");
+    }
+    db.execute("UPDATE TEST SET VALUE=0", &count);
+
+    if (count != 2)
+      throw std::runtime_error("not rolled back");
+
+    {
+      Transaction transaction(db);
+      db.execute("DELETE FROM TEST");
+      transaction.commit();
+    }
+    db.execute("UPDATE TEST SET VALUE=0", &count);
+
+    passed = count == 0;
+  }
+  catch (std::runtime_error& e)
+  {
+    std::cerr << e.what() << std::endl;
+  }
+  test.boolean("Transaction", passed);
+
+  // Queue test.
+  {
+    struct Insert: public Queue::Operation
+    {
+      int id;
+
+      void
+      execute(Connection& conn)
+      {
+        Statement& insertion = conn.prepare("INSERT INTO TEST VALUES(?,?,?,?)");
+        insertion << id << 0.1 * id << "NAME" << Null();
+        insertion.execute();
+      }
+    };
+
+    Queue queue(db);
+    std::vector<unsigned> tickets;
+    for (int i = 0; i < 100; ++i)
+    {
+      Insert* op = new Insert;
+      op->id = i % 90;
+      tickets.push_back(queue.push(op));
+    }
+    queue.start();
+
+    std::string error;
+    int count = 0;
+    bool flushed = queue.flush(5.0);
+    db.execute("UPDATE TEST SET VALUE=0", &count);
+
+    int errors = 0;
+    unsigned ticket = 0;
+    bool tickets_ok = true;
+    while (queue.popError(error, &ticket))
+      tickets_ok = tickets_ok && ticket == tickets[90 + errors++];
+
+    test.boolean("Queue -- operations", flushed && count == 90);
+    test.boolean("Queue -- failed operations", errors == 10);
+    test.boolean("Queue -- failed tickets", tickets_ok);
+    test.boolean("Queue -- batches", queue.getCommitCount() == 90);
+
+    queue.stopAndJoin();
+  }
+
+  // WAL mode test.
+  passed = false;
+  try
+  {
+    const char* path = "test_Database.db";
+    std::remove(path);
+    {
+      Connection wal(path, Connection::CF_CREATE | Connection::CF_WAL);
+      Statement& mode = wal.prepare("PRAGMA journal_mode");
+      std::string value;
+      if (mode.execute())
+        mode >> value;
+      mode.reset();
+      passed = value == "wal";
+    }
+    std::remove(path);
+    std::remove("test_Database.db-wal");
+    std::remove("test_Database.db-shm");
+  }
+  catch (std::runtime_error& e)
+  {
+    std::cerr << e.what() << std::endl;
+  }
+  test.boolean("Connection -- WAL mode", passed);
+
   return 0;
 }
@@ -0,0 +1,127 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Concurrency.hpp>
+#include <DUNE/Entities/EntityDataBase.hpp>
+#include <DUNE/Utils/String.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Resolves labels while the main thread reserves them.
+class Reader: public Concurrency::Thread
+{
+public:
+  Reader(Entities::EntityDataBase& edb):
+    m_edb(edb),
+    m_errors(0)
+  { }
+
+  unsigned
+  getErrors(void) const
+  {
+    return m_errors;
+  }
+
+private:
+  Entities::EntityDataBase& m_edb;
+  unsigned m_errors;
+
+  void
+  run(void)
+  {
+    unsigned last = 0;
+
+    while (last < 200)
+    {
+      std::string label = "Entity " + Utils::String::str(last);
+      if (!m_edb.labelExists(label))
+        continue;
+
+      if (m_edb.resolve(label) != last || m_edb.resolve(last) != label)
+        ++m_errors;
+
+      ++last;
+    }
+  }
+};
+
+int
+main(void)
+{
+  Test test("Entities::EntityDataBase");
+
+  Entities::EntityDataBase edb;
+  Reader reader(edb);
+  reader.start();
+
+  for (unsigned i = 0; i < 200; ++i)
+    edb.reserve("Entity " + Utils::String::str(i), "Task");
+
+  reader.join();
+  test.boolean("concurrent resolution", reader.getErrors() == 0);
+
+  test.boolean("idExists()", edb.idExists(199) && !edb.idExists(200) && !edb.idExists(1000));
+  test.boolean("labelExists()", edb.labelExists("Entity 10") && !edb.labelExists("Entity 200"));
+  test.boolean("resolveTaskName()", edb.resolveTaskName("Entity 10") == "Task");
+
+  bool thrown = false;
+  try
+  {
+    edb.reserve("Entity 10", "Task");
+  }
+  catch (Entities::EntityDataBase::ReservedUnique&)
+  {
+    thrown = true;
+  }
+  test.boolean("duplicate label", thrown);
+
+  for (unsigned i = 200; i < 256; ++i)
+    edb.reserve("Entity " + Utils::String::str(i), "Task");
+
+  thrown = false;
+  try
+  {
+    edb.reserve("Entity 256", "Task");
+  }
+  catch (Entities::EntityDataBase::InvalidId&)
+  {
+    thrown = true;
+  }
+  test.boolean("id space exhausted", thrown);
+  test.boolean("entries()", edb.entries().size() == 256);
+
+  return test.getReturnValue();
+}
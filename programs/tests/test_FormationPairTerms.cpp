@@ -0,0 +1,410 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+// The pair kernel is local to the formation controller task.
+#include <Maneuver/VehicleFormation/FormCollAvoid/PairTerms.cpp>
+
+using DUNE_NAMESPACES;
+using namespace Maneuver::VehicleFormation::FormCollAvoid;
+
+//! Minimum relative velocity, as hard-coded in the controller.
+static const double c_vel_lim = 0.5;
+
+//! Pair computation as done by the formation controller before
+//! the pair kernel, kept as a reference.
+static void
+referencePair(const PairContext& ctx, const Matrix& md_uav_state, const Matrix& md_vehicle_accel,
+              const Matrix& m_formation_pos, unsigned ind_uav2, PairTerms& terms)
+{
+  unsigned ind_uav = ctx.own;
+  double t_rot_formation[4] = {ctx.rot_cos, -ctx.rot_sin, ctx.rot_sin, ctx.rot_cos};
+  Matrix md_rot_formation = Matrix(t_rot_formation, 2, 2);
+  double t_form_pos1[2] = {ctx.form_pos[0], ctx.form_pos[1]};
+  Matrix vd_form_pos1 = Matrix(t_form_pos1, 2, 1);
+  double t_accel_lim_x[2] = {ctx.accel_lim_x[0], ctx.accel_lim_x[1]};
+  Matrix vd_body_accel_lim_x = Matrix(t_accel_lim_x, 2, 1);
+  double t_accel_lim_y[2] = {ctx.accel_lim_y[0], ctx.accel_lim_y[1]};
+  Matrix vd_body_accel_lim_y = Matrix(t_accel_lim_y, 2, 1);
+  double t_wind[3] = {ctx.wind[0], ctx.wind[1], 0};
+  Matrix m_wind = Matrix(t_wind, 3, 1);
+  double d_deconfliction_dist = ctx.deconfl_dist;
+  double k_long_dist1 = ctx.k_long1;
+  double k_long_dist3 = ctx.k_long2 - ctx.k_long1;
+
+  double mt_rot[4];
+  Matrix vd_form_pos2 = Matrix(2, 1, 0.0);
+  double vt_form_pos2[2] = {0, 0};
+  double vt_form_dir[2];
+  Matrix vd_inter_uav_des_pos = Matrix(2, 1, 0.0);
+  Matrix vd_inter_uav_des_vel = Matrix(2, 1, 0.0);
+  Matrix vd_inter_uav_des_acc = Matrix(2, 1, 0.0);
+  Matrix vt_surf_deriv = Matrix(2, 1, 0.0);
+  double d_err_x_s_conv;
+  int int_Max;
+
+  Matrix vd_inter_uav_state = md_uav_state.get(0, 5, ind_uav2 + 1, ind_uav2 + 1) -
+    md_uav_state.get(0, 5, ind_uav + 1, ind_uav + 1);
+  Matrix vd_inter_uav_pos = vd_inter_uav_state.get(0, 1, 0, 0);
+  double d_inter_uav_dist = vd_inter_uav_pos.norm_2();
+  double d_inter_uav_angle = std::atan2(vd_inter_uav_pos(1), vd_inter_uav_pos(0));
+  double d_cos_inter_uav_angle = std::cos(d_inter_uav_angle);
+  double d_sin_inter_uav_angle = std::sin(d_inter_uav_angle);
+  mt_rot[0] = d_cos_inter_uav_angle;
+  mt_rot[1] = -d_sin_inter_uav_angle;
+  mt_rot[2] = d_sin_inter_uav_angle;
+  mt_rot[3] = d_cos_inter_uav_angle;
+  Matrix md_rot = Matrix(mt_rot, 2, 2);
+  Matrix vd_inter_uav_x = md_rot.column(0);
+  Matrix vd_inter_uav_y = md_rot.column(1);
+
+  if (ctx.earth_fixed)
+  {
+    vd_inter_uav_des_pos = m_formation_pos.get(0, 1, ind_uav, ind_uav) -
+      m_formation_pos.get(0, 1, ind_uav2, ind_uav2);
+    vd_inter_uav_des_vel = Matrix(2, 1, 0.0);
+    vd_inter_uav_des_acc = Matrix(2, 1, 0.0);
+  }
+  else
+  {
+    if (ctx.curved)
+    {
+      double t_uav_turnrad = ctx.turn_rad - m_formation_pos(1, ind_uav2);
+      double t_cos_gamma = std::cos(m_formation_pos(0, ind_uav2) / ctx.turn_rad);
+      double t_sin_gamma = std::sin(m_formation_pos(0, ind_uav2) / ctx.turn_rad);
+      vt_form_dir[0] = t_sin_gamma;
+      vt_form_dir[1] = 1 - t_cos_gamma;
+      vt_form_pos2[0] = 0;
+      vt_form_pos2[1] = m_formation_pos(1, ind_uav);
+      vd_form_pos2 = t_uav_turnrad * Matrix(vt_form_dir, 2, 1) + Matrix(vt_form_pos2, 2, 1);
+    }
+    else
+    {
+      vd_form_pos2 = m_formation_pos.get(0, 1, ind_uav2, ind_uav2);
+    }
+
+    vd_inter_uav_des_pos = md_rot_formation * (vd_form_pos1 - vd_form_pos2);
+    vd_inter_uav_des_vel(0) = vd_inter_uav_state(1) * ctx.turn_rate;
+    vd_inter_uav_des_vel(1) = -vd_inter_uav_state(0) * ctx.turn_rate;
+    vd_inter_uav_des_acc = vd_inter_uav_state.get(0, 1, 0, 0) * ctx.turn_rate * ctx.turn_rate;
+  }
+
+  Matrix vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
+  double d_err_y = Matrix::dot(vd_err, vd_inter_uav_y);
+  double d_err_x = Matrix::dot(vd_err, vd_inter_uav_x);
+  if (d_err_x < d_deconfliction_dist - d_inter_uav_dist)
+  {
+    int_Max = 2;
+    d_err_x = d_deconfliction_dist - d_inter_uav_dist;
+  }
+  else
+  {
+    int_Max = 1;
+  }
+  Matrix vd_orig_err = vd_err;
+
+  Matrix vd_deriv_err = -vd_inter_uav_state.get(3, 4, 0, 0) - vd_inter_uav_des_vel;
+  double d_deriv_err_x = Matrix::dot(vd_deriv_err, vd_inter_uav_x);
+  double d_deriv_err_y = Matrix::dot(vd_deriv_err, vd_inter_uav_y);
+
+  double d_vel_proj_x = Matrix::dot((md_uav_state.get(3, 4, ind_uav2 + 1, ind_uav2 + 1) - m_wind.get(0, 1, 0, 0)),
+                                    vd_inter_uav_x);
+  double d_accel_max_proj_x = std::abs(Matrix::dot(vd_body_accel_lim_x, vd_inter_uav_x)) +
+    std::abs(Matrix::dot(vd_body_accel_lim_y, vd_inter_uav_x));
+  double d_vel_proj_y = Matrix::dot((md_uav_state.get(3, 4, ind_uav2 + 1, ind_uav2 + 1) - m_wind.get(0, 1, 0, 0)),
+                                    vd_inter_uav_y);
+  double d_accel_max_proj_y = std::abs(Matrix::dot(vd_body_accel_lim_x, vd_inter_uav_y)) +
+    std::abs(Matrix::dot(vd_body_accel_lim_y, vd_inter_uav_y));
+
+  double d_c1 = std::max(ctx.speed_max - d_vel_proj_x, c_vel_lim);
+  double t_ctrl_marg_mult = 2 * ctx.speed_max / (ctx.speed_max + d_vel_proj_x);
+  double d_c2 = ctx.deconfl_offset * t_ctrl_marg_mult;
+  if (d_err_x < 0)
+    d_c2 = std::max(4 * (1 + ctx.acc_safety_marg) * d_c1 * d_c1 / (27 * d_accel_max_proj_x), d_c2);
+
+  if (d_inter_uav_dist < d_deconfliction_dist)
+  {
+    d_err_x = std::min(d_err_x, d_c2 * 0.5);
+    if (d_deriv_err_x > 0)
+      d_err_x_s_conv = d_err_x;
+    else
+      d_err_x_s_conv = std::min(d_err_x, 0.0);
+  }
+  else
+  {
+    d_err_x = std::min(d_err_x, d_c2 * 0.5);
+    d_err_x_s_conv = d_err_x;
+  }
+
+  if (int_Max == 2)
+  {
+    double t_err_y = 2 * d_deconfliction_dist;
+    if (t_err_y > std::abs(d_err_y))
+    {
+      if (d_err_y < 0)
+        d_err_y = -t_err_y;
+      else
+        d_err_y = t_err_y;
+    }
+  }
+  vd_err(0) = d_err_x;
+  vd_err(1) = d_err_y;
+  vd_err = md_rot * vd_err;
+
+  double d_des_dist = vd_inter_uav_des_pos.norm_2();
+  double d_predicted_dist = d_inter_uav_dist + std::min(0.0, d_deriv_err_x * std::abs(d_deriv_err_x) *
+                                                        (1 + ctx.acc_safety_marg) / d_accel_max_proj_x);
+  double d_dist2confl = d_predicted_dist - d_deconfliction_dist;
+  if (d_dist2confl < 0)
+    terms.weight = 1 + d_dist2confl / ctx.deconfl_offset *
+      d_dist2confl / ctx.deconfl_offset * ctx.k_deconfl;
+  else if (d_predicted_dist <= d_des_dist * k_long_dist1)
+    terms.weight = 1;
+  else if (d_predicted_dist < d_des_dist * ctx.k_long2)
+  {
+    double t_dist_gain = (d_predicted_dist - d_des_dist * k_long_dist1) / (d_des_dist * k_long_dist3);
+    terms.weight = 1 - t_dist_gain * t_dist_gain;
+  }
+  else
+    terms.weight = 0;
+
+  double d_c3;
+  double d_c4;
+  if (d_err_y < 0)
+  {
+    d_c3 = std::max(ctx.speed_max - d_vel_proj_y, c_vel_lim);
+    d_c4 = 4 * (1 + ctx.acc_safety_marg) * d_c3 * d_c3 / (27 * d_accel_max_proj_y);
+  }
+  else
+  {
+    d_c3 = std::min(- ctx.speed_max - d_vel_proj_y, -c_vel_lim);
+    d_c4 = - 4 * (1 + ctx.acc_safety_marg) * d_c3 * d_c3 / (27 * d_accel_max_proj_y);
+  }
+
+  double t_surf_x = d_c1 * d_err_x / (d_err_x - d_c2);
+  double t_surf_y = d_c3 * d_err_y / (d_err_y - d_c4);
+  Matrix vd_surf = vd_deriv_err - t_surf_x * vd_inter_uav_x - t_surf_y * vd_inter_uav_y;
+
+  double d_inter_uav_angle_dot = Matrix::dot(vd_inter_uav_state.get(3, 4, 0, 0),
+                                             vd_inter_uav_y / d_inter_uav_dist);
+  vt_surf_deriv(0) = d_c1 * d_c2 * d_deriv_err_x / ((d_err_x_s_conv - d_c2) * (d_err_x_s_conv - d_c2)) +
+    t_surf_y * d_inter_uav_angle_dot;
+  vt_surf_deriv(1) = d_c3 * d_c4 * d_deriv_err_y / ((d_err_y - d_c4) * (d_err_y - d_c4)) -
+    t_surf_x * d_inter_uav_angle_dot;
+  Matrix vt_virt_err = md_vehicle_accel.get(0, 1, ind_uav2 + 1, ind_uav2 + 1) +
+    vd_inter_uav_des_acc - md_rot * vt_surf_deriv;
+
+  terms.surf[0] = vd_surf(0);
+  terms.surf[1] = vd_surf(1);
+  terms.virt_err[0] = vt_virt_err(0);
+  terms.virt_err[1] = vt_virt_err(1);
+  terms.dist = d_inter_uav_dist;
+  terms.err = vd_orig_err.norm_2();
+  terms.dir[0] = vd_inter_uav_x(0);
+  terms.dir[1] = vd_inter_uav_x(1);
+  terms.err_g[0] = vd_err(0);
+  terms.err_g[1] = vd_err(1);
+  terms.err_r[0] = Matrix::dot(vd_err, vd_inter_uav_x);
+  terms.err_r[1] = Matrix::dot(vd_err, vd_inter_uav_y);
+  terms.err_v[0] = Matrix::dot(vd_deriv_err, vd_inter_uav_x);
+  terms.err_v[1] = Matrix::dot(vd_deriv_err, vd_inter_uav_y);
+  terms.surf_r[0] = Matrix::dot(vd_surf, vd_inter_uav_x);
+  terms.surf_r[1] = Matrix::dot(vd_surf, vd_inter_uav_y);
+}
+
+//! Check if the control law terms are equal.
+static bool
+sameControl(const PairTerms& a, const PairTerms& b)
+{
+  return a.weight == b.weight
+    && a.surf[0] == b.surf[0] && a.surf[1] == b.surf[1]
+    && a.virt_err[0] == b.virt_err[0] && a.virt_err[1] == b.virt_err[1];
+}
+
+//! Check if every term is equal.
+static bool
+sameTerms(const PairTerms& a, const PairTerms& b)
+{
+  return sameControl(a, b)
+    && a.dist == b.dist && a.err == b.err
+    && a.dir[0] == b.dir[0] && a.dir[1] == b.dir[1]
+    && a.err_g[0] == b.err_g[0] && a.err_g[1] == b.err_g[1]
+    && a.err_r[0] == b.err_r[0] && a.err_r[1] == b.err_r[1]
+    && a.err_v[0] == b.err_v[0] && a.err_v[1] == b.err_v[1]
+    && a.surf_r[0] == b.surf_r[0] && a.surf_r[1] == b.surf_r[1];
+}
+
+//! Random team and controller state.
+struct Scenario
+{
+  Matrix state;
+  Matrix accel;
+  Matrix form;
+  PairContext ctx;
+
+  Scenario(Random::Generator& rng, unsigned n, unsigned frame):
+    state(12, n + 1, 0.0),
+    accel(3, n + 1, 0.0),
+    form(3, n, 0.0)
+  {
+    // Mix of tight and spread out teams, to cover every weight branch.
+    double spread = rng.uniform() < 0.5 ? 30 : 400;
+
+    for (unsigned i = 0; i <= n; ++i)
+    {
+      state(0, i) = rng.uniform(-spread, spread);
+      state(1, i) = rng.uniform(-spread, spread);
+      state(3, i) = rng.uniform(-25, 25);
+      state(4, i) = rng.uniform(-25, 25);
+      accel(0, i) = rng.uniform(-3, 3);
+      accel(1, i) = rng.uniform(-3, 3);
+    }
+
+    for (unsigned i = 0; i < n; ++i)
+    {
+      form(0, i) = rng.uniform(-100, 100);
+      form(1, i) = rng.uniform(-100, 100);
+    }
+
+    double course = rng.uniform(-Math::c_pi, Math::c_pi);
+    double turn_rad = rng.uniform(150, 1000) * (rng.uniform() < 0.5 ? -1 : 1);
+
+    ctx.own = (unsigned)(rng.uniform() * n) % n;
+    ctx.earth_fixed = (frame == 0);
+    ctx.curved = (frame == 2);
+    ctx.turn_rad = turn_rad;
+    ctx.turn_rate = rng.uniform(5, 30) / turn_rad;
+    ctx.rot_cos = std::cos(course);
+    ctx.rot_sin = std::sin(course);
+    ctx.form_pos[0] = form(0, ctx.own);
+    ctx.form_pos[1] = form(1, ctx.own);
+    ctx.accel_lim_x[0] = rng.uniform(0.5, 3) * ctx.rot_cos;
+    ctx.accel_lim_x[1] = rng.uniform(0.5, 3) * ctx.rot_sin;
+    ctx.accel_lim_y[0] = -rng.uniform(0.5, 3) * ctx.rot_sin;
+    ctx.accel_lim_y[1] = rng.uniform(0.5, 3) * ctx.rot_cos;
+    ctx.wind[0] = rng.uniform(-5, 5);
+    ctx.wind[1] = rng.uniform(-5, 5);
+    ctx.deconfl_offset = rng.uniform(5, 20);
+    ctx.deconfl_dist = rng.uniform(5, 20) + ctx.deconfl_offset;
+    ctx.k_deconfl = rng.uniform(1, 10);
+    ctx.k_long1 = 1.5;
+    ctx.k_long2 = 4;
+    ctx.speed_max = rng.uniform(18, 30);
+    ctx.acc_safety_marg = rng.uniform(0.1, 0.5);
+    ctx.rel_vel_lim = c_vel_lim;
+  }
+};
+
+int
+main(void)
+{
+  Test test("Maneuver::VehicleFormation::FormCollAvoid::PairTerms");
+
+  Random::Generator* rng = Random::Factory::create(Random::Factory::c_mt19937, 20171);
+
+  unsigned pairs = 0;
+  unsigned skipped = 0;
+  bool full_ok[3] = {true, true, true};
+  bool fast_ok = true;
+  bool skip_ok = true;
+  bool solver_ok = true;
+
+  PairSolver solver;
+  solver.setThreads(3);
+
+  for (unsigned k = 0; k < 300; ++k)
+  {
+    unsigned frame = k % 3;
+    // Some teams are large enough for the solver to use its workers.
+    unsigned n = (k % 10 == 0) ? 80 : 2 + k % 9;
+    Scenario s(*rng, n, frame);
+
+    TeamState team;
+    team.load(s.state, s.accel, s.form);
+
+    std::vector<PairTerms> terms;
+    solver.compute(s.ctx, team, (k % 2) == 0, terms);
+
+    for (unsigned i = 0; i < n; ++i)
+    {
+      if (i == s.ctx.own)
+        continue;
+
+      PairTerms ref;
+      referencePair(s.ctx, s.state, s.accel, s.form, i, ref);
+
+      PairTerms full;
+      computePair(s.ctx, team, i, true, full);
+      full_ok[frame] = full_ok[frame] && sameTerms(ref, full);
+
+      PairTerms fast;
+      computePair(s.ctx, team, i, false, fast);
+      if (ref.weight == 0)
+      {
+        ++skipped;
+        skip_ok = skip_ok && fast.weight == 0
+          && fast.surf[0] == 0 && fast.surf[1] == 0
+          && fast.virt_err[0] == 0 && fast.virt_err[1] == 0;
+      }
+      else
+      {
+        fast_ok = fast_ok && sameControl(ref, fast);
+      }
+
+      if (k % 2 == 0)
+        solver_ok = solver_ok && sameTerms(ref, terms[i]);
+      else
+        solver_ok = solver_ok && sameControl(ref.weight == 0 ? fast : ref, terms[i]);
+
+      ++pairs;
+    }
+  }
+
+  delete rng;
+
+  test.boolean("pairs with and without weight are covered", skipped > 0 && skipped < pairs);
+  test.boolean("earth fixed frame matches previous loop", full_ok[0]);
+  test.boolean("path frame matches previous loop", full_ok[1]);
+  test.boolean("curved path frame matches previous loop", full_ok[2]);
+  test.boolean("control terms match previous loop", fast_ok);
+  test.boolean("pairs without weight are skipped", skip_ok);
+  test.boolean("worker threads match previous loop", solver_ok);
+
+  return test.getReturnValue();
+}
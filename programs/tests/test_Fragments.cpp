@@ -0,0 +1,103 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+#include <DUNE/Network/Fragments.hpp>
+#include <DUNE/Network/Reassembler.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+int
+main(void)
+{
+  Test test("Network::Fragments");
+
+  IMC::SonarData sonar;
+  sonar.setSource(0x2001);
+  sonar.data.resize(3000);
+  for (unsigned i = 0; i < sonar.data.size(); ++i)
+    sonar.data[i] = (char)(i * 7);
+
+  Network::Fragments frags(&sonar, 256);
+  int count = frags.getNumberOfFragments();
+  test.boolean("getNumberOfFragments()", count > 1);
+
+  {
+    uint8_t bfr[256];
+    Utils::ByteBuffer ref;
+    uint16_t n = frags.serializeFragment(1, bfr, sizeof(bfr));
+    IMC::Packet::serialize(frags.getFragment(1), ref);
+    test.boolean("serializeFragment()", n == ref.getSize() && std::memcmp(bfr, ref.getBuffer(), n) == 0);
+  }
+
+  Network::Reassembler reassembler;
+  IMC::Message* msg = NULL;
+
+  // Deliver all but the second fragment, in reverse order.
+  for (int i = count - 1; i >= 0; --i)
+  {
+    if (i != 1)
+      msg = reassembler.add(frags.getFragment(i));
+  }
+
+  std::vector<unsigned> missing;
+  reassembler.getMissingFragments(sonar.getSource(), frags.getFragment(0)->uid, missing);
+  test.boolean("getMissingFragments()", msg == NULL && missing.size() == 1 && missing[0] == 1);
+
+  // Duplicates are ignored.
+  msg = reassembler.add(frags.getFragment(0));
+  test.boolean("duplicate fragment", msg == NULL && reassembler.getCount() == 1);
+
+  msg = reassembler.add(frags.getFragment(1));
+  test.boolean("reassembly", msg != NULL && *msg == sonar);
+  test.boolean("reassembly releases memory", reassembler.getCount() == 0 && reassembler.getSize() == 0);
+  delete msg;
+
+  // Memory budget.
+  Network::Fragments frags2(&sonar, 256);
+  Network::Reassembler limited(1024);
+  limited.add(frags.getFragment(0));
+  limited.add(frags.getFragment(1));
+  limited.add(frags2.getFragment(0));
+  limited.add(frags2.getFragment(1));
+  limited.add(frags2.getFragment(2));
+  test.boolean("memory budget", limited.getCount() == 1 && limited.getEvictions() == 1);
+  test.boolean("memory budget keeps recent",
+               limited.getMissingFragments(sonar.getSource(), frags2.getFragment(0)->uid, missing));
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,127 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Media.hpp>
+#include <DUNE/Time.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+using Media::BayerDecoder;
+using Media::ImagePipeline;
+
+static const unsigned c_width = 321;
+static const unsigned c_height = 243;
+
+int
+main(void)
+{
+  Test test("Media::ImagePipeline");
+
+  std::vector<uint8_t> bayer(c_width * c_height);
+  std::srand(1);
+  for (size_t i = 0; i < bayer.size(); ++i)
+    bayer[i] = std::rand() & 0xff;
+
+  // Reference output of the single-threaded decoder.
+  std::vector<uint8_t> reference(c_width * c_height * 3);
+  BayerDecoder decoder(BayerDecoder::TILE_GBRG, BayerDecoder::METHOD_BILINEAR);
+  decoder.decodeToRGB24(&bayer[0], &reference[0], c_width, c_height);
+
+  {
+    ImagePipeline pipeline(c_width, c_height, 4, 3);
+    pipeline.setBayer(BayerDecoder::TILE_GBRG, BayerDecoder::METHOD_BILINEAR);
+    pipeline.setQuality(90);
+    pipeline.start();
+
+    // Fill all buffers, the next frame must be dropped.
+    std::vector<ImagePipeline::Image*> images;
+    ImagePipeline::Image* image = NULL;
+    while ((image = pipeline.acquire()) != NULL)
+      images.push_back(image);
+
+    test.boolean("buffers", images.size() == 4);
+    test.boolean("dropped", pipeline.getStatistics().dropped == 1);
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+      images[i]->bayer = bayer;
+      pipeline.submit(images[i], (double)i);
+    }
+
+    bool same = true;
+    bool jpeg = true;
+    bool order = true;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+      image = pipeline.wait(5.0);
+      if (image == NULL)
+      {
+        order = false;
+        break;
+      }
+
+      order = order && image->timestamp == (double)i;
+      same = same && image->rgb == reference;
+      jpeg = jpeg && image->jpeg.size() > 2 && image->jpeg[0] == 0xff && image->jpeg[1] == 0xd8;
+      pipeline.release(image);
+    }
+
+    test.boolean("delivered in order", order);
+    test.boolean("output equals single-threaded decoder", same);
+    test.boolean("JPEG images", jpeg);
+    test.boolean("nothing left", pipeline.wait(0.05) == NULL);
+
+    ImagePipeline::Statistics stats = pipeline.getStatistics();
+    test.boolean("statistics", stats.submitted == 4 && stats.completed == 4);
+    test.boolean("latency", stats.latency_mean > 0 && stats.latency_mean <= stats.latency_max);
+  }
+
+  // Plain RGB input without encoding is delivered as is.
+  {
+    ImagePipeline pipeline(c_width, c_height, 2, 2);
+    pipeline.setEncoding(false);
+    pipeline.start();
+
+    ImagePipeline::Image* image = pipeline.acquire();
+    image->rgb = reference;
+    pipeline.submit(image, 1.0);
+    image = pipeline.wait(1.0);
+    test.boolean("passthrough", image != NULL && image->rgb == reference && image->jpeg.empty());
+    pipeline.release(image);
+  }
+
+  return test.getReturnValue();
+}
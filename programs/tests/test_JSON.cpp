@@ -0,0 +1,173 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+static bool
+throws(IMC::JSONParser& parser, const char* text)
+{
+  try
+  {
+    delete parser.parse(text, std::strlen(text));
+  }
+  catch (std::runtime_error&)
+  {
+    return true;
+  }
+
+  return false;
+}
+
+int
+main(void)
+{
+  Test test("IMC::JSON");
+
+  IMC::JSONWriter writer;
+  IMC::JSONParser parser;
+
+  IMC::EstimatedState es;
+  es.setTimeStamp(1500000000.123456);
+  es.setSource(0x2001);
+  es.setSourceEntity(7);
+  es.setDestination(0x4001);
+  es.lat = 0.7188016469123456;
+  es.lon = -0.1527495873;
+  es.x = 123.4567f;
+  es.y = -98.7654f;
+  es.psi = 0.1f;
+  es.depth = 2.5f;
+
+  writer.write(&es);
+  IMC::Message* msg = parser.parse(writer.str());
+  test.boolean("round trip", *msg == es);
+  test.boolean("header round trip",
+               msg->getTimeStamp() == es.getTimeStamp()
+               && msg->getSource() == es.getSource()
+               && msg->getSourceEntity() == es.getSourceEntity()
+               && msg->getDestination() == es.getDestination());
+  delete msg;
+
+  test.boolean("numbers are not quoted",
+               writer.str().find("\"psi\": 0.1,") != std::string::npos
+               && writer.str().find("\"src\": 8193,") != std::string::npos);
+
+  writer.clear();
+  writer.setCompact(true);
+  writer.write(&es);
+  test.boolean("compact output",
+               writer.str().find_first_of(" \n") == std::string::npos
+               && writer.str().compare(0, 23, "{\"abbrev\":\"EstimatedSta") == 0);
+
+  // Legacy output quotes numbers and indents with new lines.
+  std::ostringstream os;
+  es.toJSON(os);
+  msg = parser.parse(os.str());
+  test.boolean("parse Message::toJSON() output",
+               msg->getId() == es.getId() && msg->getSource() == es.getSource()
+               && static_cast<IMC::EstimatedState*>(msg)->depth == es.depth);
+  delete msg;
+
+  IMC::Goto man;
+  man.lat = 0.71;
+  man.lon = -0.15;
+  man.z = 2;
+  man.speed = 1.5;
+  man.custom = "key=\"value\"\n\ttab \\ \x01";
+
+  IMC::PlanManeuver pman;
+  pman.maneuver_id = "1";
+  pman.data.set(man);
+
+  IMC::PlanSpecification spec;
+  spec.plan_id = "test";
+  spec.start_man_id = "1";
+  spec.maneuvers.push_back(pman);
+  spec.maneuvers.push_back(pman);
+
+  IMC::PlanControl pc;
+  pc.type = IMC::PlanControl::PC_REQUEST;
+  pc.op = IMC::PlanControl::PC_LOAD;
+  pc.plan_id = "test";
+  pc.arg.set(spec);
+
+  writer.clear();
+  writer.write(&pc);
+  msg = parser.parse(writer.str());
+  test.boolean("nested messages and escapes round trip", *msg == pc);
+  delete msg;
+
+  IMC::DevDataBinary bin;
+  const char data[] = {0x00, 0x7f, (char)0x80, (char)0xff};
+  bin.value.assign(data, data + sizeof(data));
+  writer.clear();
+  writer.write(&bin);
+  test.boolean("raw data as hexadecimal", writer.str().find("\"007f80ff\"") != std::string::npos);
+  msg = parser.parse(writer.str());
+  test.boolean("raw data round trip", *msg == bin);
+  delete msg;
+
+  msg = parser.parse("{\"abbrev\": \"DevDataText\", \"value\": \"\\u00e9\\ud83d\\ude00\"}");
+  test.boolean("unicode escapes",
+               static_cast<IMC::DevDataText*>(msg)->value == "\xc3\xa9\xf0\x9f\x98\x80");
+  delete msg;
+
+  msg = parser.parse("{\"abbrev\": \"Heartbeat\"}");
+  test.boolean("missing fields keep defaults", msg->getId() == IMC::Heartbeat::getIdStatic());
+  delete msg;
+
+  IMC::FuelLevel fuel;
+  fuel.value = std::numeric_limits<float>::quiet_NaN();
+  writer.clear();
+  writer.setCompact(false);
+  writer.write(&fuel);
+  test.boolean("non-finite numbers as null", writer.str().find("\"value\": null") != std::string::npos);
+
+  test.boolean("unknown field throws", throws(parser, "{\"abbrev\": \"Heartbeat\", \"foo\": 1}"));
+  test.boolean("unknown message throws", throws(parser, "{\"abbrev\": \"Foo\"}"));
+  test.boolean("out of range integer throws", throws(parser, "{\"abbrev\": \"EntityState\", \"state\": 256}"));
+  test.boolean("truncated document throws", throws(parser, "{\"abbrev\": \"EntityState\", \"state\": "));
+  test.boolean("trailing characters throw", throws(parser, "{\"abbrev\": \"Heartbeat\"} x"));
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,227 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+#include <DUNE/Compression.hpp>
+#include <DUNE/FileSystem.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Handler recording what it receives.
+struct Collector: public IMC::LogReader::Handler
+{
+  std::vector<unsigned> begins;
+  std::vector<std::string> errors;
+  std::vector<unsigned> counts;
+  std::vector<double> timestamps;
+  unsigned batches;
+  unsigned stop_after;
+
+  Collector(void):
+    batches(0),
+    stop_after(0)
+  { }
+
+  void
+  onBegin(unsigned stream, const std::string& path)
+  {
+    (void)path;
+    begins.push_back(stream);
+    counts.push_back(0);
+  }
+
+  bool
+  onMessages(unsigned stream, std::vector<IMC::Message*>& msgs)
+  {
+    counts[stream] += msgs.size();
+    for (unsigned i = 0; i < msgs.size(); ++i)
+      timestamps.push_back(msgs[i]->getTimeStamp());
+
+    return ++batches != stop_after;
+  }
+
+  void
+  onEnd(unsigned stream, const std::string& error)
+  {
+    (void)stream;
+    errors.push_back(error);
+  }
+
+  bool
+  ordered(void) const
+  {
+    for (unsigned i = 1; i < timestamps.size(); ++i)
+    {
+      if (timestamps[i] < timestamps[i - 1])
+        return false;
+    }
+
+    return true;
+  }
+};
+
+static void
+write(std::ostream& os, const IMC::Message& msg)
+{
+  Utils::ByteBuffer bfr;
+  IMC::Packet::serialize(&msg, bfr);
+  os.write(bfr.getBufferSigned(), bfr.getSize());
+}
+
+int
+main(void)
+{
+  Test test("IMC::LogReader");
+
+  FileSystem::Path root("/tmp/dune-test-LogReader");
+  if (root.exists())
+    root.remove(FileSystem::Path::MODE_RECURSIVE);
+  (root / "b").create();
+
+  std::string path_a = (root / "a.lsf.gz").str();
+  std::string path_b = (root / "b" / "Data.lsf").str();
+  std::string path_c = (root / "c.lsf").str();
+
+  {
+    Compression::FileOutput a(path_a.c_str(), Compression::METHOD_GZIP);
+    std::ofstream b(path_b.c_str(), std::ios::binary);
+    std::ofstream c(path_c.c_str(), std::ios::binary);
+
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+      IMC::EstimatedState es;
+      es.setTimeStamp(i * 2);
+      write(a, es);
+
+      if (i % 10 == 0)
+      {
+        IMC::Rpm rpm;
+        rpm.setTimeStamp(i * 2);
+        write(a, rpm);
+      }
+
+      IMC::Heartbeat hb;
+      hb.setTimeStamp(i * 2 + 1);
+      write(b, hb);
+      write(c, hb);
+    }
+  }
+
+  // Cut the last packet short.
+  {
+    std::ifstream ifs(path_c.c_str(), std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    std::ofstream ofs(path_c.c_str(), std::ios::binary | std::ios::trunc);
+    ofs.write(data.data(), data.size() - 1);
+  }
+
+  IMC::LogReader reader;
+  reader.add(path_a);
+  reader.add((root / "b").str());
+  test.boolean("log directories are resolved", reader.getPaths()[1] == path_b);
+
+  {
+    Collector c;
+    reader.run(c);
+    test.boolean("logs delivered in order",
+                 c.begins.size() == 2 && c.begins[0] == 0 && c.begins[1] == 1);
+    test.boolean("all messages delivered", c.counts[0] == 1100 && c.counts[1] == 1000);
+    test.boolean("messages of each log in log order",
+                 c.timestamps.size() == 2100 && c.timestamps[1099] == 1998 && c.timestamps[1100] == 1);
+    test.boolean("no errors", c.errors.size() == 2 && c.errors[0].empty() && c.errors[1].empty());
+  }
+
+  {
+    std::set<uint16_t> ids;
+    ids.insert(IMC::Rpm::getIdStatic());
+    reader.setFilter(ids);
+
+    Collector c;
+    reader.run(c);
+    test.boolean("filter", c.counts[0] == 100 && c.counts[1] == 0);
+
+    reader.setKeepFirst(true);
+    Collector k;
+    reader.run(k);
+    test.boolean("keep first message of each log",
+                 k.counts[0] == 101 && k.counts[1] == 1 && k.timestamps[0] == 0 && k.timestamps[101] == 1);
+    reader.setKeepFirst(false);
+    reader.setFilter(std::set<uint16_t>());
+  }
+
+  {
+    reader.setMerge(true);
+    reader.setBatchSize(100);
+
+    Collector c;
+    reader.run(c);
+    test.boolean("merge", c.begins.size() == 1 && c.counts[0] == 2100 && c.batches == 21);
+    test.boolean("merge in timestamp order", c.ordered());
+
+    Collector s;
+    s.stop_after = 2;
+    reader.run(s);
+    test.boolean("stop merging", s.counts[0] == 200 && s.errors.size() == 1);
+    reader.setMerge(false);
+  }
+
+  {
+    Collector c;
+    c.stop_after = 1;
+    reader.run(c);
+    test.boolean("stop a log", c.counts[0] == 100 && c.counts[1] == 1000 && c.errors.size() == 2);
+  }
+
+  {
+    IMC::LogReader broken;
+    broken.add(path_c);
+    broken.add((root / "missing.lsf").str());
+
+    Collector c;
+    broken.run(c);
+    test.boolean("messages before a truncated packet", c.counts[0] == 999);
+    test.boolean("truncated packet error", !c.errors[0].empty());
+    test.boolean("missing log error", c.counts[1] == 0 && !c.errors[1].empty());
+  }
+
+  root.remove(FileSystem::Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
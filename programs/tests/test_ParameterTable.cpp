@@ -0,0 +1,204 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Tasks::BasicParameterParser;
+using DUNE::Tasks::ParameterCell;
+using DUNE::Tasks::ParameterTable;
+
+//! Object counting parameter callbacks.
+struct Listener
+{
+  unsigned calls;
+
+  Listener(void):
+    calls(0)
+  { }
+
+  void
+  onGains(void)
+  {
+    ++calls;
+  }
+};
+
+//! Value that must never be seen half written.
+struct Gains
+{
+  double kp;
+  double ki;
+  double kd;
+};
+
+//! Thread reading gains and counting inconsistent values.
+class Reader: public DUNE::Concurrency::Thread
+{
+public:
+  Reader(const ParameterCell<Gains>& cell):
+    m_cell(cell),
+    m_torn(0),
+    m_reads(0)
+  { }
+
+  unsigned
+  getTorn(void) const
+  {
+    return m_torn;
+  }
+
+  unsigned
+  getReads(void) const
+  {
+    return m_reads;
+  }
+
+private:
+  const ParameterCell<Gains>& m_cell;
+  unsigned m_torn;
+  unsigned m_reads;
+
+  void
+  run(void)
+  {
+    while (!isStopping())
+    {
+      Gains g = m_cell.load();
+      if (g.ki != -g.kp || g.kd != 2 * g.kp)
+        ++m_torn;
+      ++m_reads;
+    }
+  }
+};
+
+int
+main(void)
+{
+  Test test("Tasks::ParameterTable");
+
+  {
+    ParameterTable table;
+    Listener listener;
+    std::vector<float> gains;
+    double period = 0;
+
+    table.add("Gains", &gains, new BasicParameterParser<std::vector<float> >(gains))
+    .callback(&listener, &Listener::onGains);
+    table.add("Period", &period, new BasicParameterParser<double>(period));
+    table.setChanged(false);
+
+    table.set("Gains", "1, 2, 3");
+    test.boolean("callback covers change", !table.requiresUpdate());
+    table.runCallbacks();
+    test.boolean("callback called", listener.calls == 1);
+    test.boolean("value committed", gains.size() == 3 && gains[2] == 3.0f);
+    test.boolean("changed flag kept", table.changed(&gains));
+
+    table.set("Gains", "1, 2, 3");
+    table.runCallbacks();
+    test.boolean("unchanged value skips callback", listener.calls == 1);
+
+    table.set("Period", "0.5");
+    test.boolean("change without callback requires update", table.requiresUpdate());
+    table.setChanged(false);
+    test.boolean("no pending changes", !table.requiresUpdate());
+  }
+
+  {
+    ParameterTable table;
+    ParameterCell<double> cell;
+
+    table.add("Gain", &cell, new BasicParameterParser<ParameterCell<double> >(cell))
+    .defaultValue("1.5")
+    .maximumValue("10");
+    table.set("Gain", "");
+    test.boolean("cell default value", cell.load() == 1.5);
+    table.set("Gain", "2.5");
+    test.boolean("cell value published", cell.load() == 2.5);
+    test.boolean("cell change flagged", table.changed(&cell));
+    table.set("Gain", "2.5");
+    test.boolean("cell unchanged value", !table.changed(&cell));
+
+    bool failed = false;
+    try
+    {
+      table.set("Gain", "abc");
+    }
+    catch (std::exception&)
+    {
+      failed = true;
+    }
+
+    test.boolean("cell rejects invalid value", failed && cell.load() == 2.5);
+  }
+
+  {
+    Gains g = {0, 0, 0};
+    ParameterCell<Gains> cell(g);
+
+    std::vector<Reader*> readers;
+    for (unsigned i = 0; i < 2; ++i)
+    {
+      readers.push_back(new Reader(cell));
+      readers.back()->start();
+    }
+
+    for (unsigned i = 1; i <= 200000; ++i)
+    {
+      g.kp = i;
+      g.ki = -g.kp;
+      g.kd = 2 * g.kp;
+      cell.store(g);
+    }
+
+    unsigned torn = 0;
+    unsigned reads = 0;
+    for (unsigned i = 0; i < readers.size(); ++i)
+    {
+      readers[i]->stopAndJoin();
+      torn += readers[i]->getTorn();
+      reads += readers[i]->getReads();
+      delete readers[i];
+    }
+
+    test.boolean("concurrent reads", reads > 0);
+    test.boolean("no torn values", torn == 0);
+    test.boolean("last value", cell.load().kp == 200000);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,172 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Hardware::PayloadLog;
+using DUNE::Hardware::Decimator;
+
+//! Read the contents of a file.
+static std::vector<uint8_t>
+readFile(const DUNE::FileSystem::Path& path)
+{
+  std::ifstream ifs(path.c_str(), std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(ifs),
+                              std::istreambuf_iterator<char>());
+}
+
+//! Build a frame filled with a counter.
+static std::vector<uint8_t>
+makeFrame(unsigned index, unsigned size)
+{
+  std::vector<uint8_t> frame(size);
+  for (unsigned i = 0; i < size; ++i)
+    frame[i] = (uint8_t)(index * 31 + i);
+  return frame;
+}
+
+int
+main(void)
+{
+  Test test("Hardware::PayloadLog");
+
+  DUNE::FileSystem::Path root("/tmp/dune-test-PayloadLog");
+  if (root.exists())
+    root.remove(DUNE::FileSystem::Path::MODE_RECURSIVE);
+  root.create();
+
+  {
+    Decimator dec(3);
+    unsigned passed = 0;
+    for (unsigned i = 0; i < 9; ++i)
+      passed += dec.check(i) ? 1 : 0;
+    test.boolean("divisor", passed == 3 && dec.getSkipped() == 6);
+
+    dec.setDivisor(1);
+    dec.setMaximumRate(2.0);
+    dec.reset();
+    passed = 0;
+    for (unsigned i = 0; i < 40; ++i)
+      passed += dec.check(i * 0.125) ? 1 : 0;
+    test.boolean("maximum rate", passed == 10);
+  }
+
+  {
+    // Frames larger than a block, written across block boundaries.
+    DUNE::FileSystem::Path path = root / "frames.dat";
+    std::vector<uint8_t> expected;
+    PayloadLog log(16, 10000, 8192);
+    log.start();
+
+    test.boolean("open", log.open(path.str()));
+    for (unsigned i = 0; i < 100; ++i)
+    {
+      std::vector<uint8_t> frame = makeFrame(i, 1000 + i * 37);
+      expected.insert(expected.end(), frame.begin(), frame.end());
+      while (!log.write(&frame[0], frame.size()))
+        DUNE::Time::Delay::wait(0.001);
+    }
+
+    log.close();
+    log.stopAndJoin();
+    test.boolean("frames written", log.getWritten() == expected.size());
+    test.boolean("file contents", readFile(path) == expected);
+    test.boolean("exact file size", path.size() == (int64_t)expected.size());
+    test.boolean("no errors", log.getErrors() == 0);
+
+    // Append to an existing file with unaligned size.
+    PayloadLog app(4, 100);
+    app.start();
+    app.open(path.str());
+    std::vector<uint8_t> frame = makeFrame(7, 77);
+    app.write(&frame[0], frame.size());
+    expected.insert(expected.end(), frame.begin(), frame.end());
+    app.stopAndJoin();
+    test.boolean("append", readFile(path) == expected);
+  }
+
+  {
+    // Ring is not drained while the writer is stopped.
+    PayloadLog log(4, 16);
+    uint8_t frame[32] = {0};
+    unsigned queued = 0;
+    for (unsigned i = 0; i < 10; ++i)
+      queued += log.write(frame, 16) ? 1 : 0;
+    test.boolean("ring full", queued == 4 && log.getDropped() == 6);
+    test.boolean("oversized frame", !log.write(frame, 32) && log.getDropped() == 7);
+  }
+
+  {
+    // Partial blocks reach the disk after the flush period.
+    DUNE::FileSystem::Path path = root / "partial.dat";
+    PayloadLog log(8, 64, 4096, 0.1);
+    log.start();
+    log.open(path.str());
+    std::vector<uint8_t> frame = makeFrame(3, 50);
+    log.write(&frame[0], frame.size());
+    DUNE::Time::Delay::wait(0.5);
+    std::vector<uint8_t> data = readFile(path);
+    test.boolean("periodic flush", data.size() >= frame.size()
+                 && std::equal(frame.begin(), frame.end(), data.begin()));
+
+    // Switch files in order with data.
+    DUNE::FileSystem::Path next = root / "next.dat";
+    log.open(next.str());
+    log.write(&frame[0], frame.size());
+    log.close();
+    log.stopAndJoin();
+    test.boolean("previous file closed", readFile(path) == frame);
+    test.boolean("next file", readFile(next) == frame);
+  }
+
+  {
+    // Empty files are removed.
+    DUNE::FileSystem::Path path = root / "empty.dat";
+    PayloadLog log(4, 64);
+    log.start();
+    log.open(path.str());
+    log.close();
+    log.stopAndJoin();
+    test.boolean("empty file removed", !path.exists());
+  }
+
+  root.remove(DUNE::FileSystem::Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,206 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+// Test program for DUNE::Math::QPSolver.                                   *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Math/QPSolver.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Math::Matrix;
+using DUNE::Math::QPSolver;
+
+//! Simple linear congruential generator, to keep problems reproducible.
+static double
+next(unsigned long long& state, double a, double b)
+{
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return a + (b - a) * ((state >> 11) * (1.0 / 9007199254740992.0));
+}
+
+static bool
+near(const Matrix& a, const Matrix& b, double tol)
+{
+  if (a.size() != b.size())
+    return false;
+
+  for (int i = 0; i < a.size(); ++i)
+  {
+    if (std::fabs(a(i) - b(i)) > tol)
+      return false;
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("DUNE::Math::QPSolver");
+
+  // min 0.5 (x1^2 + x2^2) - x1 - x2  s.t.  x1 + x2 <= 1.
+  {
+    Matrix H(2);
+    Matrix f(2, 1, -1.0);
+    Matrix A(1, 2, -1.0);
+    Matrix b(1, 1, 1.0);
+    Matrix x;
+    double v = QPSolver::solve(H, f, A, b, x);
+    test.boolean("inequality constrained solution", std::fabs(x(0) - 0.5) < 1e-9 && std::fabs(x(1) - 0.5) < 1e-9);
+    test.boolean("objective value", std::fabs(v + 0.75) < 1e-9);
+
+    QPSolver solver(2, 0, 1);
+    Matrix y;
+    solver.minimize(H, f, A, b, y);
+    test.boolean("minimize() matches solve()", near(x, y, 1e-12));
+
+    std::vector<unsigned> active;
+    solver.getActiveSet(active);
+    test.boolean("active set", active.size() == 1 && active[0] == 0);
+  }
+
+  // min 0.5 (x1^2 + x2^2)  s.t.  x1 - x2 - 1 = 0.
+  {
+    Matrix H(2);
+    Matrix f(2, 1, 0.0);
+    Matrix Aeq(1, 2, 1.0);
+    Aeq(0, 1) = -1.0;
+    Matrix beq(1, 1, -1.0);
+    Matrix A;
+    Matrix b;
+    Matrix x;
+    QPSolver solver(2, 1, 0);
+    solver.minimize(H, f, Aeq, beq, A, b, x);
+    test.boolean("equality constrained solution", std::fabs(x(0) - 0.5) < 1e-9 && std::fabs(x(1) + 0.5) < 1e-9);
+  }
+
+  // Infeasible: x >= 1 and x <= -1.
+  {
+    Matrix H(1);
+    Matrix f(1, 1, 0.0);
+    Matrix A(2, 1, 1.0);
+    A(1, 0) = -1.0;
+    Matrix b(2, 1, -1.0);
+    Matrix x;
+    bool thrown = false;
+    try
+    {
+      QPSolver::solve(H, f, A, b, x);
+    }
+    catch (QPSolver::Error&)
+    {
+      thrown = true;
+    }
+    test.boolean("infeasible problem raises error", thrown);
+  }
+
+  // Dimension mismatch.
+  {
+    QPSolver solver(3, 0, 2);
+    Matrix H(2);
+    Matrix f(2, 1, 0.0);
+    Matrix A(2, 2, 0.0);
+    Matrix b(2, 1, 0.0);
+    Matrix x;
+    bool thrown = false;
+    try
+    {
+      solver.minimize(H, f, A, b, x);
+    }
+    catch (QPSolver::Error&)
+    {
+      thrown = true;
+    }
+    test.boolean("dimension mismatch raises error", thrown);
+  }
+
+  // Sequence of problems with slowly varying linear term, solved cold
+  // and warm: solutions must match and warm start must not need more
+  // iterations.
+  {
+    const int n = 6;
+    const int m = 12;
+    unsigned long long state = 1;
+
+    Matrix M(n, n);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        M(i, j) = next(state, -1.0, 1.0);
+    Matrix H = M * transpose(M) + Matrix(n) * 0.5;
+
+    Matrix A(m, n);
+    Matrix b(m, 1);
+    for (int i = 0; i < m; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+        A(i, j) = next(state, -1.0, 1.0);
+      b(i) = next(state, 0.0, 1.0);
+    }
+
+    Matrix f(n, 1);
+    for (int i = 0; i < n; ++i)
+      f(i) = next(state, -5.0, 5.0);
+
+    QPSolver warm(n, 0, m);
+    QPSolver cold(n, 0, m);
+    cold.setWarmStart(false);
+
+    bool same = true;
+    unsigned warm_iters = 0;
+    unsigned cold_iters = 0;
+    for (int k = 0; k < 200; ++k)
+    {
+      for (int i = 0; i < n; ++i)
+        f(i) += next(state, -0.05, 0.05);
+
+      Matrix xs;
+      Matrix xw;
+      Matrix xc;
+      double vs = QPSolver::solve(H, f, A, b, xs);
+      double vw = warm.minimize(H, f, A, b, xw);
+      double vc = cold.minimize(H, f, A, b, xc);
+      warm_iters += warm.getIterations();
+      cold_iters += cold.getIterations();
+
+      same = same && near(xs, xc, 1e-12) && vs == vc;
+      same = same && near(xs, xw, 1e-6) && std::fabs(vs - vw) < 1e-6;
+    }
+
+    test.boolean("warm and cold solutions match", same);
+    test.boolean("warm start does not add iterations", warm_iters <= cold_iters);
+  }
+
+  return test.getReturnValue();
+}
@@ -31,6 +31,7 @@
 #include <string>
 #include <cstdlib>
 #include <cmath>
+#include <vector>
 #include "Test.hpp"
 #include <DUNE/Math/Random.hpp>
 
@@ -45,6 +46,12 @@ test_FSR256(void);
 void
 test_MT19937(void);
 
+void
+test_Philox(void);
+
+void
+test_Blocks(void);
+
 void
 test_KernelDevice(void);
 
@@ -69,6 +76,10 @@ main(int argc, char** argv)
 #endif
   // ** FOR MT19937: we check against Matlab derived results **
   test_MT19937();
+  // ** FOR Philox: we check against the Random123 known-answer vectors **
+  test_Philox();
+  // ** FOR block generation: consistency with scalar interface and moments **
+  test_Blocks();
   // ** FOR KernelDevice: we merely check for sanity if /dev/urandom is available **
   test_KernelDevice();
 }
@@ -190,6 +201,128 @@ test_MT19937(void)
   test.boolean("MT19937", i == SEEDS);
 }
 
+void
+test_Philox(void)
+{
+  static const uint32_t ctr[3][4] =
+  {
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}
+  };
+
+  static const uint32_t key[3][2] =
+  {
+    {0x00000000, 0x00000000},
+    {0xffffffff, 0xffffffff},
+    {0xa4093822, 0x299f31d0}
+  };
+
+  static const uint32_t kat[3][4] =
+  {
+    {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+    {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+    {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}
+  };
+
+  bool ok = true;
+  for (int i = 0; i < 3; ++i)
+  {
+    uint32_t out[4];
+    Philox::generate(ctr[i], key[i], out);
+    for (int j = 0; j < 4; ++j)
+      ok = ok && out[j] == kat[i][j];
+  }
+  test.boolean("Philox known-answer vectors", ok);
+
+  // Stream position must be reachable directly.
+  Philox a(1234, 7);
+  Philox b(1234, 7);
+  for (int i = 0; i < 4 * 100 + 2; ++i)
+    (void)a.random();
+  b.setCounter(100);
+  (void)b.random();
+  (void)b.random();
+  test.boolean("Philox setCounter() skips ahead", a.random() == b.random());
+
+  // Different streams with the same seed must differ.
+  Philox c(1234, 8);
+  b.setCounter(0);
+  test.boolean("Philox streams are distinct", b.random() != c.random());
+}
+
+void
+test_Blocks(void)
+{
+  const unsigned count = 1003;
+  std::vector<double> v(count);
+
+  // Block generation must match scalar generation.
+  Philox p1(42);
+  Philox p2(42);
+  MT19937 m1(42);
+  MT19937 m2(42);
+  (void)p1.uniform();
+  (void)p2.uniform();
+  p1.fillUniform(&v[0], count);
+
+  bool ok = true;
+  for (unsigned i = 0; i < count; ++i)
+    ok = ok && v[i] == p2.uniform();
+  test.boolean("Philox fillUniform() matches uniform()", ok);
+
+  m1.fillUniform(&v[0], count, -2.0, 3.0);
+  ok = true;
+  for (unsigned i = 0; i < count; ++i)
+    ok = ok && std::fabs(v[i] - static_cast<Generator&>(m2).uniform(-2.0, 3.0)) < 1e-12;
+  test.boolean("Generator fillUniform(a, b) matches uniform(a, b)", ok);
+
+  // Gaussian moments.
+  const unsigned samples = 200000;
+  std::vector<double> g(samples);
+  Generator* gens[] = {&p1, &m1};
+  for (unsigned k = 0; k < 2; ++k)
+  {
+    gens[k]->fillGaussian(&g[0], samples, 1.0, 2.0);
+    double sum = 0;
+    double sum2 = 0;
+    for (unsigned i = 0; i < samples; ++i)
+    {
+      sum += g[i];
+      sum2 += g[i] * g[i];
+    }
+
+    double mean = sum / samples;
+    double var = sum2 / samples - mean * mean;
+    test.boolean(k == 0 ? "Philox fillGaussian() moments" : "MT19937 fillGaussian() moments",
+                 std::fabs(mean - 1.0) < 0.02 && std::fabs(var - 4.0) < 0.08);
+  }
+
+  // Odd counts must not write past the end.
+  std::vector<double> w(6, -1000.0);
+  p1.fillGaussian(&w[0], 5);
+  test.boolean("fillGaussian() odd count", w[5] == -1000.0 && w[4] != -1000.0);
+
+  // Seeded scalar generators must reproduce the sequence of
+  // repeated gaussian() calls.
+  MT19937 m3(7);
+  MT19937 m4(7);
+  m3.fillGaussian(&v[0], count);
+  ok = true;
+  for (unsigned i = 0; i < count; ++i)
+    ok = ok && v[i] == static_cast<Generator&>(m4).gaussian();
+  test.boolean("MT19937 fillGaussian() matches gaussian()", ok);
+
+  // The default generator is unchanged.
+  Generator* d = Factory::create(Factory::c_default, 7);
+  FSR256 f(7);
+  ok = true;
+  for (unsigned i = 0; i < count; ++i)
+    ok = ok && d->random() == f.random();
+  delete d;
+  test.boolean("default generator is fsr256", ok);
+}
+
 void
 test_KernelDevice(void)
 {
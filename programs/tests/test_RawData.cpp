@@ -0,0 +1,101 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <sstream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+int
+main(void)
+{
+  Test test("IMC::RawData");
+
+  IMC::SonarData sonar;
+  sonar.setSource(0x1234);
+  sonar.setSourceEntity(12);
+  sonar.setTimeStamp(1.5);
+  sonar.type = IMC::SonarData::ST_SIDESCAN;
+  sonar.frequency = 900000;
+  sonar.data.resize(4096);
+  for (unsigned i = 0; i < sonar.data.size(); ++i)
+    sonar.data[i] = (char)i;
+
+  IMC::SonarData* copy = static_cast<IMC::SonarData*>(sonar.clone());
+  test.boolean("clone() shares storage", copy->data.isShared() && sonar.data.isShared());
+  test.boolean("clone() compares equal", *copy == sonar);
+
+  const IMC::SonarData* ccopy = copy;
+  test.boolean("const access keeps sharing", ccopy->data[10] == 10 && copy->data.isShared());
+
+  copy->data[0] = 42;
+  test.boolean("write detaches", !copy->data.isShared() && !sonar.data.isShared());
+  test.boolean("write leaves original intact", sonar.data[0] == 0 && copy->data[0] == 42);
+  delete copy;
+
+  Utils::ByteBuffer flat;
+  IMC::Packet::serialize(&sonar, flat);
+
+  Utils::ByteBuffer head;
+  IMC::Packet::Segment segs[IMC::Packet::c_max_segments];
+  unsigned count = IMC::Packet::serializeSegments(&sonar, head, segs);
+  test.boolean("serializeSegments() count", count == 3);
+  test.boolean("serializeSegments() payload in place", segs[1].data == (const uint8_t*)&sonar.data.get()[0]);
+
+  std::string gathered;
+  for (unsigned i = 0; i < count; ++i)
+    gathered.append((const char*)segs[i].data, segs[i].size);
+
+  test.boolean("serializeSegments() matches serialize()",
+               gathered.size() == flat.getSize()
+               && std::memcmp(gathered.data(), flat.getBuffer(), flat.getSize()) == 0);
+
+  std::ostringstream os;
+  IMC::Packet::serialize(&sonar, head, os);
+  test.boolean("serialize() to stream", os.str() == gathered);
+
+  IMC::Message* msg = IMC::Packet::deserialize(flat.getBuffer(), flat.getSize());
+  test.boolean("deserialize()", msg != NULL && *msg == sonar);
+  delete msg;
+
+  IMC::Heartbeat hbeat;
+  count = IMC::Packet::serializeSegments(&hbeat, head, segs);
+  test.boolean("serializeSegments() without raw data", count == 2);
+
+  return test.getReturnValue();
+}
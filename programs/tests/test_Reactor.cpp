@@ -0,0 +1,291 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// POSIX headers.
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// DUNE headers.
+#include <DUNE/IO.hpp>
+#include <DUNE/Network.hpp>
+#include <DUNE/Concurrency/AtomicInteger.hpp>
+#include <DUNE/Time.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Read end of a pipe.
+class PipeHandle: public IO::Handle
+{
+public:
+  PipeHandle(void)
+  {
+    if (pipe(m_fds) != 0)
+      throw std::runtime_error("pipe");
+  }
+
+  ~PipeHandle(void)
+  {
+    close(m_fds[0]);
+    closeWriter();
+  }
+
+  void
+  put(const char* str)
+  {
+    if (::write(m_fds[1], str, std::strlen(str)) < 0)
+      throw std::runtime_error("write");
+  }
+
+  void
+  closeWriter(void)
+  {
+    if (m_fds[1] >= 0)
+      close(m_fds[1]);
+    m_fds[1] = -1;
+  }
+
+private:
+  int m_fds[2];
+
+  IO::NativeHandle
+  doGetNative(void) const
+  {
+    return m_fds[0];
+  }
+
+  size_t
+  doWrite(const uint8_t* data, size_t size)
+  {
+    (void)data;
+    return size;
+  }
+
+  size_t
+  doRead(uint8_t* data, size_t size)
+  {
+    ssize_t rv = ::read(m_fds[0], data, size);
+    return rv < 0 ? 0 : rv;
+  }
+};
+
+//! Listener counting notifications.
+struct Counter: public IO::Reactor::Listener
+{
+  Concurrency::AtomicInteger calls;
+
+  Counter(void):
+    calls(0)
+  { }
+
+  void
+  onInput(IO::Reactor::Channel& channel)
+  {
+    (void)channel;
+    calls.increment();
+  }
+};
+
+//! Listener that registers another handle and removes its own
+//! channel.
+struct Replacer: public IO::Reactor::Listener
+{
+  IO::Reactor& reactor;
+  IO::Handle& next;
+  IO::Reactor::Channel* added;
+
+  Replacer(IO::Reactor& r, IO::Handle& n):
+    reactor(r),
+    next(n),
+    added(NULL)
+  { }
+
+  void
+  onInput(IO::Reactor::Channel& channel)
+  {
+    added = reactor.add(next);
+    reactor.remove(&channel);
+  }
+};
+
+//! Listener taking a while to handle input.
+struct Slow: public IO::Reactor::Listener
+{
+  Concurrency::AtomicInteger busy;
+
+  Slow(void):
+    busy(0)
+  { }
+
+  void
+  onInput(IO::Reactor::Channel& channel)
+  {
+    (void)channel;
+    busy.increment();
+    Time::Delay::wait(0.2);
+    busy.decrement();
+  }
+};
+
+int
+main(void)
+{
+  Test test("IO::Reactor");
+
+  IO::Reactor reactor;
+  reactor.start();
+
+  // Framed input.
+  {
+    PipeHandle pipe;
+    IO::Reactor::LineFramer framer;
+    Counter counter;
+    IO::Reactor::Channel* channel = reactor.add(pipe, &framer, &counter);
+
+    double t0 = Time::Clock::getSinceEpoch();
+    pipe.put("$GPGGA,1*00\r\n$GPV");
+    channel->wait(1.0);
+    Time::Delay::wait(0.2);
+    pipe.put("TG,2*00\r\n");
+    Time::Delay::wait(0.2);
+
+    std::vector<uint8_t> frame;
+    double ts1 = 0;
+    double ts2 = 0;
+    bool ok = channel->pop(frame, ts1) && std::string(frame.begin(), frame.end()) == "$GPGGA,1*00\r\n";
+    ok = ok && channel->pop(frame, ts2) && std::string(frame.begin(), frame.end()) == "$GPVTG,2*00\r\n";
+    test.boolean("frames", ok && !channel->pop(frame, ts1));
+    test.boolean("frames stamped at first byte",
+                 ts1 == ts2 && std::fabs(ts1 - t0) < 0.1);
+    test.boolean("listener", counter.calls.value() == 2);
+
+    pipe.closeWriter();
+    test.boolean("end of input", channel->wait(1.0) && channel->hasError());
+    reactor.remove(channel);
+  }
+
+  // Raw input.
+  {
+    PipeHandle pipe;
+    IO::Reactor::Channel* channel = reactor.add(pipe, NULL, NULL, 8);
+
+    pipe.put("0123");
+    Time::Delay::wait(0.1);
+    double t1 = Time::Clock::getSinceEpoch();
+    Time::Delay::wait(0.1);
+    pipe.put("456789");
+    Time::Delay::wait(0.1);
+
+    uint8_t bfr[16];
+    double ts1 = 0;
+    double ts2 = 0;
+    size_t n1 = channel->read(bfr, sizeof(bfr), ts1);
+    std::string s1((char*)bfr, n1);
+    size_t n2 = channel->read(bfr, sizeof(bfr), ts2);
+    std::string s2((char*)bfr, n2);
+
+    test.boolean("reads keep their boundaries", s1 == "23" && s2 == "456789" && ts1 < t1 && ts2 > t1);
+    test.boolean("overruns drop the oldest bytes", channel->getOverruns() == 2);
+    test.boolean("nothing left", !channel->wait(0.05) && channel->read(bfr, sizeof(bfr), ts1) == 0);
+    reactor.remove(channel);
+  }
+
+  // Listeners calling back into the reactor.
+  {
+    PipeHandle first;
+    PipeHandle second;
+    Replacer replacer(reactor, second);
+    reactor.add(first, NULL, &replacer);
+
+    first.put("x");
+    Time::Delay::wait(0.1);
+    second.put("y");
+
+    uint8_t bfr[4];
+    double tstamp = 0;
+    bool ok = replacer.added != NULL && replacer.added->wait(1.0);
+    test.boolean("listener adds and removes channels",
+                 ok && replacer.added->read(bfr, sizeof(bfr), tstamp) == 1 && bfr[0] == 'y');
+    reactor.remove(replacer.added);
+  }
+
+  {
+    PipeHandle pipe;
+    Slow slow;
+    IO::Reactor::Channel* channel = reactor.add(pipe, NULL, &slow);
+
+    pipe.put("x");
+    Time::Delay::wait(0.1);
+    bool entered = slow.busy.value() == 1;
+    reactor.remove(channel);
+    test.boolean("remove waits for the listener", entered && slow.busy.value() == 0);
+  }
+
+  // Kernel receive timestamps.
+  {
+    Network::UDPSocket rx;
+    rx.bind(0, Network::Address::Loopback);
+    rx.enableTimestamps(true);
+
+    Network::UDPSocket tx;
+    uint16_t port = 0;
+    {
+      sockaddr_in addr;
+      socklen_t len = sizeof(addr);
+      getsockname(rx.getNative(), (sockaddr*)&addr, &len);
+      port = ntohs(addr.sin_port);
+    }
+
+    IO::Reactor::Channel* channel = reactor.add(rx);
+
+    double t0 = Time::Clock::getSinceEpoch();
+    tx.write((const uint8_t*)"ping", 4, Network::Address::Loopback, port);
+
+    uint8_t bfr[16];
+    double tstamp = 0;
+    size_t n = channel->wait(1.0) ? channel->read(bfr, sizeof(bfr), tstamp) : 0;
+    test.boolean("datagram timestamps",
+                 n == 4 && tstamp >= t0 - 0.01 && tstamp <= Time::Clock::getSinceEpoch());
+    reactor.remove(channel);
+  }
+
+  reactor.stopAndJoin();
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,106 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+int
+main(void)
+{
+  Test test("IMC::Serialization");
+
+  // Cached payload sizes must match the virtual size queries.
+  std::vector<uint32_t> ids;
+  IMC::Factory::getIds(ids);
+  unsigned mismatches = 0;
+  for (unsigned i = 0; i < ids.size(); ++i)
+  {
+    IMC::Message* msg = IMC::Factory::produce(ids[i]);
+    const IMC::Schema::Message* schema = IMC::Schema::find(ids[i]);
+    unsigned size = msg->getFixedSerializationSize() + msg->getVariableSerializationSize();
+    if (msg->getPayloadSerializationSize() != size || (schema->fixed && schema->fixed_size != size))
+      ++mismatches;
+    delete msg;
+  }
+  test.boolean("payload sizes", mismatches == 0);
+  test.boolean("static payload size", IMC::EstimatedState::c_payload_size == 88);
+
+  IMC::EstimatedState es;
+  es.lat = 0.71;
+  es.lon = -0.15;
+  es.height = 10.5;
+  es.psi = 1.25;
+  es.depth = 3.0;
+  es.alt = 12.5;
+
+  std::vector<uint8_t> bfr(IMC::EstimatedState::c_payload_size);
+  uint8_t* end = es.serializeFields(&bfr[0]);
+  test.boolean("serializeFields() size", end - &bfr[0] == IMC::EstimatedState::c_payload_size);
+
+  IMC::EstimatedState des;
+  test.boolean("deserializeFields()",
+               des.deserializeFields(&bfr[0], bfr.size()) == bfr.size() && des == es);
+
+  // Byte swap each field to emulate a peer with the opposite byte order.
+  const IMC::Schema::Message* schema = IMC::Schema::find(es.getId());
+  std::vector<uint8_t> rev(bfr);
+  unsigned offset = 0;
+  for (unsigned i = 0; i < schema->fields.size(); ++i)
+  {
+    unsigned size = IMC::Schema::getTypeSize(schema->fields[i].type);
+    for (unsigned j = 0; j < size; ++j)
+      rev[offset + j] = bfr[offset + size - 1 - j];
+    offset += size;
+  }
+
+  IMC::EstimatedState rdes;
+  test.boolean("reverseDeserializeFields()",
+               rdes.reverseDeserializeFields(&rev[0], rev.size()) == rev.size() && rdes == es);
+
+  bool thrown = false;
+  try
+  {
+    des.deserializeFields(&bfr[0], bfr.size() - 1);
+  }
+  catch (IMC::BufferTooShort&)
+  {
+    thrown = true;
+  }
+  test.boolean("truncated payload throws", thrown);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,196 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Concurrency::SharedRing;
+
+//! Number of frames written by each producer.
+static const unsigned c_frames = 2000;
+
+//! Thread writing numbered frames to a ring.
+class Producer: public DUNE::Concurrency::Thread
+{
+public:
+  Producer(SharedRing& ring, uint32_t origin):
+    m_ring(ring),
+    m_origin(origin)
+  { }
+
+private:
+  SharedRing& m_ring;
+  uint32_t m_origin;
+
+  void
+  run(void)
+  {
+    for (uint32_t i = 0; i < c_frames; ++i)
+      m_ring.write(reinterpret_cast<const uint8_t*>(&i), sizeof(i), m_origin);
+  }
+};
+
+int
+main(void)
+{
+  Test test("Concurrency::SharedRing");
+
+  {
+    SharedRing writer("test-ring-basic", 8, 64);
+    writer.create();
+    SharedRing reader("test-ring-basic", 8, 64);
+    reader.open();
+
+    const char* text = "frame";
+    test.boolean("write", writer.write(reinterpret_cast<const uint8_t*>(text), 6, 7));
+
+    uint8_t bfr[64];
+    uint32_t origin = 0;
+    unsigned rv = reader.read(bfr, origin, 0.5);
+    test.boolean("read", rv == 6 && std::strcmp((const char*)bfr, text) == 0);
+    test.boolean("origin", origin == 7);
+    test.boolean("empty read times out", reader.read(bfr, origin, 0.05) == 0);
+
+    uint8_t big[65] = {0};
+    test.boolean("oversized frame rejected", !writer.write(big, sizeof(big), 7));
+  }
+
+  {
+    SharedRing writer("test-ring-geometry", 8, 64);
+    writer.create();
+    SharedRing reader("test-ring-geometry", 16, 64);
+
+    bool failed = false;
+    try
+    {
+      reader.open();
+    }
+    catch (std::exception&)
+    {
+      failed = true;
+    }
+
+    test.boolean("geometry mismatch", failed);
+  }
+
+  {
+    SharedRing writer("test-ring-overrun", 4, 16);
+    writer.create();
+    SharedRing reader("test-ring-overrun", 4, 16);
+    reader.open();
+
+    for (uint32_t i = 0; i < 10; ++i)
+      writer.write(reinterpret_cast<const uint8_t*>(&i), sizeof(i), 1);
+
+    uint8_t bfr[16];
+    uint32_t origin = 0;
+    uint32_t value = 0;
+    reader.read(bfr, origin, 0.5);
+    std::memcpy(&value, bfr, sizeof(value));
+    test.boolean("overrun skips to oldest frame", value == 6);
+    test.boolean("overrun dropped frames", reader.getDropped() == 6);
+  }
+
+  {
+    SharedRing first("test-ring-recreate", 8, 64);
+    first.create();
+    SharedRing reader("test-ring-recreate", 8, 64);
+    reader.open();
+    test.boolean("first generation", reader.getGeneration() == 0);
+
+    SharedRing second("test-ring-recreate", 8, 64);
+    second.create();
+    test.boolean("next generation", second.getGeneration() == 1);
+
+    const char* text = "frame";
+    test.boolean("retired ring rejects writes",
+                 !first.write(reinterpret_cast<const uint8_t*>(text), 6, 1));
+    test.boolean("new ring accepts writes",
+                 second.write(reinterpret_cast<const uint8_t*>(text), 6, 2));
+
+    uint8_t bfr[64];
+    uint32_t origin = 0;
+    unsigned rv = reader.read(bfr, origin, 0.5);
+    test.boolean("reader moves to new ring", rv == 6 && origin == 2);
+    test.boolean("reader generation", reader.getGeneration() == 1);
+  }
+
+  {
+    SharedRing ring("test-ring-mpsc", 8192, 16);
+    ring.create();
+    SharedRing reader("test-ring-mpsc", 8192, 16);
+    reader.open();
+
+    std::vector<Producer*> producers;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+      producers.push_back(new Producer(ring, i));
+      producers.back()->start();
+    }
+
+    std::vector<uint32_t> next(4, 0);
+    bool ordered = true;
+    unsigned count = 0;
+    uint8_t bfr[16];
+
+    while (count < 4 * c_frames)
+    {
+      uint32_t origin = 0;
+      if (reader.read(bfr, origin, 1.0) == 0)
+        break;
+
+      uint32_t value = 0;
+      std::memcpy(&value, bfr, sizeof(value));
+      if (origin >= 4 || value != next[origin])
+        ordered = false;
+      else
+        ++next[origin];
+      ++count;
+    }
+
+    for (unsigned i = 0; i < producers.size(); ++i)
+    {
+      producers[i]->join();
+      delete producers[i];
+    }
+
+    test.boolean("multiple producers", count == 4 * c_frames);
+    test.boolean("per producer order", ordered);
+    test.boolean("no drops", reader.getDropped() == 0);
+  }
+
+  return test.getReturnValue();
+}
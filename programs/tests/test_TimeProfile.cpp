@@ -0,0 +1,188 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Coordinates.hpp>
+#include <DUNE/IMC.hpp>
+#include <DUNE/Plans.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+using Plans::TimeProfile;
+
+static const double c_lat = 0.7188;
+static const double c_lon = -0.1525;
+
+static IMC::PlanManeuver*
+makeGoto(const std::string& id, double north, double east)
+{
+  IMC::Goto m;
+  m.lat = c_lat;
+  m.lon = c_lon;
+  Coordinates::WGS84::displace(north, east, &m.lat, &m.lon);
+  m.z = 2.0;
+  m.z_units = IMC::Z_DEPTH;
+  m.speed = 1.5;
+  m.speed_units = IMC::SUNITS_METERS_PS;
+
+  IMC::PlanManeuver* pman = new IMC::PlanManeuver;
+  pman->maneuver_id = id;
+  pman->data.set(m);
+  return pman;
+}
+
+static IMC::PlanManeuver*
+makePath(const std::string& id, unsigned points)
+{
+  IMC::FollowPath m;
+  m.lat = c_lat;
+  m.lon = c_lon;
+  Coordinates::WGS84::displace(100, 0, &m.lat, &m.lon);
+  m.z = 2.0;
+  m.z_units = IMC::Z_DEPTH;
+  m.speed = 1.5;
+  m.speed_units = IMC::SUNITS_METERS_PS;
+
+  for (unsigned i = 0; i < points; ++i)
+  {
+    IMC::PathPoint p;
+    p.x = (i % 2) * 50.0;
+    p.y = i * 10.0;
+    p.z = 0;
+    m.points.push_back(p);
+  }
+
+  IMC::PlanManeuver* pman = new IMC::PlanManeuver;
+  pman->maneuver_id = id;
+  pman->data.set(m);
+  return pman;
+}
+
+static bool
+equal(const TimeProfile& a, const TimeProfile& b)
+{
+  if (a.size() != b.size() || a.lastValid() != b.lastValid())
+    return false;
+
+  TimeProfile::const_iterator itr = a.begin();
+  for (; itr != a.end(); ++itr)
+  {
+    TimeProfile::const_iterator other = b.find(itr->first);
+    if (other == b.end())
+      return false;
+
+    if (itr->second.durations != other->second.durations)
+      return false;
+
+    if (itr->second.speeds.size() != other->second.speeds.size())
+      return false;
+
+    for (size_t i = 0; i < itr->second.speeds.size(); ++i)
+    {
+      if (itr->second.speeds[i].time != other->second.speeds[i].time)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Plans::TimeProfile");
+
+  std::vector<float> act(2, 0.0f);
+  std::vector<float> rpm(2, 0.0f);
+  std::vector<float> mps(2, 0.0f);
+  act[1] = 1.0f;
+  rpm[1] = 1000.0f;
+  mps[1] = 2.0f;
+  Plans::SpeedModel model(act, rpm, mps);
+
+  IMC::EstimatedState state;
+  state.lat = c_lat;
+  state.lon = c_lon;
+
+  std::vector<IMC::PlanManeuver*> nodes;
+  nodes.push_back(makeGoto("goto1", 100, 0));
+  nodes.push_back(makePath("path", 500));
+  nodes.push_back(makeGoto("goto2", 0, 0));
+
+  TimeProfile cached(&model);
+  cached.parse(nodes, &state);
+
+  {
+    TimeProfile fresh(&model);
+    fresh.parse(nodes, &state);
+
+    cached.clear();
+    cached.parse(nodes, &state);
+    test.boolean("reload reuses all maneuvers", cached.getCacheHits() == 3);
+    test.boolean("reload gives the same profiles", equal(cached, fresh));
+    test.boolean("finite duration", cached.isDurationFinite() && cached.lastValid() == "goto2");
+  }
+
+  // Edit the last maneuver.
+  {
+    delete nodes[2];
+    nodes[2] = makeGoto("goto2", 10, 10);
+
+    TimeProfile fresh(&model);
+    fresh.parse(nodes, &state);
+
+    cached.clear();
+    cached.parse(nodes, &state);
+    test.boolean("edit reuses unchanged maneuvers", cached.getCacheHits() == 2);
+    test.boolean("edit gives the same profiles", equal(cached, fresh));
+  }
+
+  // Start from another position.
+  {
+    Coordinates::WGS84::displace(20, 20, &state.lat, &state.lon);
+
+    TimeProfile fresh(&model);
+    fresh.parse(nodes, &state);
+
+    cached.clear();
+    cached.parse(nodes, &state);
+    test.boolean("new start reparses first maneuver", cached.getCacheHits() == 2);
+    test.boolean("new start gives the same profiles", equal(cached, fresh));
+  }
+
+  for (size_t i = 0; i < nodes.size(); ++i)
+    delete nodes[i];
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,94 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Network/TxQueue.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+typedef Network::TxQueue<int> Queue;
+
+int
+main(void)
+{
+  Test test("Network::TxQueue");
+
+  Queue queue;
+  std::vector<int> out;
+
+  queue.push(1, 10, Queue::PRIORITY_LOW, -1);
+  queue.push(2, 10, Queue::PRIORITY_NORMAL, 100);
+  queue.push(3, 10, Queue::PRIORITY_NORMAL, 50);
+  queue.push(4, 10, Queue::PRIORITY_CRITICAL, -1);
+  test.boolean("size()", queue.size() == 4 && queue.getBytes() == 40);
+
+  for (unsigned i = 0; i < 4; ++i)
+    queue.pop(0, out);
+  test.boolean("priority then deadline order",
+               out.size() == 4 && out[0] == 4 && out[1] == 3 && out[2] == 2 && out[3] == 1);
+  test.boolean("empty()", queue.empty() && queue.getBytes() == 0);
+
+  int replaced = 0;
+  bool found = queue.push(10, 50, Queue::PRIORITY_LOW, -1, 0x1234, replaced);
+  test.boolean("no coalescing of first entry", !found);
+  found = queue.push(11, 50, Queue::PRIORITY_LOW, -1, 0x1234, replaced);
+  test.boolean("coalescing", found && replaced == 10 && queue.size() == 1);
+  test.boolean("coalescing statistics", queue.getStatistics().coalesced == 1);
+
+  queue.push(20, 30, Queue::PRIORITY_NORMAL, 5);
+  queue.push(21, 30, Queue::PRIORITY_NORMAL, 20);
+  out.clear();
+  test.boolean("expire()", queue.expire(10, out) == 1 && out[0] == 20);
+
+  queue.push(30, 40, Queue::PRIORITY_HIGH, -1);
+  queue.push(31, 20, Queue::PRIORITY_HIGH, -1);
+  out.clear();
+  unsigned bytes = queue.pop(64, out);
+  test.boolean("MTU packing", bytes == 60 && out.size() == 2 && out[0] == 30 && out[1] == 31);
+  out.clear();
+  bytes = queue.pop(100, out);
+  test.boolean("MTU packing across classes", bytes == 80 && out.size() == 2 && out[0] == 21 && out[1] == 11);
+
+  queue.setBandwidth(10, 40);
+  test.boolean("burst allowed", queue.canSend(40, 0));
+  queue.account(1, 40, 0);
+  test.boolean("bandwidth exhausted", !queue.canSend(20, 1));
+  test.boolean("bandwidth refilled", queue.canSend(20, 2));
+  queue.setRateWindow(10);
+  test.boolean("getRate()", queue.getRate(5) == 4.0);
+  test.boolean("statistics", queue.getStatistics().tx_bytes == 40 && queue.getStatistics().tx_count == 1);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,187 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Coordinates.hpp>
+#include <DUNE/Math/Angles.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+using Coordinates::WGS84;
+
+//! Iterative ECEF to WGS-84 conversion used as reference.
+static void
+iterativeFromECEF(double x, double y, double z, double* lat, double* lon, double* hae)
+{
+  double p = std::sqrt(x * x + y * y);
+  *lon = std::atan2(y, x);
+  *lat = std::atan2(z / p, 0.01);
+  double sl = std::sin(*lat);
+  double n = Coordinates::c_wgs84_a / std::sqrt(1 - Coordinates::c_wgs84_e2 * sl * sl);
+  *hae = p / std::cos(*lat) - n;
+  double old_hae = -1e-9;
+
+  for (unsigned i = 0; i < 1000 && std::fabs(*hae - old_hae) > 1e-7; ++i)
+  {
+    old_hae = *hae;
+    *lat = std::atan2(z / p, 1 - Coordinates::c_wgs84_e2 * n / (n + *hae));
+    sl = std::sin(*lat);
+    n = Coordinates::c_wgs84_a / std::sqrt(1 - Coordinates::c_wgs84_e2 * sl * sl);
+    *hae = p / std::cos(*lat) - n;
+  }
+}
+
+int
+main(void)
+{
+  Test test("Coordinates::WGS84");
+
+  // Round trip over a grid of coordinates.
+  {
+    double lat_err = 0;
+    double hae_err = 0;
+    double ref_err = 0;
+
+    for (int lat = -89; lat <= 89; lat += 2)
+    {
+      for (int lon = -180; lon < 180; lon += 15)
+      {
+        double hs[] = {-5000.0, 0.0, 120.0, 10000.0, 400e3};
+        for (unsigned h = 0; h < sizeof(hs) / sizeof(hs[0]); ++h)
+        {
+          double x, y, z;
+          WGS84::toECEF(Math::Angles::radians(lat), Math::Angles::radians(lon), hs[h], &x, &y, &z);
+
+          double rlat, rlon, rhae;
+          WGS84::fromECEF(x, y, z, &rlat, &rlon, &rhae);
+          lat_err = std::max(lat_err, std::fabs(rlat - Math::Angles::radians(lat)));
+          hae_err = std::max(hae_err, std::fabs(rhae - hs[h]));
+
+          double ilat, ilon, ihae;
+          iterativeFromECEF(x, y, z, &ilat, &ilon, &ihae);
+          ref_err = std::max(ref_err, std::fabs(rhae - ihae));
+        }
+      }
+    }
+
+    test.boolean("closed-form latitude", lat_err < 1e-11);
+    test.boolean("closed-form height", hae_err < 1e-4);
+    test.boolean("closed-form matches iterative", ref_err < 1e-4);
+  }
+
+  // Poles.
+  {
+    double x, y, z;
+    WGS84::toECEF(Math::Angles::radians(90.0), 0.0, 100.0, &x, &y, &z);
+    double lat, lon, hae;
+    WGS84::fromECEF(0.0, 0.0, z, &lat, &lon, &hae);
+    test.boolean("north pole", std::fabs(lat - Math::Angles::radians(90.0)) < 1e-12
+                 && std::fabs(hae - 100.0) < 1e-4);
+    WGS84::fromECEF(0.0, 0.0, -z, &lat, &lon, &hae);
+    test.boolean("south pole", std::fabs(lat + Math::Angles::radians(90.0)) < 1e-12
+                 && std::fabs(hae - 100.0) < 1e-4);
+  }
+
+  // Displace and displacement.
+  {
+    double lat = Math::Angles::radians(41.18);
+    double lon = Math::Angles::radians(-8.70);
+    double hae = 50.0;
+    WGS84::displace(1000.0, -500.0, 10.0, &lat, &lon, &hae);
+
+    double n, e, d;
+    WGS84::displacement(Math::Angles::radians(41.18), Math::Angles::radians(-8.70), 50.0,
+                        lat, lon, hae, &n, &e, &d);
+    test.boolean("displace", std::fabs(n - 1000.0) < 5.0 && std::fabs(e + 500.0) < 5.0
+                 && std::fabs(d - 10.0) < 5.0);
+
+    double bearing, range;
+    WGS84::getNEBearingAndRange(0.0, 0.0, 0.0, Math::Angles::radians(0.01), &bearing, &range);
+    test.boolean("bearing and range", std::fabs(bearing - Math::Angles::radians(90.0)) < 1e-9
+                 && std::fabs(range - 1113.19) < 0.01);
+  }
+
+  // Tangent plane.
+  {
+    double rlat = Math::Angles::radians(38.5);
+    double rlon = Math::Angles::radians(-9.1);
+    Coordinates::TangentPlane frame(rlat, rlon, 20.0);
+
+    const unsigned c_count = 1000;
+    std::vector<double> lat(c_count), lon(c_count), hae(c_count);
+    for (unsigned i = 0; i < c_count; ++i)
+    {
+      lat[i] = rlat + (i % 37) * 1e-4 - 1.8e-3;
+      lon[i] = rlon + (i % 53) * 1e-4 - 2.6e-3;
+      hae[i] = (i % 11) * 3.0 - 15.0;
+    }
+
+    std::vector<double> n(c_count), e(c_count), d(c_count);
+    frame.toNED(&lat[0], &lon[0], &hae[0], c_count, &n[0], &e[0], &d[0]);
+
+    double ned_err = 0;
+    for (unsigned i = 0; i < c_count; ++i)
+    {
+      double sn, se, sd;
+      WGS84::displacement(rlat, rlon, 20.0, lat[i], lon[i], hae[i], &sn, &se, &sd);
+      ned_err = std::max(ned_err, std::fabs(sn - n[i]) + std::fabs(se - e[i]) + std::fabs(sd - d[i]));
+    }
+    test.boolean("tangent plane matches displacement", ned_err < 1e-6);
+
+    std::vector<double> blat(c_count), blon(c_count), bhae(c_count);
+    frame.toWGS84(&n[0], &e[0], &d[0], c_count, &blat[0], &blon[0], &bhae[0]);
+
+    double rt_err = 0;
+    double hae_err = 0;
+    for (unsigned i = 0; i < c_count; ++i)
+    {
+      rt_err = std::max(rt_err, std::fabs(blat[i] - lat[i]) + std::fabs(blon[i] - lon[i]));
+      hae_err = std::max(hae_err, std::fabs(bhae[i] - hae[i]));
+    }
+    test.boolean("tangent plane round trip", rt_err < 1e-11 && hae_err < 1e-4);
+
+    double slat, slon, shae;
+    frame.toWGS84(n[5], e[5], d[5], &slat, &slon, &shae);
+    test.boolean("single conversion matches batch",
+                 slat == blat[5] && slon == blon[5] && shae == bhae[5]);
+
+    double zn, ze, zd;
+    frame.toNED(rlat, rlon, 20.0, &zn, &ze, &zd);
+    test.boolean("reference is the origin",
+                 std::fabs(zn) < 1e-6 && std::fabs(ze) < 1e-6 && std::fabs(zd) < 1e-6);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,328 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Error reported by the server, the session remains usable.
+class ServerError: public std::runtime_error
+{
+public:
+  ServerError(const std::string& msg):
+    std::runtime_error(msg)
+  { }
+};
+
+//! Client of the Transports::LogSync server.
+class Client
+{
+public:
+  Client(const Address& addr, uint16_t port):
+    m_bytes(0)
+  {
+    m_sock.connect(addr, port);
+    m_sock.setNoDelay(true);
+    m_sock.setReceiveTimeout(30);
+    m_sock.setSendTimeout(30);
+  }
+
+  ~Client(void)
+  {
+    try
+    {
+      sendLine("QUIT");
+    }
+    catch (...)
+    { }
+  }
+
+  //! Send a request line.
+  void
+  sendLine(const std::string& line)
+  {
+    std::string text = line + "\n";
+    const char* data = text.c_str();
+    size_t size = text.size();
+    while (size > 0)
+    {
+      size_t rv = m_sock.write(data, size);
+      data += rv;
+      size -= rv;
+    }
+  }
+
+  //! Receive a reply line.
+  std::string
+  readLine(void)
+  {
+    while (true)
+    {
+      size_t pos = m_pending.find('\n');
+      if (pos != std::string::npos)
+      {
+        std::string line = m_pending.substr(0, pos);
+        m_pending.erase(0, pos + 1);
+        return line;
+      }
+
+      fill();
+    }
+  }
+
+  //! Receive a given amount of payload data.
+  void
+  readData(std::vector<uint8_t>& data, size_t size)
+  {
+    while (m_pending.size() < size)
+      fill();
+
+    data.assign(m_pending.begin(), m_pending.begin() + size);
+    m_pending.erase(0, size);
+  }
+
+  //! Receive an OK reply and its payload.
+  std::string
+  readPayload(void)
+  {
+    std::string line = readLine();
+    unsigned size = 0;
+    if (line.compare(0, 4, "ERR ") == 0)
+      throw ServerError(line.substr(4));
+    if (std::sscanf(line.c_str(), "OK %u", &size) != 1)
+      throw std::runtime_error(line);
+
+    std::vector<uint8_t> data;
+    readData(data, size);
+    return std::string(data.begin(), data.end());
+  }
+
+  //! Retrieve the number of bytes received.
+  uint64_t
+  getBytes(void) const
+  {
+    return m_bytes;
+  }
+
+private:
+  //! Server socket.
+  TCPSocket m_sock;
+  //! Received data not yet consumed.
+  std::string m_pending;
+  //! Number of bytes received.
+  uint64_t m_bytes;
+
+  void
+  fill(void)
+  {
+    if (!Poll::poll(m_sock, 30.0))
+      throw std::runtime_error("timeout waiting for server");
+
+    char bfr[65536];
+    size_t rv = m_sock.read(bfr, sizeof(bfr));
+    m_pending.append(bfr, rv);
+    m_bytes += rv;
+  }
+};
+
+//! Fetch a run of chunks and write them to a local file.
+static unsigned
+fetchRun(Client& client, const std::string& path, std::fstream& file,
+         unsigned first, unsigned count, unsigned chunk_size)
+{
+  client.sendLine(String::str("GET %u %u zlib %s", first, count, path.c_str()));
+
+  unsigned fetched = 0;
+  std::vector<uint8_t> encoded;
+  std::vector<uint8_t> raw(chunk_size);
+
+  while (true)
+  {
+    std::string line = client.readLine();
+    if (line == "END")
+      break;
+
+    if (line.compare(0, 4, "ERR ") == 0)
+      throw ServerError(line.substr(4));
+
+    unsigned index = 0;
+    unsigned size = 0;
+    unsigned long long hash = 0;
+    char enc[16] = {0};
+    unsigned length = 0;
+    if (std::sscanf(line.c_str(), "CHUNK %u %u %llx %15s %u",
+                    &index, &size, &hash, enc, &length) != 5 || size > chunk_size)
+      throw std::runtime_error(line);
+
+    client.readData(encoded, length);
+
+    const uint8_t* data = length ? &encoded[0] : NULL;
+    if (std::string(enc) == "zlib")
+    {
+      Compression::ZlibDecompressor zlib;
+      zlib.decompress((char*)&raw[0], raw.size(), (char*)&encoded[0], length);
+      if (zlib.decompressed() != size)
+        throw std::runtime_error("invalid compressed chunk");
+      data = &raw[0];
+    }
+    else if (length != size)
+    {
+      throw std::runtime_error("invalid chunk");
+    }
+
+    if (FileSystem::ChunkManifest::hash(data, size) != hash)
+      throw std::runtime_error("chunk hash mismatch");
+
+    file.seekp((int64_t)index * chunk_size);
+    file.write((const char*)data, size);
+    if (!file)
+      throw std::runtime_error("failed to write file");
+
+    ++fetched;
+  }
+
+  return fetched;
+}
+
+//! Synchronize one file.
+static void
+syncFile(Client& client, const std::string& path, const Path& dst)
+{
+  client.sendLine("MANIFEST " + path);
+  FileSystem::ChunkManifest remote;
+  if (!remote.parse(client.readPayload()))
+    throw std::runtime_error("invalid manifest");
+
+  FileSystem::ChunkManifest local(remote.getChunkSize());
+  if (dst.isFile())
+  {
+    local.compute(dst.str());
+
+    // Local copy is not a prefix of the remote file.
+    if (local.getSize() > remote.getSize())
+    {
+      dst.remove();
+      local.clear();
+    }
+  }
+
+  std::vector<unsigned> missing;
+  remote.getMissing(local, missing);
+  if (missing.empty())
+    return;
+
+  dst.dirname().create();
+  if (!dst.isFile())
+    std::ofstream(dst.c_str(), std::ios::binary);
+
+  std::fstream file(dst.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+  if (!file)
+    throw std::runtime_error("failed to open " + dst.str());
+
+  uint64_t before = client.getBytes();
+  unsigned fetched = 0;
+
+  // Request consecutive missing chunks together.
+  unsigned i = 0;
+  while (i < missing.size())
+  {
+    unsigned j = i + 1;
+    while (j < missing.size() && missing[j] == missing[j - 1] + 1 && j - i < 1024)
+      ++j;
+
+    fetched += fetchRun(client, path, file, missing[i], j - i, remote.getChunkSize());
+    i = j;
+  }
+
+  std::fprintf(stdout, "%s: %u/%u chunks, %llu bytes received\n", path.c_str(),
+               fetched, remote.getChunkCount(),
+               (unsigned long long)(client.getBytes() - before));
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 4)
+  {
+    std::fprintf(stderr, "Usage: %s <host> <port> <destination> [<prefix>]\n", argv[0]);
+    std::fprintf(stderr, "Download the logs of a vehicle, fetching only missing data.\n");
+    return 1;
+  }
+
+  Path destination(argv[3]);
+  std::string prefix = (argc > 4) ? argv[4] : "";
+
+  try
+  {
+    Client client(Address(argv[1]), std::atoi(argv[2]));
+
+    client.sendLine("LIST");
+    std::istringstream list(client.readPayload());
+
+    std::string line;
+    while (std::getline(list, line))
+    {
+      long long size = 0;
+      long long mtime = 0;
+      int offset = 0;
+      if (std::sscanf(line.c_str(), "%lld %lld %n", &size, &mtime, &offset) < 2)
+        continue;
+
+      std::string path = line.substr(offset);
+      if (path.compare(0, prefix.size(), prefix) != 0)
+        continue;
+
+      try
+      {
+        syncFile(client, path, destination / path);
+      }
+      catch (ServerError& e)
+      {
+        std::fprintf(stderr, "%s: %s\n", path.c_str(), e.what());
+      }
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::fprintf(stderr, "ERROR: %s\n", e.what());
+    return 1;
+  }
+
+  return 0;
+}
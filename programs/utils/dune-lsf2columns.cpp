@@ -0,0 +1,132 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+// Utility to export LSF files to columnar files.                           *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+using DUNE_NAMESPACES;
+
+//! Append selected messages to a column file.
+class Exporter: public IMC::LogReader::Handler
+{
+public:
+  Exporter(IMC::ColumnWriter& writer):
+    m_writer(writer),
+    m_errors(0)
+  { }
+
+  bool
+  onMessages(unsigned stream, std::vector<IMC::Message*>& msgs)
+  {
+    (void)stream;
+
+    for (unsigned i = 0; i < msgs.size(); ++i)
+      m_writer.write(msgs[i]);
+
+    return true;
+  }
+
+  void
+  onEnd(unsigned stream, const std::string& error)
+  {
+    (void)stream;
+
+    if (!error.empty())
+    {
+      std::cerr << "ERROR: " << error << std::endl;
+      ++m_errors;
+    }
+  }
+
+  unsigned
+  getErrors(void) const
+  {
+    return m_errors;
+  }
+
+private:
+  IMC::ColumnWriter& m_writer;
+  unsigned m_errors;
+};
+
+int
+main(int argc, char** argv)
+{
+  int first = 1;
+  bool compress = true;
+
+  if (argc > 1 && std::strcmp(argv[1], "-r") == 0)
+  {
+    compress = false;
+    ++first;
+  }
+
+  if (argc - first < 3)
+  {
+    std::cerr << "Usage: " << argv[0] << " [-r] <output> <Abbrev[.field],...> <Data.lsf[.gz]> ..." << std::endl
+              << "  -r  store raw (uncompressed) chunks" << std::endl;
+    return 1;
+  }
+
+  try
+  {
+    IMC::ColumnWriter writer(argv[first], compress);
+
+    std::vector<std::string> specs;
+    String::split(argv[first + 1], ",", specs);
+    for (unsigned i = 0; i < specs.size(); ++i)
+      writer.select(String::trim(specs[i]));
+
+    std::vector<uint16_t> selection = writer.getSelection();
+    std::set<uint16_t> ids(selection.begin(), selection.end());
+
+    IMC::LogReader reader;
+    reader.setMerge(true);
+    reader.setFilter(ids);
+    for (int i = first + 2; i < argc; ++i)
+      reader.add(argv[i]);
+
+    Exporter exporter(writer);
+    reader.run(exporter);
+    writer.close();
+
+    return exporter.getErrors() == 0 ? 0 : 1;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+}
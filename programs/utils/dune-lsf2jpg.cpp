@@ -37,48 +37,62 @@
 #include <DUNE/DUNE.hpp>
 using DUNE_NAMESPACES;
 
-int
-main(int argc, char** argv)
+//! Write compressed images to files.
+class ImageWriter: public IMC::LogReader::Handler
 {
-  if (argc != 2)
+public:
+  ImageWriter(const Path& folder):
+    m_folder(folder)
+  { }
+
+  bool
+  onMessages(unsigned stream, std::vector<IMC::Message*>& msgs)
   {
-    std::cerr << "Usage: " << argv[0] << " Data.lsf[.gz]" << std::endl;
-    return 1;
-  }
+    (void)stream;
 
-  std::istream* is = 0;
-  Compression::Methods method = Compression::Factory::detect(argv[1]);
-  if (method == METHOD_UNKNOWN)
-    is = new std::ifstream(argv[1], std::ios::binary);
-  else
-    is = new Compression::FileInput(argv[1], method);
+    for (unsigned i = 0; i < msgs.size(); ++i)
+    {
+      DUNE::IMC::CompressedImage* img = static_cast<DUNE::IMC::CompressedImage*>(msgs[i]);
 
-  DUNE::IMC::Message* msg = NULL;
+      Path fname = m_folder / String::str("%0.4f.jpg", img->getTimeStamp());
+      std::ofstream ofs(fname.c_str(), std::ios::binary);
+      ofs.write(&(img->data[0]), img->data.size());
+    }
 
-  Path folder = Path(argv[1]).dirname();
+    return true;
+  }
 
-  try
+  void
+  onEnd(unsigned stream, const std::string& error)
   {
-    while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
-    {
-      if (msg->getId() == DUNE_IMC_COMPRESSEDIMAGE)
-      {
-        DUNE::IMC::CompressedImage* img = static_cast<DUNE::IMC::CompressedImage*>(msg);
-
-        Path fname = folder / String::str("%0.4f.jpg", img->getTimeStamp());
-        std::ofstream ofs(fname.c_str(), std::ios::binary);
-        ofs.write(&(img->data[0]), img->data.size());
-      }
+    (void)stream;
 
-      delete msg;
-    }
+    if (!error.empty())
+      std::cerr << "ERROR: " << error << std::endl;
   }
-  catch (std::runtime_error& e)
+
+private:
+  Path m_folder;
+};
+
+int
+main(int argc, char** argv)
+{
+  if (argc != 2)
   {
-    std::cerr << "ERROR: " << e.what() << std::endl;
+    std::cerr << "Usage: " << argv[0] << " Data.lsf[.gz]" << std::endl;
+    return 1;
   }
 
-  delete is;
+  std::set<uint16_t> ids;
+  ids.insert(DUNE_IMC_COMPRESSEDIMAGE);
+
+  IMC::LogReader reader;
+  reader.setFilter(ids);
+  reader.add(argv[1]);
+
+  ImageWriter writer(Path(argv[1]).dirname());
+  reader.run(writer);
 
   return 0;
 }
@@ -55,6 +55,146 @@ usage(void)
             << "\t* plain LSF files\n";
 }
 
+//! Replay messages over UDP.
+class Replay: public IMC::LogReader::Handler
+{
+public:
+  double speed, begin, end;
+  std::map<std::string, bool> filter;
+  bool filtering;
+  int verbose;
+  uint16_t src, dst;
+
+  Replay(const Address& dest, uint16_t port):
+    speed(1),
+    begin(0),
+    end(-1),
+    filtering(false),
+    verbose(0),
+    src(0xFFFF),
+    dst(0xFFFF),
+    m_dest(dest),
+    m_port(port),
+    m_failed(false)
+  { }
+
+  void
+  onBegin(unsigned stream, const std::string& path)
+  {
+    (void)stream;
+    m_file = path;
+    m_empty = true;
+    m_started = false;
+  }
+
+  bool
+  onMessages(unsigned stream, std::vector<IMC::Message*>& msgs)
+  {
+    (void)stream;
+
+    if (m_failed)
+      return false;
+
+    for (unsigned i = 0; i < msgs.size(); ++i)
+    {
+      IMC::Message* m = msgs[i];
+
+      if (m_empty)
+      {
+        m_time_origin = m->getTimeStamp();
+        m_empty = false;
+      }
+
+      if (!m_started)
+      {
+        if (m->getTimeStamp() - m_time_origin < begin)
+          continue;
+
+        m_started = true;
+        m_start_time = Clock::getSinceEpoch();
+        m_now = m_start_time;
+      }
+
+      double msg_ts = m->getTimeStamp();
+      double vtime = msg_ts - m_time_origin;
+
+      m->setTimeStamp(m_start_time + vtime);
+
+      double future = 0;
+
+      if (speed > 0 && vtime >= begin)
+      {
+        // Delay time to mimic behavior at specified speed
+        future = m_start_time + vtime / speed - begin;
+        double delay_time = (future - m_now);
+        if (delay_time > 0)
+          Delay::wait(delay_time);
+      }
+      m_now = Clock::getSinceEpoch();
+
+      if (vtime >= begin
+          && (src == 0xFFFF || src == m->getSource())
+          && (dst == 0xFFFF || dst == m->getDestination())
+          && (!filtering || filter[m->getName()]))
+      {
+        // Send message
+        IMC::Packet::serialize(m, m_bb);
+        m_sock.write(m_bb.getBuffer(), m->getSerializationSize(), m_dest, m_port);
+        if (verbose >= 1)
+          std::cout << (begin + m_now - m_start_time) << ' ' << vtime << ' ' << m_now - future << " : " << m->getName() << '\n';
+        if (verbose >= 2)
+          m->toText(std::cout);
+      }
+
+      if (end >= 0 && vtime >= end)
+        return false;
+    }
+
+    return true;
+  }
+
+  void
+  onEnd(unsigned stream, const std::string& error)
+  {
+    (void)stream;
+
+    if (m_failed)
+      return;
+
+    if (!error.empty())
+      std::cerr << m_file << ": " << error << std::endl;
+
+    if (m_empty)
+    {
+      std::cerr << m_file << " contains no messages\n";
+    }
+    else if (!m_started)
+    {
+      std::cerr << "no messages for specified time range" << std::endl;
+      m_failed = true;
+    }
+  }
+
+  bool
+  failed(void) const
+  {
+    return m_failed;
+  }
+
+private:
+  UDPSocket m_sock;
+  Address m_dest;
+  uint16_t m_port;
+  DUNE::Utils::ByteBuffer m_bb;
+  std::string m_file;
+  bool m_empty;
+  bool m_started;
+  bool m_failed;
+  double m_time_origin;
+  double m_start_time;
+  double m_now;
+};
+
 int
 main(int argc, char** argv)
 {
@@ -181,25 +321,28 @@ main(int argc, char** argv)
     return 1;
   }
 
-  UDPSocket sock;
   Address dest(argv[0]);
   uint16_t port = std::atoi(argv[1]);
 
+  Replay replay(dest, port);
+  replay.speed = speed;
+  replay.begin = begin;
+  replay.end = end;
+  replay.filter = filter;
+  replay.filtering = filtering;
+  replay.verbose = verbose;
+  replay.src = src;
+  replay.dst = dst;
+
   argv += 2;
 
   std::cout << std::fixed << std::setprecision(4);
 
+  IMC::LogReader reader;
+
   for (; *argv != 0; argv++)
   {
-    Path file(*argv);
-    std::istream* is;
-
-    if (file.isDirectory())
-    {
-      file = file / "Data.lsf";
-      if (!file.isFile())
-        file += ".gz";
-    }
+    Path file(IMC::LogReader::resolve(*argv));
 
     if (!file.isFile())
     {
@@ -207,88 +350,10 @@ main(int argc, char** argv)
       return 1;
     }
 
-    Compression::Methods method = Compression::Factory::detect(file.c_str());
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(file.c_str(), std::ios::binary);
-    else
-      is = new Compression::FileInput(file.c_str(), method);
-
-    IMC::Message* m;
-
-    m = IMC::Packet::deserialize(*is);
-    if (!m)
-    {
-      std::cerr << file << " contains no messages\n";
-      delete is;
-      continue;
-    }
-
-    DUNE::Utils::ByteBuffer bb;
-
-    double time_origin = m->getTimeStamp();
-    if (begin >= 0)
-    {
-      do
-      {
-        if (m->getTimeStamp() - time_origin >= begin)
-          break;
-        delete m;
-        m = IMC::Packet::deserialize(*is);
-      }
-      while (m);
-
-      if (!m)
-      {
-        std::cerr << "no messages for specified time range" << std::endl;
-        return 1;
-      }
-    }
-    else
-      begin = 0;
-
-    double start_time = Clock::getSinceEpoch();
-    double now = start_time;
-
-    do
-    {
-      double msg_ts = m->getTimeStamp();
-      double vtime = msg_ts - time_origin;
-
-      m->setTimeStamp(start_time + vtime);
-
-      double future = 0;
-
-      if (speed > 0 && vtime >= begin)
-      {
-        // Delay time to mimic behavior at specified speed
-        future = start_time + vtime / speed - begin;
-        double delay_time = (future - now);
-        if (delay_time > 0)
-          Delay::wait(delay_time);
-      }
-      now = Clock::getSinceEpoch();
-
-      if (vtime >= begin
-          && (src == 0xFFFF || src == m->getSource())
-          && (dst == 0xFFFF || dst == m->getDestination())
-          && (!filtering || filter[m->getName()]))
-      {
-        // Send message
-        IMC::Packet::serialize(m, bb);
-        sock.write(bb.getBuffer(), m->getSerializationSize(), dest, port);
-        if (verbose >= 1)
-          std::cout << (begin + now - start_time) << ' ' << vtime << ' ' << now - future << " : " << m->getName() << '\n';
-        if (verbose >= 2)
-          m->toText(std::cout);
-      }
+    reader.add(file.str());
+  }
 
-      delete m;
+  reader.run(replay);
 
-      if (end >= 0 && vtime >= end)
-        break;
-    }
-    while ((m = IMC::Packet::deserialize(*is)) != 0);
-    delete is;
-  }
-  return 0;
+  return replay.failed() ? 1 : 0;
 }
@@ -132,21 +132,25 @@ namespace Control
 
           param("RPMs Feedforward Gain", m_args.rpm_ffgain)
           .defaultValue("0.5")
-          .description("RPM controller feedforward gain");
+          .description("RPM controller feedforward gain")
+          .callback(this, &Task::onGainsChanged);
 
           param("RPMs PID Gains", m_args.rpm_gains)
           .defaultValue("")
           .size(3)
-          .description("PID gains for RPM controller");
+          .description("PID gains for RPM controller")
+          .callback(this, &Task::onGainsChanged);
 
           param("MPS Feedforward Gain", m_args.mps_ffgain)
           .defaultValue("0.0")
-          .description("MPS controller feedforward gain");
+          .description("MPS controller feedforward gain")
+          .callback(this, &Task::onGainsChanged);
 
           param("MPS PID Gains", m_args.mps_gains)
           .defaultValue("")
           .size(3)
-          .description("PID gains for MPS controller");
+          .description("PID gains for MPS controller")
+          .callback(this, &Task::onGainsChanged);
 
           param("MPS Integral Limit", m_args.max_int_mps)
           .defaultValue("-1.0")
@@ -217,11 +221,7 @@ namespace Control
         void
         onUpdateParameters(void)
         {
-          if (paramChanged(m_args.rpm_gains) ||
-              paramChanged(m_args.mps_gains) ||
-              paramChanged(m_args.rpm_ffgain) ||
-              paramChanged(m_args.mps_ffgain) ||
-              paramChanged(m_args.max_int_mps) ||
+          if (paramChanged(m_args.max_int_mps) ||
               paramChanged(m_args.max_thrust) ||
               paramChanged(m_args.min_thrust) ||
               paramChanged(m_args.log_parcels))
@@ -232,6 +232,15 @@ namespace Control
           }
         }
 
+        //! Apply new controller gains without resetting the
+        //! controllers. Feedforward gains are used as they are.
+        void
+        onGainsChanged(void)
+        {
+          m_rpm_pid.setGains(m_args.rpm_gains);
+          m_mps_pid.setGains(m_args.mps_gains);
+        }
+
         //! Initialize PID related variables
         void
         initializePIDs(void)
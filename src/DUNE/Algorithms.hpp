@@ -44,5 +44,6 @@ namespace DUNE
 #include <DUNE/Algorithms/MD5.hpp>
 #include <DUNE/Algorithms/XORChecksum.hpp>
 #include <DUNE/Algorithms/UNESCO1983.hpp>
+#include <DUNE/Algorithms/XXHash.hpp>
 
 #endif
@@ -0,0 +1,56 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Algorithms/XXHash.hpp>
+
+// xxHash headers.
+#include <lz4/xxhash.h>
+
+namespace DUNE
+{
+  namespace Algorithms
+  {
+    //! Seed of the upper half of 64-bit hashes.
+    static const uint32_t c_seed_high = 0x9e3779b1;
+
+    uint32_t
+    XXHash::compute(const uint8_t* buffer, unsigned len, uint32_t seed)
+    {
+      return XXH32(buffer, (int)len, seed);
+    }
+
+    uint64_t
+    XXHash::compute64(const uint8_t* buffer, unsigned len)
+    {
+      uint64_t high = XXH32(buffer, (int)len, c_seed_high);
+      return (high << 32) | XXH32(buffer, (int)len, 0);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_ALGORITHMS_XXHASH_HPP_INCLUDED_
+#define DUNE_ALGORITHMS_XXHASH_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Algorithms
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM XXHash;
+
+    //! xxHash non-cryptographic hash function. Suitable to detect
+    //! changed or corrupted data, not to authenticate it.
+    class XXHash
+    {
+    public:
+      //! Compute the 32-bit xxHash of a given data buffer.
+      //! @param[in] buffer data buffer.
+      //! @param[in] len data buffer length.
+      //! @param[in] seed hash seed.
+      //! @return computed hash.
+      static uint32_t
+      compute(const uint8_t* buffer, unsigned len, uint32_t seed = 0);
+
+      //! Compute a 64-bit hash of a given data buffer by combining
+      //! two 32-bit xxHashes with different seeds.
+      //! @param[in] buffer data buffer.
+      //! @param[in] len data buffer length.
+      //! @return computed hash.
+      static uint64_t
+      compute64(const uint8_t* buffer, unsigned len);
+    };
+  }
+}
+
+#endif
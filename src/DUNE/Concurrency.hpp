@@ -40,6 +40,7 @@ namespace DUNE
 #include <DUNE/Concurrency/Exceptions.hpp>
 #include <DUNE/Concurrency/AtomicInteger.hpp>
 #include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/AtomicPointer.hpp>
 #include <DUNE/Concurrency/Mutex.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Concurrency/RWLock.hpp>
@@ -55,6 +56,7 @@ namespace DUNE
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Concurrency/Process.hpp>
 #include <DUNE/Concurrency/SharedMemory.hpp>
+#include <DUNE/Concurrency/SharedRing.hpp>
 #include <DUNE/Concurrency/Semaphore.hpp>
 
 #endif
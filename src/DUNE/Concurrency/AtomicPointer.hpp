@@ -0,0 +1,114 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_ATOMIC_POINTER_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_ATOMIC_POINTER_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+#if defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+#  define DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_ATOMIC
+#elif defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH)
+#  define DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_SYNC
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Pointer that can be published by one thread and read by others
+    //! without locking. Everything written to the pointed object
+    //! before store() is visible to threads that observe the pointer
+    //! with load().
+    template <typename T>
+    class AtomicPointer
+    {
+    public:
+      //! Constructor.
+      //! @param ptr initial value.
+      AtomicPointer(T* ptr = NULL):
+        m_ptr(ptr)
+      { }
+
+      //! Retrieve the pointer.
+      //! @return pointer.
+      inline T*
+      load(void) const
+      {
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_ATOMIC)
+        return __atomic_load_n(&m_ptr, __ATOMIC_ACQUIRE);
+#elif defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_SYNC)
+        T* ptr = m_ptr;
+        __sync_synchronize();
+        return ptr;
+#else
+        ScopedMutex l(m_lock);
+        return m_ptr;
+#endif
+      }
+
+      //! Publish a pointer.
+      //! @param ptr pointer.
+      inline void
+      store(T* ptr)
+      {
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_ATOMIC)
+        __atomic_store_n(&m_ptr, ptr, __ATOMIC_RELEASE);
+#elif defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_SYNC)
+        __sync_synchronize();
+        m_ptr = ptr;
+#else
+        ScopedMutex l(m_lock);
+        m_ptr = ptr;
+#endif
+      }
+
+    private:
+      //! Pointer.
+      T* volatile m_ptr;
+
+#if !defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_ATOMIC) && !defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC_SYNC)
+      //! Lock used when there are no atomic primitives.
+      mutable Mutex m_lock;
+#endif
+
+      //! Non-copyable.
+      AtomicPointer(const AtomicPointer&);
+
+      //! Non-assignable.
+      AtomicPointer&
+      operator=(const AtomicPointer&);
+    };
+  }
+}
+
+#endif
@@ -133,10 +133,12 @@ namespace DUNE
       if (fd == -1)
         throw System::Error(errno, "failed to open shared memory area");
 
-      if (ftruncate(fd, m_size) == -1)
+      // Do not resize an area owned by another process.
+      struct stat st;
+      if (fstat(fd, &st) == -1 || st.st_size < (off_t)m_size)
       {
         ::close(fd);
-        throw System::Error(errno, "failed to initialize shared memory area");
+        throw System::Error(EINVAL, "shared memory area is smaller than requested");
       }
 
       m_ptr = mmap(0, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
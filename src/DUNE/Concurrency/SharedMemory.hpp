@@ -63,6 +63,15 @@ namespace DUNE
       void
       open(void);
 
+      //! Keep the memory area when this instance is destroyed,
+      //! even if it was the creator. Used when another instance has
+      //! since replaced the area with one of the same name.
+      void
+      disown(void)
+      {
+        m_creator = false;
+      }
+
       //! Get name of memory area.
       //! @return memory area's name.
       const char*
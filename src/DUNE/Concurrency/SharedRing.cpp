@@ -0,0 +1,390 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+#include <DUNE/Concurrency/ScopedRWLock.hpp>
+#include <DUNE/Concurrency/SharedRing.hpp>
+
+#if defined(DUNE_OS_LINUX)
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#  include <linux/futex.h>
+#  include <ctime>
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Value identifying an initialized ring.
+    static const uint32_t c_magic = 0x52494d43;
+    //! Value identifying a ring replaced by a newer one.
+    static const uint32_t c_retired = 0x52455452;
+    //! Time after which a reserved but uncommitted frame is skipped.
+    static const double c_stall_timeout = 1.0;
+    //! Polling period when futexes are not available.
+    static const double c_poll_period = 0.001;
+
+    //! Ring header, at the start of the shared memory area.
+    struct SharedRing::Header
+    {
+      //! Magic value, written last by the creator and changed to
+      //! c_retired when the ring is replaced.
+      volatile uint32_t magic;
+      //! Number of slots.
+      uint32_t slots;
+      //! Maximum size of a frame.
+      uint32_t slot_size;
+      //! Number of readers waiting for frames.
+      volatile int32_t waiters;
+      //! Sequence number of next frame to reserve.
+      volatile uint64_t head;
+      //! Incremented every time a frame is committed (futex word).
+      volatile int32_t signal;
+      //! Generation, incremented every time the ring is created again.
+      uint32_t generation;
+    };
+
+    //! Slot header, followed by frame data. The sequence field is
+    //! odd while the frame is being written and is 2 * (n + 1) once
+    //! frame n is committed.
+    struct SharedRing::Slot
+    {
+      //! Slot sequence.
+      volatile uint64_t seq;
+      //! Frame size.
+      uint32_t size;
+      //! Identifier of the writer.
+      uint32_t origin;
+    };
+
+    //! Round a size up to a multiple of 8 bytes.
+    static unsigned
+    align(unsigned size)
+    {
+      return (size + 7) & ~7U;
+    }
+
+    SharedRing::SharedRing(const char* name, unsigned slots, unsigned slot_size):
+      m_name(name),
+      m_shm(NULL),
+      m_slots(slots),
+      m_slot_size(slot_size),
+      m_stride(align(sizeof(Slot) + slot_size)),
+      m_hdr(NULL),
+      m_next(0),
+      m_dropped(0),
+      m_generation(0)
+    { }
+
+    SharedRing::~SharedRing(void)
+    {
+      if (m_shm == NULL)
+        return;
+
+      // Do not remove the ring that replaced ours.
+      if (m_hdr != NULL && m_hdr->magic != c_magic)
+        m_shm->disown();
+
+      delete m_shm;
+    }
+
+    unsigned
+    SharedRing::getAreaSize(unsigned slots, unsigned slot_size)
+    {
+      return align(sizeof(Header)) + slots * align(sizeof(Slot) + slot_size);
+    }
+
+    void
+    SharedRing::create(void)
+    {
+      ScopedRWLock l(m_lock, true);
+      uint32_t generation = 0;
+
+      // Retire the ring left by a previous creator, so that instances
+      // still attached to it move to the new one.
+      try
+      {
+        SharedMemory old(m_name.c_str(), sizeof(Header));
+        old.open();
+        Header* hdr = static_cast<Header*>(*old);
+
+        if (hdr->magic == c_magic || hdr->magic == c_retired)
+          generation = hdr->generation + 1;
+
+        if (hdr->magic == c_magic)
+        {
+          hdr->magic = c_retired;
+          __sync_synchronize();
+          wake(hdr);
+        }
+      }
+      catch (std::exception&)
+      { }
+
+      delete m_shm;
+      m_hdr = NULL;
+      m_shm = new SharedMemory(m_name.c_str(), getAreaSize(m_slots, m_slot_size));
+      m_shm->create();
+
+      m_hdr = static_cast<Header*>(**m_shm);
+      std::memset(m_hdr, 0, getAreaSize(m_slots, m_slot_size));
+      m_hdr->slots = m_slots;
+      m_hdr->slot_size = m_slot_size;
+      m_hdr->generation = generation;
+      __sync_synchronize();
+      m_hdr->magic = c_magic;
+      m_next = 0;
+      m_generation = generation;
+    }
+
+    void
+    SharedRing::open(void)
+    {
+      ScopedRWLock l(m_lock, true);
+      attach();
+    }
+
+    void
+    SharedRing::attach(void)
+    {
+      SharedMemory* shm = new SharedMemory(m_name.c_str(), getAreaSize(m_slots, m_slot_size));
+
+      try
+      {
+        shm->open();
+      }
+      catch (...)
+      {
+        delete shm;
+        throw;
+      }
+
+      Header* hdr = static_cast<Header*>(**shm);
+      __sync_synchronize();
+
+      if (hdr->magic == c_retired)
+      {
+        delete shm;
+        throw System::Error(EAGAIN, "shared ring is being replaced");
+      }
+
+      if (hdr->magic != c_magic || hdr->slots != m_slots || hdr->slot_size != m_slot_size)
+      {
+        delete shm;
+        throw System::Error(EINVAL, "shared ring has a different geometry");
+      }
+
+      // The previous area, if any, was retired: never remove the
+      // one that replaced it.
+      if (m_shm != NULL)
+      {
+        m_shm->disown();
+        delete m_shm;
+      }
+
+      m_shm = shm;
+      m_hdr = hdr;
+      m_next = m_hdr->head;
+      m_generation = m_hdr->generation;
+    }
+
+    void
+    SharedRing::wake(Header* hdr)
+    {
+      __sync_add_and_fetch(&hdr->signal, 1);
+
+#if defined(DUNE_OS_LINUX)
+      if (hdr->waiters > 0)
+        syscall(SYS_futex, &hdr->signal, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+    }
+
+    SharedRing::Slot*
+    SharedRing::getSlot(uint64_t seq)
+    {
+      uint8_t* base = reinterpret_cast<uint8_t*>(m_hdr) + align(sizeof(Header));
+      return reinterpret_cast<Slot*>(base + (seq % m_slots) * m_stride);
+    }
+
+    bool
+    SharedRing::write(const uint8_t* data, unsigned size, uint32_t origin)
+    {
+      if (size > m_slot_size)
+        return false;
+
+      ScopedRWLock l(m_lock);
+      if (m_hdr->magic != c_magic)
+        return false;
+
+      uint64_t seq = __sync_fetch_and_add(&m_hdr->head, 1);
+      Slot* slot = getSlot(seq);
+
+      slot->seq = 2 * seq + 1;
+      __sync_synchronize();
+      slot->size = size;
+      slot->origin = origin;
+      std::memcpy(reinterpret_cast<uint8_t*>(slot) + sizeof(Slot), data, size);
+      __sync_synchronize();
+      slot->seq = 2 * (seq + 1);
+      wake(m_hdr);
+
+      return true;
+    }
+
+    void
+    SharedRing::wait(int32_t signal, double timeout)
+    {
+#if defined(DUNE_OS_LINUX)
+      struct timespec ts;
+      ts.tv_sec = (time_t)timeout;
+      ts.tv_nsec = (long)((timeout - ts.tv_sec) * 1e9);
+
+      __sync_add_and_fetch(&m_hdr->waiters, 1);
+      syscall(SYS_futex, &m_hdr->signal, FUTEX_WAIT, signal, &ts, NULL, 0);
+      __sync_sub_and_fetch(&m_hdr->waiters, 1);
+#else
+      (void)signal;
+      Time::Delay::wait(std::min(timeout, c_poll_period));
+#endif
+    }
+
+    unsigned
+    SharedRing::read(uint8_t* data, uint32_t& origin, double timeout)
+    {
+      bool retired = false;
+      {
+        ScopedRWLock l(m_lock);
+        retired = m_hdr->magic != c_magic;
+      }
+
+      if (retired)
+      {
+        ScopedRWLock l(m_lock, true);
+        attach();
+
+        // Frames written to the new ring before we noticed are still
+        // due to this reader.
+        m_next = (m_next > m_slots) ? m_next - m_slots : 0;
+      }
+
+      ScopedRWLock l(m_lock);
+      double now = Time::Clock::get();
+      double deadline = now + timeout;
+      double stall = -1.0;
+
+      while (true)
+      {
+        if (m_hdr->magic != c_magic)
+          return 0;
+
+        // Read the signal before the slot so that commits made after
+        // the check are not missed while waiting.
+        int32_t signal = m_hdr->signal;
+        __sync_synchronize();
+
+        Slot* slot = getSlot(m_next);
+        uint64_t committed = 2 * (m_next + 1);
+        uint64_t seq = slot->seq;
+
+        if (seq == committed)
+        {
+          __sync_synchronize();
+          unsigned size = slot->size;
+          origin = slot->origin;
+          if (size > m_slot_size)
+            size = 0;
+          std::memcpy(data, reinterpret_cast<uint8_t*>(slot) + sizeof(Slot), size);
+          __sync_synchronize();
+
+          // Frame was overwritten while being copied.
+          if (slot->seq != committed)
+            continue;
+
+          ++m_next;
+          if (size > 0)
+            return size;
+          continue;
+        }
+
+        uint64_t head = m_hdr->head;
+
+        // This reader was lapped: skip to the oldest frame still available.
+        if (seq > committed || head > m_next + m_slots)
+        {
+          uint64_t oldest = (head > m_slots) ? head - m_slots : 0;
+          if (oldest > m_next)
+          {
+            m_dropped += oldest - m_next;
+            m_next = oldest;
+          }
+          else
+          {
+            ++m_dropped;
+            ++m_next;
+          }
+          continue;
+        }
+
+        now = Time::Clock::get();
+
+        // A writer reserved this slot but has not committed it.
+        if (head > m_next)
+        {
+          if (stall < 0)
+          {
+            stall = now + c_stall_timeout;
+          }
+          else if (now >= stall)
+          {
+            ++m_dropped;
+            ++m_next;
+            stall = -1.0;
+            continue;
+          }
+        }
+
+        if (now >= deadline)
+          return 0;
+
+        wait(signal, std::min(deadline - now, c_stall_timeout));
+      }
+    }
+  }
+}
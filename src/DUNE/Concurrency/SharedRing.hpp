@@ -0,0 +1,186 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_SHARED_RING_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_SHARED_RING_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/RWLock.hpp>
+#include <DUNE/Concurrency/SharedMemory.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM SharedRing;
+
+    //! Ring of frames in a shared memory area, used to exchange data
+    //! between processes. Any number of processes may write frames
+    //! concurrently without locks; every attached instance reads all
+    //! frames in the order their slots were reserved. Writers never
+    //! wait for readers: a reader that falls more than one ring behind
+    //! skips the overwritten frames and accounts them as dropped.
+    //! Blocked readers are woken with futexes on Linux. When a ring
+    //! is created again under the same name (e.g., after its creator
+    //! restarts) the previous one is retired and attached instances
+    //! move to the new one.
+    class SharedRing
+    {
+    public:
+      //! Constructor.
+      //! @param[in] name name of the shared memory area.
+      //! @param[in] slots number of frames buffered by the ring.
+      //! @param[in] slot_size maximum size of a frame.
+      SharedRing(const char* name, unsigned slots, unsigned slot_size);
+
+      //! Destructor.
+      ~SharedRing(void);
+
+      //! Create the ring. A previous ring with the same name is
+      //! retired and replaced by one with the next generation.
+      void
+      create(void);
+
+      //! Attach to a ring created by another instance. Only frames
+      //! written after this call are read.
+      //! @throw System::Error if the ring does not exist or has a
+      //! different geometry.
+      void
+      open(void);
+
+      //! Write a frame.
+      //! @param[in] data frame data.
+      //! @param[in] size frame size.
+      //! @param[in] origin identifier of the writer.
+      //! @return true if the frame was written, false if it is
+      //! larger than the slot size or the ring was retired.
+      bool
+      write(const uint8_t* data, unsigned size, uint32_t origin);
+
+      //! Read the next frame. If the ring was retired this instance
+      //! attaches to the ring that replaced it.
+      //! @throw System::Error if the ring was retired and there is
+      //! no valid replacement.
+      //! @param[out] data destination buffer (at least slot size).
+      //! @param[out] origin identifier of the writer.
+      //! @param[in] timeout maximum amount of time to wait (s).
+      //! @return frame size or 0 if no frame was read.
+      unsigned
+      read(uint8_t* data, uint32_t& origin, double timeout);
+
+      //! Retrieve the maximum size of a frame.
+      //! @return slot size.
+      unsigned
+      getSlotSize(void) const
+      {
+        return m_slot_size;
+      }
+
+      //! Retrieve the generation of the ring, incremented every time
+      //! the ring is created again.
+      //! @return generation.
+      uint32_t
+      getGeneration(void) const
+      {
+        return m_generation;
+      }
+
+      //! Retrieve the number of frames this reader has lost.
+      //! @return number of dropped frames.
+      uint64_t
+      getDropped(void) const
+      {
+        return m_dropped;
+      }
+
+    private:
+      struct Header;
+      struct Slot;
+
+      //! Name of the shared memory area.
+      std::string m_name;
+      //! Shared memory area.
+      SharedMemory* m_shm;
+      //! Lock protecting the mapping of the area.
+      RWLock m_lock;
+      //! Number of slots.
+      unsigned m_slots;
+      //! Maximum size of a frame.
+      unsigned m_slot_size;
+      //! Distance between slots (bytes).
+      unsigned m_stride;
+      //! Ring header.
+      Header* m_hdr;
+      //! Sequence number of next frame to read.
+      uint64_t m_next;
+      //! Number of dropped frames.
+      uint64_t m_dropped;
+      //! Generation of the attached ring.
+      uint32_t m_generation;
+
+      //! Map the ring currently registered under the ring's name.
+      //! The caller must hold the write lock.
+      //! @throw System::Error if the ring does not exist or has a
+      //! different geometry.
+      void
+      attach(void);
+
+      //! Retrieve the slot of a given sequence number.
+      //! @param[in] seq sequence number.
+      //! @return slot.
+      Slot*
+      getSlot(uint64_t seq);
+
+      //! Signal a change of a ring to waiting readers.
+      //! @param[in] hdr ring header.
+      static void
+      wake(Header* hdr);
+
+      //! Wait for the ring to change.
+      //! @param[in] signal last observed signal value.
+      //! @param[in] timeout maximum amount of time to wait (s).
+      void
+      wait(int32_t signal, double timeout);
+
+      //! Compute the size of the shared memory area.
+      //! @param[in] slots number of slots.
+      //! @param[in] slot_size maximum size of a frame.
+      //! @return size in bytes.
+      static unsigned
+      getAreaSize(unsigned slots, unsigned slot_size);
+    };
+  }
+}
+
+#endif
@@ -151,6 +151,20 @@ namespace DUNE
 #endif
     }
 
+    bool
+    Thread::isCurrent(void)
+    {
+#if defined(DUNE_SYS_HAS_PTHREAD)
+      Runnable::State state = getStateImpl();
+      if (state != StateRunning && state != StateStopping)
+        return false;
+
+      return pthread_equal(pthread_self(), m_handle) != 0;
+#else
+      return false;
+#endif
+    }
+
     void
     Thread::stopImpl(void)
     {
@@ -74,6 +74,11 @@ namespace DUNE
       int
       getProcessorUsage(void);
 
+      //! Test if this is the calling thread.
+      //! @return true if called from this thread, false otherwise.
+      bool
+      isCurrent(void);
+
     protected:
       void
       startImpl(void);
@@ -0,0 +1,143 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Coordinates/TangentPlane.hpp>
+#include <DUNE/Coordinates/WGS84.hpp>
+
+namespace DUNE
+{
+  namespace Coordinates
+  {
+    //! Number of coordinates converted per block in batched
+    //! conversions.
+    static const size_t c_block = 64;
+
+    TangentPlane::TangentPlane(void)
+    {
+      setReference(0.0, 0.0, 0.0);
+    }
+
+    TangentPlane::TangentPlane(double lat, double lon, double hae)
+    {
+      setReference(lat, lon, hae);
+    }
+
+    void
+    TangentPlane::setReference(double lat, double lon, double hae)
+    {
+      m_lat = lat;
+      m_lon = lon;
+      m_hae = hae;
+
+      WGS84::toECEF(lat, lon, hae, &m_ecef[0], &m_ecef[1], &m_ecef[2]);
+
+      double slat = std::sin(lat);
+      double clat = std::cos(lat);
+      double slon = std::sin(lon);
+      double clon = std::cos(lon);
+
+      // North.
+      m_rot[0] = -slat * clon;
+      m_rot[1] = -slat * slon;
+      m_rot[2] = clat;
+      // East.
+      m_rot[3] = -slon;
+      m_rot[4] = clon;
+      m_rot[5] = 0.0;
+      // Down.
+      m_rot[6] = -clat * clon;
+      m_rot[7] = -clat * slon;
+      m_rot[8] = -slat;
+    }
+
+    void
+    TangentPlane::toNED(double lat, double lon, double hae, double* n, double* e, double* d) const
+    {
+      toNED(&lat, &lon, &hae, 1, n, e, d);
+    }
+
+    void
+    TangentPlane::toWGS84(double n, double e, double d, double* lat, double* lon, double* hae) const
+    {
+      toWGS84(&n, &e, &d, 1, lat, lon, hae);
+    }
+
+    void
+    TangentPlane::toNED(const double* lat, const double* lon, const double* hae, size_t count,
+                        double* n, double* e, double* d) const
+    {
+      // Offsets are converted in place: n, e and d hold the ECEF
+      // coordinates first.
+      WGS84::toECEF(lat, lon, hae, count, n, e, d);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        double ox = n[i] - m_ecef[0];
+        double oy = e[i] - m_ecef[1];
+        double oz = d[i] - m_ecef[2];
+
+        n[i] = m_rot[0] * ox + m_rot[1] * oy + m_rot[2] * oz;
+        e[i] = m_rot[3] * ox + m_rot[4] * oy;
+        d[i] = m_rot[6] * ox + m_rot[7] * oy + m_rot[8] * oz;
+      }
+    }
+
+    void
+    TangentPlane::toWGS84(const double* n, const double* e, const double* d, size_t count,
+                          double* lat, double* lon, double* hae) const
+    {
+      double x[c_block];
+      double y[c_block];
+      double z[c_block];
+
+      for (size_t base = 0; base < count; base += c_block)
+      {
+        size_t size = count - base < c_block ? count - base : c_block;
+
+        // The transpose of the rotation brings offsets back to ECEF.
+        for (size_t i = 0; i < size; ++i)
+        {
+          double vn = n[base + i];
+          double ve = e[base + i];
+          double vd = d[base + i];
+
+          x[i] = m_ecef[0] + m_rot[0] * vn + m_rot[3] * ve + m_rot[6] * vd;
+          y[i] = m_ecef[1] + m_rot[1] * vn + m_rot[4] * ve + m_rot[7] * vd;
+          z[i] = m_ecef[2] + m_rot[2] * vn + m_rot[8] * vd;
+        }
+
+        WGS84::fromECEF(x, y, z, size, lat + base, lon + base, hae + base);
+      }
+    }
+  }
+}
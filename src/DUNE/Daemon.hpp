@@ -95,6 +95,10 @@ namespace DUNE
     uint64_t m_fs_capacity;
     //! Periodic counter.
     Time::Counter<double> m_periodic_counter;
+    //! Maximum time to wait for all tasks before reporting boot.
+    Time::Counter<double> m_boot_counter;
+    //! True if the boot timeline was already reported.
+    bool m_boot_reported;
     //! Save configuration file name.
     std::string m_scfg_file;
     //! Saved configuration parameters.
@@ -109,6 +113,9 @@ namespace DUNE
     void
     measureCpuUsage(void);
 
+    void
+    checkBoot(void);
+
     void
     dispatchPeriodic(void);
   };
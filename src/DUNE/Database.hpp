@@ -40,4 +40,6 @@ namespace DUNE
 #include <DUNE/Database/General.hpp>
 #include <DUNE/Database/Connection.hpp>
 #include <DUNE/Database/Statement.hpp>
+#include <DUNE/Database/Transaction.hpp>
+#include <DUNE/Database/Queue.hpp>
 #endif
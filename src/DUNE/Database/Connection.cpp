@@ -76,6 +76,14 @@ namespace DUNE
         throw e;
       }
 
+      if ((flags & CF_WAL) && !(flags & CF_RDONLY))
+      {
+        execute("pragma journal_mode=WAL");
+        // In WAL mode the database cannot be corrupted without full
+        // synchronization, only the last commits can be lost.
+        execute("pragma synchronous=NORMAL");
+      }
+
       m_tbegin_stmt = new Statement("begin transaction", *this);
       m_tcommit_stmt = new Statement("commit", *this);
       m_trollback_stmt = new Statement("rollback", *this);
@@ -85,6 +93,10 @@ namespace DUNE
     {
       if (m_handle)
       {
+        std::map<std::string, Statement*>::iterator itr = m_cache.begin();
+        for (; itr != m_cache.end(); ++itr)
+          delete itr->second;
+
         delete m_tbegin_stmt;
         delete m_tcommit_stmt;
         delete m_trollback_stmt;
@@ -108,6 +120,21 @@ namespace DUNE
         *count = sqlite3_changes(m_handle);
     }
 
+    Statement&
+    Connection::prepare(const std::string& sql_stmt)
+    {
+      std::map<std::string, Statement*>::iterator itr = m_cache.find(sql_stmt);
+      if (itr != m_cache.end())
+      {
+        itr->second->reset();
+        return *itr->second;
+      }
+
+      Statement* stmt = new Statement(sql_stmt.c_str(), *this);
+      m_cache[sql_stmt] = stmt;
+      return *stmt;
+    }
+
     const char*
     Connection::lastError(void)
     {
@@ -30,6 +30,10 @@
 #ifndef DUNE_DATABASE_CONNECTION_HPP_INCLUDED_
 #define DUNE_DATABASE_CONNECTION_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
@@ -58,7 +62,9 @@ namespace DUNE
         //! Open read-only connection.
         CF_RDONLY = 1 << 0,
         //! Create database if it does not exist.
-        CF_CREATE = 1 << 1
+        CF_CREATE = 1 << 1,
+        //! Use write-ahead logging (ignored for read-only connections).
+        CF_WAL = 1 << 2
       };
 
       //! Constructs a memory-only database.
@@ -81,6 +87,14 @@ namespace DUNE
       void
       execute(const char* sql_stmt, int* count = 0);
 
+      //! Get a prepared statement from the connection's statement
+      //! cache, preparing it on first use. The statement is reset
+      //! and owned by the connection.
+      //! @param sql_stmt SQL statement.
+      //! @return prepared statement.
+      Statement&
+      prepare(const std::string& sql_stmt);
+
       //! Begin transaction.
       void
       beginTransaction(void);
@@ -112,6 +126,8 @@ namespace DUNE
       Statement* m_tbegin_stmt;
       Statement* m_tcommit_stmt;
       Statement* m_trollback_stmt;
+      //! Prepared statements by SQL text.
+      std::map<std::string, Statement*> m_cache;
 
       void
       open(const char* path, int flags);
@@ -0,0 +1,193 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Database/General.hpp>
+#include <DUNE/Database/Queue.hpp>
+#include <DUNE/Database/Transaction.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Database
+  {
+    Queue::Queue(Connection& conn):
+      m_conn(conn),
+      m_ticket(0),
+      m_busy(0),
+      m_commits(0)
+    { }
+
+    Queue::~Queue(void)
+    {
+      if (isCreated() && !isDead())
+        stopAndJoin();
+
+      while (!m_pending.empty())
+      {
+        delete m_pending.front().second;
+        m_pending.pop_front();
+      }
+    }
+
+    unsigned
+    Queue::push(Operation* op)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_pending.push_back(Entry(++m_ticket, op));
+      m_cond.broadcast();
+      return m_ticket;
+    }
+
+    bool
+    Queue::flush(double timeout)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      double deadline = Time::Clock::get() + timeout;
+      while (!m_pending.empty() || m_busy != 0)
+      {
+        if (timeout < 0)
+        {
+          m_cond.wait();
+          continue;
+        }
+
+        double remaining = deadline - Time::Clock::get();
+        if (remaining <= 0 || !m_cond.wait(remaining))
+          return m_pending.empty() && m_busy == 0;
+      }
+
+      return true;
+    }
+
+    bool
+    Queue::popError(std::string& error, unsigned* ticket)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (m_errors.empty())
+        return false;
+
+      if (ticket != NULL)
+        *ticket = m_errors.front().first;
+      error = m_errors.front().second;
+      m_errors.pop_front();
+      return true;
+    }
+
+    unsigned
+    Queue::getCommitCount(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_commits;
+    }
+
+    void
+    Queue::stopImpl(void)
+    {
+      Concurrency::Thread::stopImpl();
+
+      Concurrency::ScopedCondition l(m_cond);
+      m_cond.broadcast();
+    }
+
+    bool
+    Queue::execute(const std::vector<Entry>& batch, size_t first, size_t last)
+    {
+      try
+      {
+        Transaction transaction(m_conn);
+        for (size_t i = first; i < last; ++i)
+          batch[i].second->execute(m_conn);
+        transaction.commit();
+      }
+      catch (std::exception& e)
+      {
+        // A single operation is not retried, keep its error.
+        if (last - first == 1)
+        {
+          Concurrency::ScopedCondition l(m_cond);
+          m_errors.push_back(std::make_pair(batch[first].first, std::string(e.what())));
+        }
+
+        return false;
+      }
+
+      Concurrency::ScopedCondition l(m_cond);
+      ++m_commits;
+      return true;
+    }
+
+    void
+    Queue::run(void)
+    {
+      std::vector<Entry> batch;
+
+      while (!isStopping())
+      {
+        {
+          Concurrency::ScopedCondition l(m_cond);
+
+          while (m_pending.empty() && !isStopping())
+            m_cond.wait();
+
+          while (!m_pending.empty() && batch.size() < c_batch_size)
+          {
+            batch.push_back(m_pending.front());
+            m_pending.pop_front();
+          }
+
+          m_busy = batch.size();
+        }
+
+        if (batch.empty())
+          continue;
+
+        if (!execute(batch, 0, batch.size()) && batch.size() > 1)
+        {
+          for (size_t i = 0; i < batch.size(); ++i)
+            execute(batch, i, i + 1);
+        }
+
+        for (size_t i = 0; i < batch.size(); ++i)
+          delete batch[i].second;
+        batch.clear();
+
+        Concurrency::ScopedCondition l(m_cond);
+        m_busy = 0;
+        m_cond.broadcast();
+      }
+    }
+  }
+}
@@ -0,0 +1,149 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_DATABASE_QUEUE_HPP_INCLUDED_
+#define DUNE_DATABASE_QUEUE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Database/Connection.hpp>
+
+namespace DUNE
+{
+  namespace Database
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Queue;
+
+    //! Asynchronous write queue. Operations are executed in order
+    //! by a dedicated thread that owns the connection while it is
+    //! running. Operations queued while a commit is in progress are
+    //! grouped in a single transaction. If a batch fails it is
+    //! rolled back and its operations are retried one per
+    //! transaction, so that only the failing ones are lost.
+    class Queue: public Concurrency::Thread
+    {
+    public:
+      //! Maximum number of operations per transaction.
+      static const unsigned c_batch_size = 256;
+
+      //! Queued operation.
+      class Operation
+      {
+      public:
+        virtual
+        ~Operation(void)
+        { }
+
+        //! Execute the operation. Errors must be reported by
+        //! throwing an exception.
+        //! @param conn database connection.
+        virtual void
+        execute(Connection& conn) = 0;
+      };
+
+      //! Constructor.
+      //! @param conn database connection.
+      Queue(Connection& conn);
+
+      //! Destructor. Pending operations are discarded.
+      ~Queue(void);
+
+      //! Queue an operation.
+      //! @param op operation, owned by the queue from now on.
+      //! @return ticket identifying the operation in errors.
+      unsigned
+      push(Operation* op);
+
+      //! Wait until all queued operations are executed. The caller
+      //! may then use the connection until the next push().
+      //! @param timeout maximum amount of time to wait (s), negative
+      //! to wait forever.
+      //! @return true if the queue is empty, false on timeout.
+      bool
+      flush(double timeout = -1.0);
+
+      //! Get the next error reported by a failed operation.
+      //! @param error error description.
+      //! @param ticket if not NULL, ticket of the failed operation.
+      //! @return true if an error was available.
+      bool
+      popError(std::string& error, unsigned* ticket = NULL);
+
+      //! Get the number of committed transactions.
+      //! @return number of commits.
+      unsigned
+      getCommitCount(void);
+
+    private:
+      //! Operation and its ticket.
+      typedef std::pair<unsigned, Operation*> Entry;
+
+      //! Database connection.
+      Connection& m_conn;
+      //! Pending operations.
+      std::deque<Entry> m_pending;
+      //! Ticket of the last queued operation.
+      unsigned m_ticket;
+      //! Number of operations being executed.
+      unsigned m_busy;
+      //! Errors of failed operations, with their tickets.
+      std::deque<std::pair<unsigned, std::string> > m_errors;
+      //! Number of committed transactions.
+      unsigned m_commits;
+      //! Lock and signal for the above.
+      Concurrency::Condition m_cond;
+
+      void
+      run(void);
+
+      void
+      stopImpl(void);
+
+      //! Execute operations in a single transaction.
+      //! @param batch operations.
+      //! @param first index of the first operation.
+      //! @param last index past the last operation.
+      //! @return true on success, false if rolled back.
+      bool
+      execute(const std::vector<Entry>& batch, size_t first, size_t last);
+    };
+  }
+}
+
+#endif
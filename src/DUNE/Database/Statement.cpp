@@ -89,7 +89,12 @@ namespace DUNE
         case SQLITE_ROW:
           return true;
         default:
-          throwError();
+          {
+            // Leave the statement ready to be executed again.
+            Error e(m_conn.lastError());
+            sqlite3_reset(m_handle);
+            throw e;
+          }
       }
       return false;
     }
@@ -72,7 +72,8 @@ namespace DUNE
       //! When it returns true, the results can be obtained
       //! using operator>>() in order of the column results.
       //! When it returns false, reset() will have been called internally,
-      //! so there is no need to call it subsequently.
+      //! so there is no need to call it subsequently. The same holds
+      //! when it throws an Error.
       //! @param count for INSERT, UPDATE or DELETE statements, may return
       //! the number of rows affected by the operation
       //! @return true if there are more rows to process.
@@ -0,0 +1,73 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Database/General.hpp>
+#include <DUNE/Database/Transaction.hpp>
+
+namespace DUNE
+{
+  namespace Database
+  {
+    Transaction::Transaction(Connection& conn):
+      m_conn(conn),
+      m_active(false)
+    {
+      m_conn.beginTransaction();
+      m_active = true;
+    }
+
+    Transaction::~Transaction(void)
+    {
+      if (!m_active)
+        return;
+
+      try
+      {
+        m_conn.rollback();
+      }
+      catch (...)
+      { }
+    }
+
+    void
+    Transaction::commit(void)
+    {
+      m_conn.commit();
+      m_active = false;
+    }
+
+    void
+    Transaction::rollback(void)
+    {
+      m_active = false;
+      m_conn.rollback();
+    }
+  }
+}
@@ -0,0 +1,80 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_DATABASE_TRANSACTION_HPP_INCLUDED_
+#define DUNE_DATABASE_TRANSACTION_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Database/Connection.hpp>
+
+namespace DUNE
+{
+  namespace Database
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Transaction;
+
+    //! Scoped transaction. The transaction begins on construction
+    //! and is rolled back on destruction unless it was committed,
+    //! so several operations can be grouped in a single commit and
+    //! are undone together if any of them throws.
+    class Transaction
+    {
+    public:
+      //! Begin a transaction.
+      //! @param conn database connection.
+      Transaction(Connection& conn);
+
+      //! Destructor. Rolls back the transaction if still active.
+      ~Transaction(void);
+
+      //! Commit the transaction.
+      void
+      commit(void);
+
+      //! Rollback the transaction.
+      void
+      rollback(void);
+
+    private:
+      //! Database connection.
+      Connection& m_conn;
+      //! True if the transaction is still active.
+      bool m_active;
+
+      Transaction(const Transaction&);
+
+      Transaction&
+      operator=(const Transaction&);
+    };
+  }
+}
+
+#endif
@@ -33,8 +33,10 @@
 // ISO C++ 98 headers.
 #include <stdexcept>
 #include <map>
+#include <vector>
 
 // DUNE headers.
+#include <DUNE/Concurrency/AtomicPointer.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Utils/String.hpp>
 
@@ -99,31 +101,26 @@ namespace DUNE
       {
         Concurrency::ScopedMutex l(m_lock);
 
-        EntitiesById::iterator itr = m_by_id.begin();
-        for (; itr != m_by_id.end(); ++itr)
-          delete itr->second;
+        for (unsigned i = 0; i < m_next_id; ++i)
+          delete m_by_id[i].load();
       }
 
       //! Determine if an entity identified by a given label exists in the database.
       //! @param[in] name entity label to use.
       //! @return true if an entity with the provided label exists in the database, false otherwise.
       bool
-      labelExists(const std::string& name)
+      labelExists(const std::string& name) const
       {
-        Concurrency::ScopedMutex l(m_lock);
-        EntitiesByLabel::iterator itr = m_by_label.find(name);
-        return (itr != m_by_label.end());
+        return findLabel(name) != NULL;
       }
 
       //! Determine if an entity identified by a given numeric id exists in the database.
       //! @param[in] id numeric id to use.
       //! @return true if an entity with the provided id exists in the database, false otherwise.
       bool
-      idExists(unsigned int id)
+      idExists(unsigned int id) const
       {
-        Concurrency::ScopedMutex l(m_lock);
-        EntitiesById::iterator itr = m_by_id.find(id);
-        return (itr != m_by_id.end());
+        return findId(id) != NULL;
       }
 
       //! Add an entity to the database, identified by a unique label, and retrieve the reserved numerical id.
@@ -137,18 +134,27 @@ namespace DUNE
           throw InvalidLabel();
 
         Concurrency::ScopedMutex l(m_lock);
-        EntitiesByLabel::iterator itr = m_by_label.find(label);
 
-        if (itr != m_by_label.end())
+        if (findLabel(label) != NULL)
           throw ReservedUnique(label);
 
+        if (m_next_id >= c_max_entities)
+          throw InvalidId(m_next_id);
+
         unsigned int id = m_next_id++;
         Entity* entry = new Entity;
         entry->label = label;
         entry->id = id;
         entry->task_name = task_name;
-        m_by_id[id] = entry;
-        m_by_label[label] = entry;
+
+        // Publish the entry. Writers are serialized by m_lock and
+        // readers only ever see fully built entries.
+        m_by_id[id].store(entry);
+
+        unsigned slot = hash(label);
+        while (m_by_label[slot].load() != NULL)
+          slot = (slot + 1) & (c_label_slots - 1);
+        m_by_label[slot].store(entry);
 
         return id;
       }
@@ -157,87 +163,146 @@ namespace DUNE
       //! The NonexistentLabel exception is thrown if there is no matching entity in the database.
       //! @return numerical entity id.
       unsigned int
-      resolve(const std::string& label)
+      resolve(const std::string& label) const
       {
-        Concurrency::ScopedMutex l(m_lock);
-
-        EntitiesByLabel::iterator itr = m_by_label.find(label);
+        const Entity* entry = findLabel(label);
 
-        if (itr == m_by_label.end())
+        if (entry == NULL)
           throw NonexistentLabel(label);
 
-        return itr->second->id;
+        return entry->id;
       }
 
       //! Get the task name for the entity identified by the given label
       //! The NonexistentLabel exception is thrown if there is no matching entity in the database.
       //! @return task name.
       std::string
-      resolveTaskName(const std::string& label)
+      resolveTaskName(const std::string& label) const
       {
-        Concurrency::ScopedMutex l(m_lock);
-
-        EntitiesByLabel::iterator itr = m_by_label.find(label);
+        const Entity* entry = findLabel(label);
 
-        if (itr == m_by_label.end())
+        if (entry == NULL)
           throw NonexistentLabel(label);
 
-        return itr->second->task_name;
+        return entry->task_name;
       }
 
       //! Get the label for the entity identified by the given numeric id.
       //! The InvalidId exception is thrown if there is no matching entity in the database.
       //! @return entity label.
       const std::string&
-      resolve(unsigned int id)
+      resolve(unsigned int id) const
       {
-        Concurrency::ScopedMutex l(m_lock);
-
-        EntitiesById::iterator itr = m_by_id.find(id);
+        const Entity* entry = findId(id);
 
-        if (itr == m_by_id.end())
+        if (entry == NULL)
           throw InvalidId(id);
 
-        return itr->second->label;
+        return entry->label;
       }
 
       //! Fill a vector with pointers to the existing Entity records.
       //! @param[out] devs vector to be filled.
       void
-      contents(std::vector<Entity*>& devs)
+      contents(std::vector<Entity*>& devs) const
       {
-        Concurrency::ScopedMutex l(m_lock);
-
-        for (EntitiesById::iterator itr = m_by_id.begin(); itr != m_by_id.end(); ++itr)
-          devs.push_back(itr->second);
+        for (unsigned i = 0; i < c_max_entities; ++i)
+        {
+          Entity* entry = m_by_id[i].load();
+          if (entry == NULL)
+            break;
+
+          devs.push_back(entry);
+        }
       }
 
       //! Produce a map between the existing numeric entity ids and the entity labels.
       //! @return the produced map.
       std::map<unsigned, std::string>
-      entries(void)
+      entries(void) const
       {
         std::map<unsigned, std::string> ent;
 
-        Concurrency::ScopedMutex l(m_lock);
+        for (unsigned i = 0; i < c_max_entities; ++i)
+        {
+          const Entity* entry = m_by_id[i].load();
+          if (entry == NULL)
+            break;
 
-        for (EntitiesById::iterator itr = m_by_id.begin(); itr != m_by_id.end(); ++itr)
-          ent[itr->first] = itr->second->label;
+          ent[entry->id] = entry->label;
+        }
 
         return ent;
       }
 
     private:
-      //! Mutex for accessing the database.
+      //! Maximum number of entities (entity ids are 8-bit).
+      static const unsigned c_max_entities = 256;
+      //! Number of label slots, twice the maximum number of entities
+      //! to keep probe sequences short.
+      static const unsigned c_label_slots = 512;
+
+      //! Mutex serializing reservations.
       Concurrency::Mutex m_lock;
       //! Next vacant numeric id.
       unsigned int m_next_id;
-      //! Mapping between numeric id's and Entity records.
-      typedef std::map<unsigned, Entity*> EntitiesById;
-      EntitiesById m_by_id;
-      //! Mapping between labels and Entity records.
-      typedef std::map<std::string, Entity*> EntitiesByLabel;
-      EntitiesByLabel m_by_label;
+      //! Entity records indexed by numeric id. Slots are filled in
+      //! order and never cleared.
+      Concurrency::AtomicPointer<Entity> m_by_id[c_max_entities];
+      //! Open addressing hash table of entity records by label.
+      //! Entries are only ever added, so lookups never need a lock.
+      Concurrency::AtomicPointer<Entity> m_by_label[c_label_slots];
+
+      //! Compute the label slot of a label (FNV-1a).
+      //! @param[in] label entity label.
+      //! @return label slot.
+      static unsigned
+      hash(const std::string& label)
+      {
+        uint32_t h = 2166136261U;
+        for (unsigned i = 0; i < label.size(); ++i)
+        {
+          h ^= (uint8_t)label[i];
+          h *= 16777619U;
+        }
+
+        return h & (c_label_slots - 1);
+      }
+
+      //! Find an entity record by label.
+      //! @param[in] label entity label.
+      //! @return entity record or NULL if it does not exist.
+      const Entity*
+      findLabel(const std::string& label) const
+      {
+        unsigned slot = hash(label);
+
+        for (unsigned i = 0; i < c_label_slots; ++i)
+        {
+          const Entity* entry = m_by_label[slot].load();
+          if (entry == NULL)
+            return NULL;
+
+          if (entry->label == label)
+            return entry;
+
+          slot = (slot + 1) & (c_label_slots - 1);
+        }
+
+        return NULL;
+      }
+
+      //! Find an entity record by numeric id.
+      //! @param[in] id numeric id.
+      //! @return entity record or NULL if it does not exist.
+      const Entity*
+      findId(unsigned int id) const
+      {
+        if (id >= c_max_entities)
+          return NULL;
+
+        return m_by_id[id].load();
+      }
     };
   }
 }
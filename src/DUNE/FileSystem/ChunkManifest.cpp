@@ -0,0 +1,170 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// DUNE headers.
+#include <DUNE/Algorithms/XXHash.hpp>
+#include <DUNE/FileSystem/ChunkManifest.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace FileSystem
+  {
+    ChunkManifest::ChunkManifest(unsigned chunk_size):
+      m_chunk_size(chunk_size == 0 ? 1 : chunk_size),
+      m_size(0)
+    { }
+
+    void
+    ChunkManifest::clear(void)
+    {
+      m_size = 0;
+      m_hashes.clear();
+    }
+
+    void
+    ChunkManifest::compute(const std::string& path)
+    {
+      clear();
+
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      if (!ifs)
+        throw FileReadError(path);
+
+      std::vector<uint8_t> bfr(m_chunk_size);
+      while (true)
+      {
+        ifs.read((char*)&bfr[0], m_chunk_size);
+        unsigned count = ifs.gcount();
+        if (count == 0)
+          break;
+
+        m_hashes.push_back(hash(&bfr[0], count));
+        m_size += count;
+
+        if (count < m_chunk_size)
+          break;
+      }
+
+      if (ifs.bad())
+        throw FileReadError(path);
+    }
+
+    uint64_t
+    ChunkManifest::hash(const uint8_t* data, unsigned size)
+    {
+      return Algorithms::XXHash::compute64(data, size);
+    }
+
+    unsigned
+    ChunkManifest::getChunkLength(unsigned index) const
+    {
+      int64_t remaining = m_size - getChunkOffset(index);
+      if (remaining <= 0)
+        return 0;
+
+      if (remaining < m_chunk_size)
+        return (unsigned)remaining;
+
+      return m_chunk_size;
+    }
+
+    void
+    ChunkManifest::getMissing(const ChunkManifest& other, std::vector<unsigned>& chunks) const
+    {
+      chunks.clear();
+
+      bool comparable = (other.m_chunk_size == m_chunk_size);
+      for (unsigned i = 0; i < m_hashes.size(); ++i)
+      {
+        if (comparable && i < other.m_hashes.size()
+            && other.m_hashes[i] == m_hashes[i]
+            && other.getChunkLength(i) == getChunkLength(i))
+          continue;
+
+        chunks.push_back(i);
+      }
+    }
+
+    std::string
+    ChunkManifest::serialize(void) const
+    {
+      std::ostringstream os;
+      os << m_size << ' ' << m_chunk_size << ' ' << m_hashes.size() << '\n';
+
+      char bfr[32];
+      for (unsigned i = 0; i < m_hashes.size(); ++i)
+      {
+        std::sprintf(bfr, "%016llx\n", (unsigned long long)m_hashes[i]);
+        os << bfr;
+      }
+
+      return os.str();
+    }
+
+    bool
+    ChunkManifest::parse(const std::string& text)
+    {
+      clear();
+
+      std::istringstream is(text);
+      int64_t size = 0;
+      unsigned chunk_size = 0;
+      unsigned count = 0;
+      if (!(is >> size >> chunk_size >> count) || chunk_size == 0 || size < 0)
+        return false;
+
+      // Chunk count must match file size.
+      if ((int64_t)count != (size + chunk_size - 1) / chunk_size)
+        return false;
+
+      std::vector<uint64_t> hashes(count);
+      for (unsigned i = 0; i < count; ++i)
+      {
+        std::string word;
+        unsigned long long value = 0;
+        if (!(is >> word) || word.size() != 16
+            || std::sscanf(word.c_str(), "%llx", &value) != 1)
+          return false;
+
+        hashes[i] = value;
+      }
+
+      m_size = size;
+      m_chunk_size = chunk_size;
+      m_hashes.swap(hashes);
+      return true;
+    }
+  }
+}
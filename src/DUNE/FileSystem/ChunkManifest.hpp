@@ -0,0 +1,161 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_FILE_SYSTEM_CHUNK_MANIFEST_HPP_INCLUDED_
+#define DUNE_FILE_SYSTEM_CHUNK_MANIFEST_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace FileSystem
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ChunkManifest;
+
+    //! Description of the contents of a file as a sequence of
+    //! fixed-size chunks identified by their hashes. Comparing the
+    //! manifests of two copies of a file yields the chunks that must
+    //! be transferred to make them equal.
+    class ChunkManifest
+    {
+    public:
+      //! Constructor.
+      //! @param[in] chunk_size chunk size.
+      ChunkManifest(unsigned chunk_size = 256 * 1024);
+
+      //! Forget all chunks.
+      void
+      clear(void);
+
+      //! Hash the contents of a file.
+      //! @param[in] path file path.
+      //! @throw FileReadError if the file cannot be read.
+      void
+      compute(const std::string& path);
+
+      //! Hash a chunk of data.
+      //! @param[in] data chunk data.
+      //! @param[in] size chunk size.
+      //! @return chunk hash.
+      static uint64_t
+      hash(const uint8_t* data, unsigned size);
+
+      //! Retrieve the size of the file.
+      //! @return file size.
+      int64_t
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Retrieve the chunk size.
+      //! @return chunk size.
+      unsigned
+      getChunkSize(void) const
+      {
+        return m_chunk_size;
+      }
+
+      //! Retrieve the number of chunks.
+      //! @return number of chunks.
+      unsigned
+      getChunkCount(void) const
+      {
+        return m_hashes.size();
+      }
+
+      //! Retrieve the hash of a chunk.
+      //! @param[in] index chunk index.
+      //! @return chunk hash.
+      uint64_t
+      getHash(unsigned index) const
+      {
+        return m_hashes[index];
+      }
+
+      //! Retrieve the offset of a chunk in the file.
+      //! @param[in] index chunk index.
+      //! @return chunk offset.
+      int64_t
+      getChunkOffset(unsigned index) const
+      {
+        return (int64_t)index * m_chunk_size;
+      }
+
+      //! Retrieve the size of a chunk; only the last chunk may be
+      //! shorter than the chunk size.
+      //! @param[in] index chunk index.
+      //! @return chunk size.
+      unsigned
+      getChunkLength(unsigned index) const;
+
+      //! Find the chunks of this manifest that differ from, or are
+      //! absent in, another copy of the file.
+      //! @param[in] other manifest of the other copy.
+      //! @param[out] chunks indexes of differing chunks.
+      void
+      getMissing(const ChunkManifest& other, std::vector<unsigned>& chunks) const;
+
+      //! Convert to a textual representation.
+      //! @return manifest text.
+      std::string
+      serialize(void) const;
+
+      //! Load from a textual representation.
+      //! @param[in] text manifest text.
+      //! @return true if the text is a valid manifest, false otherwise.
+      bool
+      parse(const std::string& text);
+
+      bool
+      operator==(const ChunkManifest& other) const
+      {
+        return m_size == other.m_size
+        && m_chunk_size == other.m_chunk_size
+        && m_hashes == other.m_hashes;
+      }
+
+    private:
+      //! Chunk size.
+      unsigned m_chunk_size;
+      //! File size.
+      int64_t m_size;
+      //! Chunk hashes.
+      std::vector<uint64_t> m_hashes;
+    };
+  }
+}
+
+#endif
@@ -27,117 +27,96 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-#ifndef SENSORS_EDGETECH_2205_LOG_HPP_INCLUDED_
-#define SENSORS_EDGETECH_2205_LOG_HPP_INCLUDED_
-
 // ISO C++ 98 headers.
-#include <queue>
 #include <fstream>
 
 // DUNE headers.
-#include <DUNE/DUNE.hpp>
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
 
-// Local headers.
-#include "Packet.hpp"
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
 
-namespace Sensors
+#if defined(DUNE_SYS_HAS_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+namespace DUNE
 {
-  namespace Edgetech2205
+  namespace FileSystem
   {
-    using DUNE_NAMESPACES;
-
-    class Log: public Concurrency::Thread
+    MappedFile::MappedFile(const std::string& path):
+      m_data(NULL),
+      m_size(0),
+      m_mapped(false)
     {
-    public:
-      Log(Tasks::Task* parent, const Path& path, size_t buffer_count = 10):
-        m_parent(parent)
-      {
-        for (size_t i = 0; i < buffer_count; ++i)
-          m_clean.push(new Packet());
-
-        m_stream.open(path.c_str(), std::ofstream::app | std::ios::binary);
-        m_path = path;
-      }
+#if defined(DUNE_SYS_HAS_MMAP)
+      int fd = open(path.c_str(), O_RDONLY);
+      if (fd == -1)
+        throw FileReadError(path);
 
-      ~Log(void)
+      struct stat st;
+      if (fstat(fd, &st) == -1)
       {
-        processDirtyQueue();
-        m_stream.close();
-        clearCleanQueue();
+        close(fd);
+        throw FileReadError(path);
       }
 
-      Path
-      getPath(void)
+      m_size = st.st_size;
+      if (m_size > 0)
       {
-        return m_path;
-      }
+        void* ptr = mmap(NULL, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED)
+        {
+          close(fd);
+          throw FileReadError(path);
+        }
 
-      void
-      put(Packet* packet)
-      {
-        m_dirty.push(packet);
+        m_data = (const uint8_t*)ptr;
+        m_mapped = true;
       }
 
-      Packet*
-      get(void)
-      {
-        Packet* packet = m_clean.pop();
-        if (packet == NULL)
-          packet = new Packet();
+      // The mapping remains valid after the descriptor is closed.
+      close(fd);
 
-        return packet;
-      }
+#else
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      if (!ifs)
+        throw FileReadError(path);
 
-    private:
-      //! Parent task.
-      Tasks::Task* m_parent;
-      //! Dirty packet queue.
-      Concurrency::TSQueue<Packet*> m_dirty;
-      //! Clean packet queue.
-      Concurrency::TSQueue<Packet*> m_clean;
-      //! Log path.
-      Path m_path;
-      //! Log output stream.
-      std::ofstream m_stream;
-
-      void
-      processDirtyQueue(void)
-      {
-        while (!m_dirty.empty())
-        {
-          Packet* packet = m_dirty.pop();
-          if (packet != NULL)
-          {
-            m_stream.write((const char*)packet->getData(), packet->getSize());
-            m_clean.push(packet);
-          }
-        }
-      }
+      ifs.seekg(0, std::ios::end);
+      m_copy.resize((size_t)ifs.tellg());
+      ifs.seekg(0, std::ios::beg);
 
-      void
-      clearCleanQueue(void)
+      if (!m_copy.empty())
       {
-        while (!m_clean.empty())
-        {
-          Packet* packet = m_clean.pop();
-          if (packet != NULL)
-            delete packet;
-        }
-      }
+        ifs.read((char*)&m_copy[0], m_copy.size());
+        if ((size_t)ifs.gcount() != m_copy.size())
+          throw FileReadError(path);
 
-      void
-      run(void)
-      {
-        while (isRunning())
-        {
-          if (m_dirty.waitForItems(1.0))
-          {
-            processDirtyQueue();
-          }
-        }
+        m_data = &m_copy[0];
       }
-    };
-  }
-}
 
+      m_size = m_copy.size();
+#endif
+    }
+
+    MappedFile::~MappedFile(void)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_mapped)
+        munmap((void*)m_data, m_size);
 #endif
+    }
+  }
+}
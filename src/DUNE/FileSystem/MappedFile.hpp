@@ -0,0 +1,97 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_FILE_SYSTEM_MAPPED_FILE_HPP_INCLUDED_
+#define DUNE_FILE_SYSTEM_MAPPED_FILE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace FileSystem
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MappedFile;
+
+    //! Read-only view of the contents of a file. The file is mapped
+    //! in memory where supported and read into memory otherwise.
+    class MappedFile
+    {
+    public:
+      //! Map a file.
+      //! @param path file path.
+      //! @throw FileReadError if the file cannot be read.
+      MappedFile(const std::string& path);
+
+      //! Unmap the file.
+      ~MappedFile(void);
+
+      //! Retrieve the contents of the file.
+      //! @return pointer to the first byte, NULL if the file is empty.
+      const uint8_t*
+      getData(void) const
+      {
+        return m_data;
+      }
+
+      //! Retrieve the size of the file.
+      //! @return size in bytes.
+      size_t
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+    private:
+      //! File contents.
+      const uint8_t* m_data;
+      //! File size.
+      size_t m_size;
+      //! True if the contents are mapped.
+      bool m_mapped;
+      //! Contents, if the file could not be mapped.
+      std::vector<uint8_t> m_copy;
+
+      //! Non-copyable.
+      MappedFile(const MappedFile&);
+
+      //! Non-assignable.
+      MappedFile&
+      operator=(const MappedFile&);
+    };
+  }
+}
+
+#endif
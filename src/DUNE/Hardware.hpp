@@ -47,6 +47,8 @@ namespace DUNE
 #include <DUNE/Hardware/BasicModem.hpp>
 #include <DUNE/Hardware/HayesModem.hpp>
 #include <DUNE/Hardware/BasicDeviceDriver.hpp>
+#include <DUNE/Hardware/PayloadLog.hpp>
+#include <DUNE/Hardware/Decimator.hpp>
 #include <DUNE/Hardware/Exceptions.hpp>
 #include <DUNE/Hardware/UCTK/Constants.hpp>
 #include <DUNE/Hardware/UCTK/Errors.hpp>
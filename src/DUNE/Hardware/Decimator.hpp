@@ -0,0 +1,129 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_HARDWARE_DECIMATOR_HPP_INCLUDED_
+#define DUNE_HARDWARE_DECIMATOR_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Hardware
+  {
+    //! Selects which samples of a high-rate payload are published.
+    //! A sample passes if it is one in every N samples and at least
+    //! 1/R seconds have elapsed since the last sample that passed.
+    class Decimator
+    {
+    public:
+      //! Constructor.
+      //! @param[in] divisor publish one in every divisor samples.
+      //! @param[in] rate maximum publishing rate (Hz), 0 for unlimited.
+      Decimator(unsigned divisor = 1, double rate = 0.0):
+        m_divisor(1),
+        m_period(0.0)
+      {
+        setDivisor(divisor);
+        setMaximumRate(rate);
+        reset();
+      }
+
+      //! Set the sample divisor.
+      //! @param[in] divisor publish one in every divisor samples.
+      void
+      setDivisor(unsigned divisor)
+      {
+        m_divisor = (divisor == 0) ? 1 : divisor;
+      }
+
+      //! Set the maximum publishing rate.
+      //! @param[in] rate rate (Hz), 0 for unlimited.
+      void
+      setMaximumRate(double rate)
+      {
+        m_period = (rate > 0) ? 1.0 / rate : 0.0;
+      }
+
+      //! Forget previous samples; the next sample passes.
+      void
+      reset(void)
+      {
+        m_count = 0;
+        m_last = -1.0;
+        m_skipped = 0;
+      }
+
+      //! Account a new sample.
+      //! @param[in] now sample time (s).
+      //! @return true if the sample should be published.
+      bool
+      check(double now)
+      {
+        if (m_count++ % m_divisor != 0)
+        {
+          ++m_skipped;
+          return false;
+        }
+
+        if (m_last >= 0 && m_period > 0 && now - m_last < m_period)
+        {
+          ++m_skipped;
+          return false;
+        }
+
+        m_last = now;
+        return true;
+      }
+
+      //! Retrieve the number of samples not published since the
+      //! last reset.
+      //! @return number of samples.
+      uint64_t
+      getSkipped(void) const
+      {
+        return m_skipped;
+      }
+
+    private:
+      //! Sample divisor.
+      unsigned m_divisor;
+      //! Minimum time between published samples.
+      double m_period;
+      //! Number of samples.
+      uint64_t m_count;
+      //! Time of last published sample.
+      double m_last;
+      //! Number of samples not published.
+      uint64_t m_skipped;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,421 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Hardware/PayloadLog.hpp>
+
+#if defined(DUNE_OS_POSIX)
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#endif
+
+namespace DUNE
+{
+  namespace Hardware
+  {
+    //! Alignment of disk writes and of the block buffer.
+    static const unsigned c_alignment = 4096;
+    //! Amount of file space preallocated at once, in blocks.
+    static const unsigned c_extent_blocks = 64;
+
+    PayloadLog::PayloadLog(unsigned slots, unsigned slot_size,
+                           unsigned block_size, double flush_period):
+      m_slot_count(1),
+      m_slot_size(slot_size),
+      m_head(0),
+      m_tail(0),
+      m_waiting(0),
+      m_dropped(0),
+      m_written(0),
+      m_errors(0),
+      m_block_fill(0),
+      m_block_synced(0),
+      m_offset(0),
+      m_allocated(0),
+      m_flush_period(flush_period),
+      m_flush_time(0)
+#if defined(DUNE_OS_POSIX)
+      , m_fd(-1),
+      m_direct(false)
+#else
+      , m_file(NULL)
+#endif
+    {
+      // Slot indexes are derived from free-running counters, the
+      // number of slots must divide their range.
+      while (m_slot_count < slots)
+        m_slot_count <<= 1;
+
+      m_slots.resize(m_slot_count);
+      m_slot_data.resize((size_t)m_slot_count * m_slot_size);
+
+      m_block_size = std::max(block_size, c_alignment);
+      m_block_size = (m_block_size + c_alignment - 1) / c_alignment * c_alignment;
+      m_block_storage = new uint8_t[m_block_size + c_alignment];
+      uintptr_t addr = (uintptr_t)m_block_storage;
+      m_block = m_block_storage + (c_alignment - addr % c_alignment) % c_alignment;
+    }
+
+    PayloadLog::~PayloadLog(void)
+    {
+      closeFile();
+      delete [] m_block_storage;
+    }
+
+    bool
+    PayloadLog::open(const std::string& path)
+    {
+      return push(ST_OPEN, (const uint8_t*)path.c_str(), path.size());
+    }
+
+    bool
+    PayloadLog::close(void)
+    {
+      return push(ST_CLOSE, NULL, 0);
+    }
+
+    bool
+    PayloadLog::write(const uint8_t* data, unsigned size)
+    {
+      if (push(ST_DATA, data, size))
+        return true;
+
+      ++m_dropped;
+      return false;
+    }
+
+    bool
+    PayloadLog::push(SlotType type, const uint8_t* data, unsigned size)
+    {
+      if (size > m_slot_size)
+        return false;
+
+      if (m_head - m_tail >= m_slot_count)
+        return false;
+
+      unsigned index = m_head & (m_slot_count - 1);
+      if (size > 0)
+        std::memcpy(&m_slot_data[(size_t)index * m_slot_size], data, size);
+      m_slots[index].type = type;
+      m_slots[index].size = size;
+
+      // Publish slot contents before the new head.
+      __sync_synchronize();
+      m_head = m_head + 1;
+      __sync_synchronize();
+
+      if (m_waiting)
+      {
+        m_cond.lock();
+        m_cond.signal();
+        m_cond.unlock();
+      }
+
+      return true;
+    }
+
+    void
+    PayloadLog::process(const Slot& slot, const uint8_t* data)
+    {
+      switch (slot.type)
+      {
+        case ST_DATA:
+          if (!m_path.empty())
+            append(data, slot.size);
+          break;
+
+        case ST_OPEN:
+          openFile(std::string((const char*)data, slot.size));
+          break;
+
+        case ST_CLOSE:
+          closeFile();
+          break;
+      }
+    }
+
+    void
+    PayloadLog::openFile(const std::string& path)
+    {
+      closeFile();
+
+      m_path = path;
+      m_offset = 0;
+      m_allocated = 0;
+      m_block_fill = 0;
+      m_block_synced = 0;
+      m_flush_time = Time::Clock::get();
+
+#if defined(DUNE_OS_POSIX)
+      m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT, 0644);
+      if (m_fd == -1)
+      {
+        ++m_errors;
+        return;
+      }
+
+      struct stat st;
+      if (fstat(m_fd, &st) == 0)
+        m_offset = st.st_size;
+
+      m_direct = false;
+
+#  if defined(O_DIRECT)
+      // Direct writes must start at an aligned offset: load the
+      // trailing partial block of existing files into the buffer.
+      unsigned tail = m_offset % c_alignment;
+      if (tail > 0)
+      {
+        int rfd = ::open(path.c_str(), O_RDONLY);
+        if (rfd != -1)
+        {
+          if (pread(rfd, m_block, tail, m_offset - tail) == (ssize_t)tail)
+          {
+            m_offset -= tail;
+            m_block_fill = tail;
+            m_block_synced = tail;
+          }
+
+          ::close(rfd);
+        }
+      }
+
+      if (m_offset % c_alignment == 0)
+      {
+        int flags = fcntl(m_fd, F_GETFL);
+        if (flags != -1 && fcntl(m_fd, F_SETFL, flags | O_DIRECT) == 0)
+          m_direct = true;
+      }
+#  endif
+
+      allocate();
+#else
+      m_file = std::fopen(path.c_str(), "ab");
+      if (m_file == NULL)
+      {
+        ++m_errors;
+        return;
+      }
+
+      if (std::fseek(m_file, 0, SEEK_END) == 0)
+        m_offset = std::ftell(m_file);
+#endif
+    }
+
+    void
+    PayloadLog::closeFile(void)
+    {
+      if (m_path.empty())
+        return;
+
+      flush(false);
+
+      uint64_t size = m_offset + m_block_fill;
+      bool opened = false;
+
+#if defined(DUNE_OS_POSIX)
+      if (m_fd != -1)
+      {
+        // Discard direct I/O padding and unused preallocated space.
+        if (ftruncate(m_fd, size) != 0)
+          ++m_errors;
+
+        ::close(m_fd);
+        m_fd = -1;
+        opened = true;
+      }
+#else
+      if (m_file != NULL)
+      {
+        std::fclose(m_file);
+        m_file = NULL;
+        opened = true;
+      }
+#endif
+
+      if (opened && size == 0)
+        std::remove(m_path.c_str());
+
+      m_path.clear();
+      m_block_fill = 0;
+      m_block_synced = 0;
+    }
+
+    void
+    PayloadLog::append(const uint8_t* data, unsigned size)
+    {
+      while (size > 0)
+      {
+        unsigned count = std::min(size, m_block_size - m_block_fill);
+        std::memcpy(m_block + m_block_fill, data, count);
+        m_block_fill += count;
+        data += count;
+        size -= count;
+
+        if (m_block_fill == m_block_size)
+          flush(true);
+      }
+    }
+
+    void
+    PayloadLog::flush(bool full)
+    {
+      if (m_block_fill > m_block_synced)
+      {
+#if defined(DUNE_OS_POSIX)
+        if (m_direct)
+        {
+          // Rewrite the whole block, padded to the alignment. Padding
+          // is overwritten by subsequent flushes or truncated when
+          // the file is closed.
+          unsigned size = (m_block_fill + c_alignment - 1) / c_alignment * c_alignment;
+          std::memset(m_block + m_block_fill, 0, size - m_block_fill);
+          if (writeFile(m_block, size, m_offset))
+            m_written += m_block_fill - m_block_synced;
+        }
+        else
+#endif
+        {
+          if (writeFile(m_block + m_block_synced, m_block_fill - m_block_synced,
+                        m_offset + m_block_synced))
+            m_written += m_block_fill - m_block_synced;
+        }
+
+        m_block_synced = m_block_fill;
+        m_flush_time = Time::Clock::get();
+      }
+
+      if (full)
+      {
+        m_offset += m_block_fill;
+        m_block_fill = 0;
+        m_block_synced = 0;
+        allocate();
+      }
+    }
+
+    bool
+    PayloadLog::writeFile(const uint8_t* data, unsigned size, uint64_t offset)
+    {
+#if defined(DUNE_OS_POSIX)
+      if (m_fd == -1)
+        return false;
+
+      while (size > 0)
+      {
+        ssize_t rv = pwrite(m_fd, data, size, offset);
+        if (rv <= 0)
+        {
+          ++m_errors;
+          return false;
+        }
+
+        data += rv;
+        size -= rv;
+        offset += rv;
+      }
+
+      return true;
+#else
+      (void)offset;
+
+      if (m_file == NULL)
+        return false;
+
+      if (std::fwrite(data, 1, size, m_file) != size)
+      {
+        ++m_errors;
+        return false;
+      }
+
+      return true;
+#endif
+    }
+
+    void
+    PayloadLog::allocate(void)
+    {
+#if defined(DUNE_SYS_HAS_FALLOCATE) && defined(FALLOC_FL_KEEP_SIZE)
+      if (m_fd == -1 || m_offset + m_block_size <= m_allocated)
+        return;
+
+      uint64_t size = (uint64_t)m_block_size * c_extent_blocks;
+      if (fallocate(m_fd, FALLOC_FL_KEEP_SIZE, m_offset, size) == 0)
+        m_allocated = m_offset + size;
+      else
+        m_allocated = (uint64_t)-1;
+#endif
+    }
+
+    void
+    PayloadLog::run(void)
+    {
+      double wait = (m_flush_period > 0) ? m_flush_period : 1.0;
+
+      while (true)
+      {
+        if (m_tail == m_head)
+        {
+          if (isStopping())
+            break;
+
+          if (m_block_fill > m_block_synced
+              && Time::Clock::get() - m_flush_time >= m_flush_period)
+            flush(false);
+
+          m_cond.lock();
+          m_waiting = 1;
+          __sync_synchronize();
+          if (m_tail == m_head && !isStopping())
+            m_cond.wait(wait);
+          m_waiting = 0;
+          m_cond.unlock();
+          continue;
+        }
+
+        unsigned index = m_tail & (m_slot_count - 1);
+        __sync_synchronize();
+        process(m_slots[index], &m_slot_data[(size_t)index * m_slot_size]);
+        __sync_synchronize();
+        m_tail = m_tail + 1;
+      }
+
+      closeFile();
+    }
+  }
+}
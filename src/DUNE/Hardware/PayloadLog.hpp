@@ -0,0 +1,245 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_HARDWARE_PAYLOAD_LOG_HPP_INCLUDED_
+#define DUNE_HARDWARE_PAYLOAD_LOG_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+
+namespace DUNE
+{
+  namespace Hardware
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM PayloadLog;
+
+    //! Asynchronous writer for the native-format logs of high-rate
+    //! payloads (sonars, cameras, etc). Frames are copied into a ring
+    //! of slots allocated at construction and written to disk by a
+    //! dedicated thread, so the acquisition thread never blocks on
+    //! disk I/O or allocates memory. When the ring is full frames are
+    //! dropped and accounted.
+    //!
+    //! Data is written in aligned blocks using direct I/O and file
+    //! space is preallocated ahead of the write position, when the
+    //! platform and filesystem support it.
+    //!
+    //! Only one thread may call open(), close() and write().
+    class PayloadLog: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] slots number of frames buffered by the ring.
+      //! @param[in] slot_size maximum size of a frame.
+      //! @param[in] block_size size of disk writes (multiple of 4096).
+      //! @param[in] flush_period maximum time a partially filled
+      //! block stays in memory (s).
+      PayloadLog(unsigned slots, unsigned slot_size,
+                 unsigned block_size = 256 * 1024, double flush_period = 1.0);
+
+      //! Destructor.
+      ~PayloadLog(void);
+
+      //! Start writing frames to a file. Frames written after this
+      //! call are appended to the given file; the previous file, if
+      //! any, is closed.
+      //! @param[in] path file path.
+      //! @return true if the request was queued, false if the ring
+      //! is full or the path does not fit a slot.
+      bool
+      open(const std::string& path);
+
+      //! Close the current file. Empty files are removed.
+      //! @return true if the request was queued, false if the ring
+      //! is full.
+      bool
+      close(void);
+
+      //! Queue a frame. This function runs in constant time.
+      //! @param[in] data frame data.
+      //! @param[in] size frame size.
+      //! @return true if the frame was queued, false if it was
+      //! dropped.
+      bool
+      write(const uint8_t* data, unsigned size);
+
+      //! Retrieve the maximum size of a frame.
+      //! @return slot size.
+      unsigned
+      getSlotSize(void) const
+      {
+        return m_slot_size;
+      }
+
+      //! Retrieve the number of frames dropped because the ring was
+      //! full or they did not fit a slot.
+      //! @return number of dropped frames.
+      uint64_t
+      getDropped(void) const
+      {
+        return m_dropped;
+      }
+
+      //! Retrieve the number of bytes written to disk.
+      //! @return number of bytes.
+      uint64_t
+      getWritten(void) const
+      {
+        return m_written;
+      }
+
+      //! Retrieve the number of failed disk operations.
+      //! @return number of errors.
+      unsigned
+      getErrors(void) const
+      {
+        return m_errors;
+      }
+
+    private:
+      //! Slot types.
+      enum SlotType
+      {
+        //! Frame data.
+        ST_DATA,
+        //! Open file (path in slot data).
+        ST_OPEN,
+        //! Close file.
+        ST_CLOSE
+      };
+
+      //! Slot descriptor.
+      struct Slot
+      {
+        //! Slot type.
+        SlotType type;
+        //! Data size.
+        unsigned size;
+      };
+
+      //! Number of slots.
+      unsigned m_slot_count;
+      //! Maximum frame size.
+      unsigned m_slot_size;
+      //! Slot descriptors.
+      std::vector<Slot> m_slots;
+      //! Slot data.
+      std::vector<uint8_t> m_slot_data;
+      //! Number of slots queued (producer).
+      volatile unsigned m_head;
+      //! Number of slots consumed (writer thread).
+      volatile unsigned m_tail;
+      //! True if the writer thread is waiting for slots.
+      volatile int m_waiting;
+      //! Writer thread wake up condition.
+      Concurrency::Condition m_cond;
+      //! Number of dropped frames.
+      uint64_t m_dropped;
+      //! Number of bytes written.
+      volatile uint64_t m_written;
+      //! Number of failed disk operations.
+      volatile unsigned m_errors;
+      //! Block storage (unaligned).
+      uint8_t* m_block_storage;
+      //! Block buffer, aligned for direct I/O.
+      uint8_t* m_block;
+      //! Block size.
+      unsigned m_block_size;
+      //! Number of bytes in the block buffer.
+      unsigned m_block_fill;
+      //! Number of bytes of the block buffer already on disk.
+      unsigned m_block_synced;
+      //! File offset of the block buffer.
+      uint64_t m_offset;
+      //! End of the preallocated file space.
+      uint64_t m_allocated;
+      //! Maximum time a partial block stays in memory.
+      double m_flush_period;
+      //! Time of the last disk write.
+      double m_flush_time;
+      //! Current file path.
+      std::string m_path;
+#if defined(DUNE_OS_POSIX)
+      //! Current file descriptor.
+      int m_fd;
+      //! True if the file was opened for direct I/O.
+      bool m_direct;
+#else
+      //! Current file handle.
+      std::FILE* m_file;
+#endif
+
+      //! Queue a slot.
+      bool
+      push(SlotType type, const uint8_t* data, unsigned size);
+
+      //! Process one slot.
+      void
+      process(const Slot& slot, const uint8_t* data);
+
+      //! Open a file for writing.
+      void
+      openFile(const std::string& path);
+
+      //! Write remaining data and close the current file.
+      void
+      closeFile(void);
+
+      //! Append data to the block buffer, writing full blocks.
+      void
+      append(const uint8_t* data, unsigned size);
+
+      //! Write the block buffer to disk.
+      //! @param[in] full true if the block buffer is full.
+      void
+      flush(bool full);
+
+      //! Write data to the current file.
+      bool
+      writeFile(const uint8_t* data, unsigned size, uint64_t offset);
+
+      //! Preallocate file space for the next block.
+      void
+      allocate(void);
+
+      void
+      run(void);
+    };
+  }
+}
+
+#endif
@@ -38,11 +38,19 @@ namespace DUNE
 }
 
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/IMC/BusPredicate.hpp>
 #include <DUNE/IMC/Serialization.hpp>
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
+#include <DUNE/IMC/RawData.hpp>
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Schema.hpp>
+#include <DUNE/IMC/CompactCodec.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/JSONParser.hpp>
+#include <DUNE/IMC/LogReader.hpp>
+#include <DUNE/IMC/ColumnStore.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/Macros.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
@@ -78,26 +78,45 @@ namespace DUNE
     }
 
     void
-    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id)
+    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id, BusPredicate* predicate)
     {
       TransportBindings* bind = new TransportBindings;
       bind->setSourceEntity(DUNE_IMC_CONST_SYS_EID);
       bind->setTimeStamp();
       bind->consumer = task->getName();
       bind->message_id = id;
-      m_bind_msgs.push_back(bind);
 
       Concurrency::ScopedRWLock l(m_lock, true);
-      TransportList::iterator itr = std::find(m_recipients[id].begin(), m_recipients[id].end(), task);
-      if (itr == m_recipients[id].end())
-        m_recipients[id].push_back(task);
+      m_bind_msgs.push_back(bind);
+
+      TransportList& dlst(m_recipients[id]);
+      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
+      {
+        if (itr->task == task)
+        {
+          itr->predicate = predicate;
+          return;
+        }
+      }
+
+      Subscription sub;
+      sub.task = task;
+      sub.predicate = predicate;
+      dlst.push_back(sub);
     }
 
     void
     Bus::unregisterRecipient(Tasks::AbstractTask* task, uint16_t id)
     {
       Concurrency::ScopedRWLock l(m_lock, true);
-      m_recipients[id].remove(task);
+      TransportList& dlst(m_recipients[id]);
+      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); )
+      {
+        if (itr->task == task)
+          itr = dlst.erase(itr);
+        else
+          ++itr;
+      }
     }
 
     void
@@ -112,13 +131,22 @@ namespace DUNE
         }
       }
 
-      uint16_t id = msg->getId();
       Concurrency::ScopedRWLock l(m_lock);
-      TransportList& dlst(m_recipients[id]);
+      std::map<uint16_t, TransportList>::iterator ritr = m_recipients.find(msg->getId());
+      if (ritr == m_recipients.end())
+        return;
+
+      TransportList& dlst(ritr->second);
       for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
       {
-        if (*itr != task)
-          (*itr)->receive(msg);
+        if (itr->task == task)
+          continue;
+
+        // Filter before the recipient clones the message.
+        if (itr->predicate != NULL && !itr->predicate->match(msg))
+          continue;
+
+        itr->task->receive(msg);
       }
     }
 
@@ -143,6 +171,7 @@ namespace DUNE
     const std::vector<TransportBindings*>
     Bus::getBindings(void)
     {
+      Concurrency::ScopedRWLock l(m_lock);
       return m_bind_msgs;
     }
   }
@@ -44,6 +44,7 @@
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Concurrency/ScopedRWLock.hpp>
+#include <DUNE/IMC/BusPredicate.hpp>
 
 namespace DUNE
 {
@@ -66,11 +67,14 @@ namespace DUNE
       ~Bus(void);
 
       //! Register a task as a recipient a given message
-      //! identification number.
+      //! identification number. If a predicate is given, messages
+      //! are only delivered to the task if they match it.
+      //! Registering a task again replaces its predicate.
       //! @param task task object.
       //! @param id message identification number.
+      //! @param predicate message predicate (not owned) or NULL.
       void
-      registerRecipient(Tasks::AbstractTask* task, uint16_t id);
+      registerRecipient(Tasks::AbstractTask* task, uint16_t id, BusPredicate* predicate = NULL);
 
       //! Unregister a task as a recipient of a given message
       //! identification number.
@@ -99,7 +103,16 @@ namespace DUNE
       getBindings(void);
 
     private:
-      typedef std::list<Tasks::AbstractTask*> TransportList;
+      //! Recipient of a given message.
+      struct Subscription
+      {
+        //! Task object.
+        Tasks::AbstractTask* task;
+        //! Message predicate or NULL.
+        BusPredicate* predicate;
+      };
+
+      typedef std::list<Subscription> TransportList;
       //! Table of recipients.
       std::map<uint16_t, TransportList> m_recipients;
       //! Internal list lock.
@@ -0,0 +1,173 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/BusPredicate.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Insert a value in a sorted vector, ignoring duplicates.
+    //! @param[in] vec sorted vector.
+    //! @param[in] value value to insert.
+    static void
+    insertSorted(std::vector<unsigned>& vec, unsigned value)
+    {
+      std::vector<unsigned>::iterator itr = std::lower_bound(vec.begin(), vec.end(), value);
+      if (itr == vec.end() || *itr != value)
+        vec.insert(itr, value);
+    }
+
+    BusPredicate::BusPredicate(void):
+      m_check_dst(false),
+      m_dst(0),
+      m_period(0.0),
+      m_hits(0),
+      m_misses(0)
+    { }
+
+    BusPredicate::BusPredicate(const BusPredicate& other):
+      m_sources(other.m_sources),
+      m_entities(other.m_entities),
+      m_check_dst(other.m_check_dst),
+      m_dst(other.m_dst),
+      m_period(other.m_period),
+      m_hits(0),
+      m_misses(0)
+    { }
+
+    BusPredicate&
+    BusPredicate::source(unsigned id)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      insertSorted(m_sources, id);
+      return *this;
+    }
+
+    BusPredicate&
+    BusPredicate::sourceEntity(unsigned id)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      insertSorted(m_entities, id);
+      return *this;
+    }
+
+    BusPredicate&
+    BusPredicate::destination(unsigned id)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      m_check_dst = true;
+      m_dst = id;
+      return *this;
+    }
+
+    BusPredicate&
+    BusPredicate::rate(double frequency)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      m_period = (frequency > 0) ? 1.0 / frequency : 0.0;
+      return *this;
+    }
+
+    bool
+    BusPredicate::accepts(const Message* msg) const
+    {
+      if (m_check_dst && msg->getDestination() != m_dst)
+        return false;
+
+      if (!m_sources.empty() && !std::binary_search(m_sources.begin(), m_sources.end(),
+                                                    (unsigned)msg->getSource()))
+        return false;
+
+      if (!m_entities.empty() && !std::binary_search(m_entities.begin(), m_entities.end(),
+                                                     (unsigned)msg->getSourceEntity()))
+        return false;
+
+      return true;
+    }
+
+    bool
+    BusPredicate::match(const Message* msg)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      bool rv = accepts(msg);
+
+      if (rv && m_period > 0)
+      {
+        unsigned key = ((unsigned)msg->getSource() << 8) | msg->getSourceEntity();
+        double stamp = msg->getTimeStamp();
+        std::map<unsigned, double>::iterator itr = m_last.find(key);
+
+        if (itr == m_last.end())
+          m_last[key] = stamp;
+        else if (stamp - itr->second < m_period && stamp >= itr->second)
+          rv = false;
+        else
+          itr->second = stamp;
+      }
+
+      if (rv)
+        ++m_hits;
+      else
+        ++m_misses;
+
+      return rv;
+    }
+
+    unsigned
+    BusPredicate::getHits(void) const
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      return m_hits;
+    }
+
+    unsigned
+    BusPredicate::getMisses(void) const
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      return m_misses;
+    }
+
+    bool
+    BusPredicate::operator==(const BusPredicate& other) const
+    {
+      return m_sources == other.m_sources
+      && m_entities == other.m_entities
+      && m_check_dst == other.m_check_dst
+      && m_dst == other.m_dst
+      && m_period == other.m_period;
+    }
+  }
+}
@@ -0,0 +1,150 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_BUS_PREDICATE_HPP_INCLUDED_
+#define DUNE_IMC_BUS_PREDICATE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Forward declarations.
+    class Message;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BusPredicate;
+
+    //! Predicate evaluated by the message bus before a message is
+    //! queued to a recipient. A message matches if its source system,
+    //! source entity and destination are accepted and, when a rate
+    //! limit is set, if enough time has elapsed since the last message
+    //! accepted from the same source system and entity. Empty sets
+    //! accept any value. Criteria may be extended after the predicate
+    //! is registered, e.g., once entity identifiers are resolved.
+    //! Copies of a predicate share its criteria but start with cleared
+    //! counters.
+    class BusPredicate
+    {
+    public:
+      //! Create a predicate that accepts every message.
+      BusPredicate(void);
+
+      //! Copy constructor.
+      //! @param[in] other predicate to copy criteria from.
+      BusPredicate(const BusPredicate& other);
+
+      //! Accept messages from a given source system.
+      //! @param[in] id system identifier.
+      //! @return reference to this predicate.
+      BusPredicate&
+      source(unsigned id);
+
+      //! Accept messages from a given source entity.
+      //! @param[in] id entity identifier.
+      //! @return reference to this predicate.
+      BusPredicate&
+      sourceEntity(unsigned id);
+
+      //! Only accept messages addressed to a given system.
+      //! @param[in] id system identifier.
+      //! @return reference to this predicate.
+      BusPredicate&
+      destination(unsigned id);
+
+      //! Limit the rate of accepted messages per source system and
+      //! entity, using message timestamps.
+      //! @param[in] frequency maximum frequency (Hz).
+      //! @return reference to this predicate.
+      BusPredicate&
+      rate(double frequency);
+
+      //! Test if a message matches the predicate and update counters.
+      //! @param[in] msg message.
+      //! @return true if the message matches, false otherwise.
+      bool
+      match(const Message* msg);
+
+      //! Retrieve the number of matching messages.
+      //! @return number of hits.
+      unsigned
+      getHits(void) const;
+
+      //! Retrieve the number of rejected messages.
+      //! @return number of misses.
+      unsigned
+      getMisses(void) const;
+
+      //! Test if two predicates have the same criteria.
+      //! @param[in] other predicate.
+      //! @return true if criteria are the same, false otherwise.
+      bool
+      operator==(const BusPredicate& other) const;
+
+    private:
+      //! Accepted source systems (sorted).
+      std::vector<unsigned> m_sources;
+      //! Accepted source entities (sorted).
+      std::vector<unsigned> m_entities;
+      //! True if destination must match.
+      bool m_check_dst;
+      //! Accepted destination.
+      unsigned m_dst;
+      //! Minimum period between accepted messages (s).
+      double m_period;
+      //! Timestamp of last accepted message per source system and entity.
+      std::map<unsigned, double> m_last;
+      //! Number of hits.
+      unsigned m_hits;
+      //! Number of misses.
+      unsigned m_misses;
+      //! Lock protecting criteria, counters and timestamps.
+      mutable Concurrency::Mutex m_mutex;
+
+      //! Test static criteria of a message.
+      //! @param[in] msg message.
+      //! @return true if message passes static criteria, false otherwise.
+      bool
+      accepts(const Message* msg) const;
+
+      // Non - assignable.
+      BusPredicate&
+      operator=(const BusPredicate&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,552 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/ColumnStore.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/Compression/ZlibCompressor.hpp>
+#include <DUNE/Compression/ZlibDecompressor.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    using namespace ColumnStore;
+
+    //! Chunk alignment.
+    static const unsigned c_alignment = 8;
+    //! Minimum chunk size worth compressing.
+    static const unsigned c_min_compress = 64;
+
+    //! Group the n-th bytes of all values together, which makes
+    //! numeric columns far more compressible.
+    static void
+    shuffle(const uint8_t* src, unsigned rows, unsigned size, uint8_t* dst)
+    {
+      for (unsigned r = 0; r < rows; ++r)
+      {
+        for (unsigned b = 0; b < size; ++b)
+          dst[b * rows + r] = src[r * size + b];
+      }
+    }
+
+    //! Reverse shuffle().
+    static void
+    unshuffle(const uint8_t* src, unsigned rows, unsigned size, uint8_t* dst)
+    {
+      for (unsigned r = 0; r < rows; ++r)
+      {
+        for (unsigned b = 0; b < size; ++b)
+          dst[r * size + b] = src[b * rows + r];
+      }
+    }
+
+    template <typename Type>
+    static void
+    put(std::ostream& os, Type value)
+    {
+      os.write((const char*)&value, sizeof(Type));
+    }
+
+    //! Bounded reader over the index.
+    struct Cursor
+    {
+      const uint8_t* ptr;
+      const uint8_t* end;
+
+      template <typename Type>
+      Type
+      get(void)
+      {
+        if ((size_t)(end - ptr) < sizeof(Type))
+          throw std::runtime_error("malformed column file index");
+
+        Type value;
+        std::memcpy(&value, ptr, sizeof(Type));
+        ptr += sizeof(Type);
+        return value;
+      }
+    };
+
+    ColumnWriter::ColumnWriter(const std::string& path, bool compress):
+      m_path(path),
+      m_ofs(path.c_str(), std::ios::binary | std::ios::trunc),
+      m_compress(compress)
+    {
+      if (!m_ofs)
+        throw FileSystem::FileWriteError(path);
+
+      m_ofs.write(c_magic, c_magic_size);
+    }
+
+    ColumnWriter::~ColumnWriter(void)
+    {
+      if (m_ofs.is_open())
+        close();
+    }
+
+    ColumnWriter::Table&
+    ColumnWriter::getTable(const Schema::Message* schema)
+    {
+      std::map<uint16_t, Table>::iterator itr = m_tables.find(schema->id);
+      if (itr != m_tables.end())
+        return itr->second;
+
+      Table& table = m_tables[schema->id];
+      table.schema = schema;
+      table.info.id = schema->id;
+      table.info.rows = 0;
+      table.pending_rows = 0;
+
+      const char* names[] = {"timestamp", "src", "src_ent"};
+      Schema::FieldType types[] = {Schema::TYPE_FP64, Schema::TYPE_UINT16, Schema::TYPE_UINT8};
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        Column column;
+        column.name = names[i];
+        column.type = types[i];
+        table.info.columns.push_back(column);
+      }
+
+      table.pending.resize(table.info.columns.size());
+      return table;
+    }
+
+    void
+    ColumnWriter::select(const std::string& spec)
+    {
+      size_t dot = spec.find('.');
+      std::string abbrev = spec.substr(0, dot);
+
+      const Schema::Message* schema = Schema::find(abbrev);
+      if (schema == NULL)
+        throw InvalidMessageAbbrev(abbrev);
+
+      Table& table = getTable(schema);
+      if (table.info.rows > 0 || table.pending_rows > 0)
+        throw std::runtime_error("selection changed after writing: " + spec);
+
+      std::vector<unsigned> fields;
+      if (dot == std::string::npos)
+      {
+        for (unsigned i = 0; i < schema->fields.size(); ++i)
+        {
+          if (Schema::getTypeSize(schema->fields[i].type) > 0)
+            fields.push_back(i);
+        }
+      }
+      else
+      {
+        int index = Schema::findField(schema, spec.substr(dot + 1));
+        if (index < 0)
+          throw std::runtime_error("unknown field: " + spec);
+        if (Schema::getTypeSize(schema->fields[index].type) == 0)
+          throw std::runtime_error("field does not have a fixed size: " + spec);
+        fields.push_back(index);
+      }
+
+      for (unsigned i = 0; i < fields.size(); ++i)
+      {
+        bool present = false;
+        for (unsigned j = 0; j < table.fields.size() && !present; ++j)
+          present = table.fields[j] == fields[i];
+
+        if (present)
+          continue;
+
+        Column column;
+        column.name = schema->fields[fields[i]].abbrev;
+        column.type = schema->fields[fields[i]].type;
+        table.info.columns.push_back(column);
+        table.fields.push_back(fields[i]);
+      }
+
+      table.pending.resize(table.info.columns.size());
+    }
+
+    std::vector<uint16_t>
+    ColumnWriter::getSelection(void) const
+    {
+      std::vector<uint16_t> ids;
+      std::map<uint16_t, Table>::const_iterator itr = m_tables.begin();
+      for (; itr != m_tables.end(); ++itr)
+        ids.push_back(itr->first);
+      return ids;
+    }
+
+    bool
+    ColumnWriter::write(const Message* msg)
+    {
+      std::map<uint16_t, Table>::iterator itr = m_tables.find(msg->getId());
+      if (itr == m_tables.end())
+        return false;
+
+      Table& table = itr->second;
+      const Schema::Message* schema = table.schema;
+
+      m_payload.resize(msg->getPayloadSerializationSize());
+      if (!m_payload.empty())
+        msg->serializeFields(&m_payload[0]);
+
+      // Locate fields.
+      const uint8_t* ptr = m_payload.empty() ? NULL : &m_payload[0];
+      const uint8_t* end = ptr + m_payload.size();
+      m_offsets.resize(schema->fields.size());
+      for (unsigned i = 0; i < schema->fields.size(); ++i)
+      {
+        m_offsets[i] = ptr;
+        ptr = Schema::skip(schema->fields[i], ptr, end);
+      }
+
+      double timestamp = msg->getTimeStamp();
+      uint16_t src = msg->getSource();
+      uint8_t src_ent = msg->getSourceEntity();
+      std::vector<uint8_t>* pending = &table.pending[0];
+      pending[0].insert(pending[0].end(), (uint8_t*)&timestamp, (uint8_t*)&timestamp + sizeof(timestamp));
+      pending[1].insert(pending[1].end(), (uint8_t*)&src, (uint8_t*)&src + sizeof(src));
+      pending[2].push_back(src_ent);
+
+      for (unsigned i = 0; i < table.fields.size(); ++i)
+      {
+        unsigned field = table.fields[i];
+        unsigned size = Schema::getTypeSize(schema->fields[field].type);
+        pending[3 + i].insert(pending[3 + i].end(), m_offsets[field], m_offsets[field] + size);
+      }
+
+      if (++table.pending_rows == c_chunk_rows)
+        flush(table);
+
+      return true;
+    }
+
+    void
+    ColumnWriter::flush(Table& table)
+    {
+      if (table.pending_rows == 0)
+        return;
+
+      for (unsigned i = 0; i < table.info.columns.size(); ++i)
+      {
+        writeChunk(table.info.columns[i], table.pending[i], table.pending_rows);
+        table.pending[i].clear();
+      }
+
+      table.info.rows += table.pending_rows;
+      table.pending_rows = 0;
+    }
+
+    void
+    ColumnWriter::writeChunk(Column& column, const std::vector<uint8_t>& values, unsigned rows)
+    {
+      Chunk chunk;
+      chunk.rows = rows;
+      chunk.coding = CODING_RAW;
+
+      const uint8_t* data = &values[0];
+      size_t size = values.size();
+
+      Utils::ByteBuffer compressed;
+      if (m_compress && size >= c_min_compress)
+      {
+        m_shuffled.resize(size);
+        shuffle(data, rows, Schema::getTypeSize(column.type), &m_shuffled[0]);
+
+        Compression::ZlibCompressor cmp;
+        cmp.compress(compressed, (char*)&m_shuffled[0], size);
+        if (compressed.getSize() < size)
+        {
+          data = compressed.getBuffer();
+          size = compressed.getSize();
+          chunk.coding = CODING_SHUFFLE_ZLIB;
+        }
+      }
+
+      // Align chunks so that raw values can be used in place.
+      uint64_t offset = m_ofs.tellp();
+      while (offset % c_alignment != 0)
+      {
+        m_ofs.put(0);
+        ++offset;
+      }
+
+      m_ofs.write((const char*)data, size);
+      if (!m_ofs)
+        throw FileSystem::FileWriteError(m_path);
+
+      chunk.offset = offset;
+      chunk.size = size;
+      column.chunks.push_back(chunk);
+    }
+
+    void
+    ColumnWriter::writeIndex(void)
+    {
+      uint64_t offset = m_ofs.tellp();
+
+      put<uint32_t>(m_ofs, m_tables.size());
+      std::map<uint16_t, Table>::const_iterator itr = m_tables.begin();
+      for (; itr != m_tables.end(); ++itr)
+      {
+        const ColumnStore::Table& info = itr->second.info;
+        put<uint16_t>(m_ofs, info.id);
+        put<uint32_t>(m_ofs, info.rows);
+        put<uint16_t>(m_ofs, info.columns.size());
+
+        for (unsigned i = 0; i < info.columns.size(); ++i)
+        {
+          const Column& column = info.columns[i];
+          put<uint8_t>(m_ofs, column.name.size());
+          m_ofs.write(column.name.data(), column.name.size());
+          put<uint8_t>(m_ofs, column.type);
+          put<uint32_t>(m_ofs, column.chunks.size());
+
+          for (unsigned j = 0; j < column.chunks.size(); ++j)
+          {
+            put<uint64_t>(m_ofs, column.chunks[j].offset);
+            put<uint32_t>(m_ofs, column.chunks[j].size);
+            put<uint32_t>(m_ofs, column.chunks[j].rows);
+            put<uint8_t>(m_ofs, column.chunks[j].coding);
+          }
+        }
+      }
+
+      put<uint64_t>(m_ofs, offset);
+      m_ofs.write(c_magic, c_magic_size);
+    }
+
+    void
+    ColumnWriter::close(void)
+    {
+      std::map<uint16_t, Table>::iterator itr = m_tables.begin();
+      for (; itr != m_tables.end(); ++itr)
+        flush(itr->second);
+
+      writeIndex();
+      m_ofs.close();
+      if (!m_ofs)
+        throw FileSystem::FileWriteError(m_path);
+    }
+
+    ColumnReader::ColumnReader(const std::string& path):
+      m_file(path)
+    {
+      readIndex();
+    }
+
+    void
+    ColumnReader::readIndex(void)
+    {
+      const uint8_t* data = m_file.getData();
+      size_t size = m_file.getSize();
+      size_t trailer = sizeof(uint64_t) + c_magic_size;
+
+      if (size < c_magic_size + trailer
+          || std::memcmp(data, c_magic, c_magic_size) != 0
+          || std::memcmp(data + size - c_magic_size, c_magic, c_magic_size) != 0)
+        throw std::runtime_error("not a column file");
+
+      uint64_t offset;
+      std::memcpy(&offset, data + size - trailer, sizeof(offset));
+      if (offset < c_magic_size || offset > size - trailer)
+        throw std::runtime_error("malformed column file index");
+
+      Cursor in;
+      in.ptr = data + offset;
+      in.end = data + size - trailer;
+
+      uint32_t tables = in.get<uint32_t>();
+      for (uint32_t t = 0; t < tables; ++t)
+      {
+        ColumnStore::Table table;
+        table.id = in.get<uint16_t>();
+        table.rows = in.get<uint32_t>();
+
+        uint16_t columns = in.get<uint16_t>();
+        for (uint16_t c = 0; c < columns; ++c)
+        {
+          Column column;
+          uint8_t length = in.get<uint8_t>();
+          if (in.end - in.ptr < length)
+            throw std::runtime_error("malformed column file index");
+          column.name.assign((const char*)in.ptr, length);
+          in.ptr += length;
+
+          column.type = (Schema::FieldType)in.get<uint8_t>();
+          unsigned value_size = Schema::getTypeSize(column.type);
+          if (value_size == 0)
+            throw std::runtime_error("invalid column type: " + column.name);
+
+          uint32_t chunks = in.get<uint32_t>();
+          for (uint32_t k = 0; k < chunks; ++k)
+          {
+            Chunk chunk;
+            chunk.offset = in.get<uint64_t>();
+            chunk.size = in.get<uint32_t>();
+            chunk.rows = in.get<uint32_t>();
+            chunk.coding = in.get<uint8_t>();
+
+            if (chunk.offset > offset || chunk.size > offset - chunk.offset
+                || (chunk.coding == CODING_RAW && chunk.size != (uint64_t)chunk.rows * value_size))
+              throw std::runtime_error("malformed column chunk: " + column.name);
+
+            column.chunks.push_back(chunk);
+          }
+
+          table.columns.push_back(column);
+        }
+
+        m_tables.push_back(table);
+      }
+    }
+
+    const ColumnStore::Table*
+    ColumnReader::findTable(const std::string& abbrev) const
+    {
+      const Schema::Message* schema = Schema::find(abbrev);
+      if (schema == NULL)
+        return NULL;
+
+      for (unsigned i = 0; i < m_tables.size(); ++i)
+      {
+        if (m_tables[i].id == schema->id)
+          return &m_tables[i];
+      }
+
+      return NULL;
+    }
+
+    const ColumnStore::Column*
+    ColumnReader::findColumn(const ColumnStore::Table& table, const std::string& name)
+    {
+      for (unsigned i = 0; i < table.columns.size(); ++i)
+      {
+        if (table.columns[i].name == name)
+          return &table.columns[i];
+      }
+
+      return NULL;
+    }
+
+    const void*
+    ColumnReader::getChunk(const Column& column, unsigned index, std::vector<uint8_t>& scratch) const
+    {
+      const Chunk& chunk = column.chunks.at(index);
+      const uint8_t* data = m_file.getData() + chunk.offset;
+
+      if (chunk.coding == CODING_RAW)
+        return data;
+
+      if (chunk.coding != CODING_SHUFFLE_ZLIB)
+        throw std::runtime_error("unknown chunk coding: " + column.name);
+
+      unsigned value_size = Schema::getTypeSize(column.type);
+      size_t size = (size_t)chunk.rows * value_size;
+      std::vector<uint8_t> shuffled(size);
+      scratch.resize(size);
+
+      if (size > 0)
+      {
+        Compression::ZlibDecompressor dec;
+        dec.decompress((char*)&shuffled[0], size, (char*)data, chunk.size);
+        if (dec.decompressed() != size)
+          throw std::runtime_error("corrupted column chunk: " + column.name);
+
+        unshuffle(&shuffled[0], chunk.rows, value_size, &scratch[0]);
+      }
+
+      return scratch.empty() ? NULL : &scratch[0];
+    }
+
+    template <typename Type>
+    static void
+    convert(const void* data, unsigned rows, std::vector<double>& values)
+    {
+      const uint8_t* ptr = (const uint8_t*)data;
+      for (unsigned i = 0; i < rows; ++i)
+      {
+        Type value;
+        std::memcpy(&value, ptr + i * sizeof(Type), sizeof(Type));
+        values.push_back((double)value);
+      }
+    }
+
+    void
+    ColumnReader::read(const Column& column, std::vector<double>& values) const
+    {
+      std::vector<uint8_t> scratch;
+      values.clear();
+
+      for (unsigned i = 0; i < column.chunks.size(); ++i)
+      {
+        const void* data = getChunk(column, i, scratch);
+        unsigned rows = column.chunks[i].rows;
+
+        switch (column.type)
+        {
+          case Schema::TYPE_UINT8:
+            convert<uint8_t>(data, rows, values);
+            break;
+          case Schema::TYPE_INT8:
+            convert<int8_t>(data, rows, values);
+            break;
+          case Schema::TYPE_UINT16:
+            convert<uint16_t>(data, rows, values);
+            break;
+          case Schema::TYPE_INT16:
+            convert<int16_t>(data, rows, values);
+            break;
+          case Schema::TYPE_UINT32:
+            convert<uint32_t>(data, rows, values);
+            break;
+          case Schema::TYPE_INT32:
+            convert<int32_t>(data, rows, values);
+            break;
+          case Schema::TYPE_INT64:
+            convert<int64_t>(data, rows, values);
+            break;
+          case Schema::TYPE_FP32:
+            convert<fp32_t>(data, rows, values);
+            break;
+          case Schema::TYPE_FP64:
+            convert<fp64_t>(data, rows, values);
+            break;
+          default:
+            break;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,262 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COLUMN_STORE_HPP_INCLUDED_
+#define DUNE_IMC_COLUMN_STORE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Schema.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbols.
+    class DUNE_DLL_SYM ColumnWriter;
+    class DUNE_DLL_SYM ColumnReader;
+
+    //! Columnar storage of IMC messages.
+    //!
+    //! Each selected message type is stored as a table with the header
+    //! columns 'timestamp', 'src' and 'src_ent' followed by one column
+    //! per selected fixed-size field. Rows are split in chunks of up
+    //! to c_chunk_rows; each chunk of a column is an array of native
+    //! values, stored as-is or byte-shuffled and zlib-compressed,
+    //! whichever is smaller. Chunks are 8-byte aligned so that
+    //! uncompressed chunks can be used straight from a memory mapping.
+    //!
+    //! File layout: magic, chunks, index, index offset (uint64_t),
+    //! magic. The index lists, for each table, the message
+    //! identification number, the number of rows and, for each column,
+    //! its name, type and the offset, size, number of rows and coding
+    //! of every chunk.
+    namespace ColumnStore
+    {
+      //! File magic.
+      static const char c_magic[] = "DUNECOL1";
+      //! Size of the file magic.
+      static const unsigned c_magic_size = 8;
+      //! Maximum number of rows per chunk.
+      static const unsigned c_chunk_rows = 65536;
+
+      //! Chunk coding.
+      enum Coding
+      {
+        //! Native values.
+        CODING_RAW = 0,
+        //! Byte-shuffled and zlib-compressed values.
+        CODING_SHUFFLE_ZLIB = 1
+      };
+
+      //! Chunk of a column.
+      struct Chunk
+      {
+        //! Offset of the chunk in the file.
+        uint64_t offset;
+        //! Stored size in bytes.
+        uint32_t size;
+        //! Number of rows.
+        uint32_t rows;
+        //! Coding.
+        uint8_t coding;
+      };
+
+      //! Column of a table.
+      struct Column
+      {
+        //! Column name.
+        std::string name;
+        //! Value type.
+        Schema::FieldType type;
+        //! Chunks in row order.
+        std::vector<Chunk> chunks;
+      };
+
+      //! Table of a message type.
+      struct Table
+      {
+        //! Message identification number.
+        uint16_t id;
+        //! Number of rows.
+        uint32_t rows;
+        //! Columns.
+        std::vector<Column> columns;
+      };
+    }
+
+    //! Write messages to a columnar file.
+    class ColumnWriter
+    {
+    public:
+      //! Create a columnar file.
+      //! @param path file path.
+      //! @param compress true to compress chunks.
+      //! @throw FileSystem::FileWriteError if the file cannot be created.
+      ColumnWriter(const std::string& path, bool compress = true);
+
+      //! Close the file if needed.
+      ~ColumnWriter(void);
+
+      //! Select a message or a field to export.
+      //! @param spec message abbreviation, to select all fixed-size
+      //! fields, or message abbreviation and field name separated by
+      //! a dot.
+      //! @throw std::runtime_error if the message or field is unknown
+      //! or the field does not have a fixed size.
+      void
+      select(const std::string& spec);
+
+      //! Retrieve the identification numbers of selected messages.
+      //! @return message identification numbers.
+      std::vector<uint16_t>
+      getSelection(void) const;
+
+      //! Append a message.
+      //! @param msg message.
+      //! @return true if the message was selected, false otherwise.
+      bool
+      write(const Message* msg);
+
+      //! Write remaining chunks and the index and close the file.
+      void
+      close(void);
+
+    private:
+      //! Table being written.
+      struct Table
+      {
+        //! Message description.
+        const Schema::Message* schema;
+        //! Index of the field of each data column.
+        std::vector<unsigned> fields;
+        //! Description of written chunks.
+        ColumnStore::Table info;
+        //! Values not yet written, per column.
+        std::vector<std::vector<uint8_t> > pending;
+        //! Number of rows not yet written.
+        unsigned pending_rows;
+      };
+
+      //! File path.
+      std::string m_path;
+      //! Output file.
+      std::ofstream m_ofs;
+      //! True to compress chunks.
+      bool m_compress;
+      //! Tables by message identification number.
+      std::map<uint16_t, Table> m_tables;
+      //! Serialized payload.
+      std::vector<uint8_t> m_payload;
+      //! Field offsets in the serialized payload.
+      std::vector<const uint8_t*> m_offsets;
+      //! Scratch buffers for encoding chunks.
+      std::vector<uint8_t> m_shuffled;
+      std::vector<uint8_t> m_compressed;
+
+      Table&
+      getTable(const Schema::Message* schema);
+
+      void
+      flush(Table& table);
+
+      void
+      writeChunk(ColumnStore::Column& column, const std::vector<uint8_t>& values, unsigned rows);
+
+      void
+      writeIndex(void);
+    };
+
+    //! Read columns from a memory-mapped columnar file.
+    class ColumnReader
+    {
+    public:
+      //! Open a columnar file.
+      //! @param path file path.
+      //! @throw FileSystem::FileReadError if the file cannot be read.
+      //! @throw std::runtime_error if the file is malformed.
+      ColumnReader(const std::string& path);
+
+      //! Retrieve all tables.
+      //! @return tables.
+      const std::vector<ColumnStore::Table>&
+      getTables(void) const
+      {
+        return m_tables;
+      }
+
+      //! Find the table of a message.
+      //! @param abbrev message abbreviation.
+      //! @return table or NULL if the message was not exported.
+      const ColumnStore::Table*
+      findTable(const std::string& abbrev) const;
+
+      //! Find a column.
+      //! @param table table.
+      //! @param name column name.
+      //! @return column or NULL if the column does not exist.
+      static const ColumnStore::Column*
+      findColumn(const ColumnStore::Table& table, const std::string& name);
+
+      //! Retrieve the values of a chunk. Uncompressed chunks are
+      //! returned without copying.
+      //! @param column column.
+      //! @param index chunk index.
+      //! @param scratch buffer used for compressed chunks.
+      //! @return pointer to an array of native values.
+      const void*
+      getChunk(const ColumnStore::Column& column, unsigned index, std::vector<uint8_t>& scratch) const;
+
+      //! Read a whole column converted to double precision.
+      //! @param column column.
+      //! @param values output values.
+      void
+      read(const ColumnStore::Column& column, std::vector<double>& values) const;
+
+    private:
+      //! File contents.
+      FileSystem::MappedFile m_file;
+      //! Tables.
+      std::vector<ColumnStore::Table> m_tables;
+
+      void
+      readIndex(void);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,772 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/IMC/CompactCodec.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Factory.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Frame carries a key header.
+    static const uint8_t c_flag_key = 0x01;
+    //! Message fields are preceded by field masks.
+    static const uint8_t c_flag_mask = 0x02;
+    //! Source entity differs from the key header.
+    static const uint8_t c_flag_src_ent = 0x04;
+    //! Destination differs from the key header.
+    static const uint8_t c_flag_dst = 0x08;
+    //! Destination entity differs from the key header.
+    static const uint8_t c_flag_dst_ent = 0x10;
+    //! Frame has quantized fields and ends with a digest of their
+    //! quantization steps.
+    static const uint8_t c_flag_precision = 0x20;
+    //! Largest timestamp offset of a delta header (milliseconds).
+    static const int64_t c_max_delta = 0x7fffffff;
+    //! Largest magnitude of a quantized value.
+    static const double c_max_quantized = 9007199254740992.0;
+
+    static void
+    writeVarint(uint64_t value, std::vector<uint8_t>& out)
+    {
+      while (value >= 0x80)
+      {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+      }
+
+      out.push_back((uint8_t)value);
+    }
+
+    static void
+    writeSigned(int64_t value, std::vector<uint8_t>& out)
+    {
+      writeVarint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63), out);
+    }
+
+    static void
+    writeBytes(const uint8_t* data, unsigned size, std::vector<uint8_t>& out)
+    {
+      out.insert(out.end(), data, data + size);
+    }
+
+    //! Write the bit pattern of a value in little-endian byte order.
+    static void
+    writeFixed(uint64_t bits, unsigned size, std::vector<uint8_t>& out)
+    {
+      for (unsigned i = 0; i < size; ++i)
+        out.push_back((uint8_t)(bits >> (8 * i)));
+    }
+
+    template <typename Type>
+    static void
+    writeNative(Type value, std::vector<uint8_t>& out)
+    {
+      const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&value);
+      out.insert(out.end(), ptr, ptr + sizeof(Type));
+    }
+
+    uint8_t
+    CompactCodec::readByte(Reader& in)
+    {
+      if (in.ptr == in.end)
+        throw BufferTooShort();
+
+      return *in.ptr++;
+    }
+
+    uint64_t
+    CompactCodec::readVarint(Reader& in)
+    {
+      uint64_t value = 0;
+
+      for (unsigned shift = 0; shift < 64; shift += 7)
+      {
+        uint8_t byte = readByte(in);
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+
+      throw InvalidFormat();
+    }
+
+    int64_t
+    CompactCodec::readSigned(Reader& in)
+    {
+      uint64_t value = readVarint(in);
+      return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+    }
+
+    uint64_t
+    CompactCodec::readFixed(Reader& in, unsigned size)
+    {
+      if ((unsigned)(in.end - in.ptr) < size)
+        throw BufferTooShort();
+
+      uint64_t bits = 0;
+      for (unsigned i = 0; i < size; ++i)
+        bits |= (uint64_t)in.ptr[i] << (8 * i);
+
+      in.ptr += size;
+      return bits;
+    }
+
+    template <typename Type>
+    Type
+    CompactCodec::readNative(Reader& in)
+    {
+      if ((unsigned)(in.end - in.ptr) < sizeof(Type))
+        throw BufferTooShort();
+
+      Type value;
+      std::memcpy(&value, in.ptr, sizeof(Type));
+      in.ptr += sizeof(Type);
+      return value;
+    }
+
+    CompactCodec::CompactCodec(void):
+      m_key_interval(c_key_interval),
+      m_field_mask(true),
+      m_digest(0),
+      m_quantized(false)
+    { }
+
+    void
+    CompactCodec::setKeyInterval(unsigned interval)
+    {
+      m_key_interval = (interval == 0) ? 1 : interval;
+    }
+
+    void
+    CompactCodec::setFieldMask(bool enabled)
+    {
+      m_field_mask = enabled;
+    }
+
+    void
+    CompactCodec::setPrecision(uint16_t msg_id, const std::string& field, double precision)
+    {
+      const Schema::Message* schema = getSchema(msg_id);
+      int index = Schema::findField(schema, field);
+      if (index < 0)
+        throw std::runtime_error("invalid field: " + field);
+
+      Schema::FieldType type = schema->fields[index].type;
+      if (type != Schema::TYPE_FP32 && type != Schema::TYPE_FP64)
+        throw std::runtime_error("field is not floating point: " + field);
+
+      getPrecisions(schema);
+      m_precision[msg_id][index] = (precision > 0) ? precision : 0;
+    }
+
+    double
+    CompactCodec::getPrecision(uint16_t msg_id, const std::string& field)
+    {
+      const Schema::Message* schema = getSchema(msg_id);
+      int index = Schema::findField(schema, field);
+      if (index < 0)
+        throw std::runtime_error("invalid field: " + field);
+
+      return getPrecisions(schema)[index];
+    }
+
+    void
+    CompactCodec::reset(void)
+    {
+      m_tx.clear();
+      m_rx.clear();
+    }
+
+    const std::vector<double>&
+    CompactCodec::getPrecisions(const Schema::Message* schema)
+    {
+      std::map<uint16_t, std::vector<double> >::iterator itr = m_precision.find(schema->id);
+      if (itr != m_precision.end())
+        return itr->second;
+
+      std::vector<double>& precisions = m_precision[schema->id];
+      precisions.resize(schema->fields.size(), 0);
+      return precisions;
+    }
+
+    const Schema::Message*
+    CompactCodec::getSchema(uint16_t id)
+    {
+      const Schema::Message* schema = Schema::find(id);
+      if (schema == NULL)
+        throw InvalidMessageId(id);
+
+      return schema;
+    }
+
+    void
+    CompactCodec::encode(const Message* msg, std::vector<uint8_t>& frame)
+    {
+      const Schema::Message* schema = getSchema(msg->getId());
+
+      m_scratch.resize(msg->getPayloadSerializationSize());
+      if (!m_scratch.empty())
+        msg->serializeFields(&m_scratch[0]);
+
+      Reference& ref = m_tx[msg->getSource()];
+      int64_t delta = 0;
+      bool key = !ref.valid || ref.count >= m_key_interval;
+
+      if (!key)
+      {
+        double offset = std::floor((msg->getTimeStamp() - ref.timestamp) * 1000.0 + 0.5);
+        if (std::fabs(offset) > c_max_delta)
+          key = true;
+        else
+          delta = (int64_t)offset;
+      }
+
+      uint8_t flags = m_field_mask ? c_flag_mask : 0;
+
+      if (key)
+      {
+        ref.valid = true;
+        ++ref.seq;
+        ref.count = 0;
+        ref.timestamp = msg->getTimeStamp();
+        ref.src_ent = msg->getSourceEntity();
+        ref.dst = msg->getDestination();
+        ref.dst_ent = msg->getDestinationEntity();
+        flags |= c_flag_key;
+      }
+      else
+      {
+        if (msg->getSourceEntity() != ref.src_ent)
+          flags |= c_flag_src_ent;
+        if (msg->getDestination() != ref.dst)
+          flags |= c_flag_dst;
+        if (msg->getDestinationEntity() != ref.dst_ent)
+          flags |= c_flag_dst_ent;
+      }
+
+      ++ref.count;
+
+      frame.clear();
+      frame.push_back(flags);
+      writeVarint(msg->getSource(), frame);
+      frame.push_back(ref.seq);
+      writeVarint(msg->getId(), frame);
+
+      if (key)
+      {
+        uint64_t bits = 0;
+        fp64_t timestamp = msg->getTimeStamp();
+        std::memcpy(&bits, &timestamp, sizeof(bits));
+        writeFixed(bits, sizeof(bits), frame);
+        frame.push_back(ref.src_ent);
+        writeVarint(ref.dst, frame);
+        frame.push_back(ref.dst_ent);
+      }
+      else
+      {
+        writeSigned(delta, frame);
+        if (flags & c_flag_src_ent)
+          frame.push_back(msg->getSourceEntity());
+        if (flags & c_flag_dst)
+          writeVarint(msg->getDestination(), frame);
+        if (flags & c_flag_dst_ent)
+          frame.push_back(msg->getDestinationEntity());
+      }
+
+      Reader in;
+      in.ptr = m_scratch.empty() ? NULL : &m_scratch[0];
+      in.end = in.ptr + m_scratch.size();
+      m_digest = 2166136261u;
+      m_quantized = false;
+      encodeMessage(schema, in, frame);
+
+      if (m_quantized)
+      {
+        frame[0] |= c_flag_precision;
+        frame.push_back((uint8_t)(m_digest ^ (m_digest >> 8) ^ (m_digest >> 16) ^ (m_digest >> 24)));
+      }
+    }
+
+    Message*
+    CompactCodec::decode(const uint8_t* data, unsigned size)
+    {
+      Reader in;
+      in.ptr = data;
+      in.end = data + size;
+
+      if (in.ptr == in.end)
+        throw BufferTooShort();
+
+      uint8_t flags = *in.ptr++;
+      uint16_t src = (uint16_t)readVarint(in);
+      if (in.ptr == in.end)
+        throw BufferTooShort();
+      uint8_t seq = *in.ptr++;
+      uint16_t id = (uint16_t)readVarint(in);
+      const Schema::Message* schema = getSchema(id);
+
+      Reference& ref = m_rx[src];
+      fp64_t timestamp = 0;
+      uint8_t src_ent = 0;
+      uint16_t dst = 0;
+      uint8_t dst_ent = 0;
+
+      if (flags & c_flag_key)
+      {
+        uint64_t bits = readFixed(in, sizeof(bits));
+        std::memcpy(&timestamp, &bits, sizeof(timestamp));
+        src_ent = readByte(in);
+        dst = (uint16_t)readVarint(in);
+        dst_ent = readByte(in);
+
+        ref.valid = true;
+        ref.seq = seq;
+        ref.timestamp = timestamp;
+        ref.src_ent = src_ent;
+        ref.dst = dst;
+        ref.dst_ent = dst_ent;
+      }
+      else
+      {
+        if (!ref.valid || ref.seq != seq)
+          throw MissingKeyHeader(src);
+
+        timestamp = ref.timestamp + readSigned(in) / 1000.0;
+        src_ent = (flags & c_flag_src_ent) ? readByte(in) : ref.src_ent;
+        dst = (flags & c_flag_dst) ? (uint16_t)readVarint(in) : ref.dst;
+        dst_ent = (flags & c_flag_dst_ent) ? readByte(in) : ref.dst_ent;
+      }
+
+      m_scratch.clear();
+      m_digest = 2166136261u;
+      m_quantized = false;
+      decodeMessage(schema, (flags & c_flag_mask) != 0, in, m_scratch);
+
+      if (m_quantized != ((flags & c_flag_precision) != 0))
+        throw PrecisionMismatch(id);
+
+      if (m_quantized)
+      {
+        uint8_t digest = (uint8_t)(m_digest ^ (m_digest >> 8) ^ (m_digest >> 16) ^ (m_digest >> 24));
+        if (readByte(in) != digest)
+          throw PrecisionMismatch(id);
+      }
+
+      Message* msg = Factory::produce(id);
+      if (msg == NULL)
+        throw InvalidMessageId(id);
+
+      try
+      {
+        if (!m_scratch.empty())
+          msg->deserializeFields(&m_scratch[0], m_scratch.size());
+      }
+      catch (...)
+      {
+        delete msg;
+        throw;
+      }
+
+      msg->setTimeStamp(timestamp);
+      msg->setSource(src);
+      msg->setSourceEntity(src_ent);
+      msg->setDestination(dst);
+      msg->setDestinationEntity(dst_ent);
+      return msg;
+    }
+
+    void
+    CompactCodec::addPrecision(uint16_t id, unsigned index, double precision)
+    {
+      // FNV-1a over the message, field and step of each quantized
+      // field, in the order the fields appear in the frame.
+      uint8_t data[12];
+      data[0] = (uint8_t)id;
+      data[1] = (uint8_t)(id >> 8);
+      data[2] = (uint8_t)index;
+      data[3] = (uint8_t)(index >> 8);
+      std::memcpy(data + 4, &precision, sizeof(precision));
+
+      for (unsigned i = 0; i < sizeof(data); ++i)
+        m_digest = (m_digest ^ data[i]) * 16777619u;
+
+      m_quantized = true;
+    }
+
+    void
+    CompactCodec::encodeMessage(const Schema::Message* schema, Reader& in, std::vector<uint8_t>& out)
+    {
+      const std::vector<double>& precisions = getPrecisions(schema);
+      unsigned count = schema->fields.size();
+
+      if (!m_field_mask)
+      {
+        for (unsigned i = 0; i < count; ++i)
+        {
+          if (precisions[i] > 0)
+            addPrecision(schema->id, i, precisions[i]);
+          encodeField(schema->fields[i], precisions[i], in, out);
+        }
+        return;
+      }
+
+      // Locate fields and build the mask of non-default fields.
+      std::vector<Reader> spans(count);
+      size_t mask_index = out.size();
+      out.resize(mask_index + (count + 7) / 8, 0);
+
+      for (unsigned i = 0; i < count; ++i)
+      {
+        spans[i].ptr = in.ptr;
+        in.ptr = Schema::skip(schema->fields[i], in.ptr, in.end);
+        spans[i].end = in.ptr;
+
+        if (!isDefault(schema->fields[i], spans[i].ptr, spans[i].end - spans[i].ptr))
+          out[mask_index + i / 8] |= (uint8_t)(1 << (i % 8));
+      }
+
+      for (unsigned i = 0; i < count; ++i)
+      {
+        if ((out[mask_index + i / 8] & (1 << (i % 8))) == 0)
+          continue;
+
+        if (precisions[i] > 0)
+          addPrecision(schema->id, i, precisions[i]);
+        encodeField(schema->fields[i], precisions[i], spans[i], out);
+      }
+    }
+
+    void
+    CompactCodec::encodeInline(Reader& in, std::vector<uint8_t>& out)
+    {
+      uint16_t id = readNative<uint16_t>(in);
+      if (id == DUNE_IMC_CONST_NULL_ID)
+      {
+        writeVarint(0, out);
+        return;
+      }
+
+      writeVarint((uint64_t)id + 1, out);
+      encodeMessage(getSchema(id), in, out);
+    }
+
+    void
+    CompactCodec::encodeField(const Schema::Field& field, double precision, Reader& in, std::vector<uint8_t>& out)
+    {
+      switch (field.type)
+      {
+        case Schema::TYPE_UINT8:
+        case Schema::TYPE_INT8:
+          out.push_back(readByte(in));
+          break;
+
+        case Schema::TYPE_UINT16:
+          writeVarint(readNative<uint16_t>(in), out);
+          break;
+
+        case Schema::TYPE_UINT32:
+          writeVarint(readNative<uint32_t>(in), out);
+          break;
+
+        case Schema::TYPE_INT16:
+          writeSigned(readNative<int16_t>(in), out);
+          break;
+
+        case Schema::TYPE_INT32:
+          writeSigned(readNative<int32_t>(in), out);
+          break;
+
+        case Schema::TYPE_INT64:
+          writeSigned(readNative<int64_t>(in), out);
+          break;
+
+        case Schema::TYPE_FP32:
+        case Schema::TYPE_FP64:
+          {
+            unsigned size = Schema::getTypeSize(field.type);
+            double value = 0;
+            uint64_t bits = 0;
+
+            if (field.type == Schema::TYPE_FP32)
+            {
+              fp32_t v = readNative<fp32_t>(in);
+              uint32_t b = 0;
+              std::memcpy(&b, &v, sizeof(b));
+              value = v;
+              bits = b;
+            }
+            else
+            {
+              value = readNative<fp64_t>(in);
+              std::memcpy(&bits, &value, sizeof(bits));
+            }
+
+            if (precision <= 0)
+            {
+              writeFixed(bits, size, out);
+              break;
+            }
+
+            // Quantized values are offset by one, zero escapes to the
+            // raw bit pattern of values that cannot be quantized.
+            double q = std::floor(value / precision + 0.5);
+            if (std::fabs(q) < c_max_quantized)
+            {
+              int64_t n = (int64_t)q;
+              writeVarint((((uint64_t)n << 1) ^ (uint64_t)(n >> 63)) + 1, out);
+            }
+            else
+            {
+              writeVarint(0, out);
+              writeFixed(bits, size, out);
+            }
+          }
+          break;
+
+        case Schema::TYPE_RAWDATA:
+        case Schema::TYPE_PLAINTEXT:
+          {
+            uint16_t size = readNative<uint16_t>(in);
+            if (in.end - in.ptr < size)
+              throw BufferTooShort();
+
+            writeVarint(size, out);
+            writeBytes(in.ptr, size, out);
+            in.ptr += size;
+          }
+          break;
+
+        case Schema::TYPE_MESSAGE:
+          encodeInline(in, out);
+          break;
+
+        case Schema::TYPE_MESSAGE_LIST:
+          {
+            uint16_t count = readNative<uint16_t>(in);
+            writeVarint(count, out);
+            for (unsigned i = 0; i < count; ++i)
+              encodeInline(in, out);
+          }
+          break;
+      }
+    }
+
+    void
+    CompactCodec::decodeMessage(const Schema::Message* schema, bool mask, Reader& in, std::vector<uint8_t>& out)
+    {
+      const std::vector<double>& precisions = getPrecisions(schema);
+      unsigned count = schema->fields.size();
+      const uint8_t* bits = NULL;
+
+      if (mask)
+      {
+        unsigned size = (count + 7) / 8;
+        if ((unsigned)(in.end - in.ptr) < size)
+          throw BufferTooShort();
+
+        bits = in.ptr;
+        in.ptr += size;
+      }
+
+      for (unsigned i = 0; i < count; ++i)
+      {
+        if (bits != NULL && (bits[i / 8] & (1 << (i % 8))) == 0)
+        {
+          writeDefault(schema->fields[i], out);
+          continue;
+        }
+
+        if (precisions[i] > 0)
+          addPrecision(schema->id, i, precisions[i]);
+        decodeField(schema->fields[i], precisions[i], mask, in, out);
+      }
+    }
+
+    void
+    CompactCodec::decodeInline(bool mask, Reader& in, std::vector<uint8_t>& out)
+    {
+      uint64_t tag = readVarint(in);
+      if (tag == 0)
+      {
+        writeNative<uint16_t>(DUNE_IMC_CONST_NULL_ID, out);
+        return;
+      }
+
+      uint16_t id = (uint16_t)(tag - 1);
+      writeNative<uint16_t>(id, out);
+      decodeMessage(getSchema(id), mask, in, out);
+    }
+
+    void
+    CompactCodec::decodeField(const Schema::Field& field, double precision, bool mask, Reader& in, std::vector<uint8_t>& out)
+    {
+      switch (field.type)
+      {
+        case Schema::TYPE_UINT8:
+        case Schema::TYPE_INT8:
+          out.push_back(readByte(in));
+          break;
+
+        case Schema::TYPE_UINT16:
+          writeNative<uint16_t>((uint16_t)readVarint(in), out);
+          break;
+
+        case Schema::TYPE_UINT32:
+          writeNative<uint32_t>((uint32_t)readVarint(in), out);
+          break;
+
+        case Schema::TYPE_INT16:
+          writeNative<int16_t>((int16_t)readSigned(in), out);
+          break;
+
+        case Schema::TYPE_INT32:
+          writeNative<int32_t>((int32_t)readSigned(in), out);
+          break;
+
+        case Schema::TYPE_INT64:
+          writeNative<int64_t>(readSigned(in), out);
+          break;
+
+        case Schema::TYPE_FP32:
+        case Schema::TYPE_FP64:
+          {
+            unsigned size = Schema::getTypeSize(field.type);
+            uint64_t bits = 0;
+            double value = 0;
+            bool raw = true;
+
+            if (precision > 0)
+            {
+              uint64_t tag = readVarint(in);
+              if (tag != 0)
+              {
+                uint64_t z = tag - 1;
+                int64_t n = (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+                value = (double)n * precision;
+                raw = false;
+              }
+            }
+
+            if (raw)
+              bits = readFixed(in, size);
+
+            if (field.type == Schema::TYPE_FP32)
+            {
+              fp32_t v = (fp32_t)value;
+              if (raw)
+              {
+                uint32_t b = (uint32_t)bits;
+                std::memcpy(&v, &b, sizeof(v));
+              }
+              writeNative<fp32_t>(v, out);
+            }
+            else
+            {
+              if (raw)
+                std::memcpy(&value, &bits, sizeof(value));
+              writeNative<fp64_t>(value, out);
+            }
+          }
+          break;
+
+        case Schema::TYPE_RAWDATA:
+        case Schema::TYPE_PLAINTEXT:
+          {
+            uint64_t size = readVarint(in);
+            if (size > 0xffff || (uint64_t)(in.end - in.ptr) < size)
+              throw BufferTooShort();
+
+            writeNative<uint16_t>((uint16_t)size, out);
+            writeBytes(in.ptr, (unsigned)size, out);
+            in.ptr += size;
+          }
+          break;
+
+        case Schema::TYPE_MESSAGE:
+          decodeInline(mask, in, out);
+          break;
+
+        case Schema::TYPE_MESSAGE_LIST:
+          {
+            uint64_t count = readVarint(in);
+            if (count > 0xffff)
+              throw InvalidFormat();
+
+            writeNative<uint16_t>((uint16_t)count, out);
+            for (unsigned i = 0; i < count; ++i)
+              decodeInline(mask, in, out);
+          }
+          break;
+      }
+    }
+
+    bool
+    CompactCodec::isDefault(const Schema::Field& field, const uint8_t* data, unsigned size)
+    {
+      // Variable size fields start with a length, count or
+      // identification number: empty data, empty lists and null
+      // messages are the defaults.
+      if (field.type == Schema::TYPE_MESSAGE)
+        return size == 2 && data[0] == 0xff && data[1] == 0xff;
+
+      if (Schema::getTypeSize(field.type) == 0)
+        return size == 2 && data[0] == 0 && data[1] == 0;
+
+      for (unsigned i = 0; i < size; ++i)
+      {
+        if (data[i] != 0)
+          return false;
+      }
+
+      return true;
+    }
+
+    void
+    CompactCodec::writeDefault(const Schema::Field& field, std::vector<uint8_t>& out)
+    {
+      if (field.type == Schema::TYPE_MESSAGE)
+      {
+        writeNative<uint16_t>(DUNE_IMC_CONST_NULL_ID, out);
+        return;
+      }
+
+      unsigned size = Schema::getTypeSize(field.type);
+      out.resize(out.size() + (size == 0 ? 2 : size), 0);
+    }
+  }
+}
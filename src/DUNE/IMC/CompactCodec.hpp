@@ -0,0 +1,225 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COMPACT_CODEC_HPP_INCLUDED_
+#define DUNE_IMC_COMPACT_CODEC_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Schema.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM CompactCodec;
+
+    //! Schema-driven compact encoding of IMC messages, meant for links
+    //! that are billed per byte (acoustic modems, satellite).
+    //!
+    //! Integers are encoded as (zig-zag) varints, fields holding their
+    //! default value can be omitted using a field mask and the message
+    //! header is delta-coded against the last key header sent by the
+    //! same source. A key header is sent every N messages, so the loss
+    //! of a frame only affects frames that reference a lost key.
+    //!
+    //! Floating point fields are sent without loss unless a
+    //! quantization step is set with setPrecision(). Steps must be
+    //! set alike on both peers: frames with quantized fields carry a
+    //! digest of the steps used and decoding throws
+    //! PrecisionMismatch if the decoder's steps differ. Instances are
+    //! not thread safe.
+    class CompactCodec
+    {
+    public:
+      //! Default number of messages between key headers.
+      static const unsigned c_key_interval = 16;
+
+      //! Constructor.
+      CompactCodec(void);
+
+      //! Set the number of messages between key headers of the same
+      //! source.
+      //! @param interval number of messages, 1 to send only key
+      //! headers.
+      void
+      setKeyInterval(unsigned interval);
+
+      //! Enable or disable field masks when encoding.
+      //! @param enabled true to omit fields holding default values.
+      void
+      setFieldMask(bool enabled);
+
+      //! Set the quantization step of a floating point field.
+      //! @param msg_id message identification number.
+      //! @param field field abbreviation.
+      //! @param precision quantization step, zero to transmit the
+      //! field without loss.
+      void
+      setPrecision(uint16_t msg_id, const std::string& field, double precision);
+
+      //! Retrieve the quantization step of a field.
+      //! @param msg_id message identification number.
+      //! @param field field abbreviation.
+      //! @return quantization step, zero if the field is lossless.
+      double
+      getPrecision(uint16_t msg_id, const std::string& field);
+
+      //! Encode a message.
+      //! @param msg message.
+      //! @param frame output frame (previous contents are discarded).
+      void
+      encode(const Message* msg, std::vector<uint8_t>& frame);
+
+      //! Decode a message.
+      //! @param data frame data.
+      //! @param size frame size.
+      //! @return message allocated on the heap.
+      Message*
+      decode(const uint8_t* data, unsigned size);
+
+      //! Forget all key headers, forcing the next message of every
+      //! source to carry a key header.
+      void
+      reset(void);
+
+    private:
+      //! Header reference of a source.
+      struct Reference
+      {
+        //! True if a key header was sent or received.
+        bool valid;
+        //! Key sequence number.
+        uint8_t seq;
+        //! Number of messages since the key header.
+        unsigned count;
+        //! Key timestamp.
+        fp64_t timestamp;
+        //! Key source entity.
+        uint8_t src_ent;
+        //! Key destination.
+        uint16_t dst;
+        //! Key destination entity.
+        uint8_t dst_ent;
+
+        Reference(void):
+          valid(false),
+          seq(0),
+          count(0),
+          timestamp(0),
+          src_ent(0),
+          dst(0),
+          dst_ent(0)
+        { }
+      };
+
+      //! Bounded reader over a buffer.
+      struct Reader
+      {
+        const uint8_t* ptr;
+        const uint8_t* end;
+      };
+
+      //! Messages between key headers.
+      unsigned m_key_interval;
+      //! True to encode field masks.
+      bool m_field_mask;
+      //! Encoder references, by source.
+      std::map<uint16_t, Reference> m_tx;
+      //! Decoder references, by source.
+      std::map<uint16_t, Reference> m_rx;
+      //! Quantization steps by message identification number.
+      std::map<uint16_t, std::vector<double> > m_precision;
+      //! Scratch buffer holding standard serialized payloads.
+      std::vector<uint8_t> m_scratch;
+      //! Digest of the quantization steps of the current frame.
+      uint32_t m_digest;
+      //! True if the current frame has quantized fields.
+      bool m_quantized;
+
+      const std::vector<double>&
+      getPrecisions(const Schema::Message* schema);
+
+      const Schema::Message*
+      getSchema(uint16_t id);
+
+      void
+      addPrecision(uint16_t id, unsigned index, double precision);
+
+      void
+      encodeMessage(const Schema::Message* schema, Reader& in, std::vector<uint8_t>& out);
+
+      void
+      encodeInline(Reader& in, std::vector<uint8_t>& out);
+
+      void
+      encodeField(const Schema::Field& field, double precision, Reader& in, std::vector<uint8_t>& out);
+
+      void
+      decodeMessage(const Schema::Message* schema, bool mask, Reader& in, std::vector<uint8_t>& out);
+
+      void
+      decodeInline(bool mask, Reader& in, std::vector<uint8_t>& out);
+
+      void
+      decodeField(const Schema::Field& field, double precision, bool mask, Reader& in, std::vector<uint8_t>& out);
+
+      static bool
+      isDefault(const Schema::Field& field, const uint8_t* data, unsigned size);
+
+      static void
+      writeDefault(const Schema::Field& field, std::vector<uint8_t>& out);
+
+      static uint8_t
+      readByte(Reader& in);
+
+      static uint64_t
+      readVarint(Reader& in);
+
+      static int64_t
+      readSigned(Reader& in);
+
+      static uint64_t
+      readFixed(Reader& in, unsigned size);
+
+      template <typename Type>
+      static Type
+      readNative(Reader& in);
+    };
+  }
+}
+
+#endif
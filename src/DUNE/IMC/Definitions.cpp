@@ -118,9 +118,12 @@ namespace DUNE
       IMC::toJSON(os__, "description", description, nindent__);
     }
 
+    const uint16_t QueryEntityState::c_payload_size;
+
     QueryEntityState::QueryEntityState(void)
     {
       m_header.mgid = 2;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -249,9 +252,12 @@ namespace DUNE
       IMC::toJSON(os__, "deact_time", deact_time, nindent__);
     }
 
+    const uint16_t QueryEntityInfo::c_payload_size;
+
     QueryEntityInfo::QueryEntityInfo(void)
     {
       m_header.mgid = 4;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -278,25 +284,24 @@ namespace DUNE
     uint8_t*
     QueryEntityInfo::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     QueryEntityInfo::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     QueryEntityInfo::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
@@ -379,9 +384,12 @@ namespace DUNE
       IMC::toJSON(os__, "list", list, nindent__);
     }
 
+    const uint16_t CpuUsage::c_payload_size;
+
     CpuUsage::CpuUsage(void)
     {
       m_header.mgid = 7;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -409,25 +417,24 @@ namespace DUNE
     uint8_t*
     CpuUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     CpuUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     CpuUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -510,9 +517,12 @@ namespace DUNE
       IMC::toJSON(os__, "message_id", message_id, nindent__);
     }
 
+    const uint16_t RestartSystem::c_payload_size;
+
     RestartSystem::RestartSystem(void)
     {
       m_header.mgid = 9;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -549,9 +559,12 @@ namespace DUNE
       return 0;
     }
 
+    const uint16_t DevCalibrationControl::c_payload_size;
+
     DevCalibrationControl::DevCalibrationControl(void)
     {
       m_header.mgid = 12;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -578,25 +591,24 @@ namespace DUNE
     uint8_t*
     DevCalibrationControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DevCalibrationControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DevCalibrationControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -741,9 +753,12 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    const uint16_t QueryEntityActivationState::c_payload_size;
+
     QueryEntityActivationState::QueryEntityActivationState(void)
     {
       m_header.mgid = 15;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -780,9 +795,12 @@ namespace DUNE
       return 0;
     }
 
+    const uint16_t VehicleOperationalLimits::c_payload_size;
+
     VehicleOperationalLimits::VehicleOperationalLimits(void)
     {
       m_header.mgid = 16;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -858,76 +876,75 @@ namespace DUNE
     uint8_t*
     VehicleOperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(speed_min, ptr__);
-      ptr__ += IMC::serialize(speed_max, ptr__);
-      ptr__ += IMC::serialize(long_accel, ptr__);
-      ptr__ += IMC::serialize(alt_max_msl, ptr__);
-      ptr__ += IMC::serialize(dive_fraction_max, ptr__);
-      ptr__ += IMC::serialize(climb_fraction_max, ptr__);
-      ptr__ += IMC::serialize(bank_max, ptr__);
-      ptr__ += IMC::serialize(p_max, ptr__);
-      ptr__ += IMC::serialize(pitch_min, ptr__);
-      ptr__ += IMC::serialize(pitch_max, ptr__);
-      ptr__ += IMC::serialize(q_max, ptr__);
-      ptr__ += IMC::serialize(g_min, ptr__);
-      ptr__ += IMC::serialize(g_max, ptr__);
-      ptr__ += IMC::serialize(g_lat_max, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(rpm_rate_max, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(speed_min, bfr__ + 1);
+      IMC::serialize(speed_max, bfr__ + 5);
+      IMC::serialize(long_accel, bfr__ + 9);
+      IMC::serialize(alt_max_msl, bfr__ + 13);
+      IMC::serialize(dive_fraction_max, bfr__ + 17);
+      IMC::serialize(climb_fraction_max, bfr__ + 21);
+      IMC::serialize(bank_max, bfr__ + 25);
+      IMC::serialize(p_max, bfr__ + 29);
+      IMC::serialize(pitch_min, bfr__ + 33);
+      IMC::serialize(pitch_max, bfr__ + 37);
+      IMC::serialize(q_max, bfr__ + 41);
+      IMC::serialize(g_min, bfr__ + 45);
+      IMC::serialize(g_max, bfr__ + 49);
+      IMC::serialize(g_lat_max, bfr__ + 53);
+      IMC::serialize(rpm_min, bfr__ + 57);
+      IMC::serialize(rpm_max, bfr__ + 61);
+      IMC::serialize(rpm_rate_max, bfr__ + 65);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     VehicleOperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::deserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::deserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::deserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::deserialize(p_max, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::deserialize(q_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_min, bfr__, size__);
-      bfr__ += IMC::deserialize(g_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(speed_min, bfr__ + 1);
+      IMC::load(speed_max, bfr__ + 5);
+      IMC::load(long_accel, bfr__ + 9);
+      IMC::load(alt_max_msl, bfr__ + 13);
+      IMC::load(dive_fraction_max, bfr__ + 17);
+      IMC::load(climb_fraction_max, bfr__ + 21);
+      IMC::load(bank_max, bfr__ + 25);
+      IMC::load(p_max, bfr__ + 29);
+      IMC::load(pitch_min, bfr__ + 33);
+      IMC::load(pitch_max, bfr__ + 37);
+      IMC::load(q_max, bfr__ + 41);
+      IMC::load(g_min, bfr__ + 45);
+      IMC::load(g_max, bfr__ + 49);
+      IMC::load(g_lat_max, bfr__ + 53);
+      IMC::load(rpm_min, bfr__ + 57);
+      IMC::load(rpm_max, bfr__ + 61);
+      IMC::load(rpm_rate_max, bfr__ + 65);
+      return c_payload_size;
     }
 
     uint16_t
     VehicleOperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(speed_min, bfr__ + 1);
+      IMC::reverseLoad(speed_max, bfr__ + 5);
+      IMC::reverseLoad(long_accel, bfr__ + 9);
+      IMC::reverseLoad(alt_max_msl, bfr__ + 13);
+      IMC::reverseLoad(dive_fraction_max, bfr__ + 17);
+      IMC::reverseLoad(climb_fraction_max, bfr__ + 21);
+      IMC::reverseLoad(bank_max, bfr__ + 25);
+      IMC::reverseLoad(p_max, bfr__ + 29);
+      IMC::reverseLoad(pitch_min, bfr__ + 33);
+      IMC::reverseLoad(pitch_max, bfr__ + 37);
+      IMC::reverseLoad(q_max, bfr__ + 41);
+      IMC::reverseLoad(g_min, bfr__ + 45);
+      IMC::reverseLoad(g_max, bfr__ + 49);
+      IMC::reverseLoad(g_lat_max, bfr__ + 53);
+      IMC::reverseLoad(rpm_min, bfr__ + 57);
+      IMC::reverseLoad(rpm_max, bfr__ + 61);
+      IMC::reverseLoad(rpm_rate_max, bfr__ + 65);
+      return c_payload_size;
     }
 
     void
@@ -1040,9 +1057,12 @@ namespace DUNE
       msgs.setDestinationEntity(value__);
     }
 
+    const uint16_t SimulatedState::c_payload_size;
+
     SimulatedState::SimulatedState(void)
     {
       m_header.mgid = 50;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -1111,76 +1131,75 @@ namespace DUNE
     uint8_t*
     SimulatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(svx, ptr__);
-      ptr__ += IMC::serialize(svy, ptr__);
-      ptr__ += IMC::serialize(svz, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(height, bfr__ + 16);
+      IMC::serialize(x, bfr__ + 20);
+      IMC::serialize(y, bfr__ + 24);
+      IMC::serialize(z, bfr__ + 28);
+      IMC::serialize(phi, bfr__ + 32);
+      IMC::serialize(theta, bfr__ + 36);
+      IMC::serialize(psi, bfr__ + 40);
+      IMC::serialize(u, bfr__ + 44);
+      IMC::serialize(v, bfr__ + 48);
+      IMC::serialize(w, bfr__ + 52);
+      IMC::serialize(p, bfr__ + 56);
+      IMC::serialize(q, bfr__ + 60);
+      IMC::serialize(r, bfr__ + 64);
+      IMC::serialize(svx, bfr__ + 68);
+      IMC::serialize(svy, bfr__ + 72);
+      IMC::serialize(svz, bfr__ + 76);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SimulatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(svx, bfr__, size__);
-      bfr__ += IMC::deserialize(svy, bfr__, size__);
-      bfr__ += IMC::deserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(height, bfr__ + 16);
+      IMC::load(x, bfr__ + 20);
+      IMC::load(y, bfr__ + 24);
+      IMC::load(z, bfr__ + 28);
+      IMC::load(phi, bfr__ + 32);
+      IMC::load(theta, bfr__ + 36);
+      IMC::load(psi, bfr__ + 40);
+      IMC::load(u, bfr__ + 44);
+      IMC::load(v, bfr__ + 48);
+      IMC::load(w, bfr__ + 52);
+      IMC::load(p, bfr__ + 56);
+      IMC::load(q, bfr__ + 60);
+      IMC::load(r, bfr__ + 64);
+      IMC::load(svx, bfr__ + 68);
+      IMC::load(svy, bfr__ + 72);
+      IMC::load(svz, bfr__ + 76);
+      return c_payload_size;
     }
 
     uint16_t
     SimulatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(height, bfr__ + 16);
+      IMC::reverseLoad(x, bfr__ + 20);
+      IMC::reverseLoad(y, bfr__ + 24);
+      IMC::reverseLoad(z, bfr__ + 28);
+      IMC::reverseLoad(phi, bfr__ + 32);
+      IMC::reverseLoad(theta, bfr__ + 36);
+      IMC::reverseLoad(psi, bfr__ + 40);
+      IMC::reverseLoad(u, bfr__ + 44);
+      IMC::reverseLoad(v, bfr__ + 48);
+      IMC::reverseLoad(w, bfr__ + 52);
+      IMC::reverseLoad(p, bfr__ + 56);
+      IMC::reverseLoad(q, bfr__ + 60);
+      IMC::reverseLoad(r, bfr__ + 64);
+      IMC::reverseLoad(svx, bfr__ + 68);
+      IMC::reverseLoad(svy, bfr__ + 72);
+      IMC::reverseLoad(svz, bfr__ + 76);
+      return c_payload_size;
     }
 
     void
@@ -1336,9 +1355,12 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    const uint16_t DynamicsSimParam::c_payload_size;
+
     DynamicsSimParam::DynamicsSimParam(void)
     {
       m_header.mgid = 53;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -1369,31 +1391,30 @@ namespace DUNE
     uint8_t*
     DynamicsSimParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(tas2acc_pgain, ptr__);
-      ptr__ += IMC::serialize(bank2p_pgain, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(tas2acc_pgain, bfr__ + 1);
+      IMC::serialize(bank2p_pgain, bfr__ + 5);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DynamicsSimParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(tas2acc_pgain, bfr__ + 1);
+      IMC::load(bank2p_pgain, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
     DynamicsSimParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(tas2acc_pgain, bfr__ + 1);
+      IMC::reverseLoad(bank2p_pgain, bfr__ + 5);
+      return c_payload_size;
     }
 
     void
@@ -1404,9 +1425,12 @@ namespace DUNE
       IMC::toJSON(os__, "bank2p_pgain", bank2p_pgain, nindent__);
     }
 
+    const uint16_t StorageUsage::c_payload_size;
+
     StorageUsage::StorageUsage(void)
     {
       m_header.mgid = 100;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -1436,28 +1460,27 @@ namespace DUNE
     uint8_t*
     StorageUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(available, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(available, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     StorageUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(available, bfr__ + 0);
+      IMC::load(value, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     StorageUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(available, bfr__ + 0);
+      IMC::load(value, bfr__ + 4);
+      return c_payload_size;
     }
 
     fp64_t
@@ -1890,9 +1913,12 @@ namespace DUNE
       IMC::toJSON(os__, "file", file, nindent__);
     }
 
+    const uint16_t ClockControl::c_payload_size;
+
     ClockControl::ClockControl(void)
     {
       m_header.mgid = 106;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -1924,31 +1950,30 @@ namespace DUNE
     uint8_t*
     ClockControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(clock, ptr__);
-      ptr__ += IMC::serialize(tz, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(clock, bfr__ + 1);
+      IMC::serialize(tz, bfr__ + 9);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ClockControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(clock, bfr__ + 1);
+      IMC::load(tz, bfr__ + 9);
+      return c_payload_size;
     }
 
     uint16_t
     ClockControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(clock, bfr__ + 1);
+      IMC::load(tz, bfr__ + 9);
+      return c_payload_size;
     }
 
     void
@@ -1959,9 +1984,12 @@ namespace DUNE
       IMC::toJSON(os__, "tz", tz, nindent__);
     }
 
+    const uint16_t HistoricCTD::c_payload_size;
+
     HistoricCTD::HistoricCTD(void)
     {
       m_header.mgid = 107;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -1992,31 +2020,30 @@ namespace DUNE
     uint8_t*
     HistoricCTD::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(conductivity, ptr__);
-      ptr__ += IMC::serialize(temperature, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      return ptr__;
+      IMC::serialize(conductivity, bfr__ + 0);
+      IMC::serialize(temperature, bfr__ + 4);
+      IMC::serialize(depth, bfr__ + 8);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     HistoricCTD::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::deserialize(temperature, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(conductivity, bfr__ + 0);
+      IMC::load(temperature, bfr__ + 4);
+      IMC::load(depth, bfr__ + 8);
+      return c_payload_size;
     }
 
     uint16_t
     HistoricCTD::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(temperature, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(conductivity, bfr__ + 0);
+      IMC::reverseLoad(temperature, bfr__ + 4);
+      IMC::reverseLoad(depth, bfr__ + 8);
+      return c_payload_size;
     }
 
     void
@@ -2027,9 +2054,12 @@ namespace DUNE
       IMC::toJSON(os__, "depth", depth, nindent__);
     }
 
+    const uint16_t HistoricTelemetry::c_payload_size;
+
     HistoricTelemetry::HistoricTelemetry(void)
     {
       m_header.mgid = 108;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -2064,37 +2094,36 @@ namespace DUNE
     uint8_t*
     HistoricTelemetry::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(altitude, ptr__);
-      ptr__ += IMC::serialize(roll, ptr__);
-      ptr__ += IMC::serialize(pitch, ptr__);
-      ptr__ += IMC::serialize(yaw, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      return ptr__;
+      IMC::serialize(altitude, bfr__ + 0);
+      IMC::serialize(roll, bfr__ + 4);
+      IMC::serialize(pitch, bfr__ + 6);
+      IMC::serialize(yaw, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 10);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     HistoricTelemetry::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(roll, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch, bfr__, size__);
-      bfr__ += IMC::deserialize(yaw, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(altitude, bfr__ + 0);
+      IMC::load(roll, bfr__ + 4);
+      IMC::load(pitch, bfr__ + 6);
+      IMC::load(yaw, bfr__ + 8);
+      IMC::load(speed, bfr__ + 10);
+      return c_payload_size;
     }
 
     uint16_t
     HistoricTelemetry::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(roll, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(yaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(altitude, bfr__ + 0);
+      IMC::reverseLoad(roll, bfr__ + 4);
+      IMC::reverseLoad(pitch, bfr__ + 6);
+      IMC::reverseLoad(yaw, bfr__ + 8);
+      IMC::reverseLoad(speed, bfr__ + 10);
+      return c_payload_size;
     }
 
     void
@@ -2261,9 +2290,12 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    const uint16_t Heartbeat::c_payload_size;
+
     Heartbeat::Heartbeat(void)
     {
       m_header.mgid = 150;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -2456,9 +2488,12 @@ namespace DUNE
       IMC::toJSON(os__, "service_type", service_type, nindent__);
     }
 
+    const uint16_t RSSI::c_payload_size;
+
     RSSI::RSSI(void)
     {
       m_header.mgid = 153;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -2486,25 +2521,24 @@ namespace DUNE
     uint8_t*
     RSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     RSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     RSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -2525,9 +2559,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t VSWR::c_payload_size;
+
     VSWR::VSWR(void)
     {
       m_header.mgid = 154;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -2554,25 +2591,24 @@ namespace DUNE
     uint8_t*
     VSWR::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     VSWR::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     VSWR::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -2593,9 +2629,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t LinkLevel::c_payload_size;
+
     LinkLevel::LinkLevel(void)
     {
       m_header.mgid = 155;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -2622,25 +2661,24 @@ namespace DUNE
     uint8_t*
     LinkLevel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     LinkLevel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     LinkLevel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -3347,9 +3385,12 @@ namespace DUNE
       IMC::toJSON(os__, "grouplist", grouplist, nindent__);
     }
 
+    const uint16_t LinkLatency::c_payload_size;
+
     LinkLatency::LinkLatency(void)
     {
       m_header.mgid = 182;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -3379,28 +3420,27 @@ namespace DUNE
     uint8_t*
     LinkLatency::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(sys_src, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(sys_src, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     LinkLatency::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(sys_src, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     LinkLatency::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::reverseLoad(sys_src, bfr__ + 4);
+      return c_payload_size;
     }
 
     fp64_t
@@ -3422,9 +3462,12 @@ namespace DUNE
       IMC::toJSON(os__, "sys_src", sys_src, nindent__);
     }
 
+    const uint16_t ExtendedRSSI::c_payload_size;
+
     ExtendedRSSI::ExtendedRSSI(void)
     {
       m_header.mgid = 183;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -3453,28 +3496,27 @@ namespace DUNE
     uint8_t*
     ExtendedRSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(units, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ExtendedRSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(units, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     ExtendedRSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(units, bfr__ + 4);
+      return c_payload_size;
     }
 
     fp64_t
@@ -4053,9 +4095,12 @@ namespace DUNE
       }
     }
 
+    const uint16_t LblRange::c_payload_size;
+
     LblRange::LblRange(void)
     {
       m_header.mgid = 200;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -4084,28 +4129,27 @@ namespace DUNE
     uint8_t*
     LblRange::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(range, bfr__ + 1);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     LblRange::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(range, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
     LblRange::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(range, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
@@ -4536,9 +4580,12 @@ namespace DUNE
       }
     }
 
+    const uint16_t AcousticSystemsQuery::c_payload_size;
+
     AcousticSystemsQuery::AcousticSystemsQuery(void)
     {
       m_header.mgid = 212;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -4699,9 +4746,12 @@ namespace DUNE
       IMC::toJSON(os__, "integrity", integrity, nindent__);
     }
 
+    const uint16_t Rpm::c_payload_size;
+
     Rpm::Rpm(void)
     {
       m_header.mgid = 250;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -4728,25 +4778,24 @@ namespace DUNE
     uint8_t*
     Rpm::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Rpm::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Rpm::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -4767,9 +4816,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Voltage::c_payload_size;
+
     Voltage::Voltage(void)
     {
       m_header.mgid = 251;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -4796,25 +4848,24 @@ namespace DUNE
     uint8_t*
     Voltage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Voltage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Voltage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -4835,9 +4886,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Current::c_payload_size;
+
     Current::Current(void)
     {
       m_header.mgid = 252;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -4864,25 +4918,24 @@ namespace DUNE
     uint8_t*
     Current::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Current::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Current::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -4903,9 +4956,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t GpsFix::c_payload_size;
+
     GpsFix::GpsFix(void)
     {
       m_header.mgid = 253;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -4964,70 +5020,69 @@ namespace DUNE
     uint8_t*
     GpsFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(utc_year, ptr__);
-      ptr__ += IMC::serialize(utc_month, ptr__);
-      ptr__ += IMC::serialize(utc_day, ptr__);
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(sog, ptr__);
-      ptr__ += IMC::serialize(hdop, ptr__);
-      ptr__ += IMC::serialize(vdop, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 2);
+      IMC::serialize(utc_year, bfr__ + 3);
+      IMC::serialize(utc_month, bfr__ + 5);
+      IMC::serialize(utc_day, bfr__ + 6);
+      IMC::serialize(utc_time, bfr__ + 7);
+      IMC::serialize(lat, bfr__ + 11);
+      IMC::serialize(lon, bfr__ + 19);
+      IMC::serialize(height, bfr__ + 27);
+      IMC::serialize(satellites, bfr__ + 31);
+      IMC::serialize(cog, bfr__ + 32);
+      IMC::serialize(sog, bfr__ + 36);
+      IMC::serialize(hdop, bfr__ + 40);
+      IMC::serialize(vdop, bfr__ + 44);
+      IMC::serialize(hacc, bfr__ + 48);
+      IMC::serialize(vacc, bfr__ + 52);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GpsFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(sog, bfr__, size__);
-      bfr__ += IMC::deserialize(hdop, bfr__, size__);
-      bfr__ += IMC::deserialize(vdop, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::load(utc_year, bfr__ + 3);
+      IMC::load(utc_month, bfr__ + 5);
+      IMC::load(utc_day, bfr__ + 6);
+      IMC::load(utc_time, bfr__ + 7);
+      IMC::load(lat, bfr__ + 11);
+      IMC::load(lon, bfr__ + 19);
+      IMC::load(height, bfr__ + 27);
+      IMC::load(satellites, bfr__ + 31);
+      IMC::load(cog, bfr__ + 32);
+      IMC::load(sog, bfr__ + 36);
+      IMC::load(hdop, bfr__ + 40);
+      IMC::load(vdop, bfr__ + 44);
+      IMC::load(hacc, bfr__ + 48);
+      IMC::load(vacc, bfr__ + 52);
+      return c_payload_size;
     }
 
     uint16_t
     GpsFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::reverseLoad(utc_year, bfr__ + 3);
+      IMC::load(utc_month, bfr__ + 5);
+      IMC::load(utc_day, bfr__ + 6);
+      IMC::reverseLoad(utc_time, bfr__ + 7);
+      IMC::reverseLoad(lat, bfr__ + 11);
+      IMC::reverseLoad(lon, bfr__ + 19);
+      IMC::reverseLoad(height, bfr__ + 27);
+      IMC::load(satellites, bfr__ + 31);
+      IMC::reverseLoad(cog, bfr__ + 32);
+      IMC::reverseLoad(sog, bfr__ + 36);
+      IMC::reverseLoad(hdop, bfr__ + 40);
+      IMC::reverseLoad(vdop, bfr__ + 44);
+      IMC::reverseLoad(hacc, bfr__ + 48);
+      IMC::reverseLoad(vacc, bfr__ + 52);
+      return c_payload_size;
     }
 
     void
@@ -5051,9 +5106,12 @@ namespace DUNE
       IMC::toJSON(os__, "vacc", vacc, nindent__);
     }
 
+    const uint16_t EulerAngles::c_payload_size;
+
     EulerAngles::EulerAngles(void)
     {
       m_header.mgid = 254;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5092,37 +5150,36 @@ namespace DUNE
     uint8_t*
     EulerAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(psi_magnetic, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(phi, bfr__ + 8);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 24);
+      IMC::serialize(psi_magnetic, bfr__ + 32);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     EulerAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(phi, bfr__ + 8);
+      IMC::load(theta, bfr__ + 16);
+      IMC::load(psi, bfr__ + 24);
+      IMC::load(psi_magnetic, bfr__ + 32);
+      return c_payload_size;
     }
 
     uint16_t
     EulerAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(phi, bfr__ + 8);
+      IMC::reverseLoad(theta, bfr__ + 16);
+      IMC::reverseLoad(psi, bfr__ + 24);
+      IMC::reverseLoad(psi_magnetic, bfr__ + 32);
+      return c_payload_size;
     }
 
     void
@@ -5135,9 +5192,12 @@ namespace DUNE
       IMC::toJSON(os__, "psi_magnetic", psi_magnetic, nindent__);
     }
 
+    const uint16_t EulerAnglesDelta::c_payload_size;
+
     EulerAnglesDelta::EulerAnglesDelta(void)
     {
       m_header.mgid = 255;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5172,37 +5232,36 @@ namespace DUNE
     uint8_t*
     EulerAnglesDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      IMC::serialize(timestep, bfr__ + 32);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     EulerAnglesDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      IMC::load(timestep, bfr__ + 32);
+      return c_payload_size;
     }
 
     uint16_t
     EulerAnglesDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      IMC::reverseLoad(timestep, bfr__ + 32);
+      return c_payload_size;
     }
 
     void
@@ -5215,9 +5274,12 @@ namespace DUNE
       IMC::toJSON(os__, "timestep", timestep, nindent__);
     }
 
+    const uint16_t AngularVelocity::c_payload_size;
+
     AngularVelocity::AngularVelocity(void)
     {
       m_header.mgid = 256;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5250,34 +5312,33 @@ namespace DUNE
     uint8_t*
     AngularVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     AngularVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     uint16_t
     AngularVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     void
@@ -5289,9 +5350,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t Acceleration::c_payload_size;
+
     Acceleration::Acceleration(void)
     {
       m_header.mgid = 257;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5324,34 +5388,33 @@ namespace DUNE
     uint8_t*
     Acceleration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Acceleration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     uint16_t
     Acceleration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     void
@@ -5363,9 +5426,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t MagneticField::c_payload_size;
+
     MagneticField::MagneticField(void)
     {
       m_header.mgid = 258;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5398,34 +5464,33 @@ namespace DUNE
     uint8_t*
     MagneticField::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     MagneticField::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     uint16_t
     MagneticField::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     void
@@ -5437,9 +5502,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t GroundVelocity::c_payload_size;
+
     GroundVelocity::GroundVelocity(void)
     {
       m_header.mgid = 259;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5472,34 +5540,33 @@ namespace DUNE
     uint8_t*
     GroundVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 9);
+      IMC::serialize(z, bfr__ + 17);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GroundVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 9);
+      IMC::load(z, bfr__ + 17);
+      return c_payload_size;
     }
 
     uint16_t
     GroundVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 9);
+      IMC::reverseLoad(z, bfr__ + 17);
+      return c_payload_size;
     }
 
     void
@@ -5511,9 +5578,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t WaterVelocity::c_payload_size;
+
     WaterVelocity::WaterVelocity(void)
     {
       m_header.mgid = 260;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5546,34 +5616,33 @@ namespace DUNE
     uint8_t*
     WaterVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 9);
+      IMC::serialize(z, bfr__ + 17);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     WaterVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 9);
+      IMC::load(z, bfr__ + 17);
+      return c_payload_size;
     }
 
     uint16_t
     WaterVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 9);
+      IMC::reverseLoad(z, bfr__ + 17);
+      return c_payload_size;
     }
 
     void
@@ -5585,9 +5654,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t VelocityDelta::c_payload_size;
+
     VelocityDelta::VelocityDelta(void)
     {
       m_header.mgid = 261;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5620,34 +5692,33 @@ namespace DUNE
     uint8_t*
     VelocityDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     VelocityDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     uint16_t
     VelocityDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return c_payload_size;
     }
 
     void
@@ -5659,9 +5730,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t DeviceState::c_payload_size;
+
     DeviceState::DeviceState(void)
     {
       m_header.mgid = 282;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5698,40 +5772,39 @@ namespace DUNE
     uint8_t*
     DeviceState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(phi, bfr__ + 12);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 20);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DeviceState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      IMC::load(phi, bfr__ + 12);
+      IMC::load(theta, bfr__ + 16);
+      IMC::load(psi, bfr__ + 20);
+      return c_payload_size;
     }
 
     uint16_t
     DeviceState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      IMC::reverseLoad(phi, bfr__ + 12);
+      IMC::reverseLoad(theta, bfr__ + 16);
+      IMC::reverseLoad(psi, bfr__ + 20);
+      return c_payload_size;
     }
 
     void
@@ -5745,9 +5818,12 @@ namespace DUNE
       IMC::toJSON(os__, "psi", psi, nindent__);
     }
 
+    const uint16_t BeamConfig::c_payload_size;
+
     BeamConfig::BeamConfig(void)
     {
       m_header.mgid = 283;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5778,28 +5854,27 @@ namespace DUNE
     uint8_t*
     BeamConfig::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(beam_width, ptr__);
-      ptr__ += IMC::serialize(beam_height, ptr__);
-      return ptr__;
+      IMC::serialize(beam_width, bfr__ + 0);
+      IMC::serialize(beam_height, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     BeamConfig::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::deserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(beam_width, bfr__ + 0);
+      IMC::load(beam_height, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     BeamConfig::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(beam_width, bfr__ + 0);
+      IMC::reverseLoad(beam_height, bfr__ + 4);
+      return c_payload_size;
     }
 
     void
@@ -5937,9 +6012,12 @@ namespace DUNE
       beam_config.setDestinationEntity(value__);
     }
 
+    const uint16_t Temperature::c_payload_size;
+
     Temperature::Temperature(void)
     {
       m_header.mgid = 263;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -5966,25 +6044,24 @@ namespace DUNE
     uint8_t*
     Temperature::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Temperature::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Temperature::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6005,9 +6082,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Pressure::c_payload_size;
+
     Pressure::Pressure(void)
     {
       m_header.mgid = 264;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6034,25 +6114,24 @@ namespace DUNE
     uint8_t*
     Pressure::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Pressure::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Pressure::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6073,9 +6152,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Depth::c_payload_size;
+
     Depth::Depth(void)
     {
       m_header.mgid = 265;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6102,25 +6184,24 @@ namespace DUNE
     uint8_t*
     Depth::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Depth::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Depth::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6141,9 +6222,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t DepthOffset::c_payload_size;
+
     DepthOffset::DepthOffset(void)
     {
       m_header.mgid = 266;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6170,25 +6254,24 @@ namespace DUNE
     uint8_t*
     DepthOffset::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DepthOffset::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DepthOffset::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6209,9 +6292,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t SoundSpeed::c_payload_size;
+
     SoundSpeed::SoundSpeed(void)
     {
       m_header.mgid = 267;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6238,25 +6324,24 @@ namespace DUNE
     uint8_t*
     SoundSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SoundSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     SoundSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6277,9 +6362,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t WaterDensity::c_payload_size;
+
     WaterDensity::WaterDensity(void)
     {
       m_header.mgid = 268;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6306,25 +6394,24 @@ namespace DUNE
     uint8_t*
     WaterDensity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     WaterDensity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     WaterDensity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6345,9 +6432,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Conductivity::c_payload_size;
+
     Conductivity::Conductivity(void)
     {
       m_header.mgid = 269;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6374,25 +6464,24 @@ namespace DUNE
     uint8_t*
     Conductivity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Conductivity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Conductivity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6413,9 +6502,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Salinity::c_payload_size;
+
     Salinity::Salinity(void)
     {
       m_header.mgid = 270;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6442,25 +6534,24 @@ namespace DUNE
     uint8_t*
     Salinity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Salinity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Salinity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6481,9 +6572,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t WindSpeed::c_payload_size;
+
     WindSpeed::WindSpeed(void)
     {
       m_header.mgid = 271;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6514,31 +6608,30 @@ namespace DUNE
     uint8_t*
     WindSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(direction, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      return ptr__;
+      IMC::serialize(direction, bfr__ + 0);
+      IMC::serialize(speed, bfr__ + 4);
+      IMC::serialize(turbulence, bfr__ + 8);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     WindSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(direction, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(direction, bfr__ + 0);
+      IMC::load(speed, bfr__ + 4);
+      IMC::load(turbulence, bfr__ + 8);
+      return c_payload_size;
     }
 
     uint16_t
     WindSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(direction, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(direction, bfr__ + 0);
+      IMC::reverseLoad(speed, bfr__ + 4);
+      IMC::reverseLoad(turbulence, bfr__ + 8);
+      return c_payload_size;
     }
 
     void
@@ -6549,9 +6642,12 @@ namespace DUNE
       IMC::toJSON(os__, "turbulence", turbulence, nindent__);
     }
 
+    const uint16_t RelativeHumidity::c_payload_size;
+
     RelativeHumidity::RelativeHumidity(void)
     {
       m_header.mgid = 272;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6579,25 +6675,24 @@ namespace DUNE
     uint8_t*
     RelativeHumidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     RelativeHumidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     RelativeHumidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -6786,6 +6881,22 @@ namespace DUNE
       return ptr__;
     }
 
+    uint8_t*
+    SonarData::serializeFieldsHead(uint8_t* bfr__, const RawData*& tail__) const
+    {
+      uint8_t* ptr__ = bfr__;
+      ptr__ += IMC::serialize(type, ptr__);
+      ptr__ += IMC::serialize(frequency, ptr__);
+      ptr__ += IMC::serialize(min_range, ptr__);
+      ptr__ += IMC::serialize(max_range, ptr__);
+      ptr__ += IMC::serialize(bits_per_point, ptr__);
+      ptr__ += IMC::serialize(scale_factor, ptr__);
+      ptr__ += beam_config.serialize(ptr__);
+      ptr__ += IMC::serialize((uint16_t)data.size(), ptr__);
+      tail__ = &data;
+      return ptr__;
+    }
+
     uint16_t
     SonarData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
@@ -6859,9 +6970,12 @@ namespace DUNE
       beam_config.setDestinationEntity(value__);
     }
 
+    const uint16_t Pulse::c_payload_size;
+
     Pulse::Pulse(void)
     {
       m_header.mgid = 277;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6898,9 +7012,12 @@ namespace DUNE
       return 0;
     }
 
+    const uint16_t PulseDetectionControl::c_payload_size;
+
     PulseDetectionControl::PulseDetectionControl(void)
     {
       m_header.mgid = 278;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -6927,25 +7044,24 @@ namespace DUNE
     uint8_t*
     PulseDetectionControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     PulseDetectionControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     PulseDetectionControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -7036,9 +7152,12 @@ namespace DUNE
       IMC::toJSON(os__, "opmodes", opmodes, nindent__);
     }
 
+    const uint16_t GpsNavData::c_payload_size;
+
     GpsNavData::GpsNavData(void)
     {
       m_header.mgid = 280;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7093,67 +7212,66 @@ namespace DUNE
     uint8_t*
     GpsNavData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(itow, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height_ell, ptr__);
-      ptr__ += IMC::serialize(height_sea, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      ptr__ += IMC::serialize(vel_n, ptr__);
-      ptr__ += IMC::serialize(vel_e, ptr__);
-      ptr__ += IMC::serialize(vel_d, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(gspeed, ptr__);
-      ptr__ += IMC::serialize(heading, ptr__);
-      ptr__ += IMC::serialize(sacc, ptr__);
-      ptr__ += IMC::serialize(cacc, ptr__);
-      return ptr__;
+      IMC::serialize(itow, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 4);
+      IMC::serialize(lon, bfr__ + 12);
+      IMC::serialize(height_ell, bfr__ + 20);
+      IMC::serialize(height_sea, bfr__ + 24);
+      IMC::serialize(hacc, bfr__ + 28);
+      IMC::serialize(vacc, bfr__ + 32);
+      IMC::serialize(vel_n, bfr__ + 36);
+      IMC::serialize(vel_e, bfr__ + 40);
+      IMC::serialize(vel_d, bfr__ + 44);
+      IMC::serialize(speed, bfr__ + 48);
+      IMC::serialize(gspeed, bfr__ + 52);
+      IMC::serialize(heading, bfr__ + 56);
+      IMC::serialize(sacc, bfr__ + 60);
+      IMC::serialize(cacc, bfr__ + 64);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GpsNavData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(itow, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::deserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::deserialize(heading, bfr__, size__);
-      bfr__ += IMC::deserialize(sacc, bfr__, size__);
-      bfr__ += IMC::deserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(itow, bfr__ + 0);
+      IMC::load(lat, bfr__ + 4);
+      IMC::load(lon, bfr__ + 12);
+      IMC::load(height_ell, bfr__ + 20);
+      IMC::load(height_sea, bfr__ + 24);
+      IMC::load(hacc, bfr__ + 28);
+      IMC::load(vacc, bfr__ + 32);
+      IMC::load(vel_n, bfr__ + 36);
+      IMC::load(vel_e, bfr__ + 40);
+      IMC::load(vel_d, bfr__ + 44);
+      IMC::load(speed, bfr__ + 48);
+      IMC::load(gspeed, bfr__ + 52);
+      IMC::load(heading, bfr__ + 56);
+      IMC::load(sacc, bfr__ + 60);
+      IMC::load(cacc, bfr__ + 64);
+      return c_payload_size;
     }
 
-    uint16_t
-    GpsNavData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(itow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(heading, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+    uint16_t
+    GpsNavData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(itow, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 4);
+      IMC::reverseLoad(lon, bfr__ + 12);
+      IMC::reverseLoad(height_ell, bfr__ + 20);
+      IMC::reverseLoad(height_sea, bfr__ + 24);
+      IMC::reverseLoad(hacc, bfr__ + 28);
+      IMC::reverseLoad(vacc, bfr__ + 32);
+      IMC::reverseLoad(vel_n, bfr__ + 36);
+      IMC::reverseLoad(vel_e, bfr__ + 40);
+      IMC::reverseLoad(vel_d, bfr__ + 44);
+      IMC::reverseLoad(speed, bfr__ + 48);
+      IMC::reverseLoad(gspeed, bfr__ + 52);
+      IMC::reverseLoad(heading, bfr__ + 56);
+      IMC::reverseLoad(sacc, bfr__ + 60);
+      IMC::reverseLoad(cacc, bfr__ + 64);
+      return c_payload_size;
     }
 
     void
@@ -7176,9 +7294,12 @@ namespace DUNE
       IMC::toJSON(os__, "cacc", cacc, nindent__);
     }
 
+    const uint16_t ServoPosition::c_payload_size;
+
     ServoPosition::ServoPosition(void)
     {
       m_header.mgid = 281;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7208,28 +7329,27 @@ namespace DUNE
     uint8_t*
     ServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
     ServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
@@ -7263,9 +7383,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t DataSanity::c_payload_size;
+
     DataSanity::DataSanity(void)
     {
       m_header.mgid = 284;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7292,25 +7415,24 @@ namespace DUNE
     uint8_t*
     DataSanity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sane, ptr__);
-      return ptr__;
+      IMC::serialize(sane, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DataSanity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(sane, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DataSanity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(sane, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -7319,9 +7441,12 @@ namespace DUNE
       IMC::toJSON(os__, "sane", sane, nindent__);
     }
 
+    const uint16_t RhodamineDye::c_payload_size;
+
     RhodamineDye::RhodamineDye(void)
     {
       m_header.mgid = 285;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7348,25 +7473,24 @@ namespace DUNE
     uint8_t*
     RhodamineDye::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     RhodamineDye::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     RhodamineDye::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7387,9 +7511,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t CrudeOil::c_payload_size;
+
     CrudeOil::CrudeOil(void)
     {
       m_header.mgid = 286;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7416,25 +7543,24 @@ namespace DUNE
     uint8_t*
     CrudeOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     CrudeOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     CrudeOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7455,9 +7581,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t FineOil::c_payload_size;
+
     FineOil::FineOil(void)
     {
       m_header.mgid = 287;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7484,25 +7613,24 @@ namespace DUNE
     uint8_t*
     FineOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FineOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     FineOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7523,9 +7651,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Turbidity::c_payload_size;
+
     Turbidity::Turbidity(void)
     {
       m_header.mgid = 288;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7552,25 +7683,24 @@ namespace DUNE
     uint8_t*
     Turbidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Turbidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Turbidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7591,9 +7721,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Chlorophyll::c_payload_size;
+
     Chlorophyll::Chlorophyll(void)
     {
       m_header.mgid = 289;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7620,25 +7753,24 @@ namespace DUNE
     uint8_t*
     Chlorophyll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Chlorophyll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Chlorophyll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7659,9 +7791,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Fluorescein::c_payload_size;
+
     Fluorescein::Fluorescein(void)
     {
       m_header.mgid = 290;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7688,25 +7823,24 @@ namespace DUNE
     uint8_t*
     Fluorescein::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Fluorescein::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Fluorescein::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7727,9 +7861,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Phycocyanin::c_payload_size;
+
     Phycocyanin::Phycocyanin(void)
     {
       m_header.mgid = 291;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7756,25 +7893,24 @@ namespace DUNE
     uint8_t*
     Phycocyanin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Phycocyanin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Phycocyanin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7795,9 +7931,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Phycoerythrin::c_payload_size;
+
     Phycoerythrin::Phycoerythrin(void)
     {
       m_header.mgid = 292;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7824,25 +7963,24 @@ namespace DUNE
     uint8_t*
     Phycoerythrin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Phycoerythrin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Phycoerythrin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -7863,9 +8001,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t GpsFixRtk::c_payload_size;
+
     GpsFixRtk::GpsFixRtk(void)
     {
       m_header.mgid = 293;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -7922,67 +8063,66 @@ namespace DUNE
     uint8_t*
     GpsFixRtk::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(tow, ptr__);
-      ptr__ += IMC::serialize(base_lat, ptr__);
-      ptr__ += IMC::serialize(base_lon, ptr__);
-      ptr__ += IMC::serialize(base_height, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(e, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(v_n, ptr__);
-      ptr__ += IMC::serialize(v_e, ptr__);
-      ptr__ += IMC::serialize(v_d, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(iar_hyp, ptr__);
-      ptr__ += IMC::serialize(iar_ratio, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 2);
+      IMC::serialize(tow, bfr__ + 3);
+      IMC::serialize(base_lat, bfr__ + 7);
+      IMC::serialize(base_lon, bfr__ + 15);
+      IMC::serialize(base_height, bfr__ + 23);
+      IMC::serialize(n, bfr__ + 27);
+      IMC::serialize(e, bfr__ + 31);
+      IMC::serialize(d, bfr__ + 35);
+      IMC::serialize(v_n, bfr__ + 39);
+      IMC::serialize(v_e, bfr__ + 43);
+      IMC::serialize(v_d, bfr__ + 47);
+      IMC::serialize(satellites, bfr__ + 51);
+      IMC::serialize(iar_hyp, bfr__ + 52);
+      IMC::serialize(iar_ratio, bfr__ + 54);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GpsFixRtk::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(tow, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(base_height, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(e, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(v_n, bfr__, size__);
-      bfr__ += IMC::deserialize(v_e, bfr__, size__);
-      bfr__ += IMC::deserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::load(tow, bfr__ + 3);
+      IMC::load(base_lat, bfr__ + 7);
+      IMC::load(base_lon, bfr__ + 15);
+      IMC::load(base_height, bfr__ + 23);
+      IMC::load(n, bfr__ + 27);
+      IMC::load(e, bfr__ + 31);
+      IMC::load(d, bfr__ + 35);
+      IMC::load(v_n, bfr__ + 39);
+      IMC::load(v_e, bfr__ + 43);
+      IMC::load(v_d, bfr__ + 47);
+      IMC::load(satellites, bfr__ + 51);
+      IMC::load(iar_hyp, bfr__ + 52);
+      IMC::load(iar_ratio, bfr__ + 54);
+      return c_payload_size;
     }
 
     uint16_t
     GpsFixRtk::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::reverseLoad(tow, bfr__ + 3);
+      IMC::reverseLoad(base_lat, bfr__ + 7);
+      IMC::reverseLoad(base_lon, bfr__ + 15);
+      IMC::reverseLoad(base_height, bfr__ + 23);
+      IMC::reverseLoad(n, bfr__ + 27);
+      IMC::reverseLoad(e, bfr__ + 31);
+      IMC::reverseLoad(d, bfr__ + 35);
+      IMC::reverseLoad(v_n, bfr__ + 39);
+      IMC::reverseLoad(v_e, bfr__ + 43);
+      IMC::reverseLoad(v_d, bfr__ + 47);
+      IMC::load(satellites, bfr__ + 51);
+      IMC::reverseLoad(iar_hyp, bfr__ + 52);
+      IMC::reverseLoad(iar_ratio, bfr__ + 54);
+      return c_payload_size;
     }
 
     void
@@ -8005,9 +8145,12 @@ namespace DUNE
       IMC::toJSON(os__, "iar_ratio", iar_ratio, nindent__);
     }
 
+    const uint16_t EstimatedState::c_payload_size;
+
     EstimatedState::EstimatedState(void)
     {
       m_header.mgid = 350;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8080,82 +8223,81 @@ namespace DUNE
     uint8_t*
     EstimatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(height, bfr__ + 16);
+      IMC::serialize(x, bfr__ + 20);
+      IMC::serialize(y, bfr__ + 24);
+      IMC::serialize(z, bfr__ + 28);
+      IMC::serialize(phi, bfr__ + 32);
+      IMC::serialize(theta, bfr__ + 36);
+      IMC::serialize(psi, bfr__ + 40);
+      IMC::serialize(u, bfr__ + 44);
+      IMC::serialize(v, bfr__ + 48);
+      IMC::serialize(w, bfr__ + 52);
+      IMC::serialize(vx, bfr__ + 56);
+      IMC::serialize(vy, bfr__ + 60);
+      IMC::serialize(vz, bfr__ + 64);
+      IMC::serialize(p, bfr__ + 68);
+      IMC::serialize(q, bfr__ + 72);
+      IMC::serialize(r, bfr__ + 76);
+      IMC::serialize(depth, bfr__ + 80);
+      IMC::serialize(alt, bfr__ + 84);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     EstimatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(height, bfr__ + 16);
+      IMC::load(x, bfr__ + 20);
+      IMC::load(y, bfr__ + 24);
+      IMC::load(z, bfr__ + 28);
+      IMC::load(phi, bfr__ + 32);
+      IMC::load(theta, bfr__ + 36);
+      IMC::load(psi, bfr__ + 40);
+      IMC::load(u, bfr__ + 44);
+      IMC::load(v, bfr__ + 48);
+      IMC::load(w, bfr__ + 52);
+      IMC::load(vx, bfr__ + 56);
+      IMC::load(vy, bfr__ + 60);
+      IMC::load(vz, bfr__ + 64);
+      IMC::load(p, bfr__ + 68);
+      IMC::load(q, bfr__ + 72);
+      IMC::load(r, bfr__ + 76);
+      IMC::load(depth, bfr__ + 80);
+      IMC::load(alt, bfr__ + 84);
+      return c_payload_size;
     }
 
     uint16_t
     EstimatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(height, bfr__ + 16);
+      IMC::reverseLoad(x, bfr__ + 20);
+      IMC::reverseLoad(y, bfr__ + 24);
+      IMC::reverseLoad(z, bfr__ + 28);
+      IMC::reverseLoad(phi, bfr__ + 32);
+      IMC::reverseLoad(theta, bfr__ + 36);
+      IMC::reverseLoad(psi, bfr__ + 40);
+      IMC::reverseLoad(u, bfr__ + 44);
+      IMC::reverseLoad(v, bfr__ + 48);
+      IMC::reverseLoad(w, bfr__ + 52);
+      IMC::reverseLoad(vx, bfr__ + 56);
+      IMC::reverseLoad(vy, bfr__ + 60);
+      IMC::reverseLoad(vz, bfr__ + 64);
+      IMC::reverseLoad(p, bfr__ + 68);
+      IMC::reverseLoad(q, bfr__ + 72);
+      IMC::reverseLoad(r, bfr__ + 76);
+      IMC::reverseLoad(depth, bfr__ + 80);
+      IMC::reverseLoad(alt, bfr__ + 84);
+      return c_payload_size;
     }
 
     void
@@ -8291,9 +8433,12 @@ namespace DUNE
       }
     }
 
+    const uint16_t DissolvedOxygen::c_payload_size;
+
     DissolvedOxygen::DissolvedOxygen(void)
     {
       m_header.mgid = 295;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8320,25 +8465,24 @@ namespace DUNE
     uint8_t*
     DissolvedOxygen::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DissolvedOxygen::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DissolvedOxygen::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -8359,9 +8503,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t AirSaturation::c_payload_size;
+
     AirSaturation::AirSaturation(void)
     {
       m_header.mgid = 296;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8388,25 +8535,24 @@ namespace DUNE
     uint8_t*
     AirSaturation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     AirSaturation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     AirSaturation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -8427,9 +8573,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Throttle::c_payload_size;
+
     Throttle::Throttle(void)
     {
       m_header.mgid = 297;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8456,25 +8605,24 @@ namespace DUNE
     uint8_t*
     Throttle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Throttle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Throttle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -8495,9 +8643,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t PH::c_payload_size;
+
     PH::PH(void)
     {
       m_header.mgid = 298;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8524,25 +8675,24 @@ namespace DUNE
     uint8_t*
     PH::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     PH::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     PH::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -8563,9 +8713,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Redox::c_payload_size;
+
     Redox::Redox(void)
     {
       m_header.mgid = 299;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8592,25 +8745,24 @@ namespace DUNE
     uint8_t*
     Redox::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Redox::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Redox::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -8631,9 +8783,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t CameraZoom::c_payload_size;
+
     CameraZoom::CameraZoom(void)
     {
       m_header.mgid = 300;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8664,31 +8819,30 @@ namespace DUNE
     uint8_t*
     CameraZoom::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(zoom, ptr__);
-      ptr__ += IMC::serialize(action, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(zoom, bfr__ + 1);
+      IMC::serialize(action, bfr__ + 2);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     CameraZoom::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(zoom, bfr__ + 1);
+      IMC::load(action, bfr__ + 2);
+      return c_payload_size;
     }
 
     uint16_t
     CameraZoom::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(zoom, bfr__ + 1);
+      IMC::load(action, bfr__ + 2);
+      return c_payload_size;
     }
 
     uint16_t
@@ -8711,9 +8865,12 @@ namespace DUNE
       IMC::toJSON(os__, "action", action, nindent__);
     }
 
+    const uint16_t SetThrusterActuation::c_payload_size;
+
     SetThrusterActuation::SetThrusterActuation(void)
     {
       m_header.mgid = 301;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8743,28 +8900,27 @@ namespace DUNE
     uint8_t*
     SetThrusterActuation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SetThrusterActuation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
     SetThrusterActuation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
@@ -8798,9 +8954,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t SetServoPosition::c_payload_size;
+
     SetServoPosition::SetServoPosition(void)
     {
       m_header.mgid = 302;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8830,28 +8989,27 @@ namespace DUNE
     uint8_t*
     SetServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SetServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
     SetServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
@@ -8885,9 +9043,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t SetControlSurfaceDeflection::c_payload_size;
+
     SetControlSurfaceDeflection::SetControlSurfaceDeflection(void)
     {
       m_header.mgid = 303;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -8916,28 +9077,27 @@ namespace DUNE
     uint8_t*
     SetControlSurfaceDeflection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(angle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(angle, bfr__ + 1);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SetControlSurfaceDeflection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(angle, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
     SetControlSurfaceDeflection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(angle, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
@@ -9077,9 +9237,12 @@ namespace DUNE
       IMC::toJSON(os__, "actions", actions, nindent__);
     }
 
+    const uint16_t ButtonEvent::c_payload_size;
+
     ButtonEvent::ButtonEvent(void)
     {
       m_header.mgid = 306;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9108,28 +9271,27 @@ namespace DUNE
     uint8_t*
     ButtonEvent::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(button, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(button, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ButtonEvent::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(button, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     uint16_t
     ButtonEvent::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(button, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return c_payload_size;
     }
 
     fp64_t
@@ -9213,9 +9375,12 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    const uint16_t PowerOperation::c_payload_size;
+
     PowerOperation::PowerOperation(void)
     {
       m_header.mgid = 308;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9246,31 +9411,30 @@ namespace DUNE
     uint8_t*
     PowerOperation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(time_remain, ptr__);
-      ptr__ += IMC::serialize(sched_time, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(time_remain, bfr__ + 1);
+      IMC::serialize(sched_time, bfr__ + 5);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     PowerOperation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::deserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(time_remain, bfr__ + 1);
+      IMC::load(sched_time, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
     PowerOperation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(time_remain, bfr__ + 1);
+      IMC::reverseLoad(sched_time, bfr__ + 5);
+      return c_payload_size;
     }
 
     void
@@ -9350,9 +9514,12 @@ namespace DUNE
       IMC::toJSON(os__, "sched_time", sched_time, nindent__);
     }
 
+    const uint16_t QueryPowerChannelState::c_payload_size;
+
     QueryPowerChannelState::QueryPowerChannelState(void)
     {
       m_header.mgid = 310;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9655,9 +9822,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t SetPWM::c_payload_size;
+
     SetPWM::SetPWM(void)
     {
       m_header.mgid = 315;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9688,31 +9858,30 @@ namespace DUNE
     uint8_t*
     SetPWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(period, bfr__ + 1);
+      IMC::serialize(duty_cycle, bfr__ + 5);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SetPWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(period, bfr__ + 1);
+      IMC::load(duty_cycle, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
     SetPWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(period, bfr__ + 1);
+      IMC::reverseLoad(duty_cycle, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
@@ -9735,9 +9904,12 @@ namespace DUNE
       IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
     }
 
+    const uint16_t PWM::c_payload_size;
+
     PWM::PWM(void)
     {
       m_header.mgid = 316;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9768,31 +9940,30 @@ namespace DUNE
     uint8_t*
     PWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(period, bfr__ + 1);
+      IMC::serialize(duty_cycle, bfr__ + 5);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     PWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(period, bfr__ + 1);
+      IMC::load(duty_cycle, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
     PWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(period, bfr__ + 1);
+      IMC::reverseLoad(duty_cycle, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
@@ -9815,9 +9986,12 @@ namespace DUNE
       IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
     }
 
+    const uint16_t EstimatedStreamVelocity::c_payload_size;
+
     EstimatedStreamVelocity::EstimatedStreamVelocity(void)
     {
       m_header.mgid = 351;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9848,31 +10022,30 @@ namespace DUNE
     uint8_t*
     EstimatedStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     EstimatedStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      return c_payload_size;
     }
 
     uint16_t
     EstimatedStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      return c_payload_size;
     }
 
     void
@@ -9883,9 +10056,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t IndicatedSpeed::c_payload_size;
+
     IndicatedSpeed::IndicatedSpeed(void)
     {
       m_header.mgid = 352;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9912,25 +10088,24 @@ namespace DUNE
     uint8_t*
     IndicatedSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     IndicatedSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     IndicatedSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -9951,9 +10126,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t TrueSpeed::c_payload_size;
+
     TrueSpeed::TrueSpeed(void)
     {
       m_header.mgid = 353;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -9980,25 +10158,24 @@ namespace DUNE
     uint8_t*
     TrueSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     TrueSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     TrueSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -10019,9 +10196,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t NavigationUncertainty::c_payload_size;
+
     NavigationUncertainty::NavigationUncertainty(void)
     {
       m_header.mgid = 354;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10074,64 +10254,63 @@ namespace DUNE
     uint8_t*
     NavigationUncertainty::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(phi, bfr__ + 12);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 20);
+      IMC::serialize(p, bfr__ + 24);
+      IMC::serialize(q, bfr__ + 28);
+      IMC::serialize(r, bfr__ + 32);
+      IMC::serialize(u, bfr__ + 36);
+      IMC::serialize(v, bfr__ + 40);
+      IMC::serialize(w, bfr__ + 44);
+      IMC::serialize(bias_psi, bfr__ + 48);
+      IMC::serialize(bias_r, bfr__ + 52);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     NavigationUncertainty::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      IMC::load(phi, bfr__ + 12);
+      IMC::load(theta, bfr__ + 16);
+      IMC::load(psi, bfr__ + 20);
+      IMC::load(p, bfr__ + 24);
+      IMC::load(q, bfr__ + 28);
+      IMC::load(r, bfr__ + 32);
+      IMC::load(u, bfr__ + 36);
+      IMC::load(v, bfr__ + 40);
+      IMC::load(w, bfr__ + 44);
+      IMC::load(bias_psi, bfr__ + 48);
+      IMC::load(bias_r, bfr__ + 52);
+      return c_payload_size;
     }
 
     uint16_t
     NavigationUncertainty::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      IMC::reverseLoad(phi, bfr__ + 12);
+      IMC::reverseLoad(theta, bfr__ + 16);
+      IMC::reverseLoad(psi, bfr__ + 20);
+      IMC::reverseLoad(p, bfr__ + 24);
+      IMC::reverseLoad(q, bfr__ + 28);
+      IMC::reverseLoad(r, bfr__ + 32);
+      IMC::reverseLoad(u, bfr__ + 36);
+      IMC::reverseLoad(v, bfr__ + 40);
+      IMC::reverseLoad(w, bfr__ + 44);
+      IMC::reverseLoad(bias_psi, bfr__ + 48);
+      IMC::reverseLoad(bias_r, bfr__ + 52);
+      return c_payload_size;
     }
 
     void
@@ -10153,9 +10332,12 @@ namespace DUNE
       IMC::toJSON(os__, "bias_r", bias_r, nindent__);
     }
 
+    const uint16_t NavigationData::c_payload_size;
+
     NavigationData::NavigationData(void)
     {
       m_header.mgid = 355;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10198,49 +10380,48 @@ namespace DUNE
     uint8_t*
     NavigationData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(cyaw, ptr__);
-      ptr__ += IMC::serialize(lbl_rej_level, ptr__);
-      ptr__ += IMC::serialize(gps_rej_level, ptr__);
-      ptr__ += IMC::serialize(custom_x, ptr__);
-      ptr__ += IMC::serialize(custom_y, ptr__);
-      ptr__ += IMC::serialize(custom_z, ptr__);
-      return ptr__;
+      IMC::serialize(bias_psi, bfr__ + 0);
+      IMC::serialize(bias_r, bfr__ + 4);
+      IMC::serialize(cog, bfr__ + 8);
+      IMC::serialize(cyaw, bfr__ + 12);
+      IMC::serialize(lbl_rej_level, bfr__ + 16);
+      IMC::serialize(gps_rej_level, bfr__ + 20);
+      IMC::serialize(custom_x, bfr__ + 24);
+      IMC::serialize(custom_y, bfr__ + 28);
+      IMC::serialize(custom_z, bfr__ + 32);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     NavigationData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::deserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(bias_psi, bfr__ + 0);
+      IMC::load(bias_r, bfr__ + 4);
+      IMC::load(cog, bfr__ + 8);
+      IMC::load(cyaw, bfr__ + 12);
+      IMC::load(lbl_rej_level, bfr__ + 16);
+      IMC::load(gps_rej_level, bfr__ + 20);
+      IMC::load(custom_x, bfr__ + 24);
+      IMC::load(custom_y, bfr__ + 28);
+      IMC::load(custom_z, bfr__ + 32);
+      return c_payload_size;
     }
 
     uint16_t
     NavigationData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(bias_psi, bfr__ + 0);
+      IMC::reverseLoad(bias_r, bfr__ + 4);
+      IMC::reverseLoad(cog, bfr__ + 8);
+      IMC::reverseLoad(cyaw, bfr__ + 12);
+      IMC::reverseLoad(lbl_rej_level, bfr__ + 16);
+      IMC::reverseLoad(gps_rej_level, bfr__ + 20);
+      IMC::reverseLoad(custom_x, bfr__ + 24);
+      IMC::reverseLoad(custom_y, bfr__ + 28);
+      IMC::reverseLoad(custom_z, bfr__ + 32);
+      return c_payload_size;
     }
 
     void
@@ -10257,9 +10438,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom_z", custom_z, nindent__);
     }
 
+    const uint16_t GpsFixRejection::c_payload_size;
+
     GpsFixRejection::GpsFixRejection(void)
     {
       m_header.mgid = 356;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10288,28 +10472,27 @@ namespace DUNE
     uint8_t*
     GpsFixRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      return ptr__;
+      IMC::serialize(utc_time, bfr__ + 0);
+      IMC::serialize(reason, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GpsFixRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(utc_time, bfr__ + 0);
+      IMC::load(reason, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     GpsFixRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(utc_time, bfr__ + 0);
+      IMC::load(reason, bfr__ + 4);
+      return c_payload_size;
     }
 
     void
@@ -10319,9 +10502,12 @@ namespace DUNE
       IMC::toJSON(os__, "reason", reason, nindent__);
     }
 
+    const uint16_t LblRangeAcceptance::c_payload_size;
+
     LblRangeAcceptance::LblRangeAcceptance(void)
     {
       m_header.mgid = 357;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10352,31 +10538,30 @@ namespace DUNE
     uint8_t*
     LblRangeAcceptance::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      ptr__ += IMC::serialize(acceptance, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(range, bfr__ + 1);
+      IMC::serialize(acceptance, bfr__ + 5);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     LblRangeAcceptance::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(range, bfr__ + 1);
+      IMC::load(acceptance, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
     LblRangeAcceptance::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(range, bfr__ + 1);
+      IMC::load(acceptance, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
@@ -10399,9 +10584,12 @@ namespace DUNE
       IMC::toJSON(os__, "acceptance", acceptance, nindent__);
     }
 
+    const uint16_t DvlRejection::c_payload_size;
+
     DvlRejection::DvlRejection(void)
     {
       m_header.mgid = 358;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10434,34 +10622,33 @@ namespace DUNE
     uint8_t*
     DvlRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      IMC::serialize(reason, bfr__ + 1);
+      IMC::serialize(value, bfr__ + 2);
+      IMC::serialize(timestep, bfr__ + 6);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DvlRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(reason, bfr__ + 1);
+      IMC::load(value, bfr__ + 2);
+      IMC::load(timestep, bfr__ + 6);
+      return c_payload_size;
     }
 
     uint16_t
     DvlRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(reason, bfr__ + 1);
+      IMC::reverseLoad(value, bfr__ + 2);
+      IMC::reverseLoad(timestep, bfr__ + 6);
+      return c_payload_size;
     }
 
     fp64_t
@@ -10617,9 +10804,12 @@ namespace DUNE
       }
     }
 
+    const uint16_t AlignmentState::c_payload_size;
+
     AlignmentState::AlignmentState(void)
     {
       m_header.mgid = 361;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10646,25 +10836,24 @@ namespace DUNE
     uint8_t*
     AlignmentState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     AlignmentState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(state, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     AlignmentState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(state, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -10673,9 +10862,12 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    const uint16_t GroupStreamVelocity::c_payload_size;
+
     GroupStreamVelocity::GroupStreamVelocity(void)
     {
       m_header.mgid = 362;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10706,31 +10898,30 @@ namespace DUNE
     uint8_t*
     GroupStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GroupStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      return c_payload_size;
     }
 
     uint16_t
     GroupStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      return c_payload_size;
     }
 
     void
@@ -10741,9 +10932,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t Airflow::c_payload_size;
+
     Airflow::Airflow(void)
     {
       m_header.mgid = 363;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10774,31 +10968,30 @@ namespace DUNE
     uint8_t*
     Airflow::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(va, ptr__);
-      ptr__ += IMC::serialize(aoa, ptr__);
-      ptr__ += IMC::serialize(ssa, ptr__);
-      return ptr__;
+      IMC::serialize(va, bfr__ + 0);
+      IMC::serialize(aoa, bfr__ + 4);
+      IMC::serialize(ssa, bfr__ + 8);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Airflow::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(va, bfr__, size__);
-      bfr__ += IMC::deserialize(aoa, bfr__, size__);
-      bfr__ += IMC::deserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(va, bfr__ + 0);
+      IMC::load(aoa, bfr__ + 4);
+      IMC::load(ssa, bfr__ + 8);
+      return c_payload_size;
     }
 
     uint16_t
     Airflow::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(va, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(aoa, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(va, bfr__ + 0);
+      IMC::reverseLoad(aoa, bfr__ + 4);
+      IMC::reverseLoad(ssa, bfr__ + 8);
+      return c_payload_size;
     }
 
     void
@@ -10809,9 +11002,12 @@ namespace DUNE
       IMC::toJSON(os__, "ssa", ssa, nindent__);
     }
 
+    const uint16_t DesiredHeading::c_payload_size;
+
     DesiredHeading::DesiredHeading(void)
     {
       m_header.mgid = 400;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10838,25 +11034,24 @@ namespace DUNE
     uint8_t*
     DesiredHeading::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredHeading::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredHeading::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -10877,9 +11072,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t DesiredZ::c_payload_size;
+
     DesiredZ::DesiredZ(void)
     {
       m_header.mgid = 401;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10908,28 +11106,27 @@ namespace DUNE
     uint8_t*
     DesiredZ::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(z_units, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredZ::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(z_units, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredZ::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(z_units, bfr__ + 4);
+      return c_payload_size;
     }
 
     fp64_t
@@ -10951,9 +11148,12 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    const uint16_t DesiredSpeed::c_payload_size;
+
     DesiredSpeed::DesiredSpeed(void)
     {
       m_header.mgid = 402;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -10981,29 +11181,28 @@ namespace DUNE
 
     uint8_t*
     DesiredSpeed::serializeFields(uint8_t* bfr__) const
-    {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      return ptr__;
+    {
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(speed_units, bfr__ + 8);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(speed_units, bfr__ + 8);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(speed_units, bfr__ + 8);
+      return c_payload_size;
     }
 
     fp64_t
@@ -11025,9 +11224,12 @@ namespace DUNE
       IMC::toJSON(os__, "speed_units", speed_units, nindent__);
     }
 
+    const uint16_t DesiredRoll::c_payload_size;
+
     DesiredRoll::DesiredRoll(void)
     {
       m_header.mgid = 403;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11054,25 +11256,24 @@ namespace DUNE
     uint8_t*
     DesiredRoll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredRoll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredRoll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -11093,9 +11294,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t DesiredPitch::c_payload_size;
+
     DesiredPitch::DesiredPitch(void)
     {
       m_header.mgid = 404;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11122,25 +11326,24 @@ namespace DUNE
     uint8_t*
     DesiredPitch::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredPitch::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredPitch::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -11161,9 +11364,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t DesiredVerticalRate::c_payload_size;
+
     DesiredVerticalRate::DesiredVerticalRate(void)
     {
       m_header.mgid = 405;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11190,25 +11396,24 @@ namespace DUNE
     uint8_t*
     DesiredVerticalRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredVerticalRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredVerticalRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -11229,9 +11434,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t DesiredPath::c_payload_size;
+
     DesiredPath::DesiredPath(void)
     {
       m_header.mgid = 406;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11286,61 +11494,60 @@ namespace DUNE
     uint8_t*
     DesiredPath::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(path_ref, bfr__ + 0);
+      IMC::serialize(start_lat, bfr__ + 4);
+      IMC::serialize(start_lon, bfr__ + 12);
+      IMC::serialize(start_z, bfr__ + 20);
+      IMC::serialize(start_z_units, bfr__ + 24);
+      IMC::serialize(end_lat, bfr__ + 25);
+      IMC::serialize(end_lon, bfr__ + 33);
+      IMC::serialize(end_z, bfr__ + 41);
+      IMC::serialize(end_z_units, bfr__ + 45);
+      IMC::serialize(speed, bfr__ + 46);
+      IMC::serialize(speed_units, bfr__ + 50);
+      IMC::serialize(lradius, bfr__ + 51);
+      IMC::serialize(flags, bfr__ + 55);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredPath::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(path_ref, bfr__ + 0);
+      IMC::load(start_lat, bfr__ + 4);
+      IMC::load(start_lon, bfr__ + 12);
+      IMC::load(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::load(end_lat, bfr__ + 25);
+      IMC::load(end_lon, bfr__ + 33);
+      IMC::load(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::load(speed, bfr__ + 46);
+      IMC::load(speed_units, bfr__ + 50);
+      IMC::load(lradius, bfr__ + 51);
+      IMC::load(flags, bfr__ + 55);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredPath::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(path_ref, bfr__ + 0);
+      IMC::reverseLoad(start_lat, bfr__ + 4);
+      IMC::reverseLoad(start_lon, bfr__ + 12);
+      IMC::reverseLoad(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::reverseLoad(end_lat, bfr__ + 25);
+      IMC::reverseLoad(end_lon, bfr__ + 33);
+      IMC::reverseLoad(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::reverseLoad(speed, bfr__ + 46);
+      IMC::load(speed_units, bfr__ + 50);
+      IMC::reverseLoad(lradius, bfr__ + 51);
+      IMC::load(flags, bfr__ + 55);
+      return c_payload_size;
     }
 
     void
@@ -11361,9 +11568,12 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    const uint16_t DesiredControl::c_payload_size;
+
     DesiredControl::DesiredControl(void)
     {
       m_header.mgid = 407;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11402,43 +11612,42 @@ namespace DUNE
     uint8_t*
     DesiredControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      IMC::serialize(k, bfr__ + 24);
+      IMC::serialize(m, bfr__ + 32);
+      IMC::serialize(n, bfr__ + 40);
+      IMC::serialize(flags, bfr__ + 48);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      IMC::load(k, bfr__ + 24);
+      IMC::load(m, bfr__ + 32);
+      IMC::load(n, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      IMC::reverseLoad(k, bfr__ + 24);
+      IMC::reverseLoad(m, bfr__ + 32);
+      IMC::reverseLoad(n, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return c_payload_size;
     }
 
     void
@@ -11453,9 +11662,12 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    const uint16_t DesiredHeadingRate::c_payload_size;
+
     DesiredHeadingRate::DesiredHeadingRate(void)
     {
       m_header.mgid = 408;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11482,25 +11694,24 @@ namespace DUNE
     uint8_t*
     DesiredHeadingRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredHeadingRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredHeadingRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -11521,9 +11732,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t DesiredVelocity::c_payload_size;
+
     DesiredVelocity::DesiredVelocity(void)
     {
       m_header.mgid = 409;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11562,43 +11776,42 @@ namespace DUNE
     uint8_t*
     DesiredVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(u, bfr__ + 0);
+      IMC::serialize(v, bfr__ + 8);
+      IMC::serialize(w, bfr__ + 16);
+      IMC::serialize(p, bfr__ + 24);
+      IMC::serialize(q, bfr__ + 32);
+      IMC::serialize(r, bfr__ + 40);
+      IMC::serialize(flags, bfr__ + 48);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(u, bfr__ + 0);
+      IMC::load(v, bfr__ + 8);
+      IMC::load(w, bfr__ + 16);
+      IMC::load(p, bfr__ + 24);
+      IMC::load(q, bfr__ + 32);
+      IMC::load(r, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(u, bfr__ + 0);
+      IMC::reverseLoad(v, bfr__ + 8);
+      IMC::reverseLoad(w, bfr__ + 16);
+      IMC::reverseLoad(p, bfr__ + 24);
+      IMC::reverseLoad(q, bfr__ + 32);
+      IMC::reverseLoad(r, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return c_payload_size;
     }
 
     void
@@ -11613,9 +11826,12 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    const uint16_t PathControlState::c_payload_size;
+
     PathControlState::PathControlState(void)
     {
       m_header.mgid = 410;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11682,79 +11898,78 @@ namespace DUNE
     uint8_t*
     PathControlState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(course_error, ptr__);
-      ptr__ += IMC::serialize(eta, ptr__);
-      return ptr__;
+      IMC::serialize(path_ref, bfr__ + 0);
+      IMC::serialize(start_lat, bfr__ + 4);
+      IMC::serialize(start_lon, bfr__ + 12);
+      IMC::serialize(start_z, bfr__ + 20);
+      IMC::serialize(start_z_units, bfr__ + 24);
+      IMC::serialize(end_lat, bfr__ + 25);
+      IMC::serialize(end_lon, bfr__ + 33);
+      IMC::serialize(end_z, bfr__ + 41);
+      IMC::serialize(end_z_units, bfr__ + 45);
+      IMC::serialize(lradius, bfr__ + 46);
+      IMC::serialize(flags, bfr__ + 50);
+      IMC::serialize(x, bfr__ + 51);
+      IMC::serialize(y, bfr__ + 55);
+      IMC::serialize(z, bfr__ + 59);
+      IMC::serialize(vx, bfr__ + 63);
+      IMC::serialize(vy, bfr__ + 67);
+      IMC::serialize(vz, bfr__ + 71);
+      IMC::serialize(course_error, bfr__ + 75);
+      IMC::serialize(eta, bfr__ + 79);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     PathControlState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(course_error, bfr__, size__);
-      bfr__ += IMC::deserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(path_ref, bfr__ + 0);
+      IMC::load(start_lat, bfr__ + 4);
+      IMC::load(start_lon, bfr__ + 12);
+      IMC::load(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::load(end_lat, bfr__ + 25);
+      IMC::load(end_lon, bfr__ + 33);
+      IMC::load(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::load(lradius, bfr__ + 46);
+      IMC::load(flags, bfr__ + 50);
+      IMC::load(x, bfr__ + 51);
+      IMC::load(y, bfr__ + 55);
+      IMC::load(z, bfr__ + 59);
+      IMC::load(vx, bfr__ + 63);
+      IMC::load(vy, bfr__ + 67);
+      IMC::load(vz, bfr__ + 71);
+      IMC::load(course_error, bfr__ + 75);
+      IMC::load(eta, bfr__ + 79);
+      return c_payload_size;
     }
 
     uint16_t
     PathControlState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(course_error, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(path_ref, bfr__ + 0);
+      IMC::reverseLoad(start_lat, bfr__ + 4);
+      IMC::reverseLoad(start_lon, bfr__ + 12);
+      IMC::reverseLoad(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::reverseLoad(end_lat, bfr__ + 25);
+      IMC::reverseLoad(end_lon, bfr__ + 33);
+      IMC::reverseLoad(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::reverseLoad(lradius, bfr__ + 46);
+      IMC::load(flags, bfr__ + 50);
+      IMC::reverseLoad(x, bfr__ + 51);
+      IMC::reverseLoad(y, bfr__ + 55);
+      IMC::reverseLoad(z, bfr__ + 59);
+      IMC::reverseLoad(vx, bfr__ + 63);
+      IMC::reverseLoad(vy, bfr__ + 67);
+      IMC::reverseLoad(vz, bfr__ + 71);
+      IMC::reverseLoad(course_error, bfr__ + 75);
+      IMC::reverseLoad(eta, bfr__ + 79);
+      return c_payload_size;
     }
 
     void
@@ -11781,9 +11996,12 @@ namespace DUNE
       IMC::toJSON(os__, "eta", eta, nindent__);
     }
 
+    const uint16_t AllocatedControlTorques::c_payload_size;
+
     AllocatedControlTorques::AllocatedControlTorques(void)
     {
       m_header.mgid = 411;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11814,31 +12032,30 @@ namespace DUNE
     uint8_t*
     AllocatedControlTorques::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      return ptr__;
+      IMC::serialize(k, bfr__ + 0);
+      IMC::serialize(m, bfr__ + 8);
+      IMC::serialize(n, bfr__ + 16);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     AllocatedControlTorques::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(k, bfr__ + 0);
+      IMC::load(m, bfr__ + 8);
+      IMC::load(n, bfr__ + 16);
+      return c_payload_size;
     }
 
     uint16_t
     AllocatedControlTorques::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(k, bfr__ + 0);
+      IMC::reverseLoad(m, bfr__ + 8);
+      IMC::reverseLoad(n, bfr__ + 16);
+      return c_payload_size;
     }
 
     void
@@ -11849,9 +12066,12 @@ namespace DUNE
       IMC::toJSON(os__, "n", n, nindent__);
     }
 
+    const uint16_t ControlParcel::c_payload_size;
+
     ControlParcel::ControlParcel(void)
     {
       m_header.mgid = 412;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11884,34 +12104,33 @@ namespace DUNE
     uint8_t*
     ControlParcel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(i, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(a, ptr__);
-      return ptr__;
+      IMC::serialize(p, bfr__ + 0);
+      IMC::serialize(i, bfr__ + 4);
+      IMC::serialize(d, bfr__ + 8);
+      IMC::serialize(a, bfr__ + 12);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ControlParcel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(i, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(p, bfr__ + 0);
+      IMC::load(i, bfr__ + 4);
+      IMC::load(d, bfr__ + 8);
+      IMC::load(a, bfr__ + 12);
+      return c_payload_size;
     }
 
     uint16_t
     ControlParcel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(i, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(p, bfr__ + 0);
+      IMC::reverseLoad(i, bfr__ + 4);
+      IMC::reverseLoad(d, bfr__ + 8);
+      IMC::reverseLoad(a, bfr__ + 12);
+      return c_payload_size;
     }
 
     void
@@ -11923,9 +12142,12 @@ namespace DUNE
       IMC::toJSON(os__, "a", a, nindent__);
     }
 
+    const uint16_t Brake::c_payload_size;
+
     Brake::Brake(void)
     {
       m_header.mgid = 413;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -11952,25 +12174,24 @@ namespace DUNE
     uint8_t*
     Brake::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Brake::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Brake::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -11979,9 +12200,12 @@ namespace DUNE
       IMC::toJSON(os__, "op", op, nindent__);
     }
 
+    const uint16_t DesiredLinearState::c_payload_size;
+
     DesiredLinearState::DesiredLinearState(void)
     {
       m_header.mgid = 414;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -12026,52 +12250,51 @@ namespace DUNE
     uint8_t*
     DesiredLinearState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(ax, ptr__);
-      ptr__ += IMC::serialize(ay, ptr__);
-      ptr__ += IMC::serialize(az, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      IMC::serialize(vx, bfr__ + 24);
+      IMC::serialize(vy, bfr__ + 32);
+      IMC::serialize(vz, bfr__ + 40);
+      IMC::serialize(ax, bfr__ + 48);
+      IMC::serialize(ay, bfr__ + 56);
+      IMC::serialize(az, bfr__ + 64);
+      IMC::serialize(flags, bfr__ + 72);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredLinearState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(ax, bfr__, size__);
-      bfr__ += IMC::deserialize(ay, bfr__, size__);
-      bfr__ += IMC::deserialize(az, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      IMC::load(vx, bfr__ + 24);
+      IMC::load(vy, bfr__ + 32);
+      IMC::load(vz, bfr__ + 40);
+      IMC::load(ax, bfr__ + 48);
+      IMC::load(ay, bfr__ + 56);
+      IMC::load(az, bfr__ + 64);
+      IMC::load(flags, bfr__ + 72);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredLinearState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ax, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ay, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(az, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      IMC::reverseLoad(vx, bfr__ + 24);
+      IMC::reverseLoad(vy, bfr__ + 32);
+      IMC::reverseLoad(vz, bfr__ + 40);
+      IMC::reverseLoad(ax, bfr__ + 48);
+      IMC::reverseLoad(ay, bfr__ + 56);
+      IMC::reverseLoad(az, bfr__ + 64);
+      IMC::reverseLoad(flags, bfr__ + 72);
+      return c_payload_size;
     }
 
     void
@@ -12089,9 +12312,12 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    const uint16_t DesiredThrottle::c_payload_size;
+
     DesiredThrottle::DesiredThrottle(void)
     {
       m_header.mgid = 415;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -12118,25 +12344,24 @@ namespace DUNE
     uint8_t*
     DesiredThrottle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DesiredThrottle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     DesiredThrottle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -12924,9 +13149,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    const uint16_t PathPoint::c_payload_size;
+
     PathPoint::PathPoint(void)
     {
       m_header.mgid = 458;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -12957,31 +13185,30 @@ namespace DUNE
     uint8_t*
     PathPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     PathPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      return c_payload_size;
     }
 
     uint16_t
     PathPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      return c_payload_size;
     }
 
     void
@@ -13242,9 +13469,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    const uint16_t TeleoperationDone::c_payload_size;
+
     TeleoperationDone::TeleoperationDone(void)
     {
       m_header.mgid = 460;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -13512,9 +13742,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    const uint16_t TrajectoryPoint::c_payload_size;
+
     TrajectoryPoint::TrajectoryPoint(void)
     {
       m_header.mgid = 464;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -13547,34 +13780,33 @@ namespace DUNE
     uint8_t*
     TrajectoryPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(t, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(t, bfr__ + 12);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     TrajectoryPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      IMC::load(t, bfr__ + 12);
+      return c_payload_size;
     }
 
     uint16_t
     TrajectoryPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      IMC::reverseLoad(t, bfr__ + 12);
+      return c_payload_size;
     }
 
     void
@@ -13791,9 +14023,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    const uint16_t VehicleFormationParticipant::c_payload_size;
+
     VehicleFormationParticipant::VehicleFormationParticipant(void)
     {
       m_header.mgid = 467;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -13826,34 +14061,33 @@ namespace DUNE
     uint8_t*
     VehicleFormationParticipant::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(vid, ptr__);
-      ptr__ += IMC::serialize(off_x, ptr__);
-      ptr__ += IMC::serialize(off_y, ptr__);
-      ptr__ += IMC::serialize(off_z, ptr__);
-      return ptr__;
+      IMC::serialize(vid, bfr__ + 0);
+      IMC::serialize(off_x, bfr__ + 2);
+      IMC::serialize(off_y, bfr__ + 6);
+      IMC::serialize(off_z, bfr__ + 10);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     VehicleFormationParticipant::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(vid, bfr__, size__);
-      bfr__ += IMC::deserialize(off_x, bfr__, size__);
-      bfr__ += IMC::deserialize(off_y, bfr__, size__);
-      bfr__ += IMC::deserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(vid, bfr__ + 0);
+      IMC::load(off_x, bfr__ + 2);
+      IMC::load(off_y, bfr__ + 6);
+      IMC::load(off_z, bfr__ + 10);
+      return c_payload_size;
     }
 
     uint16_t
     VehicleFormationParticipant::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(vid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(vid, bfr__ + 0);
+      IMC::reverseLoad(off_x, bfr__ + 2);
+      IMC::reverseLoad(off_y, bfr__ + 6);
+      IMC::reverseLoad(off_z, bfr__ + 10);
+      return c_payload_size;
     }
 
     void
@@ -14019,9 +14253,12 @@ namespace DUNE
       participants.setDestinationEntity(value__);
     }
 
+    const uint16_t StopManeuver::c_payload_size;
+
     StopManeuver::StopManeuver(void)
     {
       m_header.mgid = 468;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -14058,9 +14295,12 @@ namespace DUNE
       return 0;
     }
 
+    const uint16_t RegisterManeuver::c_payload_size;
+
     RegisterManeuver::RegisterManeuver(void)
     {
       m_header.mgid = 469;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -14087,25 +14327,24 @@ namespace DUNE
     uint8_t*
     RegisterManeuver::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mid, ptr__);
-      return ptr__;
+      IMC::serialize(mid, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     RegisterManeuver::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(mid, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     RegisterManeuver::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(mid, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -14182,9 +14421,12 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    const uint16_t FollowSystem::c_payload_size;
+
     FollowSystem::FollowSystem(void)
     {
       m_header.mgid = 471;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -14225,46 +14467,45 @@ namespace DUNE
     uint8_t*
     FollowSystem::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(system, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::serialize(system, bfr__ + 0);
+      IMC::serialize(duration, bfr__ + 2);
+      IMC::serialize(speed, bfr__ + 4);
+      IMC::serialize(speed_units, bfr__ + 8);
+      IMC::serialize(x, bfr__ + 9);
+      IMC::serialize(y, bfr__ + 13);
+      IMC::serialize(z, bfr__ + 17);
+      IMC::serialize(z_units, bfr__ + 21);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FollowSystem::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(system, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(system, bfr__ + 0);
+      IMC::load(duration, bfr__ + 2);
+      IMC::load(speed, bfr__ + 4);
+      IMC::load(speed_units, bfr__ + 8);
+      IMC::load(x, bfr__ + 9);
+      IMC::load(y, bfr__ + 13);
+      IMC::load(z, bfr__ + 17);
+      IMC::load(z_units, bfr__ + 21);
+      return c_payload_size;
     }
 
     uint16_t
     FollowSystem::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(system, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(system, bfr__ + 0);
+      IMC::reverseLoad(duration, bfr__ + 2);
+      IMC::reverseLoad(speed, bfr__ + 4);
+      IMC::load(speed_units, bfr__ + 8);
+      IMC::reverseLoad(x, bfr__ + 9);
+      IMC::reverseLoad(y, bfr__ + 13);
+      IMC::reverseLoad(z, bfr__ + 17);
+      IMC::load(z_units, bfr__ + 21);
+      return c_payload_size;
     }
 
     void
@@ -14280,9 +14521,12 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    const uint16_t CommsRelay::c_payload_size;
+
     CommsRelay::CommsRelay(void)
     {
       m_header.mgid = 472;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -14325,46 +14569,45 @@ namespace DUNE
     uint8_t*
     CommsRelay::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(sys_a, ptr__);
-      ptr__ += IMC::serialize(sys_b, ptr__);
-      ptr__ += IMC::serialize(move_threshold, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 16);
+      IMC::serialize(speed_units, bfr__ + 20);
+      IMC::serialize(duration, bfr__ + 21);
+      IMC::serialize(sys_a, bfr__ + 23);
+      IMC::serialize(sys_b, bfr__ + 25);
+      IMC::serialize(move_threshold, bfr__ + 27);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     CommsRelay::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::deserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(speed, bfr__ + 16);
+      IMC::load(speed_units, bfr__ + 20);
+      IMC::load(duration, bfr__ + 21);
+      IMC::load(sys_a, bfr__ + 23);
+      IMC::load(sys_b, bfr__ + 25);
+      IMC::load(move_threshold, bfr__ + 27);
+      return c_payload_size;
     }
 
     uint16_t
     CommsRelay::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(speed, bfr__ + 16);
+      IMC::load(speed_units, bfr__ + 20);
+      IMC::reverseLoad(duration, bfr__ + 21);
+      IMC::reverseLoad(sys_a, bfr__ + 23);
+      IMC::reverseLoad(sys_b, bfr__ + 25);
+      IMC::reverseLoad(move_threshold, bfr__ + 27);
+      return c_payload_size;
     }
 
     void
@@ -14380,9 +14623,12 @@ namespace DUNE
       IMC::toJSON(os__, "move_threshold", move_threshold, nindent__);
     }
 
+    const uint16_t PolygonVertex::c_payload_size;
+
     PolygonVertex::PolygonVertex(void)
     {
       m_header.mgid = 474;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -14413,28 +14659,27 @@ namespace DUNE
     uint8_t*
     PolygonVertex::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     PolygonVertex::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      return c_payload_size;
     }
 
     uint16_t
     PolygonVertex::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      return c_payload_size;
     }
 
     void
@@ -14947,9 +15192,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    const uint16_t FollowReference::c_payload_size;
+
     FollowReference::FollowReference(void)
     {
       m_header.mgid = 478;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -14984,37 +15232,36 @@ namespace DUNE
     uint8_t*
     FollowReference::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(control_src, ptr__);
-      ptr__ += IMC::serialize(control_ent, ptr__);
-      ptr__ += IMC::serialize(timeout, ptr__);
-      ptr__ += IMC::serialize(loiter_radius, ptr__);
-      ptr__ += IMC::serialize(altitude_interval, ptr__);
-      return ptr__;
+      IMC::serialize(control_src, bfr__ + 0);
+      IMC::serialize(control_ent, bfr__ + 2);
+      IMC::serialize(timeout, bfr__ + 3);
+      IMC::serialize(loiter_radius, bfr__ + 7);
+      IMC::serialize(altitude_interval, bfr__ + 11);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FollowReference::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      bfr__ += IMC::deserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::deserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(control_src, bfr__ + 0);
+      IMC::load(control_ent, bfr__ + 2);
+      IMC::load(timeout, bfr__ + 3);
+      IMC::load(loiter_radius, bfr__ + 7);
+      IMC::load(altitude_interval, bfr__ + 11);
+      return c_payload_size;
     }
 
     uint16_t
     FollowReference::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(control_src, bfr__ + 0);
+      IMC::load(control_ent, bfr__ + 2);
+      IMC::reverseLoad(timeout, bfr__ + 3);
+      IMC::reverseLoad(loiter_radius, bfr__ + 7);
+      IMC::reverseLoad(altitude_interval, bfr__ + 11);
+      return c_payload_size;
     }
 
     void
@@ -16169,9 +16416,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    const uint16_t ScheduledGoto::c_payload_size;
+
     ScheduledGoto::ScheduledGoto(void)
     {
       m_header.mgid = 487;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -16214,46 +16464,45 @@ namespace DUNE
     uint8_t*
     ScheduledGoto::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(arrival_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(travel_z, ptr__);
-      ptr__ += IMC::serialize(travel_z_units, ptr__);
-      ptr__ += IMC::serialize(delayed, ptr__);
-      return ptr__;
+      IMC::serialize(arrival_time, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 8);
+      IMC::serialize(lon, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      IMC::serialize(z_units, bfr__ + 28);
+      IMC::serialize(travel_z, bfr__ + 29);
+      IMC::serialize(travel_z_units, bfr__ + 33);
+      IMC::serialize(delayed, bfr__ + 34);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ScheduledGoto::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(arrival_time, bfr__ + 0);
+      IMC::load(lat, bfr__ + 8);
+      IMC::load(lon, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      IMC::load(z_units, bfr__ + 28);
+      IMC::load(travel_z, bfr__ + 29);
+      IMC::load(travel_z_units, bfr__ + 33);
+      IMC::load(delayed, bfr__ + 34);
+      return c_payload_size;
     }
 
     uint16_t
     ScheduledGoto::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(arrival_time, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 8);
+      IMC::reverseLoad(lon, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      IMC::load(z_units, bfr__ + 28);
+      IMC::reverseLoad(travel_z, bfr__ + 29);
+      IMC::load(travel_z_units, bfr__ + 33);
+      IMC::load(delayed, bfr__ + 34);
+      return c_payload_size;
     }
 
     void
@@ -16541,9 +16790,12 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    const uint16_t ImageTracking::c_payload_size;
+
     ImageTracking::ImageTracking(void)
     {
       m_header.mgid = 490;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17453,9 +17705,12 @@ namespace DUNE
       IMC::toJSON(os__, "last_error_time", last_error_time, nindent__);
     }
 
+    const uint16_t OperationalLimits::c_payload_size;
+
     OperationalLimits::OperationalLimits(void)
     {
       m_header.mgid = 504;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17512,58 +17767,57 @@ namespace DUNE
     uint8_t*
     OperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(max_depth, ptr__);
-      ptr__ += IMC::serialize(min_altitude, ptr__);
-      ptr__ += IMC::serialize(max_altitude, ptr__);
-      ptr__ += IMC::serialize(min_speed, ptr__);
-      ptr__ += IMC::serialize(max_speed, ptr__);
-      ptr__ += IMC::serialize(max_vrate, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(orientation, ptr__);
-      ptr__ += IMC::serialize(width, ptr__);
-      ptr__ += IMC::serialize(length, ptr__);
-      return ptr__;
+      IMC::serialize(mask, bfr__ + 0);
+      IMC::serialize(max_depth, bfr__ + 1);
+      IMC::serialize(min_altitude, bfr__ + 5);
+      IMC::serialize(max_altitude, bfr__ + 9);
+      IMC::serialize(min_speed, bfr__ + 13);
+      IMC::serialize(max_speed, bfr__ + 17);
+      IMC::serialize(max_vrate, bfr__ + 21);
+      IMC::serialize(lat, bfr__ + 25);
+      IMC::serialize(lon, bfr__ + 33);
+      IMC::serialize(orientation, bfr__ + 41);
+      IMC::serialize(width, bfr__ + 45);
+      IMC::serialize(length, bfr__ + 49);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     OperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::deserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(orientation, bfr__, size__);
-      bfr__ += IMC::deserialize(width, bfr__, size__);
-      bfr__ += IMC::deserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(mask, bfr__ + 0);
+      IMC::load(max_depth, bfr__ + 1);
+      IMC::load(min_altitude, bfr__ + 5);
+      IMC::load(max_altitude, bfr__ + 9);
+      IMC::load(min_speed, bfr__ + 13);
+      IMC::load(max_speed, bfr__ + 17);
+      IMC::load(max_vrate, bfr__ + 21);
+      IMC::load(lat, bfr__ + 25);
+      IMC::load(lon, bfr__ + 33);
+      IMC::load(orientation, bfr__ + 41);
+      IMC::load(width, bfr__ + 45);
+      IMC::load(length, bfr__ + 49);
+      return c_payload_size;
     }
 
     uint16_t
     OperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(orientation, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(mask, bfr__ + 0);
+      IMC::reverseLoad(max_depth, bfr__ + 1);
+      IMC::reverseLoad(min_altitude, bfr__ + 5);
+      IMC::reverseLoad(max_altitude, bfr__ + 9);
+      IMC::reverseLoad(min_speed, bfr__ + 13);
+      IMC::reverseLoad(max_speed, bfr__ + 17);
+      IMC::reverseLoad(max_vrate, bfr__ + 21);
+      IMC::reverseLoad(lat, bfr__ + 25);
+      IMC::reverseLoad(lon, bfr__ + 33);
+      IMC::reverseLoad(orientation, bfr__ + 41);
+      IMC::reverseLoad(width, bfr__ + 45);
+      IMC::reverseLoad(length, bfr__ + 49);
+      return c_payload_size;
     }
 
     void
@@ -17583,9 +17837,12 @@ namespace DUNE
       IMC::toJSON(os__, "length", length, nindent__);
     }
 
+    const uint16_t GetOperationalLimits::c_payload_size;
+
     GetOperationalLimits::GetOperationalLimits(void)
     {
       m_header.mgid = 505;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17622,9 +17879,12 @@ namespace DUNE
       return 0;
     }
 
+    const uint16_t Calibration::c_payload_size;
+
     Calibration::Calibration(void)
     {
       m_header.mgid = 506;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17651,25 +17911,24 @@ namespace DUNE
     uint8_t*
     Calibration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(duration, ptr__);
-      return ptr__;
+      IMC::serialize(duration, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Calibration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(duration, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     Calibration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(duration, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -17678,9 +17937,12 @@ namespace DUNE
       IMC::toJSON(os__, "duration", duration, nindent__);
     }
 
+    const uint16_t ControlLoops::c_payload_size;
+
     ControlLoops::ControlLoops(void)
     {
       m_header.mgid = 507;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17711,31 +17973,30 @@ namespace DUNE
     uint8_t*
     ControlLoops::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(enable, ptr__);
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(scope_ref, ptr__);
-      return ptr__;
+      IMC::serialize(enable, bfr__ + 0);
+      IMC::serialize(mask, bfr__ + 1);
+      IMC::serialize(scope_ref, bfr__ + 5);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ControlLoops::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(enable, bfr__ + 0);
+      IMC::load(mask, bfr__ + 1);
+      IMC::load(scope_ref, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
     ControlLoops::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(enable, bfr__ + 0);
+      IMC::reverseLoad(mask, bfr__ + 1);
+      IMC::reverseLoad(scope_ref, bfr__ + 5);
+      return c_payload_size;
     }
 
     void
@@ -17746,9 +18007,12 @@ namespace DUNE
       IMC::toJSON(os__, "scope_ref", scope_ref, nindent__);
     }
 
+    const uint16_t VehicleMedium::c_payload_size;
+
     VehicleMedium::VehicleMedium(void)
     {
       m_header.mgid = 508;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17775,25 +18039,24 @@ namespace DUNE
     uint8_t*
     VehicleMedium::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(medium, ptr__);
-      return ptr__;
+      IMC::serialize(medium, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     VehicleMedium::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(medium, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     VehicleMedium::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(medium, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -17802,9 +18065,12 @@ namespace DUNE
       IMC::toJSON(os__, "medium", medium, nindent__);
     }
 
+    const uint16_t Collision::c_payload_size;
+
     Collision::Collision(void)
     {
       m_header.mgid = 509;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17833,28 +18099,27 @@ namespace DUNE
     uint8_t*
     Collision::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Collision::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     Collision::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return c_payload_size;
     }
 
     fp64_t
@@ -17876,9 +18141,12 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    const uint16_t FormState::c_payload_size;
+
     FormState::FormState(void)
     {
       m_header.mgid = 510;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -17915,40 +18183,39 @@ namespace DUNE
     uint8_t*
     FormState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::serialize(possimerr, bfr__ + 0);
+      IMC::serialize(converg, bfr__ + 4);
+      IMC::serialize(turbulence, bfr__ + 8);
+      IMC::serialize(possimmon, bfr__ + 12);
+      IMC::serialize(commmon, bfr__ + 13);
+      IMC::serialize(convergmon, bfr__ + 14);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FormState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(possimerr, bfr__ + 0);
+      IMC::load(converg, bfr__ + 4);
+      IMC::load(turbulence, bfr__ + 8);
+      IMC::load(possimmon, bfr__ + 12);
+      IMC::load(commmon, bfr__ + 13);
+      IMC::load(convergmon, bfr__ + 14);
+      return c_payload_size;
     }
 
     uint16_t
     FormState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(possimerr, bfr__ + 0);
+      IMC::reverseLoad(converg, bfr__ + 4);
+      IMC::reverseLoad(turbulence, bfr__ + 8);
+      IMC::load(possimmon, bfr__ + 12);
+      IMC::load(commmon, bfr__ + 13);
+      IMC::load(convergmon, bfr__ + 14);
+      return c_payload_size;
     }
 
     void
@@ -18024,9 +18291,12 @@ namespace DUNE
       IMC::toJSON(os__, "mode", mode, nindent__);
     }
 
+    const uint16_t FormationState::c_payload_size;
+
     FormationState::FormationState(void)
     {
       m_header.mgid = 512;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -18067,46 +18337,45 @@ namespace DUNE
     uint8_t*
     FormationState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      IMC::serialize(op, bfr__ + 1);
+      IMC::serialize(possimerr, bfr__ + 2);
+      IMC::serialize(converg, bfr__ + 6);
+      IMC::serialize(turbulence, bfr__ + 10);
+      IMC::serialize(possimmon, bfr__ + 14);
+      IMC::serialize(commmon, bfr__ + 15);
+      IMC::serialize(convergmon, bfr__ + 16);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FormationState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(op, bfr__ + 1);
+      IMC::load(possimerr, bfr__ + 2);
+      IMC::load(converg, bfr__ + 6);
+      IMC::load(turbulence, bfr__ + 10);
+      IMC::load(possimmon, bfr__ + 14);
+      IMC::load(commmon, bfr__ + 15);
+      IMC::load(convergmon, bfr__ + 16);
+      return c_payload_size;
     }
 
     uint16_t
     FormationState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(op, bfr__ + 1);
+      IMC::reverseLoad(possimerr, bfr__ + 2);
+      IMC::reverseLoad(converg, bfr__ + 6);
+      IMC::reverseLoad(turbulence, bfr__ + 10);
+      IMC::load(possimmon, bfr__ + 14);
+      IMC::load(commmon, bfr__ + 15);
+      IMC::load(convergmon, bfr__ + 16);
+      return c_payload_size;
     }
 
     void
@@ -18196,9 +18465,12 @@ namespace DUNE
       IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
     }
 
+    const uint16_t Abort::c_payload_size;
+
     Abort::Abort(void)
     {
       m_header.mgid = 550;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -20029,9 +20301,12 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    const uint16_t MapPoint::c_payload_size;
+
     MapPoint::MapPoint(void)
     {
       m_header.mgid = 604;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -20062,31 +20337,30 @@ namespace DUNE
     uint8_t*
     MapPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(alt, bfr__ + 16);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     MapPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(alt, bfr__ + 16);
+      return c_payload_size;
     }
 
     uint16_t
     MapPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(alt, bfr__ + 16);
+      return c_payload_size;
     }
 
     void
@@ -21154,9 +21428,12 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    const uint16_t ImageTxSettings::c_payload_size;
+
     ImageTxSettings::ImageTxSettings(void)
     {
       m_header.mgid = 703;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -21189,34 +21466,33 @@ namespace DUNE
     uint8_t*
     ImageTxSettings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(fps, ptr__);
-      ptr__ += IMC::serialize(quality, ptr__);
-      ptr__ += IMC::serialize(reps, ptr__);
-      ptr__ += IMC::serialize(tsize, ptr__);
-      return ptr__;
+      IMC::serialize(fps, bfr__ + 0);
+      IMC::serialize(quality, bfr__ + 1);
+      IMC::serialize(reps, bfr__ + 2);
+      IMC::serialize(tsize, bfr__ + 3);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     ImageTxSettings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(fps, bfr__ + 0);
+      IMC::load(quality, bfr__ + 1);
+      IMC::load(reps, bfr__ + 2);
+      IMC::load(tsize, bfr__ + 3);
+      return c_payload_size;
     }
 
     uint16_t
     ImageTxSettings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(fps, bfr__ + 0);
+      IMC::load(quality, bfr__ + 1);
+      IMC::load(reps, bfr__ + 2);
+      IMC::load(tsize, bfr__ + 3);
+      return c_payload_size;
     }
 
     void
@@ -21228,9 +21504,12 @@ namespace DUNE
       IMC::toJSON(os__, "tsize", tsize, nindent__);
     }
 
+    const uint16_t RemoteState::c_payload_size;
+
     RemoteState::RemoteState(void)
     {
       m_header.mgid = 750;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -21267,37 +21546,36 @@ namespace DUNE
     uint8_t*
     RemoteState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
-    }
-
-    uint16_t
-    RemoteState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 4);
+      IMC::serialize(depth, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 9);
+      IMC::serialize(psi, bfr__ + 13);
+      return bfr__ + c_payload_size;
+    }
+
+    uint16_t
+    RemoteState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 4);
+      IMC::load(depth, bfr__ + 8);
+      IMC::load(speed, bfr__ + 9);
+      IMC::load(psi, bfr__ + 13);
+      return c_payload_size;
     }
 
     uint16_t
     RemoteState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 4);
+      IMC::load(depth, bfr__ + 8);
+      IMC::reverseLoad(speed, bfr__ + 9);
+      IMC::reverseLoad(psi, bfr__ + 13);
+      return c_payload_size;
     }
 
     void
@@ -21776,9 +22054,12 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    const uint16_t CreateSession::c_payload_size;
+
     CreateSession::CreateSession(void)
     {
       m_header.mgid = 806;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -21805,25 +22086,24 @@ namespace DUNE
     uint8_t*
     CreateSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timeout, ptr__);
-      return ptr__;
+      IMC::serialize(timeout, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     CreateSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(timeout, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     CreateSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(timeout, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -21832,9 +22112,12 @@ namespace DUNE
       IMC::toJSON(os__, "timeout", timeout, nindent__);
     }
 
+    const uint16_t CloseSession::c_payload_size;
+
     CloseSession::CloseSession(void)
     {
       m_header.mgid = 807;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -21861,25 +22144,24 @@ namespace DUNE
     uint8_t*
     CloseSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     CloseSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(sessid, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     CloseSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(sessid, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -21950,9 +22232,12 @@ namespace DUNE
       IMC::toJSON(os__, "messages", messages, nindent__);
     }
 
+    const uint16_t SessionKeepAlive::c_payload_size;
+
     SessionKeepAlive::SessionKeepAlive(void)
     {
       m_header.mgid = 809;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -21979,25 +22264,24 @@ namespace DUNE
     uint8_t*
     SessionKeepAlive::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SessionKeepAlive::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(sessid, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     SessionKeepAlive::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(sessid, bfr__ + 0);
+      return c_payload_size;
     }
 
     void
@@ -22006,9 +22290,12 @@ namespace DUNE
       IMC::toJSON(os__, "sessid", sessid, nindent__);
     }
 
+    const uint16_t SessionStatus::c_payload_size;
+
     SessionStatus::SessionStatus(void)
     {
       m_header.mgid = 810;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -22037,28 +22324,27 @@ namespace DUNE
     uint8_t*
     SessionStatus::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      ptr__ += IMC::serialize(status, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      IMC::serialize(status, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SessionStatus::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(sessid, bfr__ + 0);
+      IMC::load(status, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     SessionStatus::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(sessid, bfr__ + 0);
+      IMC::load(status, bfr__ + 4);
+      return c_payload_size;
     }
 
     void
@@ -22285,6 +22571,18 @@ namespace DUNE
       return ptr__;
     }
 
+    uint8_t*
+    UamTxFrame::serializeFieldsHead(uint8_t* bfr__, const RawData*& tail__) const
+    {
+      uint8_t* ptr__ = bfr__;
+      ptr__ += IMC::serialize(seq, ptr__);
+      ptr__ += IMC::serialize(sys_dst, ptr__);
+      ptr__ += IMC::serialize(flags, ptr__);
+      ptr__ += IMC::serialize((uint16_t)data.size(), ptr__);
+      tail__ = &data;
+      return ptr__;
+    }
+
     uint16_t
     UamTxFrame::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
@@ -22550,9 +22848,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t FormCtrlParam::c_payload_size;
+
     FormCtrlParam::FormCtrlParam(void)
     {
       m_header.mgid = 820;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -22589,40 +22890,39 @@ namespace DUNE
     uint8_t*
     FormCtrlParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(longain, ptr__);
-      ptr__ += IMC::serialize(latgain, ptr__);
-      ptr__ += IMC::serialize(bondthick, ptr__);
-      ptr__ += IMC::serialize(leadgain, ptr__);
-      ptr__ += IMC::serialize(deconflgain, ptr__);
-      return ptr__;
+      IMC::serialize(action, bfr__ + 0);
+      IMC::serialize(longain, bfr__ + 1);
+      IMC::serialize(latgain, bfr__ + 5);
+      IMC::serialize(bondthick, bfr__ + 9);
+      IMC::serialize(leadgain, bfr__ + 13);
+      IMC::serialize(deconflgain, bfr__ + 17);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FormCtrlParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(longain, bfr__, size__);
-      bfr__ += IMC::deserialize(latgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::deserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::load(longain, bfr__ + 1);
+      IMC::load(latgain, bfr__ + 5);
+      IMC::load(bondthick, bfr__ + 9);
+      IMC::load(leadgain, bfr__ + 13);
+      IMC::load(deconflgain, bfr__ + 17);
+      return c_payload_size;
     }
 
     uint16_t
     FormCtrlParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(longain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(latgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::reverseLoad(longain, bfr__ + 1);
+      IMC::reverseLoad(latgain, bfr__ + 5);
+      IMC::reverseLoad(bondthick, bfr__ + 9);
+      IMC::reverseLoad(leadgain, bfr__ + 13);
+      IMC::reverseLoad(deconflgain, bfr__ + 17);
+      return c_payload_size;
     }
 
     void
@@ -22636,9 +22936,12 @@ namespace DUNE
       IMC::toJSON(os__, "deconflgain", deconflgain, nindent__);
     }
 
+    const uint16_t FormationEval::c_payload_size;
+
     FormationEval::FormationEval(void)
     {
       m_header.mgid = 821;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -22669,31 +22972,30 @@ namespace DUNE
     uint8_t*
     FormationEval::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(err_mean, ptr__);
-      ptr__ += IMC::serialize(dist_min_abs, ptr__);
-      ptr__ += IMC::serialize(dist_min_mean, ptr__);
-      return ptr__;
+      IMC::serialize(err_mean, bfr__ + 0);
+      IMC::serialize(dist_min_abs, bfr__ + 4);
+      IMC::serialize(dist_min_mean, bfr__ + 8);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FormationEval::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(err_mean, bfr__ + 0);
+      IMC::load(dist_min_abs, bfr__ + 4);
+      IMC::load(dist_min_mean, bfr__ + 8);
+      return c_payload_size;
     }
 
     uint16_t
     FormationEval::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(err_mean, bfr__ + 0);
+      IMC::reverseLoad(dist_min_abs, bfr__ + 4);
+      IMC::reverseLoad(dist_min_mean, bfr__ + 8);
+      return c_payload_size;
     }
 
     void
@@ -22704,9 +23006,12 @@ namespace DUNE
       IMC::toJSON(os__, "dist_min_mean", dist_min_mean, nindent__);
     }
 
+    const uint16_t FormationControlParams::c_payload_size;
+
     FormationControlParams::FormationControlParams(void)
     {
       m_header.mgid = 822;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -22753,55 +23058,54 @@ namespace DUNE
     uint8_t*
     FormationControlParams::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(lon_gain, ptr__);
-      ptr__ += IMC::serialize(lat_gain, ptr__);
-      ptr__ += IMC::serialize(bond_thick, ptr__);
-      ptr__ += IMC::serialize(lead_gain, ptr__);
-      ptr__ += IMC::serialize(deconfl_gain, ptr__);
-      ptr__ += IMC::serialize(accel_switch_gain, ptr__);
-      ptr__ += IMC::serialize(safe_dist, ptr__);
-      ptr__ += IMC::serialize(deconflict_offset, ptr__);
-      ptr__ += IMC::serialize(accel_safe_margin, ptr__);
-      ptr__ += IMC::serialize(accel_lim_x, ptr__);
-      return ptr__;
+      IMC::serialize(action, bfr__ + 0);
+      IMC::serialize(lon_gain, bfr__ + 1);
+      IMC::serialize(lat_gain, bfr__ + 5);
+      IMC::serialize(bond_thick, bfr__ + 9);
+      IMC::serialize(lead_gain, bfr__ + 13);
+      IMC::serialize(deconfl_gain, bfr__ + 17);
+      IMC::serialize(accel_switch_gain, bfr__ + 21);
+      IMC::serialize(safe_dist, bfr__ + 25);
+      IMC::serialize(deconflict_offset, bfr__ + 29);
+      IMC::serialize(accel_safe_margin, bfr__ + 33);
+      IMC::serialize(accel_lim_x, bfr__ + 37);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     FormationControlParams::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::deserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::load(lon_gain, bfr__ + 1);
+      IMC::load(lat_gain, bfr__ + 5);
+      IMC::load(bond_thick, bfr__ + 9);
+      IMC::load(lead_gain, bfr__ + 13);
+      IMC::load(deconfl_gain, bfr__ + 17);
+      IMC::load(accel_switch_gain, bfr__ + 21);
+      IMC::load(safe_dist, bfr__ + 25);
+      IMC::load(deconflict_offset, bfr__ + 29);
+      IMC::load(accel_safe_margin, bfr__ + 33);
+      IMC::load(accel_lim_x, bfr__ + 37);
+      return c_payload_size;
     }
 
     uint16_t
     FormationControlParams::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::reverseLoad(lon_gain, bfr__ + 1);
+      IMC::reverseLoad(lat_gain, bfr__ + 5);
+      IMC::reverseLoad(bond_thick, bfr__ + 9);
+      IMC::reverseLoad(lead_gain, bfr__ + 13);
+      IMC::reverseLoad(deconfl_gain, bfr__ + 17);
+      IMC::reverseLoad(accel_switch_gain, bfr__ + 21);
+      IMC::reverseLoad(safe_dist, bfr__ + 25);
+      IMC::reverseLoad(deconflict_offset, bfr__ + 29);
+      IMC::reverseLoad(accel_safe_margin, bfr__ + 33);
+      IMC::reverseLoad(accel_lim_x, bfr__ + 37);
+      return c_payload_size;
     }
 
     void
@@ -23007,6 +23311,18 @@ namespace DUNE
       return ptr__;
     }
 
+    uint8_t*
+    MessagePart::serializeFieldsHead(uint8_t* bfr__, const RawData*& tail__) const
+    {
+      uint8_t* ptr__ = bfr__;
+      ptr__ += IMC::serialize(uid, ptr__);
+      ptr__ += IMC::serialize(frag_number, ptr__);
+      ptr__ += IMC::serialize(num_frags, ptr__);
+      ptr__ += IMC::serialize((uint16_t)data.size(), ptr__);
+      tail__ = &data;
+      return ptr__;
+    }
+
     uint16_t
     MessagePart::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
@@ -23100,9 +23416,12 @@ namespace DUNE
       IMC::toJSON(os__, "content", content, nindent__);
     }
 
+    const uint16_t Aborted::c_payload_size;
+
     Aborted::Aborted(void)
     {
       m_header.mgid = 889;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23139,9 +23458,12 @@ namespace DUNE
       return 0;
     }
 
+    const uint16_t UsblAngles::c_payload_size;
+
     UsblAngles::UsblAngles(void)
     {
       m_header.mgid = 890;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23172,31 +23494,30 @@ namespace DUNE
     uint8_t*
     UsblAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(bearing, ptr__);
-      ptr__ += IMC::serialize(elevation, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(bearing, bfr__ + 2);
+      IMC::serialize(elevation, bfr__ + 6);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     UsblAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(bearing, bfr__, size__);
-      bfr__ += IMC::deserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(target, bfr__ + 0);
+      IMC::load(bearing, bfr__ + 2);
+      IMC::load(elevation, bfr__ + 6);
+      return c_payload_size;
     }
 
     uint16_t
     UsblAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bearing, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(target, bfr__ + 0);
+      IMC::reverseLoad(bearing, bfr__ + 2);
+      IMC::reverseLoad(elevation, bfr__ + 6);
+      return c_payload_size;
     }
 
     void
@@ -23207,9 +23528,12 @@ namespace DUNE
       IMC::toJSON(os__, "elevation", elevation, nindent__);
     }
 
+    const uint16_t UsblPosition::c_payload_size;
+
     UsblPosition::UsblPosition(void)
     {
       m_header.mgid = 891;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23242,34 +23566,33 @@ namespace DUNE
     uint8_t*
     UsblPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 2);
+      IMC::serialize(y, bfr__ + 6);
+      IMC::serialize(z, bfr__ + 10);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     UsblPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(target, bfr__ + 0);
+      IMC::load(x, bfr__ + 2);
+      IMC::load(y, bfr__ + 6);
+      IMC::load(z, bfr__ + 10);
+      return c_payload_size;
     }
 
     uint16_t
     UsblPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(target, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 2);
+      IMC::reverseLoad(y, bfr__ + 6);
+      IMC::reverseLoad(z, bfr__ + 10);
+      return c_payload_size;
     }
 
     void
@@ -23281,9 +23604,12 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    const uint16_t UsblFix::c_payload_size;
+
     UsblFix::UsblFix(void)
     {
       m_header.mgid = 892;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23320,37 +23646,36 @@ namespace DUNE
     uint8_t*
     UsblFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 2);
+      IMC::serialize(lon, bfr__ + 10);
+      IMC::serialize(z_units, bfr__ + 18);
+      IMC::serialize(z, bfr__ + 19);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     UsblFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(target, bfr__ + 0);
+      IMC::load(lat, bfr__ + 2);
+      IMC::load(lon, bfr__ + 10);
+      IMC::load(z_units, bfr__ + 18);
+      IMC::load(z, bfr__ + 19);
+      return c_payload_size;
     }
 
     uint16_t
     UsblFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(target, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 2);
+      IMC::reverseLoad(lon, bfr__ + 10);
+      IMC::load(z_units, bfr__ + 18);
+      IMC::reverseLoad(z, bfr__ + 19);
+      return c_payload_size;
     }
 
     void
@@ -23425,9 +23750,12 @@ namespace DUNE
       IMC::toJSON(os__, "config", config, nindent__);
     }
 
+    const uint16_t GetParametersXml::c_payload_size;
+
     GetParametersXml::GetParametersXml(void)
     {
       m_header.mgid = 894;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23464,9 +23792,12 @@ namespace DUNE
       return 0;
     }
 
+    const uint16_t SetImageCoords::c_payload_size;
+
     SetImageCoords::SetImageCoords(void)
     {
       m_header.mgid = 895;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23497,31 +23828,30 @@ namespace DUNE
     uint8_t*
     SetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::serialize(camid, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 3);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 3);
+      return c_payload_size;
     }
 
     uint16_t
     SetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 3);
+      return c_payload_size;
     }
 
     void
@@ -23532,9 +23862,12 @@ namespace DUNE
       IMC::toJSON(os__, "y", y, nindent__);
     }
 
+    const uint16_t GetImageCoords::c_payload_size;
+
     GetImageCoords::GetImageCoords(void)
     {
       m_header.mgid = 896;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23565,31 +23898,30 @@ namespace DUNE
     uint8_t*
     GetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::serialize(camid, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 3);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 3);
+      return c_payload_size;
     }
 
     uint16_t
     GetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 3);
+      return c_payload_size;
     }
 
     void
@@ -23600,9 +23932,12 @@ namespace DUNE
       IMC::toJSON(os__, "y", y, nindent__);
     }
 
+    const uint16_t GetWorldCoordinates::c_payload_size;
+
     GetWorldCoordinates::GetWorldCoordinates(void)
     {
       m_header.mgid = 897;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -23639,40 +23974,39 @@ namespace DUNE
     uint8_t*
     GetWorldCoordinates::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(tracking, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(tracking, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 1);
+      IMC::serialize(lon, bfr__ + 9);
+      IMC::serialize(x, bfr__ + 17);
+      IMC::serialize(y, bfr__ + 21);
+      IMC::serialize(z, bfr__ + 25);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     GetWorldCoordinates::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(tracking, bfr__ + 0);
+      IMC::load(lat, bfr__ + 1);
+      IMC::load(lon, bfr__ + 9);
+      IMC::load(x, bfr__ + 17);
+      IMC::load(y, bfr__ + 21);
+      IMC::load(z, bfr__ + 25);
+      return c_payload_size;
     }
 
     uint16_t
     GetWorldCoordinates::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(tracking, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 1);
+      IMC::reverseLoad(lon, bfr__ + 9);
+      IMC::reverseLoad(x, bfr__ + 17);
+      IMC::reverseLoad(y, bfr__ + 21);
+      IMC::reverseLoad(z, bfr__ + 25);
+      return c_payload_size;
     }
 
     void
@@ -24178,9 +24512,12 @@ namespace DUNE
       modems.setDestinationEntity(value__);
     }
 
+    const uint16_t DissolvedOrganicMatter::c_payload_size;
+
     DissolvedOrganicMatter::DissolvedOrganicMatter(void)
     {
       m_header.mgid = 903;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -24209,28 +24546,27 @@ namespace DUNE
     uint8_t*
     DissolvedOrganicMatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 4);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     DissolvedOrganicMatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return c_payload_size;
     }
 
     uint16_t
     DissolvedOrganicMatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return c_payload_size;
     }
 
     fp64_t
@@ -24252,9 +24588,12 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    const uint16_t OpticalBackscatter::c_payload_size;
+
     OpticalBackscatter::OpticalBackscatter(void)
     {
       m_header.mgid = 904;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -24281,25 +24620,24 @@ namespace DUNE
     uint8_t*
     OpticalBackscatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     OpticalBackscatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     uint16_t
     OpticalBackscatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return c_payload_size;
     }
 
     fp64_t
@@ -24320,9 +24658,12 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    const uint16_t Tachograph::c_payload_size;
+
     Tachograph::Tachograph(void)
     {
       m_header.mgid = 905;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -24379,70 +24720,69 @@ namespace DUNE
     uint8_t*
     Tachograph::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timestamp_last_service, ptr__);
-      ptr__ += IMC::serialize(time_next_service, ptr__);
-      ptr__ += IMC::serialize(time_motor_next_service, ptr__);
-      ptr__ += IMC::serialize(time_idle_ground, ptr__);
-      ptr__ += IMC::serialize(time_idle_air, ptr__);
-      ptr__ += IMC::serialize(time_idle_water, ptr__);
-      ptr__ += IMC::serialize(time_idle_underwater, ptr__);
-      ptr__ += IMC::serialize(time_idle_unknown, ptr__);
-      ptr__ += IMC::serialize(time_motor_ground, ptr__);
-      ptr__ += IMC::serialize(time_motor_air, ptr__);
-      ptr__ += IMC::serialize(time_motor_water, ptr__);
-      ptr__ += IMC::serialize(time_motor_underwater, ptr__);
-      ptr__ += IMC::serialize(time_motor_unknown, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(depth_max, ptr__);
-      return ptr__;
+      IMC::serialize(timestamp_last_service, bfr__ + 0);
+      IMC::serialize(time_next_service, bfr__ + 8);
+      IMC::serialize(time_motor_next_service, bfr__ + 12);
+      IMC::serialize(time_idle_ground, bfr__ + 16);
+      IMC::serialize(time_idle_air, bfr__ + 20);
+      IMC::serialize(time_idle_water, bfr__ + 24);
+      IMC::serialize(time_idle_underwater, bfr__ + 28);
+      IMC::serialize(time_idle_unknown, bfr__ + 32);
+      IMC::serialize(time_motor_ground, bfr__ + 36);
+      IMC::serialize(time_motor_air, bfr__ + 40);
+      IMC::serialize(time_motor_water, bfr__ + 44);
+      IMC::serialize(time_motor_underwater, bfr__ + 48);
+      IMC::serialize(time_motor_unknown, bfr__ + 52);
+      IMC::serialize(rpm_min, bfr__ + 56);
+      IMC::serialize(rpm_max, bfr__ + 58);
+      IMC::serialize(depth_max, bfr__ + 60);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     Tachograph::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(timestamp_last_service, bfr__ + 0);
+      IMC::load(time_next_service, bfr__ + 8);
+      IMC::load(time_motor_next_service, bfr__ + 12);
+      IMC::load(time_idle_ground, bfr__ + 16);
+      IMC::load(time_idle_air, bfr__ + 20);
+      IMC::load(time_idle_water, bfr__ + 24);
+      IMC::load(time_idle_underwater, bfr__ + 28);
+      IMC::load(time_idle_unknown, bfr__ + 32);
+      IMC::load(time_motor_ground, bfr__ + 36);
+      IMC::load(time_motor_air, bfr__ + 40);
+      IMC::load(time_motor_water, bfr__ + 44);
+      IMC::load(time_motor_underwater, bfr__ + 48);
+      IMC::load(time_motor_unknown, bfr__ + 52);
+      IMC::load(rpm_min, bfr__ + 56);
+      IMC::load(rpm_max, bfr__ + 58);
+      IMC::load(depth_max, bfr__ + 60);
+      return c_payload_size;
     }
 
     uint16_t
     Tachograph::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::reverseLoad(timestamp_last_service, bfr__ + 0);
+      IMC::reverseLoad(time_next_service, bfr__ + 8);
+      IMC::reverseLoad(time_motor_next_service, bfr__ + 12);
+      IMC::reverseLoad(time_idle_ground, bfr__ + 16);
+      IMC::reverseLoad(time_idle_air, bfr__ + 20);
+      IMC::reverseLoad(time_idle_water, bfr__ + 24);
+      IMC::reverseLoad(time_idle_underwater, bfr__ + 28);
+      IMC::reverseLoad(time_idle_unknown, bfr__ + 32);
+      IMC::reverseLoad(time_motor_ground, bfr__ + 36);
+      IMC::reverseLoad(time_motor_air, bfr__ + 40);
+      IMC::reverseLoad(time_motor_water, bfr__ + 44);
+      IMC::reverseLoad(time_motor_underwater, bfr__ + 48);
+      IMC::reverseLoad(time_motor_unknown, bfr__ + 52);
+      IMC::reverseLoad(rpm_min, bfr__ + 56);
+      IMC::reverseLoad(rpm_max, bfr__ + 58);
+      IMC::reverseLoad(depth_max, bfr__ + 60);
+      return c_payload_size;
     }
 
     void
@@ -24528,9 +24868,12 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    const uint16_t SadcReadings::c_payload_size;
+
     SadcReadings::SadcReadings(void)
     {
       m_header.mgid = 907;
+      m_fixed_payload_size = c_payload_size;
       clear();
     }
 
@@ -24562,31 +24905,30 @@ namespace DUNE
     uint8_t*
     SadcReadings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(channel, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(gain, ptr__);
-      return ptr__;
+      IMC::serialize(channel, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      IMC::serialize(gain, bfr__ + 5);
+      return bfr__ + c_payload_size;
     }
 
     uint16_t
     SadcReadings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(channel, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      IMC::load(gain, bfr__ + 5);
+      return c_payload_size;
     }
 
     uint16_t
     SadcReadings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_payload_size) throw BufferTooShort();
+      IMC::load(channel, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      IMC::load(gain, bfr__ + 5);
+      return c_payload_size;
     }
 
     fp64_t
@@ -44,6 +44,7 @@
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
+#include <DUNE/IMC/RawData.hpp>
 #include <DUNE/IMC/Enumerations.hpp>
 #include <DUNE/IMC/Bitfields.hpp>
 #include <DUNE/IMC/SuperTypes.hpp>
@@ -150,6 +151,8 @@ namespace DUNE
     class QueryEntityState: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -286,6 +289,8 @@ namespace DUNE
     public:
       //! Entity Identifier.
       uint8_t id;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -431,6 +436,8 @@ namespace DUNE
     public:
       //! Usage percentage.
       uint8_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -565,6 +572,8 @@ namespace DUNE
     class RestartSystem: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -633,6 +642,8 @@ namespace DUNE
 
       //! Operation.
       uint8_t op;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -870,6 +881,8 @@ namespace DUNE
     class QueryEntityActivationState: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -970,6 +983,8 @@ namespace DUNE
       fp32_t rpm_max;
       //! Maximum RPM rate.
       fp32_t rpm_rate_max;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 69;
 
       static uint16_t
       getIdStatic(void)
@@ -1148,6 +1163,8 @@ namespace DUNE
       fp32_t svy;
       //! Stream Velocity Z (Down).
       fp32_t svz;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 80;
 
       static uint16_t
       getIdStatic(void)
@@ -1384,6 +1401,8 @@ namespace DUNE
       fp32_t tas2acc_pgain;
       //! Bank to Bank Rate Gain.
       fp32_t bank2p_pgain;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 9;
 
       static uint16_t
       getIdStatic(void)
@@ -1447,6 +1466,8 @@ namespace DUNE
       uint32_t available;
       //! Usage.
       uint8_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -1993,6 +2014,8 @@ namespace DUNE
       fp64_t clock;
       //! Timezone.
       int8_t tz;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 10;
 
       static uint16_t
       getIdStatic(void)
@@ -2058,6 +2081,8 @@ namespace DUNE
       fp32_t temperature;
       //! Depth.
       fp32_t depth;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 12;
 
       static uint16_t
       getIdStatic(void)
@@ -2127,6 +2152,8 @@ namespace DUNE
       uint16_t yaw;
       //! Speed.
       int16_t speed;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 12;
 
       static uint16_t
       getIdStatic(void)
@@ -2354,6 +2381,8 @@ namespace DUNE
     class Heartbeat: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -2566,6 +2595,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -2633,6 +2664,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -2700,6 +2733,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -3532,6 +3567,8 @@ namespace DUNE
       fp32_t value;
       //! Communications Source System ID.
       uint16_t sys_src;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 6;
 
       static uint16_t
       getIdStatic(void)
@@ -3601,6 +3638,8 @@ namespace DUNE
       fp32_t value;
       //! RSSI Units.
       uint8_t units;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -4116,6 +4155,8 @@ namespace DUNE
       uint8_t id;
       //! Range.
       fp32_t range;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -4569,6 +4610,8 @@ namespace DUNE
     class AcousticSystemsQuery: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -4762,6 +4805,8 @@ namespace DUNE
     public:
       //! Value.
       int16_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 2;
 
       static uint16_t
       getIdStatic(void)
@@ -4829,6 +4874,8 @@ namespace DUNE
     public:
       //! Measured Voltage Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -4896,6 +4943,8 @@ namespace DUNE
     public:
       //! Measured Current Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -5031,6 +5080,8 @@ namespace DUNE
       fp32_t hacc;
       //! Vertical Accuracy Estimate.
       fp32_t vacc;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 56;
 
       static uint16_t
       getIdStatic(void)
@@ -5100,6 +5151,8 @@ namespace DUNE
       fp64_t psi;
       //! Yaw Angle (Magnetic).
       fp64_t psi_magnetic;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 40;
 
       static uint16_t
       getIdStatic(void)
@@ -5169,6 +5222,8 @@ namespace DUNE
       fp64_t z;
       //! Timestep.
       fp32_t timestep;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 36;
 
       static uint16_t
       getIdStatic(void)
@@ -5236,6 +5291,8 @@ namespace DUNE
       fp64_t y;
       //! Z.
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 32;
 
       static uint16_t
       getIdStatic(void)
@@ -5303,6 +5360,8 @@ namespace DUNE
       fp64_t y;
       //! Z.
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 32;
 
       static uint16_t
       getIdStatic(void)
@@ -5370,6 +5429,8 @@ namespace DUNE
       fp64_t y;
       //! Z.
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 32;
 
       static uint16_t
       getIdStatic(void)
@@ -5448,6 +5509,8 @@ namespace DUNE
       fp64_t y;
       //! Z.
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 25;
 
       static uint16_t
       getIdStatic(void)
@@ -5526,6 +5589,8 @@ namespace DUNE
       fp64_t y;
       //! Z.
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 25;
 
       static uint16_t
       getIdStatic(void)
@@ -5593,6 +5658,8 @@ namespace DUNE
       fp64_t y;
       //! Z.
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 32;
 
       static uint16_t
       getIdStatic(void)
@@ -5664,6 +5731,8 @@ namespace DUNE
       fp32_t theta;
       //! Device Rotation - Z.
       fp32_t psi;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 24;
 
       static uint16_t
       getIdStatic(void)
@@ -5727,6 +5796,8 @@ namespace DUNE
       fp32_t beam_width;
       //! Beam Height.
       fp32_t beam_height;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -5892,6 +5963,8 @@ namespace DUNE
     public:
       //! Measured Temperature.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -5959,6 +6032,8 @@ namespace DUNE
     public:
       //! Measured Pressure.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -6026,6 +6101,8 @@ namespace DUNE
     public:
       //! Measured Depth.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -6093,6 +6170,8 @@ namespace DUNE
     public:
       //! Measured Offset.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -6160,6 +6239,8 @@ namespace DUNE
     public:
       //! Computed Sound Speed.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -6227,6 +6308,8 @@ namespace DUNE
     public:
       //! Computed Water Density.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -6294,6 +6377,8 @@ namespace DUNE
     public:
       //! Measured Conductivity.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -6361,6 +6446,8 @@ namespace DUNE
     public:
       //! Measured Salinity.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -6432,6 +6519,8 @@ namespace DUNE
       fp32_t speed;
       //! Turbulence.
       fp32_t turbulence;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 12;
 
       static uint16_t
       getIdStatic(void)
@@ -6493,6 +6582,8 @@ namespace DUNE
     public:
       //! Relative Humidity Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -6718,7 +6809,7 @@ namespace DUNE
       //! Beam Configuration.
       MessageList<BeamConfig> beam_config;
       //! Data.
-      std::vector<char> data;
+      RawData data;
 
       static uint16_t
       getIdStatic(void)
@@ -6746,6 +6837,9 @@ namespace DUNE
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
+      uint8_t*
+      serializeFieldsHead(uint8_t* bfr__, const RawData*& tail__) const;
+
       uint16_t
       deserializeFields(const uint8_t* bfr__, uint16_t size__);
 
@@ -6800,6 +6894,8 @@ namespace DUNE
     class Pulse: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -6864,6 +6960,8 @@ namespace DUNE
 
       //! Operation.
       uint8_t op;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -7030,6 +7128,8 @@ namespace DUNE
       fp32_t sacc;
       //! Course / Heading Accuracy Estimate.
       fp32_t cacc;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 68;
 
       static uint16_t
       getIdStatic(void)
@@ -7093,6 +7193,8 @@ namespace DUNE
       uint8_t id;
       //! Position.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -7175,6 +7277,8 @@ namespace DUNE
 
       //! Sanity.
       uint8_t sane;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -7236,6 +7340,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7303,6 +7409,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7370,6 +7478,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7437,6 +7547,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7504,6 +7616,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7571,6 +7685,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7638,6 +7754,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7705,6 +7823,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -7826,6 +7946,8 @@ namespace DUNE
       uint16_t iar_hyp;
       //! IAR Ratio.
       fp32_t iar_ratio;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 58;
 
       static uint16_t
       getIdStatic(void)
@@ -7925,6 +8047,8 @@ namespace DUNE
       fp32_t depth;
       //! Altitude.
       fp32_t alt;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 88;
 
       static uint16_t
       getIdStatic(void)
@@ -8082,6 +8206,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -8149,6 +8275,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -8216,6 +8344,8 @@ namespace DUNE
     public:
       //! Value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -8283,6 +8413,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -8350,6 +8482,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -8434,6 +8568,8 @@ namespace DUNE
       uint8_t zoom;
       //! Action.
       uint8_t action;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 3;
 
       static uint16_t
       getIdStatic(void)
@@ -8503,6 +8639,8 @@ namespace DUNE
       uint8_t id;
       //! Actuation Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -8578,6 +8716,8 @@ namespace DUNE
       uint8_t id;
       //! Position.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -8653,6 +8793,8 @@ namespace DUNE
       uint8_t id;
       //! Angle.
       fp32_t angle;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -8867,6 +9009,8 @@ namespace DUNE
       uint8_t button;
       //! Value.
       uint8_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 2;
 
       static uint16_t
       getIdStatic(void)
@@ -9041,6 +9185,8 @@ namespace DUNE
       fp32_t time_remain;
       //! Scheduled Time.
       fp64_t sched_time;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 13;
 
       static uint16_t
       getIdStatic(void)
@@ -9190,6 +9336,8 @@ namespace DUNE
     class QueryPowerChannelState: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -9544,6 +9692,8 @@ namespace DUNE
       uint32_t period;
       //! Duty Cycle.
       uint32_t duty_cycle;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 9;
 
       static uint16_t
       getIdStatic(void)
@@ -9615,6 +9765,8 @@ namespace DUNE
       uint32_t period;
       //! Duty Cycle.
       uint32_t duty_cycle;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 9;
 
       static uint16_t
       getIdStatic(void)
@@ -9686,6 +9838,8 @@ namespace DUNE
       fp64_t y;
       //! Z component (Down).
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 24;
 
       static uint16_t
       getIdStatic(void)
@@ -9747,6 +9901,8 @@ namespace DUNE
     public:
       //! Measured speed.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -9814,6 +9970,8 @@ namespace DUNE
     public:
       //! Estimated value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -9907,6 +10065,8 @@ namespace DUNE
       fp32_t bias_psi;
       //! Variance - Gyro. Yaw Rate Bias.
       fp32_t bias_r;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 56;
 
       static uint16_t
       getIdStatic(void)
@@ -9984,6 +10144,8 @@ namespace DUNE
       fp32_t custom_y;
       //! Variance - Custom Variable Z.
       fp32_t custom_z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 36;
 
       static uint16_t
       getIdStatic(void)
@@ -10062,6 +10224,8 @@ namespace DUNE
       fp32_t utc_time;
       //! Reason.
       uint8_t reason;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -10142,6 +10306,8 @@ namespace DUNE
       fp32_t range;
       //! Acceptance.
       uint8_t acceptance;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 6;
 
       static uint16_t
       getIdStatic(void)
@@ -10237,6 +10403,8 @@ namespace DUNE
       fp32_t value;
       //! Timestep.
       fp32_t timestep;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 10;
 
       static uint16_t
       getIdStatic(void)
@@ -10408,6 +10576,8 @@ namespace DUNE
 
       //! State.
       uint8_t state;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -10473,6 +10643,8 @@ namespace DUNE
       fp64_t y;
       //! Z component (Down).
       fp64_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 24;
 
       static uint16_t
       getIdStatic(void)
@@ -10538,6 +10710,8 @@ namespace DUNE
       fp32_t aoa;
       //! Sideslip angle.
       fp32_t ssa;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 12;
 
       static uint16_t
       getIdStatic(void)
@@ -10599,6 +10773,8 @@ namespace DUNE
     public:
       //! Value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -10668,6 +10844,8 @@ namespace DUNE
       fp32_t value;
       //! Z Units.
       uint8_t z_units;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -10737,6 +10915,8 @@ namespace DUNE
       fp64_t value;
       //! Speed Units.
       uint8_t speed_units;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 9;
 
       static uint16_t
       getIdStatic(void)
@@ -10804,6 +10984,8 @@ namespace DUNE
     public:
       //! Value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -10871,6 +11053,8 @@ namespace DUNE
     public:
       //! Value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -10938,6 +11122,8 @@ namespace DUNE
     public:
       //! Value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -11050,6 +11236,8 @@ namespace DUNE
       fp32_t lradius;
       //! Flags.
       uint8_t flags;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 56;
 
       static uint16_t
       getIdStatic(void)
@@ -11140,6 +11328,8 @@ namespace DUNE
       fp64_t n;
       //! Flags.
       uint8_t flags;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 49;
 
       static uint16_t
       getIdStatic(void)
@@ -11201,6 +11391,8 @@ namespace DUNE
     public:
       //! Value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -11297,6 +11489,8 @@ namespace DUNE
       fp64_t r;
       //! Flags.
       uint8_t flags;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 49;
 
       static uint16_t
       getIdStatic(void)
@@ -11409,6 +11603,8 @@ namespace DUNE
       fp32_t course_error;
       //! Estimated Time to Arrival (ETA).
       uint16_t eta;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 81;
 
       static uint16_t
       getIdStatic(void)
@@ -11474,6 +11670,8 @@ namespace DUNE
       fp64_t m;
       //! Torque about the x axis.
       fp64_t n;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 24;
 
       static uint16_t
       getIdStatic(void)
@@ -11541,6 +11739,8 @@ namespace DUNE
       fp32_t d;
       //! Anti-Windup Parcel.
       fp32_t a;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 16;
 
       static uint16_t
       getIdStatic(void)
@@ -11611,6 +11811,8 @@ namespace DUNE
 
       //! Operation.
       uint8_t op;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -11713,6 +11915,8 @@ namespace DUNE
       fp64_t az;
       //! Flags.
       uint16_t flags;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 74;
 
       static uint16_t
       getIdStatic(void)
@@ -11774,6 +11978,8 @@ namespace DUNE
     public:
       //! Value.
       fp64_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 8;
 
       static uint16_t
       getIdStatic(void)
@@ -12480,6 +12686,8 @@ namespace DUNE
       fp32_t y;
       //! Down Offset (m).
       fp32_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 12;
 
       static uint16_t
       getIdStatic(void)
@@ -12723,6 +12931,8 @@ namespace DUNE
     class TeleoperationDone: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -12963,6 +13173,8 @@ namespace DUNE
       fp32_t z;
       //! Time Offset (s).
       fp32_t t;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 16;
 
       static uint16_t
       getIdStatic(void)
@@ -13200,6 +13412,8 @@ namespace DUNE
       fp32_t off_y;
       //! Formation offset -- Depth/Altitude.
       fp32_t off_z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 14;
 
       static uint16_t
       getIdStatic(void)
@@ -13360,6 +13574,8 @@ namespace DUNE
     class StopManeuver: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -13415,6 +13631,8 @@ namespace DUNE
     public:
       //! Maneuver ID.
       uint16_t mid;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 2;
 
       static uint16_t
       getIdStatic(void)
@@ -13574,6 +13792,8 @@ namespace DUNE
       fp32_t z;
       //! Z Units.
       uint8_t z_units;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 22;
 
       static uint16_t
       getIdStatic(void)
@@ -13649,6 +13869,8 @@ namespace DUNE
       uint16_t sys_b;
       //! Move threshold.
       fp32_t move_threshold;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 31;
 
       static uint16_t
       getIdStatic(void)
@@ -13712,6 +13934,8 @@ namespace DUNE
       fp64_t lat;
       //! Longitude WGS-84.
       fp64_t lon;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 16;
 
       static uint16_t
       getIdStatic(void)
@@ -14175,6 +14399,8 @@ namespace DUNE
       fp32_t loiter_radius;
       //! Altitude Interval.
       fp32_t altitude_interval;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 15;
 
       static uint16_t
       getIdStatic(void)
@@ -15124,6 +15350,8 @@ namespace DUNE
       uint8_t travel_z_units;
       //! Delayed Behavior.
       uint8_t delayed;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 35;
 
       static uint16_t
       getIdStatic(void)
@@ -15376,6 +15604,8 @@ namespace DUNE
     class ImageTracking: public Maneuver
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -16211,6 +16441,8 @@ namespace DUNE
       fp32_t width;
       //! Area -- Length.
       fp32_t length;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 53;
 
       static uint16_t
       getIdStatic(void)
@@ -16270,6 +16502,8 @@ namespace DUNE
     class GetOperationalLimits: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -16325,6 +16559,8 @@ namespace DUNE
     public:
       //! Duration.
       uint16_t duration;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 2;
 
       static uint16_t
       getIdStatic(void)
@@ -16399,6 +16635,8 @@ namespace DUNE
       uint32_t mask;
       //! Scope Time Reference.
       uint32_t scope_ref;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 9;
 
       static uint16_t
       getIdStatic(void)
@@ -16475,6 +16713,8 @@ namespace DUNE
 
       //! Medium.
       uint8_t medium;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 1;
 
       static uint16_t
       getIdStatic(void)
@@ -16551,6 +16791,8 @@ namespace DUNE
       fp32_t value;
       //! Type.
       uint8_t type;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -16657,6 +16899,8 @@ namespace DUNE
       uint8_t commmon;
       //! Convergence.
       uint8_t convergmon;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 15;
 
       static uint16_t
       getIdStatic(void)
@@ -16859,6 +17103,8 @@ namespace DUNE
       uint8_t commmon;
       //! Convergence.
       uint8_t convergmon;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 17;
 
       static uint16_t
       getIdStatic(void)
@@ -17021,6 +17267,8 @@ namespace DUNE
     class Abort: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -18669,6 +18917,8 @@ namespace DUNE
       fp64_t lon;
       //! Altitude.
       fp32_t alt;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 20;
 
       static uint16_t
       getIdStatic(void)
@@ -19787,6 +20037,8 @@ namespace DUNE
       uint8_t reps;
       //! Target Size.
       uint8_t tsize;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -19856,6 +20108,8 @@ namespace DUNE
       fp32_t speed;
       //! Heading.
       fp32_t psi;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 17;
 
       static uint16_t
       getIdStatic(void)
@@ -20373,6 +20627,8 @@ namespace DUNE
     public:
       //! Session Timeout.
       uint32_t timeout;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -20434,6 +20690,8 @@ namespace DUNE
     public:
       //! Session Identifier.
       uint32_t sessid;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -20564,6 +20822,8 @@ namespace DUNE
     public:
       //! Session Identifier.
       uint32_t sessid;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -20636,6 +20896,8 @@ namespace DUNE
       uint32_t sessid;
       //! Status.
       uint8_t status;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -20923,7 +21185,7 @@ namespace DUNE
       //! Flags.
       uint8_t flags;
       //! Data.
-      std::vector<char> data;
+      RawData data;
 
       static uint16_t
       getIdStatic(void)
@@ -20951,6 +21213,9 @@ namespace DUNE
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
+      uint8_t*
+      serializeFieldsHead(uint8_t* bfr__, const RawData*& tail__) const;
+
       uint16_t
       deserializeFields(const uint8_t* bfr__, uint16_t size__);
 
@@ -21265,6 +21530,8 @@ namespace DUNE
       fp32_t leadgain;
       //! Deconfliction Gain.
       fp32_t deconflgain;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 21;
 
       static uint16_t
       getIdStatic(void)
@@ -21330,6 +21597,8 @@ namespace DUNE
       fp32_t dist_min_abs;
       //! Mean minimum distance.
       fp32_t dist_min_mean;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 12;
 
       static uint16_t
       getIdStatic(void)
@@ -21422,6 +21691,8 @@ namespace DUNE
       fp32_t accel_safe_margin;
       //! Maximum Longitudinal Acceleration.
       fp32_t accel_lim_x;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 41;
 
       static uint16_t
       getIdStatic(void)
@@ -21609,7 +21880,7 @@ namespace DUNE
       //! Total Number of fragments.
       uint8_t num_frags;
       //! Fragment Data.
-      std::vector<char> data;
+      RawData data;
 
       static uint16_t
       getIdStatic(void)
@@ -21637,6 +21908,9 @@ namespace DUNE
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
+      uint8_t*
+      serializeFieldsHead(uint8_t* bfr__, const RawData*& tail__) const;
+
       uint16_t
       deserializeFields(const uint8_t* bfr__, uint16_t size__);
 
@@ -21744,6 +22018,8 @@ namespace DUNE
     class Aborted: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -21803,6 +22079,8 @@ namespace DUNE
       fp32_t bearing;
       //! Elevation.
       fp32_t elevation;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 10;
 
       static uint16_t
       getIdStatic(void)
@@ -21870,6 +22148,8 @@ namespace DUNE
       fp32_t y;
       //! Z.
       fp32_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 14;
 
       static uint16_t
       getIdStatic(void)
@@ -21939,6 +22219,8 @@ namespace DUNE
       uint8_t z_units;
       //! Z Reference.
       fp32_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 23;
 
       static uint16_t
       getIdStatic(void)
@@ -22067,6 +22349,8 @@ namespace DUNE
     class GetParametersXml: public Message
     {
     public:
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 0;
 
       static uint16_t
       getIdStatic(void)
@@ -22126,6 +22410,8 @@ namespace DUNE
       uint16_t x;
       //! Y.
       uint16_t y;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -22191,6 +22477,8 @@ namespace DUNE
       uint16_t x;
       //! Y.
       uint16_t y;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -22262,6 +22550,8 @@ namespace DUNE
       fp32_t y;
       //! Z.
       fp32_t z;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 29;
 
       static uint16_t
       getIdStatic(void)
@@ -22752,6 +23042,8 @@ namespace DUNE
       fp32_t value;
       //! Type of measurement.
       uint8_t type;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 5;
 
       static uint16_t
       getIdStatic(void)
@@ -22819,6 +23111,8 @@ namespace DUNE
     public:
       //! Value.
       fp32_t value;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 4;
 
       static uint16_t
       getIdStatic(void)
@@ -22916,6 +23210,8 @@ namespace DUNE
       int16_t rpm_max;
       //! Recorded Depth - Maximum.
       fp32_t depth_max;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 64;
 
       static uint16_t
       getIdStatic(void)
@@ -23082,6 +23378,8 @@ namespace DUNE
       int32_t value;
       //! Gain.
       uint8_t gain;
+      //! Serialized payload size.
+      static const uint16_t c_payload_size = 6;
 
       static uint16_t
       getIdStatic(void)
@@ -120,6 +120,33 @@ namespace DUNE
       { }
     };
 
+    //! Delta-coded header without a matching key header.
+    class MissingKeyHeader: public std::runtime_error
+    {
+    public:
+      MissingKeyHeader(uint16_t src):
+        std::runtime_error("missing key header for source: " + Utils::String::toHex(src))
+      { }
+    };
+
+    //! Frame quantized with field precisions other than the decoder's.
+    class PrecisionMismatch: public std::runtime_error
+    {
+    public:
+      PrecisionMismatch(uint16_t id):
+        std::runtime_error("field precisions do not match for message: " + DUNE::Utils::String::str(id))
+      { }
+    };
+
+    //! Malformed JSON document.
+    class InvalidJSON: public std::runtime_error
+    {
+    public:
+      InvalidJSON(const std::string& reason, unsigned offset):
+        std::runtime_error(Utils::String::str("invalid JSON at offset %u: %s", offset, reason.c_str()))
+      { }
+    };
+
     class InvalidMessageSize: public std::runtime_error
     {
     public:
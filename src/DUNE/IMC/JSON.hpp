@@ -38,6 +38,7 @@
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Utils/String.hpp>
+#include <DUNE/IMC/RawData.hpp>
 
 namespace DUNE
 {
@@ -120,6 +121,19 @@ namespace DUNE
       const char* indent = indentJSON(nindent);
       os << prefix << '\n' << indent << '"' << label << "\": \"" << Utils::String::toHex(value) << '"';
     }
+
+    //! Convert a shared raw data buffer to a JSON string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const RawData& value, unsigned nindent, char prefix)
+    {
+      toJSON(os, label, value.get(), nindent, prefix);
+    }
   }
 }
 
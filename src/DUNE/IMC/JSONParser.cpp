@@ -0,0 +1,690 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/JSONParser.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Serialization.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Maximum length of a number token.
+    static const unsigned c_max_number = 64;
+    //! Maximum nesting depth of skipped values.
+    static const unsigned c_max_depth = 64;
+
+    //! Header members of top-level objects.
+    static const char* c_header[] =
+    {
+      "abbrev", "timestamp", "src", "src_ent", "dst", "dst_ent"
+    };
+
+    template <typename Type>
+    static void
+    append(Type value, std::vector<uint8_t>& out)
+    {
+      uint8_t bfr[sizeof(Type)];
+      IMC::serialize(value, bfr);
+      out.insert(out.end(), bfr, bfr + sizeof(Type));
+    }
+
+    //! Decode a hexadecimal digit.
+    //! @return digit value or -1 if the character is not a digit.
+    static int
+    hexDigit(char c)
+    {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      return -1;
+    }
+
+    //! Encode a code point as UTF-8.
+    static void
+    appendUTF8(uint32_t code, std::string& out)
+    {
+      if (code < 0x80)
+      {
+        out.push_back((char)code);
+      }
+      else if (code < 0x800)
+      {
+        out.push_back((char)(0xc0 | (code >> 6)));
+        out.push_back((char)(0x80 | (code & 0x3f)));
+      }
+      else if (code < 0x10000)
+      {
+        out.push_back((char)(0xe0 | (code >> 12)));
+        out.push_back((char)(0x80 | ((code >> 6) & 0x3f)));
+        out.push_back((char)(0x80 | (code & 0x3f)));
+      }
+      else
+      {
+        out.push_back((char)(0xf0 | (code >> 18)));
+        out.push_back((char)(0x80 | ((code >> 12) & 0x3f)));
+        out.push_back((char)(0x80 | ((code >> 6) & 0x3f)));
+        out.push_back((char)(0x80 | (code & 0x3f)));
+      }
+    }
+
+    JSONParser::JSONParser(void):
+      m_begin(NULL),
+      m_ptr(NULL),
+      m_end(NULL)
+    { }
+
+    void
+    JSONParser::fail(const std::string& reason)
+    {
+      throw InvalidJSON(reason, m_ptr - m_begin);
+    }
+
+    void
+    JSONParser::skipSpace(void)
+    {
+      while (m_ptr != m_end && (*m_ptr == ' ' || *m_ptr == '\n' || *m_ptr == '\r' || *m_ptr == '\t'))
+        ++m_ptr;
+    }
+
+    bool
+    JSONParser::accept(char c)
+    {
+      skipSpace();
+      if (m_ptr == m_end || *m_ptr != c)
+        return false;
+
+      ++m_ptr;
+      return true;
+    }
+
+    void
+    JSONParser::expect(char c)
+    {
+      if (!accept(c))
+        fail(std::string("expected '") + c + "'");
+    }
+
+    bool
+    JSONParser::acceptLiteral(const char* literal)
+    {
+      skipSpace();
+      size_t size = std::strlen(literal);
+      if ((size_t)(m_end - m_ptr) < size || std::strncmp(m_ptr, literal, size) != 0)
+        return false;
+
+      m_ptr += size;
+      return true;
+    }
+
+    void
+    JSONParser::parseString(std::string& value)
+    {
+      expect('"');
+      value.clear();
+
+      while (true)
+      {
+        // Copy runs of unescaped characters in one go.
+        const char* start = m_ptr;
+        while (m_ptr != m_end && *m_ptr != '"' && *m_ptr != '\\')
+          ++m_ptr;
+        value.append(start, m_ptr - start);
+
+        if (m_ptr == m_end)
+          fail("unterminated string");
+
+        if (*m_ptr++ == '"')
+          return;
+
+        if (m_ptr == m_end)
+          fail("unterminated string");
+
+        char c = *m_ptr++;
+        switch (c)
+        {
+          case '"':
+          case '\\':
+          case '/':
+            value.push_back(c);
+            break;
+          case 'n':
+            value.push_back('\n');
+            break;
+          case 'r':
+            value.push_back('\r');
+            break;
+          case 't':
+            value.push_back('\t');
+            break;
+          case 'b':
+            value.push_back('\b');
+            break;
+          case 'f':
+            value.push_back('\f');
+            break;
+          case 'u':
+            {
+              uint32_t code = 0;
+              for (unsigned pair = 0; pair < 2; ++pair)
+              {
+                if (m_end - m_ptr < 4)
+                  fail("truncated unicode escape");
+
+                uint32_t unit = 0;
+                for (unsigned i = 0; i < 4; ++i)
+                {
+                  int digit = hexDigit(*m_ptr++);
+                  if (digit < 0)
+                    fail("invalid unicode escape");
+                  unit = (unit << 4) | digit;
+                }
+
+                if (pair == 0)
+                {
+                  code = unit;
+                  // High surrogates must be followed by a low surrogate.
+                  if (unit < 0xd800 || unit > 0xdbff)
+                    break;
+                  if (m_end - m_ptr < 2 || m_ptr[0] != '\\' || m_ptr[1] != 'u')
+                    fail("unpaired surrogate");
+                  m_ptr += 2;
+                }
+                else
+                {
+                  if (unit < 0xdc00 || unit > 0xdfff)
+                    fail("unpaired surrogate");
+                  code = 0x10000 + ((code - 0xd800) << 10) + (unit - 0xdc00);
+                }
+              }
+
+              appendUTF8(code, value);
+            }
+            break;
+          default:
+            fail("invalid escape sequence");
+        }
+      }
+    }
+
+    void
+    JSONParser::skipValue(void)
+    {
+      // Track nesting explicitly to bound the work done on hostile input.
+      std::vector<char> closing;
+
+      do
+      {
+        skipSpace();
+        if (m_ptr == m_end)
+          fail("unexpected end of document");
+
+        switch (*m_ptr)
+        {
+          case '"':
+            parseString(m_text);
+            break;
+
+          case '{':
+          case '[':
+            if (closing.size() == c_max_depth)
+              fail("nesting too deep");
+
+            closing.push_back(*m_ptr == '{' ? '}' : ']');
+            ++m_ptr;
+
+            if (accept(closing.back()))
+            {
+              closing.pop_back();
+              break;
+            }
+
+            if (closing.back() == '}')
+            {
+              parseString(m_text);
+              expect(':');
+            }
+            continue;
+
+          case 't':
+          case 'f':
+          case 'n':
+            if (!acceptLiteral("true") && !acceptLiteral("false") && !acceptLiteral("null"))
+              fail("invalid literal");
+            break;
+
+          default:
+            {
+              char text[c_max_number];
+              parseNumberToken(text, sizeof(text));
+            }
+            break;
+        }
+
+        // Close finished containers and move to the next element.
+        while (!closing.empty())
+        {
+          if (accept(closing.back()))
+          {
+            closing.pop_back();
+            continue;
+          }
+
+          expect(',');
+          if (closing.back() == '}')
+          {
+            parseString(m_text);
+            expect(':');
+          }
+          break;
+        }
+      }
+      while (!closing.empty());
+    }
+
+    void
+    JSONParser::parseMembers(std::vector<Member>& members)
+    {
+      members.clear();
+      expect('{');
+      if (accept('}'))
+        return;
+
+      do
+      {
+        Member member;
+        parseString(member.key);
+        expect(':');
+        skipSpace();
+        member.value = m_ptr;
+        skipValue();
+        members.push_back(member);
+      }
+      while (accept(','));
+
+      expect('}');
+    }
+
+    const char*
+    JSONParser::parseNumberToken(char* text, unsigned size)
+    {
+      skipSpace();
+      const char* start = m_ptr;
+      while (m_ptr != m_end && (std::strchr("+-.eE", *m_ptr) != NULL || (*m_ptr >= '0' && *m_ptr <= '9')))
+        ++m_ptr;
+
+      unsigned length = m_ptr - start;
+      if (length == 0)
+        fail("expected number");
+      if (length >= size)
+        fail("number too long");
+
+      std::memcpy(text, start, length);
+      text[length] = 0;
+      return start;
+    }
+
+    double
+    JSONParser::parseDouble(void)
+    {
+      skipSpace();
+      if (acceptLiteral("null"))
+        return std::numeric_limits<double>::quiet_NaN();
+
+      // Numbers may be quoted.
+      bool quoted = accept('"');
+      char text[c_max_number];
+      const char* start = parseNumberToken(text, sizeof(text));
+      if (quoted)
+        expect('"');
+
+      char* end = NULL;
+      double value = std::strtod(text, &end);
+      if (*end != 0)
+      {
+        m_ptr = start;
+        fail("invalid number");
+      }
+
+      return value;
+    }
+
+    int64_t
+    JSONParser::parseInteger(int64_t min, int64_t max)
+    {
+      skipSpace();
+      bool quoted = accept('"');
+      char text[c_max_number];
+      const char* start = parseNumberToken(text, sizeof(text));
+      if (quoted)
+        expect('"');
+
+      char* end = NULL;
+      errno = 0;
+      long long value = std::strtoll(text, &end, 10);
+
+      // Accept integral values written in floating point notation.
+      if (*end != 0)
+      {
+        double real = std::strtod(text, &end);
+        if (*end != 0 || real != (double)(long long)real)
+        {
+          m_ptr = start;
+          fail("invalid integer");
+        }
+        value = (long long)real;
+      }
+
+      if (errno == ERANGE || value < min || value > max)
+      {
+        m_ptr = start;
+        fail("integer out of range");
+      }
+
+      return value;
+    }
+
+    const Schema::Message*
+    JSONParser::findSchema(const std::vector<Member>& members)
+    {
+      for (unsigned i = 0; i < members.size(); ++i)
+      {
+        if (members[i].key != "abbrev")
+          continue;
+
+        m_ptr = members[i].value;
+        parseString(m_text);
+        const Schema::Message* schema = Schema::find(m_text);
+        if (schema == NULL)
+          throw InvalidMessageAbbrev(m_text);
+        return schema;
+      }
+
+      fail("missing message abbreviation");
+      return NULL;
+    }
+
+    const JSONParser::Defaults&
+    JSONParser::getDefaults(const Schema::Message* schema)
+    {
+      std::map<uint16_t, Defaults>::iterator itr = m_defaults.find(schema->id);
+      if (itr != m_defaults.end())
+        return itr->second;
+
+      Defaults& defaults = m_defaults[schema->id];
+      Message* msg = Factory::produce(schema->id);
+      defaults.payload.resize(msg->getPayloadSerializationSize());
+      if (!defaults.payload.empty())
+        msg->serializeFields(&defaults.payload[0]);
+      delete msg;
+
+      const uint8_t* base = defaults.payload.empty() ? NULL : &defaults.payload[0];
+      const uint8_t* end = base + defaults.payload.size();
+      const uint8_t* ptr = base;
+      for (unsigned i = 0; i < schema->fields.size(); ++i)
+      {
+        defaults.offsets.push_back(ptr - base);
+        ptr = Schema::skip(schema->fields[i], ptr, end);
+      }
+      defaults.offsets.push_back(ptr - base);
+
+      return defaults;
+    }
+
+    void
+    JSONParser::parseFields(const Schema::Message* schema, const std::vector<Member>& members,
+                            bool top, std::vector<uint8_t>& out)
+    {
+      // Reject members that are neither fields nor header members.
+      unsigned header = top ? sizeof(c_header) / sizeof(c_header[0]) : 1;
+      for (unsigned i = 0; i < members.size(); ++i)
+      {
+        bool known = false;
+        for (unsigned j = 0; j < header && !known; ++j)
+          known = members[i].key == c_header[j];
+
+        if (!known && Schema::findField(schema, members[i].key) < 0)
+        {
+          m_ptr = members[i].value;
+          fail("unknown field: " + members[i].key);
+        }
+      }
+
+      const Defaults& defaults = getDefaults(schema);
+      const char* after = m_ptr;
+
+      for (unsigned i = 0; i < schema->fields.size(); ++i)
+      {
+        const Member* member = NULL;
+        for (unsigned j = 0; j < members.size() && member == NULL; ++j)
+        {
+          if (members[j].key == schema->fields[i].abbrev)
+            member = &members[j];
+        }
+
+        if (member == NULL)
+        {
+          out.insert(out.end(),
+                     defaults.payload.begin() + defaults.offsets[i],
+                     defaults.payload.begin() + defaults.offsets[i + 1]);
+          continue;
+        }
+
+        m_ptr = member->value;
+        parseField(schema->fields[i], out);
+      }
+
+      m_ptr = after;
+    }
+
+    void
+    JSONParser::parseInline(std::vector<uint8_t>& out)
+    {
+      if (acceptLiteral("null"))
+      {
+        append<uint16_t>(DUNE_IMC_CONST_NULL_ID, out);
+        return;
+      }
+
+      std::vector<Member> members;
+      parseMembers(members);
+      const char* after = m_ptr;
+
+      const Schema::Message* schema = findSchema(members);
+      append<uint16_t>(schema->id, out);
+      m_ptr = after;
+      parseFields(schema, members, false, out);
+    }
+
+    void
+    JSONParser::parseField(const Schema::Field& field, std::vector<uint8_t>& out)
+    {
+      switch (field.type)
+      {
+        case Schema::TYPE_UINT8:
+          append<uint8_t>(parseInteger(0, 0xff), out);
+          break;
+
+        case Schema::TYPE_INT8:
+          append<int8_t>(parseInteger(-0x80, 0x7f), out);
+          break;
+
+        case Schema::TYPE_UINT16:
+          append<uint16_t>(parseInteger(0, 0xffff), out);
+          break;
+
+        case Schema::TYPE_INT16:
+          append<int16_t>(parseInteger(-0x8000, 0x7fff), out);
+          break;
+
+        case Schema::TYPE_UINT32:
+          append<uint32_t>(parseInteger(0, 0xffffffffLL), out);
+          break;
+
+        case Schema::TYPE_INT32:
+          append<int32_t>(parseInteger(-0x80000000LL, 0x7fffffffLL), out);
+          break;
+
+        case Schema::TYPE_INT64:
+          append<int64_t>(parseInteger(std::numeric_limits<int64_t>::min(),
+                                       std::numeric_limits<int64_t>::max()), out);
+          break;
+
+        case Schema::TYPE_FP32:
+          append<fp32_t>((fp32_t)parseDouble(), out);
+          break;
+
+        case Schema::TYPE_FP64:
+          append<fp64_t>(parseDouble(), out);
+          break;
+
+        case Schema::TYPE_PLAINTEXT:
+          parseString(m_text);
+          if (m_text.size() > 0xffff)
+            fail("string too long");
+          append<uint16_t>(m_text.size(), out);
+          out.insert(out.end(), m_text.begin(), m_text.end());
+          break;
+
+        case Schema::TYPE_RAWDATA:
+          {
+            parseString(m_text);
+            if (m_text.size() % 2 != 0 || m_text.size() / 2 > 0xffff)
+              fail("invalid hexadecimal data");
+
+            append<uint16_t>(m_text.size() / 2, out);
+            for (unsigned i = 0; i < m_text.size(); i += 2)
+            {
+              int hi = hexDigit(m_text[i]);
+              int lo = hexDigit(m_text[i + 1]);
+              if (hi < 0 || lo < 0)
+                fail("invalid hexadecimal data");
+              out.push_back((uint8_t)((hi << 4) | lo));
+            }
+          }
+          break;
+
+        case Schema::TYPE_MESSAGE:
+          parseInline(out);
+          break;
+
+        case Schema::TYPE_MESSAGE_LIST:
+          {
+            size_t index = out.size();
+            append<uint16_t>(0, out);
+
+            uint16_t count = 0;
+            expect('[');
+            if (!accept(']'))
+            {
+              do
+              {
+                if (count == 0xffff)
+                  fail("too many messages");
+                parseInline(out);
+                ++count;
+              }
+              while (accept(','));
+
+              expect(']');
+            }
+
+            IMC::serialize(count, &out[index]);
+          }
+          break;
+      }
+    }
+
+    Message*
+    JSONParser::parse(const char* data, unsigned size)
+    {
+      m_begin = data;
+      m_ptr = data;
+      m_end = data + size;
+
+      std::vector<Member> members;
+      parseMembers(members);
+      skipSpace();
+      if (m_ptr != m_end)
+        fail("trailing characters");
+      const char* after = m_ptr;
+
+      const Schema::Message* schema = findSchema(members);
+
+      std::vector<uint8_t> payload;
+      parseFields(schema, members, true, payload);
+
+      Message* msg = Factory::produce(schema->id);
+
+      try
+      {
+        for (unsigned i = 0; i < members.size(); ++i)
+        {
+          m_ptr = members[i].value;
+          const std::string& key = members[i].key;
+
+          if (key == "timestamp")
+            msg->setTimeStamp(parseDouble());
+          else if (key == "src")
+            msg->setSource(parseInteger(0, 0xffff));
+          else if (key == "src_ent")
+            msg->setSourceEntity(parseInteger(0, 0xff));
+          else if (key == "dst")
+            msg->setDestination(parseInteger(0, 0xffff));
+          else if (key == "dst_ent")
+            msg->setDestinationEntity(parseInteger(0, 0xff));
+        }
+
+        m_ptr = after;
+        if (!payload.empty())
+          msg->deserializeFields(&payload[0], payload.size());
+      }
+      catch (...)
+      {
+        delete msg;
+        throw;
+      }
+
+      return msg;
+    }
+  }
+}
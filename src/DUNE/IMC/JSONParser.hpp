@@ -0,0 +1,168 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_JSON_PARSER_HPP_INCLUDED_
+#define DUNE_IMC_JSON_PARSER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Schema.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM JSONParser;
+
+    //! Build IMC messages from JSON documents.
+    //!
+    //! The accepted layout is the one produced by JSONWriter and
+    //! Message::toJSON(): an object with the member 'abbrev', optional
+    //! header members ('timestamp', 'src', 'src_ent', 'dst' and
+    //! 'dst_ent') and one member per message field. Numbers may be
+    //! given as JSON numbers or as quoted strings, raw data fields as
+    //! hexadecimal strings, inline messages as nested objects (or
+    //! null) and message lists as arrays. Missing fields keep their
+    //! default values. The input is parsed in place, field values are
+    //! serialized straight into the message payload and the result is
+    //! unpacked by the generated deserialization code.
+    class JSONParser
+    {
+    public:
+      //! Constructor.
+      JSONParser(void);
+
+      //! Parse a message.
+      //! @param data JSON document.
+      //! @param size document size.
+      //! @return new message, owned by the caller.
+      //! @throw InvalidJSON if the document is malformed.
+      //! @throw InvalidMessageAbbrev if the message is unknown.
+      Message*
+      parse(const char* data, unsigned size);
+
+      //! Parse a message.
+      //! @param text JSON document.
+      //! @return new message, owned by the caller.
+      Message*
+      parse(const std::string& text)
+      {
+        return parse(text.data(), text.size());
+      }
+
+    private:
+      //! Object member.
+      struct Member
+      {
+        //! Member name.
+        std::string key;
+        //! Start of the member's value.
+        const char* value;
+      };
+
+      //! Default payload of a message.
+      struct Defaults
+      {
+        //! Serialized payload.
+        std::vector<uint8_t> payload;
+        //! Offset of each field in the payload, plus the payload size.
+        std::vector<unsigned> offsets;
+      };
+
+      //! Start of the document.
+      const char* m_begin;
+      //! Current position.
+      const char* m_ptr;
+      //! End of the document.
+      const char* m_end;
+      //! Scratch string.
+      std::string m_text;
+      //! Default payloads by message identification number.
+      std::map<uint16_t, Defaults> m_defaults;
+
+      void
+      fail(const std::string& reason);
+
+      void
+      skipSpace(void);
+
+      bool
+      accept(char c);
+
+      void
+      expect(char c);
+
+      bool
+      acceptLiteral(const char* literal);
+
+      void
+      parseString(std::string& value);
+
+      void
+      skipValue(void);
+
+      void
+      parseMembers(std::vector<Member>& members);
+
+      const char*
+      parseNumberToken(char* text, unsigned size);
+
+      double
+      parseDouble(void);
+
+      int64_t
+      parseInteger(int64_t min, int64_t max);
+
+      const Schema::Message*
+      findSchema(const std::vector<Member>& members);
+
+      void
+      parseFields(const Schema::Message* schema, const std::vector<Member>& members,
+                  bool top, std::vector<uint8_t>& out);
+
+      void
+      parseField(const Schema::Field& field, std::vector<uint8_t>& out);
+
+      void
+      parseInline(std::vector<uint8_t>& out);
+
+      const Defaults&
+      getDefaults(const Schema::Message* schema);
+    };
+  }
+}
+
+#endif
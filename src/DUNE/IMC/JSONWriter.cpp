@@ -0,0 +1,437 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Math/General.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Number of indentation spaces per nesting level.
+    static const unsigned c_nindent = 2;
+    //! Hexadecimal digits.
+    static const char c_hex[] = "0123456789abcdef";
+
+    JSONWriter::JSONWriter(bool compact):
+      m_compact(compact),
+      m_after_key(false)
+    { }
+
+    void
+    JSONWriter::setCompact(bool compact)
+    {
+      m_compact = compact;
+    }
+
+    void
+    JSONWriter::clear(void)
+    {
+      m_bfr.clear();
+      m_first.clear();
+      m_after_key = false;
+    }
+
+    void
+    JSONWriter::newline(unsigned depth)
+    {
+      if (m_compact)
+        return;
+
+      m_bfr.push_back('\n');
+      m_bfr.append(depth * c_nindent, ' ');
+    }
+
+    void
+    JSONWriter::prefix(void)
+    {
+      if (m_after_key)
+      {
+        m_after_key = false;
+        return;
+      }
+
+      if (m_first.empty())
+        return;
+
+      if (m_first.back())
+        m_first.back() = false;
+      else
+        m_bfr.push_back(',');
+
+      newline(m_first.size());
+    }
+
+    void
+    JSONWriter::beginObject(void)
+    {
+      prefix();
+      m_bfr.push_back('{');
+      m_first.push_back(true);
+    }
+
+    void
+    JSONWriter::endObject(void)
+    {
+      bool empty = m_first.back();
+      m_first.pop_back();
+      if (!empty)
+        newline(m_first.size());
+      m_bfr.push_back('}');
+    }
+
+    void
+    JSONWriter::beginArray(void)
+    {
+      prefix();
+      m_bfr.push_back('[');
+      m_first.push_back(true);
+    }
+
+    void
+    JSONWriter::endArray(void)
+    {
+      bool empty = m_first.back();
+      m_first.pop_back();
+      if (!empty)
+        newline(m_first.size());
+      m_bfr.push_back(']');
+    }
+
+    void
+    JSONWriter::key(const char* name)
+    {
+      prefix();
+      appendString(name, std::strlen(name));
+      m_bfr.push_back(':');
+      if (!m_compact)
+        m_bfr.push_back(' ');
+      m_after_key = true;
+    }
+
+    void
+    JSONWriter::writeInteger(int64_t value)
+    {
+      char text[32];
+      std::sprintf(text, "%lld", (long long)value);
+      prefix();
+      m_bfr.append(text);
+    }
+
+    void
+    JSONWriter::writeUnsigned(uint64_t value)
+    {
+      char text[32];
+      std::sprintf(text, "%llu", (unsigned long long)value);
+      prefix();
+      m_bfr.append(text);
+    }
+
+    void
+    JSONWriter::writeNumber(double value)
+    {
+      // Infinities and NaN yield NaN when subtracted from themselves.
+      if (Math::isNaN(value - value))
+      {
+        writeNull();
+        return;
+      }
+
+      // Shortest representation that reads back to the same value.
+      char text[32];
+      for (int precision = 15; precision <= 17; ++precision)
+      {
+        std::sprintf(text, "%.*g", precision, value);
+        if (std::strtod(text, NULL) == value)
+          break;
+      }
+
+      prefix();
+      m_bfr.append(text);
+    }
+
+    void
+    JSONWriter::writeNumber(float value)
+    {
+      if (Math::isNaN(value - value))
+      {
+        writeNull();
+        return;
+      }
+
+      char text[32];
+      for (int precision = 6; precision <= 9; ++precision)
+      {
+        std::sprintf(text, "%.*g", precision, value);
+        if ((float)std::strtod(text, NULL) == value)
+          break;
+      }
+
+      prefix();
+      m_bfr.append(text);
+    }
+
+    void
+    JSONWriter::appendString(const char* data, unsigned size)
+    {
+      m_bfr.reserve(m_bfr.size() + size + 2);
+      m_bfr.push_back('"');
+
+      // Copy runs of characters that need no escaping in one go.
+      unsigned start = 0;
+      for (unsigned i = 0; i < size; ++i)
+      {
+        unsigned char c = (unsigned char)data[i];
+        if (c >= 0x20 && c != '"' && c != '\\')
+          continue;
+
+        m_bfr.append(data + start, i - start);
+        start = i + 1;
+
+        switch (c)
+        {
+          case '"':
+            m_bfr.append("\\\"");
+            break;
+          case '\\':
+            m_bfr.append("\\\\");
+            break;
+          case '\n':
+            m_bfr.append("\\n");
+            break;
+          case '\r':
+            m_bfr.append("\\r");
+            break;
+          case '\t':
+            m_bfr.append("\\t");
+            break;
+          case '\b':
+            m_bfr.append("\\b");
+            break;
+          case '\f':
+            m_bfr.append("\\f");
+            break;
+          default:
+            m_bfr.append("\\u00");
+            m_bfr.push_back(c_hex[c >> 4]);
+            m_bfr.push_back(c_hex[c & 0x0f]);
+            break;
+        }
+      }
+
+      m_bfr.append(data + start, size - start);
+      m_bfr.push_back('"');
+    }
+
+    void
+    JSONWriter::writeString(const char* data, unsigned size)
+    {
+      prefix();
+      appendString(data, size);
+    }
+
+    void
+    JSONWriter::writeHex(const uint8_t* data, unsigned size)
+    {
+      prefix();
+      m_bfr.reserve(m_bfr.size() + size * 2 + 2);
+      m_bfr.push_back('"');
+      for (unsigned i = 0; i < size; ++i)
+      {
+        m_bfr.push_back(c_hex[data[i] >> 4]);
+        m_bfr.push_back(c_hex[data[i] & 0x0f]);
+      }
+      m_bfr.push_back('"');
+    }
+
+    void
+    JSONWriter::writeNull(void)
+    {
+      prefix();
+      m_bfr.append("null");
+    }
+
+    template <typename Type>
+    Type
+    JSONWriter::readNative(Reader& in)
+    {
+      if ((unsigned)(in.end - in.ptr) < sizeof(Type))
+        throw BufferTooShort();
+
+      Type value;
+      std::memcpy(&value, in.ptr, sizeof(Type));
+      in.ptr += sizeof(Type);
+      return value;
+    }
+
+    void
+    JSONWriter::write(const Message* msg)
+    {
+      const Schema::Message* schema = Schema::find(msg->getId());
+      if (schema == NULL)
+        throw InvalidMessageId(msg->getId());
+
+      m_scratch.resize(msg->getPayloadSerializationSize());
+      if (!m_scratch.empty())
+        msg->serializeFields(&m_scratch[0]);
+
+      beginObject();
+      key("abbrev");
+      writeString(schema->abbrev, std::strlen(schema->abbrev));
+      key("timestamp");
+      writeNumber(msg->getTimeStamp());
+      key("src");
+      writeUnsigned(msg->getSource());
+      key("src_ent");
+      writeUnsigned(msg->getSourceEntity());
+      key("dst");
+      writeUnsigned(msg->getDestination());
+      key("dst_ent");
+      writeUnsigned(msg->getDestinationEntity());
+
+      Reader in;
+      in.ptr = m_scratch.empty() ? NULL : &m_scratch[0];
+      in.end = in.ptr + m_scratch.size();
+      writeFields(schema, in);
+      endObject();
+    }
+
+    void
+    JSONWriter::writeFields(const Schema::Message* schema, Reader& in)
+    {
+      for (unsigned i = 0; i < schema->fields.size(); ++i)
+      {
+        key(schema->fields[i].abbrev);
+        writeField(schema->fields[i], in);
+      }
+    }
+
+    void
+    JSONWriter::writeInline(Reader& in)
+    {
+      uint16_t id = readNative<uint16_t>(in);
+      if (id == DUNE_IMC_CONST_NULL_ID)
+      {
+        writeNull();
+        return;
+      }
+
+      const Schema::Message* schema = Schema::find(id);
+      if (schema == NULL)
+        throw InvalidMessageId(id);
+
+      beginObject();
+      key("abbrev");
+      writeString(schema->abbrev, std::strlen(schema->abbrev));
+      writeFields(schema, in);
+      endObject();
+    }
+
+    void
+    JSONWriter::writeField(const Schema::Field& field, Reader& in)
+    {
+      switch (field.type)
+      {
+        case Schema::TYPE_UINT8:
+          writeUnsigned(readNative<uint8_t>(in));
+          break;
+
+        case Schema::TYPE_INT8:
+          writeInteger(readNative<int8_t>(in));
+          break;
+
+        case Schema::TYPE_UINT16:
+          writeUnsigned(readNative<uint16_t>(in));
+          break;
+
+        case Schema::TYPE_INT16:
+          writeInteger(readNative<int16_t>(in));
+          break;
+
+        case Schema::TYPE_UINT32:
+          writeUnsigned(readNative<uint32_t>(in));
+          break;
+
+        case Schema::TYPE_INT32:
+          writeInteger(readNative<int32_t>(in));
+          break;
+
+        case Schema::TYPE_INT64:
+          writeInteger(readNative<int64_t>(in));
+          break;
+
+        case Schema::TYPE_FP32:
+          writeNumber(readNative<fp32_t>(in));
+          break;
+
+        case Schema::TYPE_FP64:
+          writeNumber(readNative<fp64_t>(in));
+          break;
+
+        case Schema::TYPE_RAWDATA:
+        case Schema::TYPE_PLAINTEXT:
+          {
+            uint16_t size = readNative<uint16_t>(in);
+            if (in.end - in.ptr < size)
+              throw BufferTooShort();
+
+            if (field.type == Schema::TYPE_RAWDATA)
+              writeHex(in.ptr, size);
+            else
+              writeString((const char*)in.ptr, size);
+            in.ptr += size;
+          }
+          break;
+
+        case Schema::TYPE_MESSAGE:
+          writeInline(in);
+          break;
+
+        case Schema::TYPE_MESSAGE_LIST:
+          {
+            uint16_t count = readNative<uint16_t>(in);
+            beginArray();
+            for (unsigned i = 0; i < count; ++i)
+              writeInline(in);
+            endArray();
+          }
+          break;
+      }
+    }
+  }
+}
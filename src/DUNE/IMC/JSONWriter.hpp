@@ -0,0 +1,196 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_JSON_WRITER_HPP_INCLUDED_
+#define DUNE_IMC_JSON_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Schema.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM JSONWriter;
+
+    //! Buffer based JSON encoder.
+    //!
+    //! Messages are written with the same layout as Message::toJSON(),
+    //! but numbers are emitted as JSON numbers using the shortest
+    //! representation that reads back to the same value, strings are
+    //! escaped in a single pass and the output can be compact (no
+    //! indentation). Non-finite numbers are written as null.
+    class JSONWriter
+    {
+    public:
+      //! Constructor.
+      //! @param compact true to omit indentation and line breaks.
+      JSONWriter(bool compact = false);
+
+      //! Enable or disable compact output.
+      //! @param compact true to omit indentation and line breaks.
+      void
+      setCompact(bool compact);
+
+      //! Discard the output.
+      void
+      clear(void);
+
+      //! Retrieve the output.
+      //! @return JSON text.
+      const std::string&
+      str(void) const
+      {
+        return m_bfr;
+      }
+
+      //! Write a message, including its header.
+      //! @param msg message.
+      void
+      write(const Message* msg);
+
+      //! Start an object.
+      void
+      beginObject(void);
+
+      //! End the current object.
+      void
+      endObject(void);
+
+      //! Start an array.
+      void
+      beginArray(void);
+
+      //! End the current array.
+      void
+      endArray(void);
+
+      //! Write the key of the next object member.
+      //! @param name member name.
+      void
+      key(const char* name);
+
+      //! Write a signed integer.
+      //! @param value value.
+      void
+      writeInteger(int64_t value);
+
+      //! Write an unsigned integer.
+      //! @param value value.
+      void
+      writeUnsigned(uint64_t value);
+
+      //! Write a double precision number.
+      //! @param value value.
+      void
+      writeNumber(double value);
+
+      //! Write a single precision number, using the shortest
+      //! representation that reads back to the same single precision
+      //! value.
+      //! @param value value.
+      void
+      writeNumber(float value);
+
+      //! Write a string.
+      //! @param data string data.
+      //! @param size string size.
+      void
+      writeString(const char* data, unsigned size);
+
+      //! Write a string.
+      //! @param value string.
+      void
+      writeString(const std::string& value)
+      {
+        writeString(value.data(), value.size());
+      }
+
+      //! Write binary data as an hexadecimal string.
+      //! @param data data.
+      //! @param size data size.
+      void
+      writeHex(const uint8_t* data, unsigned size);
+
+      //! Write a null value.
+      void
+      writeNull(void);
+
+    private:
+      //! Bounded reader over a serialized payload.
+      struct Reader
+      {
+        const uint8_t* ptr;
+        const uint8_t* end;
+      };
+
+      //! Output buffer.
+      std::string m_bfr;
+      //! True to omit indentation and line breaks.
+      bool m_compact;
+      //! True for each open container that has no elements yet.
+      std::vector<bool> m_first;
+      //! True if a key was written and its value is pending.
+      bool m_after_key;
+      //! Scratch buffer holding serialized payloads.
+      std::vector<uint8_t> m_scratch;
+
+      void
+      prefix(void);
+
+      void
+      newline(unsigned depth);
+
+      void
+      writeFields(const Schema::Message* schema, Reader& in);
+
+      void
+      writeField(const Schema::Field& field, Reader& in);
+
+      void
+      writeInline(Reader& in);
+
+      void
+      appendString(const char* data, unsigned size);
+
+      template <typename Type>
+      static Type
+      readNative(Reader& in);
+    };
+  }
+}
+
+#endif
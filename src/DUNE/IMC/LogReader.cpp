@@ -0,0 +1,675 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <istream>
+#include <queue>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/LogReader.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Compression/FileInput.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    using Concurrency::Condition;
+    using Concurrency::ScopedCondition;
+    using Concurrency::ScopedMutex;
+
+    //! Maximum number of bytes per chunk of packets.
+    static const unsigned c_chunk_size = 64 * 1024;
+    //! Number of chunks or batches queued between pipeline stages.
+    static const unsigned c_queue_size = 4;
+
+    //! Bounded blocking queue between pipeline stages.
+    template <typename T>
+    class Channel
+    {
+    public:
+      Channel(unsigned capacity):
+        m_capacity(capacity),
+        m_closed(false),
+        m_cancelled(false)
+      { }
+
+      //! Add an item, waiting for space.
+      //! @return false if the consumer cancelled the channel.
+      bool
+      push(T item)
+      {
+        ScopedCondition l(m_cond);
+        while (m_items.size() >= m_capacity && !m_cancelled)
+          m_cond.wait();
+
+        if (m_cancelled)
+          return false;
+
+        m_items.push_back(item);
+        m_cond.broadcast();
+        return true;
+      }
+
+      //! Remove an item, waiting for one to be available.
+      //! @return false if the channel was closed and is empty.
+      bool
+      pop(T& item)
+      {
+        ScopedCondition l(m_cond);
+        while (m_items.empty() && !m_closed && !m_cancelled)
+          m_cond.wait();
+
+        if (m_items.empty() || m_cancelled)
+          return false;
+
+        item = m_items.front();
+        m_items.pop_front();
+        m_cond.broadcast();
+        return true;
+      }
+
+      //! Signal that no more items will be added.
+      void
+      close(void)
+      {
+        ScopedCondition l(m_cond);
+        m_closed = true;
+        m_cond.broadcast();
+      }
+
+      //! Signal that no more items will be removed.
+      //! @param items items left in the channel.
+      void
+      cancel(std::deque<T>& items)
+      {
+        ScopedCondition l(m_cond);
+        m_cancelled = true;
+        items.swap(m_items);
+        m_items.clear();
+        m_cond.broadcast();
+      }
+
+      bool
+      cancelled(void)
+      {
+        ScopedCondition l(m_cond);
+        return m_cancelled;
+      }
+
+    private:
+      unsigned m_capacity;
+      std::deque<T> m_items;
+      Condition m_cond;
+      bool m_closed;
+      bool m_cancelled;
+    };
+
+    //! Packets read from a log.
+    struct Chunk
+    {
+      //! Packets, one after the other.
+      std::vector<uint8_t> data;
+    };
+
+    //! Decoded messages.
+    typedef std::vector<Message*> Batch;
+
+    //! Pipeline reading one log.
+    class LogReader::Source
+    {
+    public:
+      Source(const std::string& path, const std::set<uint16_t>& filter, bool keep_first,
+             unsigned batch_size):
+        m_path(path),
+        m_filter(filter),
+        m_keep_first(keep_first),
+        m_batch_size(batch_size),
+        m_chunks(c_queue_size),
+        m_batches(c_queue_size),
+        m_framer(*this, &Source::frame),
+        m_decoder(*this, &Source::decode),
+        m_batch(NULL),
+        m_index(0)
+      { }
+
+      ~Source(void)
+      {
+        cancel();
+        m_framer.join();
+        m_decoder.join();
+        cancel();
+
+        if (m_batch != NULL)
+          destroy(m_batch);
+      }
+
+      void
+      start(void)
+      {
+        m_framer.start();
+        m_decoder.start();
+      }
+
+      //! Retrieve the next batch of messages.
+      //! @return non-empty batch or NULL at the end of the log.
+      Batch*
+      next(void)
+      {
+        Batch* batch = NULL;
+        while (m_batches.pop(batch))
+        {
+          if (!batch->empty())
+            return batch;
+          delete batch;
+        }
+
+        return NULL;
+      }
+
+      //! Move to the next message when merging.
+      //! @return true if a message is available, false at the end of
+      //! the log.
+      bool
+      advance(void)
+      {
+        if (m_batch != NULL && m_index < m_batch->size())
+          return true;
+
+        if (m_batch != NULL)
+          destroy(m_batch);
+
+        m_index = 0;
+        m_batch = next();
+        return m_batch != NULL;
+      }
+
+      //! Retrieve the current message when merging.
+      //! @return message.
+      const Message*
+      peek(void) const
+      {
+        return (*m_batch)[m_index];
+      }
+
+      //! Take ownership of the current message when merging.
+      //! @return message.
+      Message*
+      take(void)
+      {
+        Message* msg = (*m_batch)[m_index];
+        (*m_batch)[m_index++] = NULL;
+        return msg;
+      }
+
+      //! Stop reading the log.
+      void
+      cancel(void)
+      {
+        std::deque<Chunk*> chunks;
+        m_chunks.cancel(chunks);
+        for (unsigned i = 0; i < chunks.size(); ++i)
+          delete chunks[i];
+
+        std::deque<Batch*> batches;
+        m_batches.cancel(batches);
+        for (unsigned i = 0; i < batches.size(); ++i)
+          destroy(batches[i]);
+      }
+
+      const std::string&
+      getPath(void) const
+      {
+        return m_path;
+      }
+
+      std::string
+      getError(void)
+      {
+        ScopedMutex l(m_error_mutex);
+        return m_error;
+      }
+
+      static void
+      destroy(Batch* batch)
+      {
+        for (unsigned i = 0; i < batch->size(); ++i)
+          delete (*batch)[i];
+        delete batch;
+      }
+
+    private:
+      //! Thread running one pipeline stage.
+      class Stage: public Concurrency::Thread
+      {
+      public:
+        Stage(Source& source, void (Source::*function)(void)):
+          m_source(source),
+          m_function(function)
+        { }
+
+      private:
+        Source& m_source;
+        void (Source::*m_function)(void);
+
+        void
+        run(void)
+        {
+          (m_source.*m_function)();
+        }
+      };
+
+      //! Log file path.
+      std::string m_path;
+      //! Messages to decode.
+      const std::set<uint16_t>& m_filter;
+      //! True to decode the first message regardless of the filter.
+      bool m_keep_first;
+      //! Maximum number of messages per batch.
+      unsigned m_batch_size;
+      //! Packets waiting to be decoded.
+      Channel<Chunk*> m_chunks;
+      //! Messages waiting to be delivered.
+      Channel<Batch*> m_batches;
+      //! Error description.
+      std::string m_error;
+      //! Mutex protecting the error description.
+      Concurrency::Mutex m_error_mutex;
+      //! Decompression and framing stage.
+      Stage m_framer;
+      //! Decoding stage.
+      Stage m_decoder;
+      //! Batch being merged.
+      Batch* m_batch;
+      //! Index of the current message of the batch being merged.
+      unsigned m_index;
+
+      void
+      setError(const std::string& error)
+      {
+        ScopedMutex l(m_error_mutex);
+        if (m_error.empty())
+          m_error = error;
+      }
+
+      //! Split the log into chunks of packets.
+      void
+      frame(void)
+      {
+        std::istream* is = NULL;
+        Chunk* chunk = NULL;
+
+        try
+        {
+          Compression::Methods method = Compression::Factory::detect(m_path.c_str());
+          if (method == Compression::METHOD_UNKNOWN)
+            is = new std::ifstream(m_path.c_str(), std::ios::binary);
+          else
+            is = new Compression::FileInput(m_path.c_str(), method);
+
+          if (!*is)
+            throw std::runtime_error("unable to open " + m_path);
+
+          unsigned count = 0;
+          bool first = m_keep_first;
+          chunk = new Chunk;
+          chunk->data.reserve(c_chunk_size);
+
+          uint8_t hdr_data[DUNE_IMC_CONST_HEADER_SIZE];
+          std::vector<uint8_t> skip;
+          while (true)
+          {
+            // Partial headers at the end of the log are ignored.
+            is->read((char*)hdr_data, sizeof(hdr_data));
+            if (is->gcount() < (std::streamsize)sizeof(hdr_data))
+              break;
+
+            Header hdr;
+            Packet::deserializeHeader(hdr, hdr_data, sizeof(hdr_data));
+            unsigned remaining = hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+
+            // Compressed streams cannot ignore data, read it instead.
+            if (!first && !m_filter.empty() && m_filter.find(hdr.mgid) == m_filter.end())
+            {
+              skip.resize(remaining);
+              is->read((char*)&skip[0], remaining);
+              if (is->gcount() < (std::streamsize)remaining)
+                throw BufferTooShort();
+              continue;
+            }
+
+            first = false;
+            size_t offset = chunk->data.size();
+            chunk->data.resize(offset + sizeof(hdr_data) + remaining);
+            std::memcpy(&chunk->data[offset], hdr_data, sizeof(hdr_data));
+            is->read((char*)&chunk->data[offset + sizeof(hdr_data)], remaining);
+            if (is->gcount() < (std::streamsize)remaining)
+            {
+              chunk->data.resize(offset);
+              throw BufferTooShort();
+            }
+
+            if (++count < m_batch_size && chunk->data.size() < c_chunk_size)
+              continue;
+
+            Chunk* full = chunk;
+            chunk = NULL;
+            if (!m_chunks.push(full))
+            {
+              delete full;
+              break;
+            }
+
+            count = 0;
+            chunk = new Chunk;
+            chunk->data.reserve(c_chunk_size);
+          }
+        }
+        catch (std::exception& e)
+        {
+          setError(e.what());
+        }
+
+        // Deliver the packets read before the end of the log or an error.
+        if (chunk != NULL && !chunk->data.empty())
+        {
+          if (m_chunks.push(chunk))
+            chunk = NULL;
+        }
+
+        delete chunk;
+        delete is;
+        m_chunks.close();
+      }
+
+      //! Decode chunks of packets into batches of messages.
+      void
+      decode(void)
+      {
+        Chunk* chunk = NULL;
+
+        while (m_chunks.pop(chunk))
+        {
+          Batch* batch = new Batch;
+
+          try
+          {
+            const uint8_t* ptr = &chunk->data[0];
+            const uint8_t* end = ptr + chunk->data.size();
+
+            while (ptr < end)
+            {
+              Header hdr;
+              Packet::deserializeHeader(hdr, ptr, DUNE_IMC_CONST_HEADER_SIZE);
+              unsigned size = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+              batch->push_back(Packet::deserializePayload(hdr, ptr, size, NULL));
+              ptr += size;
+            }
+          }
+          catch (std::exception& e)
+          {
+            setError(e.what());
+            delete chunk;
+
+            // Deliver the messages decoded so far and stop reading.
+            std::deque<Chunk*> chunks;
+            m_chunks.cancel(chunks);
+            for (unsigned i = 0; i < chunks.size(); ++i)
+              delete chunks[i];
+
+            if (!m_batches.push(batch))
+              destroy(batch);
+            break;
+          }
+
+          delete chunk;
+          if (!m_batches.push(batch))
+          {
+            destroy(batch);
+            break;
+          }
+        }
+
+        m_batches.close();
+      }
+    };
+
+    LogReader::LogReader(void):
+      m_concurrency(c_concurrency),
+      m_merge(false),
+      m_keep_first(false),
+      m_batch_size(c_batch_size)
+    { }
+
+    void
+    LogReader::add(const std::string& path)
+    {
+      m_paths.push_back(resolve(path));
+    }
+
+    void
+    LogReader::setConcurrency(unsigned logs)
+    {
+      m_concurrency = (logs == 0) ? 1 : logs;
+    }
+
+    void
+    LogReader::setMerge(bool merge)
+    {
+      m_merge = merge;
+    }
+
+    void
+    LogReader::setFilter(const std::set<uint16_t>& ids)
+    {
+      m_filter = ids;
+    }
+
+    void
+    LogReader::setKeepFirst(bool keep)
+    {
+      m_keep_first = keep;
+    }
+
+    void
+    LogReader::setBatchSize(unsigned size)
+    {
+      m_batch_size = (size == 0) ? 1 : size;
+    }
+
+    std::string
+    LogReader::resolve(const std::string& path)
+    {
+      FileSystem::Path file(path);
+      if (!file.isDirectory())
+        return path;
+
+      file = file / "Data.lsf";
+      if (!file.isFile())
+        file += ".gz";
+
+      return file.str();
+    }
+
+    void
+    LogReader::run(Handler& handler)
+    {
+      if (m_merge)
+        runMerged(handler);
+      else
+        runSequential(handler);
+    }
+
+    void
+    LogReader::runSequential(Handler& handler)
+    {
+      std::deque<Source*> sources;
+      unsigned next = 0;
+
+      try
+      {
+        for (unsigned i = 0; i < m_paths.size(); ++i)
+        {
+          // Keep the following logs decoding in the background.
+          while (next < m_paths.size() && next < i + m_concurrency)
+          {
+            sources.push_back(new Source(m_paths[next], m_filter, m_keep_first, m_batch_size));
+            sources.back()->start();
+            ++next;
+          }
+
+          Source* source = sources.front();
+          handler.onBegin(i, source->getPath());
+
+          Batch* batch = NULL;
+          while ((batch = source->next()) != NULL)
+          {
+            bool proceed = handler.onMessages(i, *batch);
+            Source::destroy(batch);
+            if (!proceed)
+            {
+              source->cancel();
+              break;
+            }
+          }
+
+          handler.onEnd(i, source->getError());
+          sources.pop_front();
+          delete source;
+        }
+      }
+      catch (...)
+      {
+        for (unsigned i = 0; i < sources.size(); ++i)
+          delete sources[i];
+        throw;
+      }
+    }
+
+    //! Next message of a log being merged.
+    struct Head
+    {
+      double timestamp;
+      unsigned source;
+
+      bool
+      operator<(const Head& other) const
+      {
+        // Reversed for a min-heap, ties resolved by log order.
+        if (timestamp != other.timestamp)
+          return timestamp > other.timestamp;
+        return source > other.source;
+      }
+    };
+
+    void
+    LogReader::runMerged(Handler& handler)
+    {
+      std::vector<Source*> sources;
+      std::priority_queue<Head> heads;
+      Batch out;
+
+      try
+      {
+        for (unsigned i = 0; i < m_paths.size(); ++i)
+        {
+          sources.push_back(new Source(m_paths[i], m_filter, m_keep_first, m_batch_size));
+          sources.back()->start();
+        }
+
+        handler.onBegin(0, m_paths.empty() ? std::string() : m_paths[0]);
+
+        for (unsigned i = 0; i < sources.size(); ++i)
+        {
+          if (sources[i]->advance())
+          {
+            Head head = {sources[i]->peek()->getTimeStamp(), i};
+            heads.push(head);
+          }
+        }
+
+        bool proceed = true;
+        while (proceed && !heads.empty())
+        {
+          unsigned i = heads.top().source;
+          heads.pop();
+
+          out.push_back(sources[i]->take());
+          if (sources[i]->advance())
+          {
+            Head head = {sources[i]->peek()->getTimeStamp(), i};
+            heads.push(head);
+          }
+
+          if (out.size() >= m_batch_size || heads.empty())
+          {
+            proceed = handler.onMessages(0, out);
+            for (unsigned j = 0; j < out.size(); ++j)
+              delete out[j];
+            out.clear();
+          }
+        }
+
+        std::string error;
+        for (unsigned i = 0; i < sources.size() && error.empty(); ++i)
+        {
+          sources[i]->cancel();
+          error = sources[i]->getError();
+        }
+
+        handler.onEnd(0, error);
+      }
+      catch (...)
+      {
+        for (unsigned i = 0; i < out.size(); ++i)
+          delete out[i];
+        for (unsigned i = 0; i < sources.size(); ++i)
+          delete sources[i];
+        throw;
+      }
+
+      for (unsigned i = 0; i < sources.size(); ++i)
+        delete sources[i];
+    }
+  }
+}
@@ -0,0 +1,193 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LOG_READER_HPP_INCLUDED_
+#define DUNE_IMC_LOG_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <set>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LogReader;
+
+    //! Read messages from several LSF logs in parallel.
+    //!
+    //! Each log is read by a pipeline of two threads: the first
+    //! decompresses the file and splits it into packets, skipping
+    //! the payload of filtered messages, and the second validates and
+    //! decodes the packets into batches of messages. Batches are
+    //! handed to a Handler on the thread that called run(), so
+    //! handlers need no locking.
+    //!
+    //! By default logs are delivered one after the other, in the
+    //! order they were added, while the next logs are decoded in the
+    //! background. In merge mode all logs are read simultaneously and
+    //! delivered as a single stream in timestamp order, which is
+    //! useful for volumes of the same log or for logs of several
+    //! systems.
+    class LogReader
+    {
+    public:
+      //! Default number of logs decoded simultaneously.
+      static const unsigned c_concurrency = 4;
+      //! Default maximum number of messages per batch.
+      static const unsigned c_batch_size = 256;
+
+      //! Receiver of decoded messages.
+      class Handler
+      {
+      public:
+        virtual
+        ~Handler(void)
+        { }
+
+        //! Called before the first batch of a stream.
+        //! @param stream stream index (log index or zero if merging).
+        //! @param path log path.
+        virtual void
+        onBegin(unsigned stream, const std::string& path)
+        {
+          (void)stream;
+          (void)path;
+        }
+
+        //! Called for each batch of messages. Messages are deleted
+        //! when this function returns, except entries set to NULL,
+        //! which become owned by the handler.
+        //! @param stream stream index.
+        //! @param msgs messages in log order.
+        //! @return true to continue, false to stop reading the stream.
+        virtual bool
+        onMessages(unsigned stream, std::vector<Message*>& msgs) = 0;
+
+        //! Called after the last batch of a stream.
+        //! @param stream stream index.
+        //! @param error description of the error that stopped reading
+        //! the stream, empty if the stream was read to the end.
+        virtual void
+        onEnd(unsigned stream, const std::string& error)
+        {
+          (void)stream;
+          (void)error;
+        }
+      };
+
+      //! Constructor.
+      LogReader(void);
+
+      //! Add a log.
+      //! @param path LSF file (compressed or not) or log directory.
+      void
+      add(const std::string& path);
+
+      //! Retrieve the paths of the logs.
+      //! @return log file paths.
+      const std::vector<std::string>&
+      getPaths(void) const
+      {
+        return m_paths;
+      }
+
+      //! Set the number of logs decoded simultaneously when not
+      //! merging.
+      //! @param logs number of logs.
+      void
+      setConcurrency(unsigned logs);
+
+      //! Enable or disable merging of logs in timestamp order.
+      //! @param merge true to merge logs.
+      void
+      setMerge(bool merge);
+
+      //! Only decode and deliver the given messages. The payloads of
+      //! other messages are skipped without being decoded.
+      //! @param ids message identification numbers, empty to deliver
+      //! all messages.
+      void
+      setFilter(const std::set<uint16_t>& ids);
+
+      //! Deliver the first message of each log even if it is not
+      //! selected by the filter, e.g., to learn when the log starts.
+      //! @param keep true to deliver the first message.
+      void
+      setKeepFirst(bool keep);
+
+      //! Set the maximum number of messages per batch.
+      //! @param size number of messages.
+      void
+      setBatchSize(unsigned size);
+
+      //! Read all logs.
+      //! @param handler message handler.
+      void
+      run(Handler& handler);
+
+      //! Resolve the path of a log: directories are replaced by the
+      //! 'Data.lsf' or 'Data.lsf.gz' file they contain.
+      //! @param path file or directory.
+      //! @return file path.
+      static std::string
+      resolve(const std::string& path);
+
+    private:
+      class Source;
+
+      //! Log file paths.
+      std::vector<std::string> m_paths;
+      //! Number of logs decoded simultaneously.
+      unsigned m_concurrency;
+      //! True to merge logs.
+      bool m_merge;
+      //! Messages to deliver.
+      std::set<uint16_t> m_filter;
+      //! True to deliver the first message of each log.
+      bool m_keep_first;
+      //! Maximum number of messages per batch.
+      unsigned m_batch_size;
+
+      void
+      runSequential(Handler& handler);
+
+      void
+      runMerged(Handler& handler);
+    };
+  }
+}
+
+#endif
@@ -46,12 +46,16 @@ namespace DUNE
     // Export symbol.
     class DUNE_DLL_SYM Message;
 
+    // Forward declarations.
+    class RawData;
+
     //! Basic IMC message.
     class Message
     {
     public:
       //! Default constructor.
-      Message(void)
+      Message(void):
+        m_fixed_payload_size(-1)
       {
         m_header.src = AddressResolver::invalid();
         m_header.src_ent = DUNE_IMC_CONST_UNK_EID;
@@ -237,6 +241,9 @@ namespace DUNE
       unsigned
       getPayloadSerializationSize(void) const
       {
+        if (m_fixed_payload_size >= 0)
+          return m_fixed_payload_size;
+
         return getFixedSerializationSize() + getVariableSerializationSize();
       }
 
@@ -274,6 +281,21 @@ namespace DUNE
       virtual uint8_t*
       serializeFields(uint8_t* bfr) const = 0;
 
+      //! Serialize message fields, except for the contents of a
+      //! trailing shared raw data field. The length of that field is
+      //! still serialized, but its contents are returned instead of
+      //! being copied to the buffer, allowing scatter-gather output.
+      //! @param bfr destination buffer.
+      //! @param tail trailing raw data field or NULL if the message
+      //! does not end with a shared raw data field.
+      //! @return pointer to the end of the serialized data.
+      virtual uint8_t*
+      serializeFieldsHead(uint8_t* bfr, const RawData*& tail) const
+      {
+        tail = NULL;
+        return serializeFields(bfr);
+      }
+
       //! Deserialize message fields from a packet.
       //! @param bfr stream of bytes (packet)
       //! @param len length of the byte stream.
@@ -316,6 +338,10 @@ namespace DUNE
     protected:
       //! Message header.
       Header m_header;
+      //! Payload size of messages without variable size fields, set
+      //! by their constructor to avoid virtual size queries. Negative
+      //! for messages with variable size fields.
+      int m_fixed_payload_size;
 
       //! Set the timestamp of nested messages.
       //! @param[in] value timestamp.
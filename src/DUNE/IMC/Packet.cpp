@@ -83,13 +83,69 @@ namespace DUNE
       if (total > DUNE_IMC_CONST_MAX_SIZE)
         throw InvalidMessageSize(total);
 
-      uint16_t n = total;
-      std::vector<char> data(n);
-      serialize(msg, (uint8_t*)&data[0], n);
-      ofs.write(&data[0], n);
+      Utils::ByteBuffer bfr(total);
+      return serialize(msg, bfr, ofs);
+    }
+
+    uint16_t
+    Packet::serialize(const Message* msg, Utils::ByteBuffer& bfr, std::ostream& ofs)
+    {
+      Segment segs[c_max_segments];
+      unsigned count = serializeSegments(msg, bfr, segs);
+
+      uint16_t n = 0;
+      for (unsigned i = 0; i < count; ++i)
+      {
+        ofs.write((const char*)segs[i].data, segs[i].size);
+        n += segs[i].size;
+      }
+
       return n;
     }
 
+    unsigned
+    Packet::serializeSegments(const Message* msg, Utils::ByteBuffer& bfr, Segment* segs)
+    {
+      unsigned total = msg->getSerializationSize();
+      if (total > DUNE_IMC_CONST_MAX_SIZE)
+        throw InvalidMessageSize(total);
+
+      bfr.setSize(total);
+      uint8_t* start = bfr.getBuffer();
+      uint8_t* ptr = start + serializeHeader(msg, start, total);
+
+      const RawData* tail = NULL;
+      ptr = msg->serializeFieldsHead(ptr, tail);
+
+      uint16_t head = ptr - start;
+      uint16_t crc = Algorithms::CRC16::compute(start, head);
+      unsigned count = 0;
+
+      segs[count].data = start;
+      segs[count].size = head;
+      ++count;
+
+      if (tail != NULL && !tail->empty())
+      {
+        const uint8_t* data = (const uint8_t*)&tail->get()[0];
+        uint16_t size = tail->size();
+
+        crc = Algorithms::CRC16::compute(data, size, crc);
+        segs[count].data = data;
+        segs[count].size = size;
+        ++count;
+      }
+
+      IMC::serialize(crc, ptr);
+      segs[count].data = ptr;
+      segs[count].size = DUNE_IMC_CONST_FOOTER_SIZE;
+      ++count;
+
+      bfr.setSize(head + DUNE_IMC_CONST_FOOTER_SIZE);
+
+      return count;
+    }
+
     Message*
     Packet::deserialize(const uint8_t* bfr, uint16_t bfr_len, Message* msg)
     {
@@ -165,6 +221,12 @@ namespace DUNE
 
     uint16_t
     Packet::serializeHeader(const Message* msg, uint8_t* bfr, uint16_t bfr_len)
+    {
+      return serializeHeader(msg, msg->getPayloadSerializationSize(), bfr, bfr_len);
+    }
+
+    uint16_t
+    Packet::serializeHeader(const Message* msg, uint16_t payload_size, uint8_t* bfr, uint16_t bfr_len)
     {
       (void)bfr_len;
 
@@ -172,7 +234,7 @@ namespace DUNE
 
       ptr += IMC::serialize((uint16_t)DUNE_IMC_CONST_SYNC, ptr);
       ptr += IMC::serialize(msg->getId(), ptr);
-      ptr += IMC::serialize((uint16_t)msg->getPayloadSerializationSize(), ptr);
+      ptr += IMC::serialize(payload_size, ptr);
       ptr += IMC::serialize(msg->getTimeStamp(), ptr);
       ptr += IMC::serialize((uint16_t)msg->getSource(), ptr);
       ptr += IMC::serialize(msg->getSourceEntity(), ptr);
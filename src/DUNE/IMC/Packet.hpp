@@ -53,6 +53,18 @@ namespace DUNE
     class Packet
     {
     public:
+      //! Contiguous piece of a serialized message.
+      struct Segment
+      {
+        //! Start of data.
+        const uint8_t* data;
+        //! Number of bytes.
+        uint16_t size;
+      };
+
+      //! Maximum number of segments of a serialized message.
+      static const unsigned c_max_segments = 3;
+
       //! Serialize a message object.
       //! @param[in] msg message object.
       //! @param[out] bfr destination buffer.
@@ -76,6 +88,28 @@ namespace DUNE
       static uint16_t
       serialize(const Message* msg, std::ostream& ofs);
 
+      //! Serialize a message object to an output stream using a
+      //! caller supplied buffer for the header and fields.
+      //! @param[in] msg message object.
+      //! @param[out] bfr buffer for header and fields.
+      //! @param[out] ofs destination output stream.
+      //! @return number of bytes written to the destination output
+      //! stream.
+      static uint16_t
+      serialize(const Message* msg, Utils::ByteBuffer& bfr, std::ostream& ofs);
+
+      //! Serialize a message object for scatter-gather output. The
+      //! header, fields and footer are written to the given buffer,
+      //! but the contents of a trailing shared raw data field are
+      //! referenced in place. Segments are valid until the buffer or
+      //! the message are modified.
+      //! @param[in] msg message object.
+      //! @param[out] bfr buffer for header, fields and footer.
+      //! @param[out] segs array of at least c_max_segments segments.
+      //! @return number of segments.
+      static unsigned
+      serializeSegments(const Message* msg, Utils::ByteBuffer& bfr, Segment* segs);
+
       static Message*
       deserialize(const uint8_t* bfr, uint16_t bfr_len, Message* msg = NULL);
 
@@ -88,6 +122,16 @@ namespace DUNE
       static uint16_t
       serializeHeader(const Message* msg, uint8_t* bfr, uint16_t bfr_len);
 
+      //! Serialize the header of a message object with an explicit
+      //! payload size, for callers that write the payload themselves.
+      //! @param[in] msg message object.
+      //! @param[in] payload_size size of the payload in bytes.
+      //! @param[out] bfr destination buffer.
+      //! @param[in] bfr_len destination buffer size.
+      //! @return number of bytes written to the destination buffer.
+      static uint16_t
+      serializeHeader(const Message* msg, uint16_t payload_size, uint8_t* bfr, uint16_t bfr_len);
+
       static void
       deserializeHeader(Header& hdr, const uint8_t* bfr, uint16_t bfr_len);
 
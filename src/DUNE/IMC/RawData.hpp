@@ -0,0 +1,358 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_RAW_DATA_HPP_INCLUDED_
+#define DUNE_IMC_RAW_DATA_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Reference counted, copy-on-write storage for 'rawdata' fields.
+    //!
+    //! Copies of a RawData object, and therefore clones of the
+    //! messages holding it, share the same storage. The storage is
+    //! duplicated only when a shared object is modified. Pointers,
+    //! iterators and references obtained through non-const accessors
+    //! must not be used after the object is copied.
+    class RawData
+    {
+    public:
+      typedef std::vector<char> Vector;
+      typedef Vector::value_type value_type;
+      typedef Vector::size_type size_type;
+      typedef Vector::reference reference;
+      typedef Vector::const_reference const_reference;
+      typedef Vector::iterator iterator;
+      typedef Vector::const_iterator const_iterator;
+
+      //! Default constructor.
+      RawData(void):
+        m_block(NULL)
+      { }
+
+      //! Copy constructor, shares the storage of another object.
+      //! @param[in] other source object.
+      RawData(const RawData& other):
+        m_block(other.m_block)
+      {
+        acquire();
+      }
+
+      //! Construct from a character vector.
+      //! @param[in] data character vector.
+      RawData(const Vector& data):
+        m_block(new Block(data))
+      { }
+
+      //! Destructor.
+      ~RawData(void)
+      {
+        release();
+      }
+
+      //! Share the storage of another object.
+      //! @param[in] other source object.
+      //! @return this object.
+      RawData&
+      operator=(const RawData& other)
+      {
+        if (m_block != other.m_block)
+        {
+          release();
+          m_block = other.m_block;
+          acquire();
+        }
+
+        return *this;
+      }
+
+      //! Replace contents with a copy of a character vector.
+      //! @param[in] data character vector.
+      //! @return this object.
+      RawData&
+      operator=(const Vector& data)
+      {
+        reset() = data;
+        return *this;
+      }
+
+      //! Retrieve a read-only reference to the underlying vector.
+      //! @return character vector.
+      const Vector&
+      get(void) const
+      {
+        if (m_block == NULL)
+          return getEmpty();
+
+        return m_block->data;
+      }
+
+      //! Retrieve a modifiable reference to the underlying vector,
+      //! duplicating the storage if it is shared.
+      //! @return character vector.
+      Vector&
+      modify(void)
+      {
+        detach();
+        return m_block->data;
+      }
+
+      //! Implicit conversion to a read-only character vector.
+      operator const Vector&(void) const
+      {
+        return get();
+      }
+
+      //! Test if the storage is shared with other objects.
+      //! @return true if the storage is shared, false otherwise.
+      bool
+      isShared(void) const
+      {
+        return (m_block != NULL) && (m_block->refs.add(0) > 1);
+      }
+
+      size_type
+      size(void) const
+      {
+        return get().size();
+      }
+
+      bool
+      empty(void) const
+      {
+        return get().empty();
+      }
+
+      size_type
+      capacity(void) const
+      {
+        return get().capacity();
+      }
+
+      void
+      clear(void)
+      {
+        release();
+        m_block = NULL;
+      }
+
+      void
+      reserve(size_type size)
+      {
+        modify().reserve(size);
+      }
+
+      void
+      resize(size_type size, value_type value = value_type())
+      {
+        modify().resize(size, value);
+      }
+
+      void
+      assign(size_type count, value_type value)
+      {
+        reset().assign(count, value);
+      }
+
+      template <typename Iterator>
+      void
+      assign(Iterator first, Iterator last)
+      {
+        reset().assign(first, last);
+      }
+
+      void
+      push_back(value_type value)
+      {
+        modify().push_back(value);
+      }
+
+      iterator
+      insert(iterator position, value_type value)
+      {
+        return modify().insert(position, value);
+      }
+
+      template <typename Iterator>
+      void
+      insert(iterator position, Iterator first, Iterator last)
+      {
+        modify().insert(position, first, last);
+      }
+
+      iterator
+      erase(iterator first, iterator last)
+      {
+        return modify().erase(first, last);
+      }
+
+      void
+      swap(Vector& data)
+      {
+        modify().swap(data);
+      }
+
+      iterator
+      begin(void)
+      {
+        return modify().begin();
+      }
+
+      const_iterator
+      begin(void) const
+      {
+        return get().begin();
+      }
+
+      iterator
+      end(void)
+      {
+        return modify().end();
+      }
+
+      const_iterator
+      end(void) const
+      {
+        return get().end();
+      }
+
+      reference
+      operator[](size_type index)
+      {
+        return modify()[index];
+      }
+
+      const_reference
+      operator[](size_type index) const
+      {
+        return get()[index];
+      }
+
+      bool
+      operator==(const RawData& other) const
+      {
+        if (m_block == other.m_block)
+          return true;
+
+        return get() == other.get();
+      }
+
+      bool
+      operator!=(const RawData& other) const
+      {
+        return !(*this == other);
+      }
+
+    private:
+      //! Shared storage block.
+      struct Block
+      {
+        Block(void):
+          refs(1)
+        { }
+
+        Block(const Vector& vector):
+          refs(1),
+          data(vector)
+        { }
+
+        //! Reference count.
+        mutable Concurrency::AtomicCounter refs;
+        //! Contents.
+        Vector data;
+      };
+
+      //! Storage block or NULL if empty.
+      Block* m_block;
+
+      //! Retrieve the empty vector used when no storage is allocated.
+      //! @return empty vector.
+      static const Vector&
+      getEmpty(void)
+      {
+        static const Vector empty;
+        return empty;
+      }
+
+      void
+      acquire(void)
+      {
+        if (m_block != NULL)
+          m_block->refs.add(1);
+      }
+
+      void
+      release(void)
+      {
+        if (m_block != NULL && m_block->refs.sub(1) == 0)
+          delete m_block;
+      }
+
+      //! Make sure this object owns its storage, duplicating the
+      //! contents if needed.
+      void
+      detach(void)
+      {
+        if (m_block == NULL)
+        {
+          m_block = new Block;
+        }
+        else if (isShared())
+        {
+          Block* block = new Block(m_block->data);
+          release();
+          m_block = block;
+        }
+      }
+
+      //! Make sure this object owns its storage, discarding the
+      //! contents if it is shared.
+      //! @return character vector.
+      Vector&
+      reset(void)
+      {
+        if (isShared())
+          clear();
+
+        return modify();
+      }
+    };
+  }
+}
+
+#endif
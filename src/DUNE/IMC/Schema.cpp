@@ -0,0 +1,255 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+// DUNE headers.
+#include <DUNE/IMC/Schema.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Schema tables, built once from the generated definitions.
+    class SchemaTable
+    {
+    public:
+      SchemaTable(void)
+      {
+#define SCHEMA_MESSAGE(id, abbrev)              \
+        beginMessage(id, #abbrev);
+#define SCHEMA_FIELD(msg, abbrev, type, unit)   \
+        addField(#abbrev, Schema::type, unit);
+#include <DUNE/IMC/Schema.def>
+
+        std::sort(m_messages.begin(), m_messages.end(), compareId);
+
+        for (unsigned i = 0; i < m_messages.size(); ++i)
+        {
+          Schema::Message& msg = m_messages[i];
+          msg.fixed = true;
+          msg.fixed_size = 0;
+
+          for (unsigned j = 0; j < msg.fields.size(); ++j)
+          {
+            unsigned size = Schema::getTypeSize(msg.fields[j].type);
+            if (size == 0)
+              msg.fixed = false;
+
+            msg.fixed_size += size;
+          }
+
+          m_by_abbrev[msg.abbrev] = i;
+        }
+      }
+
+      const Schema::Message*
+      find(uint16_t id) const
+      {
+        Schema::Message key;
+        key.id = id;
+        std::vector<Schema::Message>::const_iterator itr =
+        std::lower_bound(m_messages.begin(), m_messages.end(), key, compareId);
+
+        if (itr == m_messages.end() || itr->id != id)
+          return NULL;
+
+        return &(*itr);
+      }
+
+      const Schema::Message*
+      find(const std::string& abbrev) const
+      {
+        std::map<std::string, unsigned>::const_iterator itr = m_by_abbrev.find(abbrev);
+        if (itr == m_by_abbrev.end())
+          return NULL;
+
+        return &m_messages[itr->second];
+      }
+
+      const std::vector<Schema::Message>&
+      getMessages(void) const
+      {
+        return m_messages;
+      }
+
+    private:
+      //! Message descriptions sorted by identification number.
+      std::vector<Schema::Message> m_messages;
+      //! Index of message descriptions by abbreviation.
+      std::map<std::string, unsigned> m_by_abbrev;
+
+      static bool
+      compareId(const Schema::Message& a, const Schema::Message& b)
+      {
+        return a.id < b.id;
+      }
+
+      void
+      beginMessage(uint16_t id, const char* abbrev)
+      {
+        m_messages.push_back(Schema::Message());
+        m_messages.back().id = id;
+        m_messages.back().abbrev = abbrev;
+        m_messages.back().fixed = true;
+        m_messages.back().fixed_size = 0;
+      }
+
+      void
+      addField(const char* abbrev, Schema::FieldType type, const char* unit)
+      {
+        Schema::Field field;
+        field.abbrev = abbrev;
+        field.type = type;
+        field.unit = unit;
+        m_messages.back().fields.push_back(field);
+      }
+    };
+
+    static const SchemaTable&
+    getTable(void)
+    {
+      static SchemaTable table;
+      return table;
+    }
+
+    const Schema::Message*
+    Schema::find(uint16_t id)
+    {
+      return getTable().find(id);
+    }
+
+    const Schema::Message*
+    Schema::find(const std::string& abbrev)
+    {
+      return getTable().find(abbrev);
+    }
+
+    int
+    Schema::findField(const Message* msg, const std::string& abbrev)
+    {
+      for (unsigned i = 0; i < msg->fields.size(); ++i)
+      {
+        if (abbrev == msg->fields[i].abbrev)
+          return (int)i;
+      }
+
+      return -1;
+    }
+
+    unsigned
+    Schema::getTypeSize(FieldType type)
+    {
+      switch (type)
+      {
+        case TYPE_UINT8:
+        case TYPE_INT8:
+          return 1;
+        case TYPE_UINT16:
+        case TYPE_INT16:
+          return 2;
+        case TYPE_UINT32:
+        case TYPE_INT32:
+        case TYPE_FP32:
+          return 4;
+        case TYPE_INT64:
+        case TYPE_FP64:
+          return 8;
+        default:
+          return 0;
+      }
+    }
+
+    //! Read a native 16-bit value of a serialized payload.
+    static uint16_t
+    readSize(const uint8_t*& ptr, const uint8_t* end)
+    {
+      if (end - ptr < 2)
+        throw BufferTooShort();
+
+      uint16_t value;
+      std::memcpy(&value, ptr, sizeof(value));
+      ptr += sizeof(value);
+      return value;
+    }
+
+    const uint8_t*
+    Schema::skip(const Field& field, const uint8_t* ptr, const uint8_t* end)
+    {
+      unsigned size = getTypeSize(field.type);
+      if (size == 0)
+      {
+        if (field.type == TYPE_RAWDATA || field.type == TYPE_PLAINTEXT)
+        {
+          size = readSize(ptr, end);
+        }
+        else
+        {
+          // Inline messages start with the identifier, lists with the
+          // number of messages.
+          unsigned count = 1;
+          if (field.type == TYPE_MESSAGE_LIST)
+            count = readSize(ptr, end);
+
+          for (unsigned i = 0; i < count; ++i)
+          {
+            uint16_t id = readSize(ptr, end);
+            if (id == DUNE_IMC_CONST_NULL_ID)
+              continue;
+
+            const Message* msg = find(id);
+            if (msg == NULL)
+              throw InvalidMessageId(id);
+
+            for (unsigned j = 0; j < msg->fields.size(); ++j)
+              ptr = skip(msg->fields[j], ptr, end);
+          }
+
+          return ptr;
+        }
+      }
+
+      if ((unsigned)(end - ptr) < size)
+        throw BufferTooShort();
+
+      return ptr + size;
+    }
+
+    const std::vector<Schema::Message>&
+    Schema::getMessages(void)
+    {
+      return getTable().getMessages();
+    }
+  }
+}
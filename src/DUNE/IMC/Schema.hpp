@@ -0,0 +1,140 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_SCHEMA_HPP_INCLUDED_
+#define DUNE_IMC_SCHEMA_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Schema;
+
+    //! Run-time description of the field layout of every IMC message,
+    //! generated from the same specification as the message classes.
+    class Schema
+    {
+    public:
+      //! Field types.
+      enum FieldType
+      {
+        TYPE_UINT8,
+        TYPE_INT8,
+        TYPE_UINT16,
+        TYPE_INT16,
+        TYPE_UINT32,
+        TYPE_INT32,
+        TYPE_INT64,
+        TYPE_FP32,
+        TYPE_FP64,
+        TYPE_RAWDATA,
+        TYPE_PLAINTEXT,
+        TYPE_MESSAGE,
+        TYPE_MESSAGE_LIST
+      };
+
+      //! Field description.
+      struct Field
+      {
+        //! Field abbreviation.
+        const char* abbrev;
+        //! Field type.
+        FieldType type;
+        //! Field unit, empty if none.
+        const char* unit;
+      };
+
+      //! Message description.
+      struct Message
+      {
+        //! Message identification number.
+        uint16_t id;
+        //! Message abbreviation.
+        const char* abbrev;
+        //! Fields in serialization order.
+        std::vector<Field> fields;
+        //! True if every field has a fixed size.
+        bool fixed;
+        //! Serialized payload size if the message is fixed, size of
+        //! the fixed-size fields otherwise.
+        unsigned fixed_size;
+      };
+
+      //! Retrieve the description of a message.
+      //! @param id message identification number.
+      //! @return message description or NULL if the message is unknown.
+      static const Message*
+      find(uint16_t id);
+
+      //! Retrieve the description of a message.
+      //! @param abbrev message abbreviation.
+      //! @return message description or NULL if the message is unknown.
+      static const Message*
+      find(const std::string& abbrev);
+
+      //! Retrieve the index of a field.
+      //! @param msg message description.
+      //! @param abbrev field abbreviation.
+      //! @return field index or -1 if the field does not exist.
+      static int
+      findField(const Message* msg, const std::string& abbrev);
+
+      //! Retrieve the serialized size of a field type.
+      //! @param type field type.
+      //! @return size in bytes or zero if the type has variable size.
+      static unsigned
+      getTypeSize(FieldType type);
+
+      //! Advance past a field of a serialized payload.
+      //! @param field field description.
+      //! @param ptr start of the field.
+      //! @param end end of the payload.
+      //! @return start of the next field.
+      //! @throw BufferTooShort if the field exceeds the payload.
+      static const uint8_t*
+      skip(const Field& field, const uint8_t* ptr, const uint8_t* end);
+
+      //! Retrieve all message descriptions, sorted by identification
+      //! number.
+      //! @return message descriptions.
+      static const std::vector<Message>&
+      getMessages(void);
+    };
+  }
+}
+
+#endif
@@ -129,5 +129,41 @@ namespace DUNE
 
       return s + 2;
     }
+
+    uint16_t
+    deserialize(RawData& t, const uint8_t* bfr, uint16_t& bfr_len)
+    {
+      if (bfr_len < 2)
+        throw BufferTooShort();
+
+      uint16_t s = 0;
+      std::memcpy(&s, bfr, 2);
+
+      if (bfr_len < s + 2)
+        throw BufferTooShort();
+
+      t.assign((const char*)(bfr + 2), (const char*)(bfr + 2 + s));
+      bfr_len -= s + 2;
+
+      return s + 2;
+    }
+
+    uint16_t
+    reverseDeserialize(RawData& t, const uint8_t* bfr, uint16_t& bfr_len)
+    {
+      if (bfr_len < 2)
+        throw BufferTooShort();
+
+      uint16_t s = 0;
+      Utils::reverseCopy(s, (char*)bfr);
+
+      if (bfr_len < s + 2)
+        throw BufferTooShort();
+
+      t.assign((const char*)(bfr + 2), (const char*)(bfr + 2 + s));
+      bfr_len -= s + 2;
+
+      return s + 2;
+    }
   }
 }
@@ -40,6 +40,7 @@
 #include <DUNE/IMC/Exceptions.hpp>
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/RawData.hpp>
 
 namespace DUNE
 {
@@ -65,6 +66,16 @@ namespace DUNE
       return static_cast<unsigned>(variable.size()) + 2;
     }
 
+    //! Retrieve the number of bytes required to serialize a shared
+    //! variable of type 'rawdata'.
+    //! @param[in] variable variable.
+    //! @return number of bytes required to serialize variable.
+    inline unsigned
+    getSerializationSize(const RawData& variable)
+    {
+      return static_cast<unsigned>(variable.size()) + 2;
+    }
+
     //! Serializator for scalar types.
     //! @param t scalar to serialize.
     //! @param bfr buffer where to place the serialized bytes.
@@ -109,6 +120,12 @@ namespace DUNE
     uint16_t
     serialize(const std::vector<char>& t, uint8_t* bfr);
 
+    inline uint16_t
+    serialize(const RawData& t, uint8_t* bfr)
+    {
+      return serialize(t.get(), bfr);
+    }
+
     //! Deserializator for scalar types.
     //! @param t scalar where to place the unserialized bytes.
     //! @param bfr buffer where to read the serialized bytes.
@@ -148,6 +165,40 @@ namespace DUNE
     uint16_t
     deserialize(std::vector<char>& t, const uint8_t* bfr, uint16_t& length);
 
+    //! Deserializator for shared raw data objects.
+    //! @param t raw data object where to place the deserialized bytes.
+    //! @param bfr buffer where to read the serialized bytes.
+    //! @param length amount of bytes available to deserialize.
+    //! @return number of deserialized bytes.
+    //! @throw BufferTooShort
+    uint16_t
+    deserialize(RawData& t, const uint8_t* bfr, uint16_t& length);
+
+    //! Unchecked deserializator for scalar types, used by messages
+    //! whose whole payload is bounds checked at once.
+    //! @param t scalar where to place the unserialized bytes.
+    //! @param bfr buffer where to read the serialized bytes.
+    template <typename Type>
+    inline void
+    load(Type& t, const uint8_t* bfr)
+    {
+      std::memcpy(&t, bfr, sizeof(Type));
+    }
+
+    //! Unchecked deserializator for scalar types with a different
+    //! byte order.
+    //! @param t scalar where to place the unserialized bytes.
+    //! @param bfr buffer where to read the serialized bytes.
+    template <typename Type>
+    inline void
+    reverseLoad(Type& t, const uint8_t* bfr)
+    {
+      uint8_t tmp[sizeof(Type)];
+      for (unsigned i = 0; i < sizeof(Type); ++i)
+        tmp[i] = bfr[sizeof(Type) - 1 - i];
+      std::memcpy(&t, tmp, sizeof(Type));
+    }
+
     //! Deserialize a numeric field with a different byte.
     //! @param t variable where to place the unserialized result.
     //! @param bfr buffer where to read the serialized bytes.
@@ -174,6 +225,9 @@ namespace DUNE
 
     uint16_t
     reverseDeserialize(std::vector<char>& t, const uint8_t* bfr, uint16_t& length);
+
+    uint16_t
+    reverseDeserialize(RawData& t, const uint8_t* bfr, uint16_t& length);
   }
 }
 
@@ -104,6 +104,20 @@ namespace DUNE
         return read(reinterpret_cast<uint8_t*>(data), length);
       }
 
+      //! Read binary data from I/O handle along with its time of
+      //! arrival, for handles that know it (e.g., sockets with
+      //! kernel timestamps enabled).
+      //! @param[in] data data buffer.
+      //! @param[in] length number of bytes to read.
+      //! @param[in,out] tstamp time of arrival (s since epoch); left
+      //! untouched if the handle does not know it.
+      //! @return number of bytes read.
+      size_t
+      readTimestamped(uint8_t* data, size_t length, double& tstamp)
+      {
+        return doReadTimestamped(data, length, tstamp);
+      }
+
       //! Read C-style string from I/O handle.
       //! @param[in] bfr data buffer.
       //! @param[in] length capacity of the data buffer.
@@ -155,6 +169,13 @@ namespace DUNE
       virtual size_t
       doRead(uint8_t* data, size_t data_size) = 0;
 
+      virtual size_t
+      doReadTimestamped(uint8_t* data, size_t data_size, double& tstamp)
+      {
+        (void)tstamp;
+        return doRead(data, data_size);
+      }
+
       virtual void
       doFlushInput(void)
       { }
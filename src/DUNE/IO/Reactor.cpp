@@ -0,0 +1,494 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IO/Poll.hpp>
+#include <DUNE/IO/Reactor.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1)
+#  include <sys/epoll.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace IO
+  {
+    //! Size of reads from handles.
+    static const size_t c_read_size = 4096;
+    //! Default raw input capacity (bytes).
+    static const size_t c_raw_capacity = 65536;
+    //! Default maximum number of queued frames.
+    static const size_t c_max_frames = 256;
+    //! Maximum number of events processed per wake-up.
+    static const int c_max_events = 32;
+    //! Wait timeout, bounds the time needed to stop (s).
+    static const double c_wait_timeout = 0.1;
+
+    Reactor::Channel::Channel(Handle& handle, Framer* framer, Listener* listener, size_t capacity):
+      m_handle(handle),
+      m_framer(framer),
+      m_listener(listener),
+      m_frame_tstamp(0),
+      m_capacity(capacity),
+      m_head(0),
+      m_size(0),
+      m_buffer(c_read_size),
+      m_overruns(0),
+      m_polled(true)
+    {
+      if (m_capacity == 0)
+        m_capacity = (m_framer == NULL) ? c_raw_capacity : c_max_frames;
+
+      if (m_framer == NULL)
+        m_ring.resize(m_capacity);
+    }
+
+    bool
+    Reactor::Channel::wait(double timeout)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      // Condition::wait() treats zero as forever.
+      if (m_frames.empty() && m_size == 0 && m_error.empty() && timeout > 0)
+        m_cond.wait(timeout);
+
+      return !m_frames.empty() || m_size > 0 || !m_error.empty();
+    }
+
+    bool
+    Reactor::Channel::pop(std::vector<uint8_t>& frame, double& tstamp)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (m_frames.empty())
+        return false;
+
+      frame.swap(m_frames.front().data);
+      tstamp = m_frames.front().tstamp;
+      m_frames.pop_front();
+      return true;
+    }
+
+    size_t
+    Reactor::Channel::read(uint8_t* data, size_t size, double& tstamp)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (m_segments.empty())
+        return 0;
+
+      Segment& seg = m_segments.front();
+      size_t count = std::min(size, seg.size);
+      size_t first = std::min(count, m_ring.size() - m_head);
+      std::memcpy(data, &m_ring[m_head], first);
+      std::memcpy(data + first, &m_ring[0], count - first);
+
+      m_head = (m_head + count) % m_ring.size();
+      m_size -= count;
+      tstamp = seg.tstamp;
+
+      seg.size -= count;
+      if (seg.size == 0)
+        m_segments.pop_front();
+
+      return count;
+    }
+
+    bool
+    Reactor::Channel::hasError(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return !m_error.empty();
+    }
+
+    std::string
+    Reactor::Channel::getError(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_error;
+    }
+
+    unsigned
+    Reactor::Channel::getOverruns(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_overruns;
+    }
+
+    void
+    Reactor::Channel::store(const uint8_t* data, size_t size, double tstamp)
+    {
+      size_t capacity = m_ring.size();
+
+      // Only the newest bytes of an oversized read fit.
+      if (size > capacity)
+      {
+        m_overruns += size - capacity;
+        data += size - capacity;
+        size = capacity;
+      }
+
+      // Drop oldest reads to make room.
+      while (m_size + size > capacity)
+      {
+        Segment& seg = m_segments.front();
+        size_t count = std::min(seg.size, m_size + size - capacity);
+        m_head = (m_head + count) % capacity;
+        m_size -= count;
+        m_overruns += count;
+
+        seg.size -= count;
+        if (seg.size == 0)
+          m_segments.pop_front();
+      }
+
+      size_t tail = (m_head + m_size) % capacity;
+      size_t first = std::min(size, capacity - tail);
+      std::memcpy(&m_ring[tail], data, first);
+      std::memcpy(&m_ring[0], data + first, size - first);
+      m_size += size;
+
+      Segment seg;
+      seg.size = size;
+      seg.tstamp = tstamp;
+      m_segments.push_back(seg);
+    }
+
+    bool
+    Reactor::Channel::receive(double tstamp)
+    {
+      size_t rv = 0;
+
+      try
+      {
+        rv = m_handle.readTimestamped(&m_buffer[0], m_buffer.size(), tstamp);
+      }
+      catch (std::exception& e)
+      {
+        fail(e.what());
+        return false;
+      }
+
+      // Zero means end of file, larger than requested means error.
+      if (rv == 0 || rv > m_buffer.size())
+      {
+        fail(rv == 0 ? "end of input" : System::Error::getLastMessage());
+        return false;
+      }
+
+      bool queued = false;
+
+      m_cond.lock();
+
+      if (m_framer == NULL)
+      {
+        store(&m_buffer[0], rv, tstamp);
+        queued = true;
+      }
+      else
+      {
+        for (size_t i = 0; i < rv; ++i)
+        {
+          // A frame arrives with its first byte.
+          if (m_frame.empty())
+            m_frame_tstamp = tstamp;
+
+          if (!m_framer->parse(m_buffer[i], m_frame))
+            continue;
+
+          if (m_frames.size() == m_capacity)
+          {
+            m_frames.pop_front();
+            ++m_overruns;
+          }
+
+          m_frames.push_back(Frame());
+          m_frames.back().data.swap(m_frame);
+          m_frames.back().tstamp = m_frame_tstamp;
+          m_frame.clear();
+          queued = true;
+        }
+      }
+
+      if (queued)
+        m_cond.broadcast();
+
+      m_cond.unlock();
+
+      if (queued)
+        notify();
+
+      return true;
+    }
+
+    void
+    Reactor::Channel::fail(const std::string& error)
+    {
+      m_cond.lock();
+      m_error = error;
+      m_cond.broadcast();
+      m_cond.unlock();
+
+      notify();
+    }
+
+    void
+    Reactor::Channel::notify(void)
+    {
+      if (m_listener != NULL)
+        m_listener->onInput(*this);
+    }
+
+    Reactor::Reactor(void):
+      m_next_id(0),
+      m_active(NULL),
+      m_active_removed(false),
+      m_epoll(-1)
+    {
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1)
+      m_epoll = epoll_create1(EPOLL_CLOEXEC);
+      if (m_epoll < 0)
+        throw System::Error("creating epoll instance", System::Error::getLastMessage());
+#endif
+    }
+
+    Reactor::~Reactor(void)
+    {
+      if (isCreated() && !isDead())
+        stopAndJoin();
+
+      std::map<uint64_t, Channel*>::iterator itr = m_channels.begin();
+      for (; itr != m_channels.end(); ++itr)
+        delete itr->second;
+
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1)
+      close(m_epoll);
+#endif
+    }
+
+    Reactor::Channel*
+    Reactor::add(Handle& handle, Framer* framer, Listener* listener, size_t capacity)
+    {
+      Concurrency::ScopedCondition l(m_lock);
+
+      Channel* channel = new Channel(handle, framer, listener, capacity);
+      uint64_t id = m_next_id++;
+
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1)
+      epoll_event evt;
+      std::memset(&evt, 0, sizeof(evt));
+      evt.events = EPOLLIN;
+      evt.data.u64 = id;
+
+      if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, handle.getNative(), &evt) < 0)
+      {
+        delete channel;
+        throw System::Error("registering handle", System::Error::getLastMessage());
+      }
+#endif
+
+      m_channels[id] = channel;
+      return channel;
+    }
+
+    void
+    Reactor::remove(Channel* channel)
+    {
+      Concurrency::ScopedCondition l(m_lock);
+
+      std::map<uint64_t, Channel*>::iterator itr = m_channels.begin();
+      for (; itr != m_channels.end(); ++itr)
+      {
+        if (itr->second != channel)
+          continue;
+
+        m_channels.erase(itr);
+        unpoll(channel);
+
+        if (channel == m_active)
+        {
+          // Removed by its own listener, released by service().
+          if (isCurrent())
+          {
+            m_active_removed = true;
+            return;
+          }
+
+          while (m_active == channel)
+            m_lock.wait();
+        }
+
+        delete channel;
+        return;
+      }
+    }
+
+    Reactor&
+    Reactor::get(void)
+    {
+      static Reactor reactor;
+      static Concurrency::Mutex mutex;
+
+      Concurrency::ScopedMutex l(mutex);
+      if (!reactor.isCreated())
+        reactor.start();
+
+      return reactor;
+    }
+
+    void
+    Reactor::poll(void)
+    {
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1)
+      epoll_event events[c_max_events];
+      int rv = epoll_wait(m_epoll, events, c_max_events, (int)(c_wait_timeout * 1000));
+
+      // Take the time of arrival before anything else.
+      double tstamp = Time::Clock::getSinceEpoch();
+
+      if (rv < 0)
+      {
+        if (errno == EINTR)
+          return;
+
+        throw System::Error("waiting for input", System::Error::getLastMessage());
+      }
+
+      for (int i = 0; i < rv; ++i)
+        service(events[i].data.u64, tstamp);
+
+#else
+      Poll poll;
+      std::vector<std::pair<uint64_t, NativeHandle> > handles;
+
+      m_lock.lock();
+      std::map<uint64_t, Channel*>::iterator itr = m_channels.begin();
+      for (; itr != m_channels.end(); ++itr)
+      {
+        if (itr->second->m_polled)
+        {
+          handles.push_back(std::make_pair(itr->first, itr->second->m_handle.getNative()));
+          poll.add(handles.back().second);
+        }
+      }
+      m_lock.unlock();
+
+      if (handles.empty())
+      {
+        Time::Delay::wait(c_wait_timeout);
+        return;
+      }
+
+      if (!poll.poll(c_wait_timeout))
+        return;
+
+      double tstamp = Time::Clock::getSinceEpoch();
+
+      for (size_t i = 0; i < handles.size(); ++i)
+      {
+        if (poll.wasTriggered(handles[i].second))
+          service(handles[i].first, tstamp);
+      }
+#endif
+    }
+
+    void
+    Reactor::service(uint64_t id, double tstamp)
+    {
+      Channel* channel = NULL;
+
+      {
+        Concurrency::ScopedCondition l(m_lock);
+
+        // The channel may have been removed meanwhile.
+        std::map<uint64_t, Channel*>::iterator itr = m_channels.find(id);
+        if (itr == m_channels.end() || !itr->second->m_polled)
+          return;
+
+        channel = itr->second;
+        m_active = channel;
+      }
+
+      bool ok = channel->receive(tstamp);
+
+      Concurrency::ScopedCondition l(m_lock);
+      m_active = NULL;
+      m_lock.broadcast();
+
+      if (m_active_removed)
+      {
+        m_active_removed = false;
+        delete channel;
+        return;
+      }
+
+      // Removed channels were already unpolled.
+      if (!ok)
+        unpoll(channel);
+    }
+
+    void
+    Reactor::unpoll(Channel* channel)
+    {
+      if (!channel->m_polled)
+        return;
+
+      channel->m_polled = false;
+
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1)
+      epoll_ctl(m_epoll, EPOLL_CTL_DEL, channel->m_handle.getNative(), NULL);
+#endif
+    }
+
+    void
+    Reactor::run(void)
+    {
+      while (!isStopping())
+        poll();
+    }
+  }
+}
@@ -0,0 +1,335 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IO_REACTOR_HPP_INCLUDED_
+#define DUNE_IO_REACTOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Reactor;
+
+    //! Event-driven reader of I/O handles.
+    //!
+    //! A single thread waits for input on all registered handles
+    //! (using epoll where available), timestamps data as soon as the
+    //! kernel reports it, reads it into a per-handle channel and
+    //! runs the channel's framer before waking its owner. Owners
+    //! either wait on the channel or register a listener that is
+    //! called from the reactor thread.
+    //!
+    //! The time of arrival is the time at which the reactor woke up
+    //! for the handle, or the kernel receive time for handles that
+    //! provide one (see IO::Handle::readTimestamped()).
+    class Reactor: public Concurrency::Thread
+    {
+    public:
+      class Channel;
+
+      //! Incremental frame extractor.
+      class Framer
+      {
+      public:
+        virtual
+        ~Framer(void)
+        { }
+
+        //! Parse one byte.
+        //! @param[in] byte received byte.
+        //! @param[in,out] frame frame under construction; framers
+        //! append bytes and clear it when they lose synchronization.
+        //! @return true if frame now holds a complete frame.
+        virtual bool
+        parse(uint8_t byte, std::vector<uint8_t>& frame) = 0;
+      };
+
+      //! Framer of delimiter-terminated lines (e.g., NMEA sentences).
+      class LineFramer: public Framer
+      {
+      public:
+        //! Constructor.
+        //! @param[in] term line terminator, included in frames.
+        //! @param[in] max_size maximum line length, longer lines are
+        //! discarded.
+        LineFramer(char term = '\n', size_t max_size = 1024):
+          m_term((uint8_t)term),
+          m_max_size(max_size)
+        { }
+
+        bool
+        parse(uint8_t byte, std::vector<uint8_t>& frame)
+        {
+          frame.push_back(byte);
+          if (byte == m_term)
+            return true;
+
+          if (frame.size() >= m_max_size)
+            frame.clear();
+
+          return false;
+        }
+
+      private:
+        //! Line terminator.
+        uint8_t m_term;
+        //! Maximum line length.
+        size_t m_max_size;
+      };
+
+      //! Channel event listener.
+      class Listener
+      {
+      public:
+        virtual
+        ~Listener(void)
+        { }
+
+        //! Called from the reactor thread when new data or frames
+        //! were queued in the channel or when an error occurred.
+        //! The reactor is not locked, so implementations may add and
+        //! remove channels, including their own. They must not block,
+        //! in particular on a thread that is removing this channel.
+        //! @param[in] channel channel.
+        virtual void
+        onInput(Channel& channel) = 0;
+      };
+
+      //! Input of a registered handle.
+      class Channel
+      {
+      public:
+        //! Wait for input or an error.
+        //! @param[in] timeout maximum amount of time to wait (s).
+        //! @return true if input is available or an error occurred,
+        //! false on timeout.
+        bool
+        wait(double timeout);
+
+        //! Retrieve the oldest frame (framed channels only).
+        //! @param[out] frame frame bytes.
+        //! @param[out] tstamp time of arrival of the first byte of
+        //! the frame (s since epoch).
+        //! @return true if a frame was retrieved.
+        bool
+        pop(std::vector<uint8_t>& frame, double& tstamp);
+
+        //! Read received bytes (raw channels only). Reads stop at the
+        //! boundary of a read from the handle, so that all returned
+        //! bytes share the same time of arrival.
+        //! @param[out] data buffer.
+        //! @param[in] size buffer capacity.
+        //! @param[out] tstamp time of arrival (s since epoch).
+        //! @return number of bytes read.
+        size_t
+        read(uint8_t* data, size_t size, double& tstamp);
+
+        //! Test if reading from the handle failed. Failed channels
+        //! are no longer polled.
+        //! @return true if an error occurred.
+        bool
+        hasError(void);
+
+        //! Get the error that stopped the channel.
+        //! @return error message.
+        std::string
+        getError(void);
+
+        //! Get number of frames (framed channels) or bytes (raw
+        //! channels) dropped because the owner did not keep up.
+        //! @return number of dropped frames or bytes.
+        unsigned
+        getOverruns(void);
+
+        //! Get the I/O handle.
+        //! @return I/O handle.
+        Handle&
+        getHandle(void)
+        {
+          return m_handle;
+        }
+
+      private:
+        //! Frame and its time of arrival.
+        struct Frame
+        {
+          std::vector<uint8_t> data;
+          double tstamp;
+        };
+
+        //! Bytes of a read from the handle still in the ring buffer.
+        struct Segment
+        {
+          size_t size;
+          double tstamp;
+        };
+
+        //! I/O handle.
+        Handle& m_handle;
+        //! Framer or NULL.
+        Framer* m_framer;
+        //! Listener or NULL.
+        Listener* m_listener;
+        //! Lock and signal of the input queues.
+        Concurrency::Condition m_cond;
+        //! Complete frames.
+        std::deque<Frame> m_frames;
+        //! Frame under construction.
+        std::vector<uint8_t> m_frame;
+        //! Time of arrival of the frame under construction.
+        double m_frame_tstamp;
+        //! Maximum number of queued frames or bytes.
+        size_t m_capacity;
+        //! Ring buffer of raw input.
+        std::vector<uint8_t> m_ring;
+        //! Index of the first byte in the ring buffer.
+        size_t m_head;
+        //! Number of bytes in the ring buffer.
+        size_t m_size;
+        //! Reads in the ring buffer.
+        std::deque<Segment> m_segments;
+        //! Read buffer.
+        std::vector<uint8_t> m_buffer;
+        //! Error message.
+        std::string m_error;
+        //! Number of dropped frames or bytes.
+        unsigned m_overruns;
+        //! True while the handle is polled (reactor lock).
+        bool m_polled;
+
+        Channel(Handle& handle, Framer* framer, Listener* listener, size_t capacity);
+
+        //! Read available input from the handle.
+        //! @param[in] tstamp time at which the handle became readable.
+        //! @return false if the channel failed.
+        bool
+        receive(double tstamp);
+
+        //! Append bytes to the ring buffer.
+        void
+        store(const uint8_t* data, size_t size, double tstamp);
+
+        //! Mark the channel as failed.
+        void
+        fail(const std::string& error);
+
+        //! Notify owner.
+        void
+        notify(void);
+
+        friend class Reactor;
+      };
+
+      //! Constructor.
+      Reactor(void);
+
+      //! Destructor. Stops the reactor and releases all channels.
+      ~Reactor(void);
+
+      //! Register a handle. The handle, framer and listener must
+      //! outlive the channel.
+      //! @param[in] handle I/O handle.
+      //! @param[in] framer framer or NULL for raw input.
+      //! @param[in] listener listener or NULL.
+      //! @param[in] capacity capacity of the raw input ring buffer
+      //! (bytes) or maximum number of queued frames.
+      //! @return channel.
+      Channel*
+      add(Handle& handle, Framer* framer = NULL, Listener* listener = NULL, size_t capacity = 0);
+
+      //! Unregister a handle and release its channel. Once this
+      //! returns, the reactor no longer touches the handle or calls
+      //! the channel's listener. If called from the channel's own
+      //! listener, the channel is released when the listener returns.
+      //! @param[in] channel channel.
+      void
+      remove(Channel* channel);
+
+      //! Get the process-wide reactor, starting it on first use.
+      //! @return reactor.
+      static Reactor&
+      get(void);
+
+    private:
+      //! Registered channels by registration number.
+      std::map<uint64_t, Channel*> m_channels;
+      //! Registration number of the next channel.
+      uint64_t m_next_id;
+      //! Lock protecting the channel table, signaled when the
+      //! reactor is done with a channel.
+      Concurrency::Condition m_lock;
+      //! Channel being read, outside the lock.
+      Channel* m_active;
+      //! True if the active channel was removed by its listener.
+      bool m_active_removed;
+      //! epoll instance (-1 if not used).
+      int m_epoll;
+
+      void
+      run(void);
+
+      //! Wait for input and process it.
+      void
+      poll(void);
+
+      //! Read input of a channel. The channel is read and its
+      //! listener called without holding the reactor lock.
+      //! @param[in] id registration number of the channel.
+      //! @param[in] tstamp time at which the handle became readable.
+      void
+      service(uint64_t id, double tstamp);
+
+      //! Stop polling the handle of a channel. The reactor lock
+      //! must be held.
+      //! @param[in] channel channel.
+      void
+      unpoll(Channel* channel);
+
+      Reactor(const Reactor&);
+
+      Reactor&
+      operator=(const Reactor&);
+    };
+  }
+}
+
+#endif
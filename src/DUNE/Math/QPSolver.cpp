@@ -55,57 +55,36 @@ namespace DUNE
 {
   namespace Math
   {
-    // Template class just to encapsulate operator() in access to a std::vector
-    // (for pedantic syntactic sugar in consistencty with DUNE::Math::Matrix
-    //  and DUNE::Math::Matrix)
-    template <typename T>
-    class tvector: public std::vector<T>
-    {
-    public:
-      tvector(size_t n):
-        std::vector<T>(n)
-      { }
-
-      inline T&
-      operator()(size_t index)
-      {
-        return std::vector<T>::operator[](index);
-      }
-
-      inline const T&
-      operator()(size_t index) const
-      {
-        return std::vector<T>::operator[](index);
-      }
-    };
+    // Utility functions, operating on row-major arrays.
+    static double
+    dot(const double* a, const double* b, int n);
 
-    // Utility functions
     static void
-    compute_d(Matrix& d, const Matrix& J, const Matrix& np);
+    compute_d(double* d, const double* J, const double* np, int n);
 
     static void
-    update_z(Matrix& z, const Matrix& J, const Matrix& d, int iq);
+    update_z(double* z, const double* J, const double* d, int n, int iq);
 
     static void
-    update_r(const Matrix& R, Matrix& r, const Matrix& d, int iq);
+    update_r(const double* R, double* r, const double* d, int n, int iq);
 
     static bool
-    add_constraint(Matrix& R, Matrix& J, Matrix& d, int& iq, double& rnorm);
+    add_constraint(double* R, double* J, double* d, int n, int& iq, double& rnorm);
 
     static void
-    delete_constraint(Matrix& R, Matrix& J, tvector<int>& A, Matrix& u, int n, int p, int& iq, int l);
+    delete_constraint(double* R, double* J, int* A, double* u, int n, int p, int& iq, int l);
 
     static void
-    cholesky_decomposition(Matrix& A);
+    cholesky_decomposition(double* A, int n);
 
     static void
-    cholesky_solve(const Matrix& L, Matrix& x, const Matrix& b);
+    cholesky_solve(const double* L, double* x, const double* b, double* y, int n);
 
     static void
-    forward_elimination(const Matrix& L, Matrix& y, const Matrix& b);
+    forward_elimination(const double* L, double* y, const double* b, int n);
 
     static void
-    backward_elimination(const Matrix& U, Matrix& x, const Matrix& y);
+    backward_elimination(const double* U, double* x, const double* y, int n);
 
     static double
     distance(double a, double b);
@@ -113,135 +92,215 @@ namespace DUNE
 #ifdef __QPDBG__
     // Utility functions for printing vectors and matrices
     static void
-    print_matrix(const char* name, const Matrix& A, int n = -1, int m = -1);
+    print_matrix(const char* name, const double* A, int n, int m);
 
     template <typename T>
     static void
-    print_vector(const char* name, const tvector<T>& v, int n = -1);
+    print_vector(const char* name, const T* v, int n);
+#endif
 
-    static void
-    print_vector(const char* name, const Matrix& v, int n = -1)
+    //! Solver workspace. All storage is allocated on construction.
+    struct QPSolver::Workspace
     {
-      std::cout << name << ": " << v << std::endl;
-    }
+      //! Number of variables.
+      int n;
+      //! Number of equality constraints.
+      int p;
+      //! Number of inequality constraints.
+      int m;
+      //! Problem data.
+      std::vector<double> H, f, Aeq, beq, A, b;
+      //! Cholesky factor of H and initial value of J.
+      std::vector<double> L, J0;
+      //! Working matrices.
+      std::vector<double> R, J;
+      //! Working vectors.
+      std::vector<double> x, x_old, s, z, r, d, np, u, u_old, y;
+      //! Active set and related bookkeeping.
+      std::vector<int> Aset, Aset_old, iai;
+      std::vector<uint8_t> iaexcl;
+      //! Inequality constraints active at the previous solution.
+      std::vector<int> hint;
+      //! Number of entries in hint.
+      int nhint;
+      //! Condition number estimate factors.
+      double c1, c2;
+      //! True if L, J0, c1 and c2 correspond to H.
+      bool factored;
+      //! True to warm start from previous active set.
+      bool warm;
+      //! Number of iterations of last run.
+      unsigned iterations;
+
+      Workspace(int n_, int p_, int m_):
+        n(n_), p(p_), m(m_),
+        H(n * n), f(n), Aeq(p * n + 1), beq(p + 1), A(m * n + 1), b(m + 1),
+        L(n * n), J0(n * n), R(n * n), J(n * n),
+        x(n), x_old(n), s(m + p + 1), z(n), r(m + p + 1), d(n), np(n),
+        u(m + p + 1), u_old(m + p + 1), y(n),
+        Aset(m + p + 1), Aset_old(m + p + 1), iai(m + p + 1),
+        iaexcl(m + p + 1), hint(m + 1), nhint(0),
+        c1(0), c2(0), factored(false), warm(false), iterations(0)
+      { }
 
-#endif
+      //! Validate dimensions of the problem matrices.
+      void
+      validate(const Matrix& H_, const Matrix& f_, const Matrix& Aeq_, const Matrix& beq_, const Matrix& A_, const Matrix& b_) const
+      {
+        if (!H_.isSquare())
+          throw Error("'H' is not a square matrix");
 
-    double
-    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x)
-    {
-      // Zero-size matrix and vector
-      Matrix Aeq;
-      Matrix beq;
-      return solve(H, f, Aeq, beq, A, b, x);
-    }
+        if (H_.columns() != n)
+          throw Error("'H' has an invalid size");
 
-    double
-    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x)
-    {
-      // Validate parameter dimensions
-      // n: number of vars
-      // p: number of equality constraints
-      // m: number of inequality constraints
-      int n = H.columns();
-      int p = Aeq.rows();
-      int m = A.rows();
+        if (f_.size() != n)
+          throw Error("'f' has an invalid size");
 
-      if (!H.isSquare())
-        throw Error("'H' is not a square matrix");
+        if (A_.rows() != m || (m > 0 && A_.columns() != n))
+          throw Error("'A' has an invalid number of rows");
+
+        if (m > 0 && !b_.isColumnVector(m))
+          throw Error("'b' has an invalid size");
 
-      if (A.columns() != n)
-        throw Error("'A' has an invalid number of rows");
+        if (Aeq_.rows() != p)
+          throw Error("'Aeq' has an invalid number of rows");
 
-      if (!b.isColumnVector(m))
-        throw Error("'b' has an invalid size");
+        if (p > 0)
+        {
+          if (Aeq_.columns() != n)
+            throw Error("'Aeq' has an invalid number of rows");
+          if (!beq_.isColumnVector(p))
+            throw Error("'beq' has an invalid size");
+        }
+      }
 
-      if (p > 0)
+      //! Copy problem data into the workspace. The cached
+      //! factorization is invalidated if H changed.
+      void
+      load(const Matrix& H_, const Matrix& f_, const Matrix& Aeq_, const Matrix& beq_, const Matrix& A_, const Matrix& b_)
       {
-        if (Aeq.columns() != n)
-          throw Error("'Aeq' has an invalid number of rows");
-        if (!beq.isColumnVector(p))
-          throw Error("'beq' has an invalid size");
+        for (int i = 0; i < n; i++)
+        {
+          for (int j = 0; j < n; j++)
+          {
+            double v = H_(i, j);
+            if (H[i * n + j] != v)
+            {
+              H[i * n + j] = v;
+              factored = false;
+            }
+          }
+
+          f[i] = f_(i);
+        }
+
+        for (int i = 0; i < p; i++)
+        {
+          for (int j = 0; j < n; j++)
+            Aeq[i * n + j] = Aeq_(i, j);
+          beq[i] = beq_(i);
+        }
+
+        for (int i = 0; i < m; i++)
+        {
+          for (int j = 0; j < n; j++)
+            A[i * n + j] = A_(i, j);
+          b[i] = b_(i);
+        }
       }
 
-      // Resize output vector
-      x.resize(n, 1);
+      //! Factorize H and compute the initial value of J.
+      void
+      factor(void)
+      {
+        if (factored)
+          return;
+
+        /* compute the trace of the original matrix G */
+        c1 = 0.0;
+        for (int i = 0; i < n; i++)
+          c1 += H[i * n + i];
+
+        /* decompose the matrix H0 in the form L^T L */
+        L = H;
+        cholesky_decomposition(&L[0], n);
+#ifdef __QPDBG__
+        print_matrix("H0", &L[0], n, n);
+#endif
+
+        /* compute the inverse of the factorized matrix G^-1, this is the initial value for H */
+        c2 = 0.0;
+        std::fill(d.begin(), d.end(), 0.0);
+        for (int i = 0; i < n; i++)
+        {
+          d[i] = 1.0;
+          forward_elimination(&L[0], &z[0], &d[0], n);
+          for (int j = 0; j < n; j++)
+            J0[i * n + j] = z[j];
+          c2 += z[i];
+          d[i] = 0.0;
+        }
+        /* c1 * c2 is an estimate for cond(H0) */
+
+        factored = true;
+      }
+
+      //! Store the active set of the current solution.
+      void
+      save(int iq)
+      {
+        nhint = 0;
+        for (int i = p; i < iq; i++)
+          hint[nhint++] = Aset[i];
+      }
 
-      // Working variables
+      //! Run the dual active-set method.
+      //! @return value of the objective function.
+      double
+      run(void);
+    };
+
+    double
+    QPSolver::Workspace::run(void)
+    {
       int i, j, k, l, ip;
-      Matrix R(n, n), J(n, n);
-      Matrix s(m + p, 1), z(n, 1), r(m + p, 1), d(n, 1), np(n, 1), u(m + p, 1), x_old(n, 1), u_old(m + p, 1);
-      double f_value, psi, c1, c2, sum, ss, R_norm;
+      double f_value, psi, sum, ss, R_norm;
       double inf = std::numeric_limits<double>::has_infinity ?
                    std::numeric_limits<double>::infinity() : 1.0E300;
 
       double t, t1, t2; /* t is the step lenght, which is the minimum of the partial step length t1
       * and the full step length t2 */
 
-      tvector<int> Aset(m + p), Aset_old(m + p), iai(m + p);
       int iq;
-      int iter = 0;
-      tvector<uint8_t> iaexcl(m + p);
-
-#ifdef __QPDBG__
-      std::cout << std::endl << "Starting solve_quadprog" << std::endl;
-      print_matrix("H", H);
-      print_vector("f", f);
-      print_matrix("Aeq", Aeq);
-      print_vector("beq", beq);
-      print_matrix("A", A);
-      print_vector("b", b);
-#endif
+      bool hinted;
+      iterations = 0;
 
       /*
        * Preprocessing phase
        */
 
-      /* compute the trace of the original matrix G */
-      Matrix H0(H);
-      c1 = 0.0;
-      for (i = 0; i < n; i++)
-        c1 += H0(i, i);
-
-      /* decompose the matrix H0 in the form L^T L */
-      cholesky_decomposition(H0);
-#ifdef __QPDBG__
-      print_matrix("H0", H0);
-#endif
       /* initialize the matrix R */
-      d.fill(0);
-      R.fill(0);
+      std::fill(d.begin(), d.end(), 0.0);
+      std::fill(R.begin(), R.end(), 0.0);
       R_norm = 1.0; /* this variable will hold the norm of the matrix R */
-      /* compute the inverse of the factorized matrix G^-1, this is the initial value for H */
-      c2 = 0.0;
-      for (i = 0; i < n; i++)
-      {
-        d(i) = 1.0;
-        forward_elimination(H0, z, d);
-        for (j = 0; j < n; j++)
-          J(i, j) = z(j);
-        c2 += z(i);
-        d(i) = 0.0;
-      }
+      J = J0;
 #ifdef __QPDBG__
-      print_matrix("J", J);
+      print_matrix("J", &J[0], n, n);
 #endif
 
-      /* c1 * c2 is an estimate for cond(H0) */
-
       /*
-        * Find the unconstrained minimizer of the quadratic form 0.5 * x G x + f x
+       * Find the unconstrained minimizer of the quadratic form 0.5 * x G x + f x
        * this is a feasible point in the dual space
        * x = G^-1 * f
        */
-      cholesky_solve(H0, x, f);
+      cholesky_solve(&L[0], &x[0], &f[0], &y[0], n);
       for (i = 0; i < n; i++)
-        x(i) = -x(i);
+        x[i] = -x[i];
       /* and compute the current solution value */
-      f_value = 0.5 * Matrix::dot(f, x);
+      f_value = 0.5 * dot(&f[0], &x[0], n);
 #ifdef __QPDBG__
       std::cout << "Unconstrained solution: " << f_value << std::endl;
-      print_vector("x", x);
+      print_vector("x", &x[0], n);
 #endif
 
       /* Add equality constraints to the working set A */
@@ -249,54 +308,48 @@ namespace DUNE
       for (i = 0; i < p; i++)
       {
         for (j = 0; j < n; j++)
-          np(j) = Aeq(i, j);
-        compute_d(d, J, np);
-        update_z(z, J, d, iq);
-        update_r(R, r, d, iq);
-    #ifdef __QPDBG__
-        print_matrix("R", R, n, iq);
-        print_vector("z", z);
-        print_vector("r", r, iq);
-        print_vector("d", d);
-    #endif
+          np[j] = Aeq[i * n + j];
+        compute_d(&d[0], &J[0], &np[0], n);
+        update_z(&z[0], &J[0], &d[0], n, iq);
+        update_r(&R[0], &r[0], &d[0], n, iq);
 
         /* compute full step length t2: i.e., the minimum step in primal space s.t. the contraint
           becomes feasible */
         t2 = 0.0;
-        if (std::fabs(Matrix::dot(z, z)) > std::numeric_limits<double>::epsilon()) // i.e. z != 0
-          t2 = (-Matrix::dot(np, x) - beq(i)) / Matrix::dot(z, np);
+        if (std::fabs(dot(&z[0], &z[0], n)) > std::numeric_limits<double>::epsilon()) // i.e. z != 0
+          t2 = (-dot(&np[0], &x[0], n) - beq[i]) / dot(&z[0], &np[0], n);
 
         /* set x = x + t2 * z */
         for (k = 0; k < n; k++)
-          x(k) += t2 * z(k);
+          x[k] += t2 * z[k];
 
         /* set u = u+ */
-        u(iq) = t2;
+        u[iq] = t2;
         for (k = 0; k < iq; k++)
-          u(k) -= t2 * r(k);
+          u[k] -= t2 * r[k];
 
         /* compute the new solution value */
-        f_value += 0.5 * (t2 * t2) * Matrix::dot(z, np);
-        Aset(i) = -i - 1;
+        f_value += 0.5 * (t2 * t2) * dot(&z[0], &np[0], n);
+        Aset[i] = -i - 1;
 
-        if (!add_constraint(R, J, d, iq, R_norm))
+        if (!add_constraint(&R[0], &J[0], &d[0], n, iq, R_norm))
           // Equality constraints are linearly dependent
           throw Error("Constraints are linearly dependent");
       }
 
       /* set iai = K \ A */
       for (i = 0; i < m; i++)
-        iai(i) = i;
+        iai[i] = i;
 
-l1:  iter++;
-    #ifdef __QPDBG__
-      print_vector("x", x);
-    #endif
+l1:  iterations++;
+#ifdef __QPDBG__
+      print_vector("x", &x[0], n);
+#endif
       /* step 1: choose a violated constraint */
       for (i = p; i < iq; i++)
       {
-        ip = Aset(i);
-        iai(ip) = -1;
+        ip = Aset[i];
+        iai[ip] = -1;
       }
 
       /* compute s(x) = A^T * x + b for all elements of K \ A */
@@ -305,71 +358,89 @@ l1:  iter++;
       ip = 0; /* ip will be the index of the chosen violated constraint */
       for (i = 0; i < m; i++)
       {
-        iaexcl(i) = true;
-        sum = 0.0;
-        for (j = 0; j < n; j++)
-          sum += A(i, j) * x(j);
-        sum += b(i);
-        s(i) = sum;
+        iaexcl[i] = true;
+        sum = dot(&A[i * n], &x[0], n) + b[i];
+        s[i] = sum;
         psi += std::min(0.0, sum);
       }
-    #ifdef __QPDBG__
-      print_vector("s", s, m);
-    #endif
+#ifdef __QPDBG__
+      print_vector("s", &s[0], m);
+#endif
 
       if (std::fabs(psi) <= m * std::numeric_limits<double>::epsilon() * c1 * c2 * 100.0)
       {
         /* numerically there are not infeasibilities anymore */
+        save(iq);
         return f_value;
       }
 
       /* save old values for u and A */
       for (i = 0; i < iq; i++)
       {
-        u_old(i) = u(i);
-        Aset_old(i) = Aset(i);
+        u_old[i] = u[i];
+        Aset_old[i] = Aset[i];
       }
       /* and for x */
       x_old = x;
 
 l2:     /* Step 2: check for feasibility and determine a new S-pair */
-      for (i = 0; i < m; i++)
+      /* when warm starting, prefer violated constraints that were
+         active in the previous solution */
+      hinted = false;
+      for (k = 0; warm && k < nhint; k++)
       {
-        if (s(i) < ss && iai(i) != -1 && iaexcl(i))
+        i = hint[k];
+        if (s[i] < 0.0 && iai[i] != -1 && iaexcl[i])
         {
-          ss = s(i);
+          ss = s[i];
           ip = i;
+          hinted = true;
+          break;
         }
       }
+
+      if (!hinted)
+      {
+        for (i = 0; i < m; i++)
+        {
+          if (s[i] < ss && iai[i] != -1 && iaexcl[i])
+          {
+            ss = s[i];
+            ip = i;
+          }
+        }
+      }
+
       if (ss >= 0.0)
       {
+        save(iq);
         return f_value;
       }
 
       /* set np = n(ip) */
       for (i = 0; i < n; i++)
-        np(i) = A(ip, i);
+        np[i] = A[ip * n + i];
       /* set u = (u 0)^T */
-      u(iq) = 0.0;
+      u[iq] = 0.0;
       /* add ip to the active set A */
-      Aset(iq) = ip;
+      Aset[iq] = ip;
 
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
       std::cout << "Trying with constraint " << ip << std::endl;
-      print_vector("np", np);
-    #endif
+      print_vector("np", &np[0], n);
+#endif
 
 l2a:    /* Step 2a: determine step direction */
         /* compute z = H np: the step direction in the primal space (through J, see the paper) */
-      compute_d(d, J, np);
-      update_z(z, J, d, iq);
+      compute_d(&d[0], &J[0], &np[0], n);
+      update_z(&z[0], &J[0], &d[0], n, iq);
       /* compute N* np (if q > 0): the negative of the step direction in the dual space */
-      update_r(R, r, d, iq);
-    #ifdef __QPDBG__
+      update_r(&R[0], &r[0], &d[0], n, iq);
+#ifdef __QPDBG__
       std::cout << "Step direction z" << std::endl;
-      print_vector("z", z);
-      print_vector("d", d);
-    #endif
+      print_vector("z", &z[0], n);
+      print_vector("d", &d[0], n);
+#endif
 
       /* Step 2b: compute step length */
       l = 0;
@@ -378,26 +449,26 @@ l2a:    /* Step 2a: determine step direction */
       /* find the index l s.t. it reaches the minimum of u+(x) / r */
       for (k = p; k < iq; k++)
       {
-        if (r(k) > 0.0)
+        if (r[k] > 0.0)
         {
-          if (u(k) / r(k) < t1)
+          if (u[k] / r[k] < t1)
           {
-            t1 = u(k) / r(k);
-            l = Aset(k);
+            t1 = u[k] / r[k];
+            l = Aset[k];
           }
         }
       }
       /* Compute t2: full step length (minimum step in primal space such that the constraint ip becomes feasible */
-      if (std::fabs(Matrix::dot(z, z)) > std::numeric_limits<double>::epsilon())  // i.e. z != 0
-        t2 = -s(ip) / Matrix::dot(z, np);
+      if (std::fabs(dot(&z[0], &z[0], n)) > std::numeric_limits<double>::epsilon())  // i.e. z != 0
+        t2 = -s[ip] / dot(&z[0], &np[0], n);
       else
         t2 = inf;  /* +inf */
 
       /* the step is chosen as the minimum of t1 and t2 */
       t = std::min(t1, t2);
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
       std::cout << "Step sizes: " << t << " (t1 = " << t1 << ", t2 = " << t2 << ") ";
-    #endif
+#endif
 
       /* Step 2c: determine new S-pair and take step: */
 
@@ -406,6 +477,7 @@ l2a:    /* Step 2a: determine step direction */
       {
         /* QPP is infeasible */
         // FIXME: unbounded to raise
+        nhint = 0;
         throw Error("Problem is unfeasible");
       }
 
@@ -414,17 +486,17 @@ l2a:    /* Step 2a: determine step direction */
       {
         /* set u = u +  t * (-r 1) and drop constraint l from the active set A */
         for (k = 0; k < iq; k++)
-          u(k) -= t * r(k);
-        u(iq) += t;
-        iai(l) = l;
-        delete_constraint(R, J, Aset, u, n, p, iq, l);
-    #ifdef __QPDBG__
+          u[k] -= t * r[k];
+        u[iq] += t;
+        iai[l] = l;
+        delete_constraint(&R[0], &J[0], &Aset[0], &u[0], n, p, iq, l);
+#ifdef __QPDBG__
         std::cout << " in dual space: "
                   << f_value << std::endl;
-        print_vector("x", x);
-        print_vector("z", z);
-        print_vector("Aset", Aset, iq + 1);
-    #endif
+        print_vector("x", &x[0], n);
+        print_vector("z", &z[0], n);
+        print_vector("Aset", &Aset[0], iq + 1);
+#endif
         goto l2a;
       }
 
@@ -432,90 +504,201 @@ l2a:    /* Step 2a: determine step direction */
 
       /* set x = x + t * z */
       for (k = 0; k < n; k++)
-        x(k) += t * z(k);
+        x[k] += t * z[k];
       /* update the solution value */
-      f_value += t * Matrix::dot(z, np) * (0.5 * t + u(iq));
+      f_value += t * dot(&z[0], &np[0], n) * (0.5 * t + u[iq]);
       /* u = u + t * (-r 1) */
       for (k = 0; k < iq; k++)
-        u(k) -= t * r(k);
-      u(iq) += t;
-    #ifdef __QPDBG__
+        u[k] -= t * r[k];
+      u[iq] += t;
+#ifdef __QPDBG__
       std::cout << " in both spaces: "
                 << f_value << std::endl;
-      print_vector("x", x);
-      print_vector("u", u, iq + 1);
-      print_vector("r", r, iq + 1);
-      print_vector("Aset", Aset, iq + 1);
-    #endif
+      print_vector("x", &x[0], n);
+      print_vector("u", &u[0], iq + 1);
+      print_vector("r", &r[0], iq + 1);
+      print_vector("Aset", &Aset[0], iq + 1);
+#endif
 
       if (std::fabs(t - t2) < std::numeric_limits<double>::epsilon())
       {
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
         std::cout << "Full step has taken " << t << std::endl;
-        print_vector("x", x);
-    #endif
+        print_vector("x", &x[0], n);
+#endif
         /* full step has taken */
         /* add constraint ip to the active set*/
-        if (!add_constraint(R, J, d, iq, R_norm))
+        if (!add_constraint(&R[0], &J[0], &d[0], n, iq, R_norm))
         {
+#ifdef __QPDBG__
           std::cout << "not iaexcl " << ip << std::endl;
-          iaexcl(ip) = false;
-          delete_constraint(R, J, Aset, u, n, p, iq, ip);
-    #ifdef __QPDBG__
-          print_matrix("R", R);
-          print_vector("Aset", Aset, iq);
-          print_vector("iai", iai);
-    #endif
+#endif
+          iaexcl[ip] = false;
+          delete_constraint(&R[0], &J[0], &Aset[0], &u[0], n, p, iq, ip);
+#ifdef __QPDBG__
+          print_matrix("R", &R[0], n, n);
+          print_vector("Aset", &Aset[0], iq);
+          print_vector("iai", &iai[0], m);
+#endif
           for (i = 0; i < m; i++)
-            iai(i) = i;
+            iai[i] = i;
           for (i = p; i < iq; i++)
           {
-            Aset(i) = Aset_old(i);
-            u(i) = u_old(i);
-            iai(Aset(i)) = -1;
+            Aset[i] = Aset_old[i];
+            u[i] = u_old[i];
+            iai[Aset[i]] = -1;
           }
           x = x_old;
           goto l2; /* go to step 2 */
         }
         else
-          iai(ip) = -1;
-    #ifdef __QPDBG__
-        print_matrix("R", R);
-        print_vector("Aset", Aset, iq);
-        print_vector("iai", iai);
-    #endif
+          iai[ip] = -1;
+#ifdef __QPDBG__
+        print_matrix("R", &R[0], n, n);
+        print_vector("Aset", &Aset[0], iq);
+        print_vector("iai", &iai[0], m);
+#endif
         goto l1;
       }
 
       /* a patial step has taken */
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
       std::cout << "Partial step has taken " << t << std::endl;
-      print_vector("x", x);
-    #endif
+      print_vector("x", &x[0], n);
+#endif
       /* drop constraint l */
-      iai(l) = l;
-      delete_constraint(R, J, Aset, u, n, p, iq, l);
-    #ifdef __QPDBG__
-      print_matrix("R", R);
-      print_vector("Aset", Aset, iq);
-    #endif
+      iai[l] = l;
+      delete_constraint(&R[0], &J[0], &Aset[0], &u[0], n, p, iq, l);
+#ifdef __QPDBG__
+      print_matrix("R", &R[0], n, n);
+      print_vector("Aset", &Aset[0], iq);
+#endif
 
       /* update s(ip) = A * x + b */
-      sum = 0.0;
-      for (k = 0; k < n; k++)
-        sum += A(ip, k) * x(k);
-      s(ip) = sum + b(ip);
+      s[ip] = dot(&A[ip * n], &x[0], n) + b[ip];
 
-    #ifdef __QPDBG__
-      print_vector("s", s, m);
-    #endif
+#ifdef __QPDBG__
+      print_vector("s", &s[0], m);
+#endif
       goto l2a;
     }
 
+    QPSolver::QPSolver(unsigned n, unsigned p, unsigned m):
+      m_ws(NULL)
+    {
+      if (n == 0)
+        throw Error("problem has no variables");
+
+      m_ws = new Workspace(n, p, m);
+      m_ws->warm = true;
+    }
+
+    QPSolver::~QPSolver(void)
+    {
+      delete m_ws;
+    }
+
+    void
+    QPSolver::setWarmStart(bool enable)
+    {
+      m_ws->warm = enable;
+    }
+
+    void
+    QPSolver::reset(void)
+    {
+      m_ws->factored = false;
+      m_ws->nhint = 0;
+    }
+
+    unsigned
+    QPSolver::getIterations(void) const
+    {
+      return m_ws->iterations;
+    }
+
+    void
+    QPSolver::getActiveSet(std::vector<unsigned>& active) const
+    {
+      active.resize(m_ws->nhint);
+      for (int i = 0; i < m_ws->nhint; i++)
+        active[i] = m_ws->hint[i];
+    }
+
+    double
+    QPSolver::minimize(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x)
+    {
+      // Zero-size matrix and vector
+      Matrix Aeq;
+      Matrix beq;
+      return minimize(H, f, Aeq, beq, A, b, x);
+    }
+
+    double
+    QPSolver::minimize(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x)
+    {
+      Workspace& ws = *m_ws;
+
+      ws.validate(H, f, Aeq, beq, A, b);
+      ws.load(H, f, Aeq, beq, A, b);
+
+      try
+      {
+        ws.factor();
+      }
+      catch (...)
+      {
+        reset();
+        throw;
+      }
+
+      double f_value = ws.run();
+
+      if (x.rows() != ws.n || x.columns() != 1)
+        x.resize(ws.n, 1);
+
+      for (int i = 0; i < ws.n; i++)
+        x(i) = ws.x[i];
+
+      return f_value;
+    }
+
+    double
+    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x)
+    {
+      // Zero-size matrix and vector
+      Matrix Aeq;
+      Matrix beq;
+      return solve(H, f, Aeq, beq, A, b, x);
+    }
+
+    double
+    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x)
+    {
+      // n: number of vars
+      // p: number of equality constraints
+      // m: number of inequality constraints
+      if (!H.isSquare())
+        throw Error("'H' is not a square matrix");
+
+      QPSolver solver(H.columns(), Aeq.rows(), A.rows());
+      solver.setWarmStart(false);
+      return solver.minimize(H, f, Aeq, beq, A, b, x);
+    }
+
+    static double
+    dot(const double* a, const double* b, int n)
+    {
+      double sum = 0.0;
+      for (int i = 0; i < n; i++)
+        sum += a[i] * b[i];
+      return sum;
+    }
+
     static void
-    compute_d(Matrix& d, const Matrix& J, const Matrix& np)
+    compute_d(double* d, const double* J, const double* np, int n)
     {
-      int i, j, n = d.rows();
+      int i, j;
       double sum;
 
       /* compute d = H^T * np */
@@ -523,29 +706,29 @@ l2a:    /* Step 2a: determine step direction */
       {
         sum = 0.0;
         for (j = 0; j < n; j++)
-          sum += J(j, i) * np(j);
-        d(i) = sum;
+          sum += J[j * n + i] * np[j];
+        d[i] = sum;
       }
     }
 
     static void
-    update_z(Matrix& z, const Matrix& J, const Matrix& d, int iq)
+    update_z(double* z, const double* J, const double* d, int n, int iq)
     {
-      int i, j, n = z.rows();
+      int i, j;
 
       /* setting of z = H * d */
       for (i = 0; i < n; i++)
       {
-        z(i) = 0.0;
+        z[i] = 0.0;
         for (j = iq; j < n; j++)
-          z(i) += J(i, j) * d(j);
+          z[i] += J[i * n + j] * d[j];
       }
     }
 
     static void
-    update_r(const Matrix& R, Matrix& r, const Matrix& d, int iq)
+    update_r(const double* R, double* r, const double* d, int n, int iq)
     {
-      int i, j; /*, n = d.size();*/
+      int i, j;
       double sum;
 
       /* setting of r = R^-1 d */
@@ -553,18 +736,17 @@ l2a:    /* Step 2a: determine step direction */
       {
         sum = 0.0;
         for (j = i + 1; j < iq; j++)
-          sum += R(i, j) * r(j);
-        r(i) = (d(i) - sum) / R(i, i);
+          sum += R[i * n + j] * r[j];
+        r[i] = (d[i] - sum) / R[i * n + i];
       }
     }
 
     static bool
-    add_constraint(Matrix& R, Matrix& J, Matrix& d, int& iq, double& R_norm)
+    add_constraint(double* R, double* J, double* d, int n, int& iq, double& R_norm)
     {
-      int n = d.rows();
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
       std::cout << "Add constraint " << iq << '/';
-    #endif
+#endif
       int i, j, k;
       double cc, ss, h, t1, t2, xny;
 
@@ -582,29 +764,30 @@ l2a:    /* Step 2a: determine step direction */
         update d depending on the sign of gs.
         Otherwise we have to apply the Givens rotation to these columns.
         The i - 1 element of d has to be updated to h. */
-        cc = d(j - 1);
-        ss = d(j);
+        cc = d[j - 1];
+        ss = d[j];
         h = distance(cc, ss);
         if (std::fabs(h) < std::numeric_limits<double>::epsilon()) // h == 0
           continue;
-        d(j) = 0.0;
+        d[j] = 0.0;
         ss = ss / h;
         cc = cc / h;
         if (cc < 0.0)
         {
           cc = -cc;
           ss = -ss;
-          d(j - 1) = -h;
+          d[j - 1] = -h;
         }
         else
-          d(j - 1) = h;
+          d[j - 1] = h;
         xny = ss / (1.0 + cc);
         for (k = 0; k < n; k++)
         {
-          t1 = J(k, j - 1);
-          t2 = J(k, j);
-          J(k, j - 1) = t1 * cc + t2 * ss;
-          J(k, j) = xny * (t1 + J(k, j - 1)) - t2;
+          double* row = J + k * n;
+          t1 = row[j - 1];
+          t2 = row[j];
+          row[j - 1] = t1 * cc + t2 * ss;
+          row[j] = xny * (t1 + row[j - 1]) - t2;
         }
       }
       /* update the number of constraints added*/
@@ -613,35 +796,35 @@ l2a:    /* Step 2a: determine step direction */
         into column iq - 1 of R
         */
       for (i = 0; i < iq; i++)
-        R(i, iq - 1) = d(i);
-    #ifdef __QPDBG__
+        R[i * n + iq - 1] = d[i];
+#ifdef __QPDBG__
       std::cout << iq << std::endl;
       print_matrix("R", R, iq, iq);
-      print_matrix("J", J);
+      print_matrix("J", J, n, n);
       print_vector("d", d, iq);
-    #endif
+#endif
 
-      if (std::fabs(d(iq - 1)) <= std::numeric_limits<double>::epsilon() * R_norm)
+      if (std::fabs(d[iq - 1]) <= std::numeric_limits<double>::epsilon() * R_norm)
       {
         // problem degenerate
         return false;
       }
-      R_norm = std::max<double>(R_norm, std::fabs(d(iq - 1)));
+      R_norm = std::max<double>(R_norm, std::fabs(d[iq - 1]));
       return true;
     }
 
     static void
-    delete_constraint(Matrix& R, Matrix& J, tvector<int>& Aset, Matrix& u, int n, int p, int& iq, int l)
+    delete_constraint(double* R, double* J, int* Aset, double* u, int n, int p, int& iq, int l)
     {
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
       std::cout << "Delete constraint " << l << ' ' << iq;
-    #endif
+#endif
       int i, j, k, qq = -1; // just to prevent warnings from smart compilers
       double cc, ss, h, xny, t1, t2;
 
       /* Find the index qq for active constraint l to be removed */
       for (i = p; i < iq; i++)
-        if (Aset(i) == l)
+        if (Aset[i] == l)
         {
           qq = i;
           break;
@@ -650,60 +833,61 @@ l2a:    /* Step 2a: determine step direction */
       /* remove the constraint from the active set and the duals */
       for (i = qq; i < iq - 1; i++)
       {
-        Aset(i) = Aset(i + 1);
-        u(i) = u(i + 1);
+        Aset[i] = Aset[i + 1];
+        u[i] = u[i + 1];
         for (j = 0; j < n; j++)
-          R(j, i) = R(j, i + 1);
+          R[j * n + i] = R[j * n + i + 1];
       }
 
-      Aset(iq - 1) = Aset(iq);
-      u(iq - 1) = u(iq);
-      Aset(iq) = 0;
-      u(iq) = 0.0;
+      Aset[iq - 1] = Aset[iq];
+      u[iq - 1] = u[iq];
+      Aset[iq] = 0;
+      u[iq] = 0.0;
       for (j = 0; j < iq; j++)
-        R(j, iq - 1) = 0.0;
+        R[j * n + iq - 1] = 0.0;
       /* constraint has been fully removed */
       iq--;
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
       std::cout << '/' << iq << std::endl;
-    #endif
+#endif
 
       if (iq == 0)
         return;
 
       for (j = qq; j < iq; j++)
       {
-        cc = R(j, j);
-        ss = R(j + 1, j);
+        cc = R[j * n + j];
+        ss = R[(j + 1) * n + j];
         h = distance(cc, ss);
         if (std::fabs(h) < std::numeric_limits<double>::epsilon()) // h == 0
           continue;
         cc = cc / h;
         ss = ss / h;
-        R(j + 1, j) = 0.0;
+        R[(j + 1) * n + j] = 0.0;
         if (cc < 0.0)
         {
-          R(j, j) = -h;
+          R[j * n + j] = -h;
           cc = -cc;
           ss = -ss;
         }
         else
-          R(j, j) = h;
+          R[j * n + j] = h;
 
         xny = ss / (1.0 + cc);
         for (k = j + 1; k < iq; k++)
         {
-          t1 = R(j, k);
-          t2 = R(j + 1, k);
-          R(j, k) = t1 * cc + t2 * ss;
-          R(j + 1, k) = xny * (t1 + R(j, k)) - t2;
+          t1 = R[j * n + k];
+          t2 = R[(j + 1) * n + k];
+          R[j * n + k] = t1 * cc + t2 * ss;
+          R[(j + 1) * n + k] = xny * (t1 + R[j * n + k]) - t2;
         }
         for (k = 0; k < n; k++)
         {
-          t1 = J(k, j);
-          t2 = J(k, j + 1);
-          J(k, j) = t1 * cc + t2 * ss;
-          J(k, j + 1) = xny * (J(k, j) + t1) - t2;
+          double* row = J + k * n;
+          t1 = row[j];
+          t2 = row[j + 1];
+          row[j] = t1 * cc + t2 * ss;
+          row[j + 1] = xny * (row[j] + t1) - t2;
         }
       }
     }
@@ -728,92 +912,86 @@ l2a:    /* Step 2a: determine step direction */
     }
 
     static void
-    cholesky_decomposition(Matrix& A)
+    cholesky_decomposition(double* A, int n)
     {
-      int i, j, k, n = A.rows();
+      int i, j, k;
       double sum;
 
       for (i = 0; i < n; i++)
       {
         for (j = i; j < n; j++)
         {
-          sum = A(j, i);
+          sum = A[j * n + i];
           for (k = i - 1; k >= 0; k--)
-            sum -= A(k, i) * A(k, j);
+            sum -= A[k * n + i] * A[k * n + j];
           if (i == j)
           {
             if (sum <= 0.0)
               throw QPSolver::Error("error in Cholesky decomposition");
-            A(i, i) = ::std::sqrt(sum);
+            A[i * n + i] = ::std::sqrt(sum);
           }
           else
           {
-            A(i, j) = sum / A(i, i);
+            A[i * n + j] = sum / A[i * n + i];
           }
         }
         for (k = i + 1; k < n; k++)
-          A(k, i) = A(i, k);
+          A[k * n + i] = A[i * n + k];
       }
     }
 
     static void
-    cholesky_solve(const Matrix& L, Matrix& x, const Matrix& b)
+    cholesky_solve(const double* L, double* x, const double* b, double* y, int n)
     {
-      Matrix y(L.rows(), 1);
-
       /* Solve L * y = b */
-      forward_elimination(L, y, b);
+      forward_elimination(L, y, b, n);
       /* Solve L^T * x = y */
-      backward_elimination(L, x, y);
+      backward_elimination(L, x, y, n);
     }
 
     static void
-    forward_elimination(const Matrix& L, Matrix& y, const Matrix& b)
+    forward_elimination(const double* L, double* y, const double* b, int n)
     {
-      int i, j, n = L.rows();
+      int i, j;
 
-      y(0) = b(0) / L(0, 0);
+      y[0] = b[0] / L[0];
       for (i = 1; i < n; i++)
       {
-        y(i) = b(i);
+        y[i] = b[i];
         for (j = 0; j < i; j++)
-          y(i) -= L(i, j) * y(j);
-        y(i) = y(i) / L(i, i);
+          y[i] -= L[i * n + j] * y[j];
+        y[i] = y[i] / L[i * n + i];
       }
     }
 
     static void
-    backward_elimination(const Matrix& U, Matrix& x, const Matrix& y)
+    backward_elimination(const double* U, double* x, const double* y, int n)
     {
-      int i, j, n = U.rows();
+      int i, j;
 
-      x(n - 1) = y(n - 1) / U(n - 1, n - 1);
+      x[n - 1] = y[n - 1] / U[(n - 1) * n + n - 1];
       for (i = n - 2; i >= 0; i--)
       {
-        x(i) = y(i);
+        x[i] = y[i];
         for (j = i + 1; j < n; j++)
-          x(i) -= U(i, j) * x(j);
-        x(i) = x(i) / U(i, i);
+          x[i] -= U[i * n + j] * x[j];
+        x[i] = x[i] / U[i * n + i];
       }
     }
 
-    #ifdef __QPDBG__
+#ifdef __QPDBG__
     static void
-    print_matrix(const char* name, const Matrix& A, int n, int m)
+    print_matrix(const char* name, const double* A, int n, int m)
     {
       std::ostringstream s;
       std::string t;
-      if (n == -1)
-        n = A.rows();
-      if (m == -1)
-        m = A.columns();
 
       s << name << ": " << std::endl;
       for (int i = 0; i < n; i++)
       {
         s << " ";
         for (int j = 0; j < m; j++)
-          s << A(i, j) << ", ";
+          s << A[i * m + j] << ", ";
         s << std::endl;
       }
       t = s.str();
@@ -824,24 +1002,21 @@ l2a:    /* Step 2a: determine step direction */
 
     template <typename T>
     static void
-    print_vector(const char* name, const tvector<T>& v, int n)
+    print_vector(const char* name, const T* v, int n)
     {
       std::ostringstream s;
       std::string t;
-      if (n == -1)
-        n = v.size();
 
       s << name << ": " << std::endl << " ";
       for (int i = 0; i < n; i++)
       {
-        s << v(i) << ", ";
+        s << v[i] << ", ";
       }
       t = s.str();
       t = t.substr(0, t.size() - 2); // To remove the trailing space and comma
 
       std::cout << t << std::endl;
     }
-
 #endif
   }
 }
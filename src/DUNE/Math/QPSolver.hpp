@@ -30,6 +30,9 @@
 #ifndef DUNE_MATH_QP_SOLVER_HPP_INCLUDED_
 #define DUNE_MATH_QP_SOLVER_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Math/Matrix.hpp>
@@ -41,7 +44,16 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM QPSolver;
 
-    //! Quadratic programming solver.
+    //! Quadratic programming solver (Goldfarb-Idnani dual active-set
+    //! method).
+    //!
+    //! The static solve() functions allocate a new workspace on each
+    //! call. For problems of the same structure solved repeatedly
+    //! (e.g., in control loops), create a QPSolver object for the
+    //! problem dimensions and call minimize(): the workspace is
+    //! allocated once, the factorization of H is reused while H is
+    //! unchanged and, if warm start is enabled, constraints that were
+    //! active in the previous solution are tried first.
     class QPSolver
     {
     public:
@@ -54,19 +66,76 @@ namespace DUNE
         { }
       };
 
+      //! Create solver for problems of fixed dimensions.
+      //! @param n number of variables.
+      //! @param p number of equality constraints.
+      //! @param m number of inequality constraints.
+      QPSolver(unsigned n, unsigned p, unsigned m);
+
+      //! Destructor.
+      ~QPSolver(void);
+
+      //! Enable or disable warm start from the previous active set.
+      //! Warm start is enabled by default.
+      //! @param enable true to enable warm start.
+      void
+      setWarmStart(bool enable);
+
+      //! Forget the cached factorization and active set.
+      void
+      reset(void);
+
       //! Minimize
       //!   0.5 x' H x + f' x
       //! subject to:
-      //!   A x <= b
+      //!   A x + b >= 0
+      //! @return value of the objective function at the solution.
+      double
+      minimize(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x);
+
+      //! Minimize
+      //!   0.5 x' H x + f' x
+      //! subject to:
+      //!   A x + b >= 0  and Aeq x + beq = 0
+      //! @return value of the objective function at the solution.
+      double
+      minimize(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x);
+
+      //! Get number of iterations of the last call to minimize().
+      //! @return number of iterations.
+      unsigned
+      getIterations(void) const;
+
+      //! Get inequality constraints active at the last solution.
+      //! @param active output vector of constraint indices.
+      void
+      getActiveSet(std::vector<unsigned>& active) const;
+
+      //! Minimize
+      //!   0.5 x' H x + f' x
+      //! subject to:
+      //!   A x + b >= 0
       static double
       solve(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x);
 
       //! Minimize
       //!   0.5 x' H x + f' x
       //! subject to:
-      //!   A x <= b  and Aeq x = beq
+      //!   A x + b >= 0  and Aeq x + beq = 0
       static double
       solve(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x);
+
+    private:
+      struct Workspace;
+
+      //! Preallocated workspace.
+      Workspace* m_ws;
+
+      // Non-copyable.
+      QPSolver(const QPSolver&);
+
+      QPSolver&
+      operator=(const QPSolver&);
     };
   }
 }
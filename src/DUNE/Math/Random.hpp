@@ -36,6 +36,7 @@
 #include <DUNE/Math/Random/DRand48.hpp>
 #include <DUNE/Math/Random/FSR256.hpp>
 #include <DUNE/Math/Random/MT19937.hpp>
+#include <DUNE/Math/Random/Philox.hpp>
 #include <DUNE/Math/Random/KernelDevice.hpp>
 
 #endif
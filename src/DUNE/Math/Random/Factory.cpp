@@ -36,6 +36,7 @@
 #include <DUNE/Math/Random/DRand48.hpp>
 #include <DUNE/Math/Random/FSR256.hpp>
 #include <DUNE/Math/Random/MT19937.hpp>
+#include <DUNE/Math/Random/Philox.hpp>
 #include <DUNE/Math/Random/KernelDevice.hpp>
 
 namespace DUNE
@@ -46,6 +47,7 @@ namespace DUNE
     {
       const char* Factory::c_drand48 = "drand48";
       const char* Factory::c_fsr256 = "fsr256";
+      const char* Factory::c_philox = "philox";
       const char* Factory::c_default = c_fsr256;
       const char* Factory::c_mt19937 = "mt19937";
       const char* Factory::c_krng = "krng";
@@ -55,6 +57,7 @@ namespace DUNE
         G_DRAND48,
         G_FSR256,
         G_MT19937,
+        G_PHILOX,
         G_KRNG
       };
 
@@ -66,6 +69,7 @@ namespace DUNE
         GEntry(Factory::c_drand48, G_DRAND48),
         GEntry(Factory::c_fsr256, G_FSR256),
         GEntry(Factory::c_mt19937, G_MT19937),
+        GEntry(Factory::c_philox, G_PHILOX),
         GEntry(Factory::c_krng, G_KRNG),
       };
 
@@ -93,6 +97,8 @@ namespace DUNE
             return new FSR256(seed_value);
           case G_MT19937:
             return new MT19937(seed_value);
+          case G_PHILOX:
+            return new Philox(seed_value);
           case G_KRNG:
             return new KernelDevice(); // can not seed
           default:
@@ -51,6 +51,7 @@ namespace DUNE
         static const char* c_fsr256;    //!< "fsr256"
         static const char* c_default;   //!< "fsr256"
         static const char* c_mt19937;   //!< "mt19337"
+        static const char* c_philox;    //!< "philox"
         static const char* c_krng;      //!< "krng"
 
         //! Create generator with given seed. If seed is negative and
@@ -28,7 +28,9 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 // DUNE headers.
 #include <DUNE/Math/Random/Generator.hpp>
@@ -42,6 +44,8 @@ namespace DUNE
     namespace Random
     {
       static double c_max_random_d = (double)Generator::c_max_random;
+      //! Number of gaussian values produced per block of uniforms.
+      static const unsigned c_gaussian_block = 64;
 
       int32_t
       Generator::arbitrarySeed(void)
@@ -95,6 +99,71 @@ namespace DUNE
         return y * std::sqrt(-2.0 * std::log(r2) / r2);
       }
 
+      void
+      Generator::fillUniform(double* values, unsigned count)
+      {
+        for (unsigned i = 0; i < count; ++i)
+          values[i] = uniform();
+      }
+
+      void
+      Generator::fillUniform(double* values, unsigned count, double a, double b)
+      {
+        fillUniform(values, count);
+
+        for (unsigned i = 0; i < count; ++i)
+          values[i] = a + (b - a) * values[i];
+      }
+
+      void
+      Generator::fillGaussian(double* values, unsigned count)
+      {
+        for (unsigned i = 0; i < count; ++i)
+          values[i] = gaussian();
+      }
+
+      void
+      Generator::boxMuller(double* values, unsigned count)
+      {
+        const double min = std::numeric_limits<double>::min();
+        double u[c_gaussian_block];
+
+        while (count > 0)
+        {
+          unsigned n = std::min(count, c_gaussian_block);
+          unsigned pairs = n / 2;
+
+          // An odd tail still consumes a full pair of uniforms.
+          fillUniform(u, (n + 1) & ~1U);
+
+          for (unsigned i = 0; i < pairs; ++i)
+          {
+            double r = std::sqrt(-2.0 * std::log(std::max(u[2 * i], min)));
+            double a = c_two_pi * u[2 * i + 1];
+            values[2 * i] = r * std::cos(a);
+            values[2 * i + 1] = r * std::sin(a);
+          }
+
+          if (n & 1)
+          {
+            double r = std::sqrt(-2.0 * std::log(std::max(u[n - 1], min)));
+            values[n - 1] = r * std::cos(c_two_pi * u[n]);
+          }
+
+          values += n;
+          count -= n;
+        }
+      }
+
+      void
+      Generator::fillGaussian(double* values, unsigned count, double mu, double sigma)
+      {
+        fillGaussian(values, count);
+
+        for (unsigned i = 0; i < count; ++i)
+          values[i] = mu + sigma * values[i];
+      }
+
       void
       Generator::ballU(double radius, double* x, double* y)
       {
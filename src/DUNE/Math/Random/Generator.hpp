@@ -102,6 +102,24 @@ namespace DUNE
           return a + (b - a) * uniform();
         }
 
+        //! Fill an array with numbers uniformly distributed in [0,1].
+        //! Default implementation calls uniform() for each element;
+        //! generators able to produce values in blocks should
+        //! override it.
+        //! @param values output array.
+        //! @param count number of values to generate.
+        virtual void
+        fillUniform(double* values, unsigned count);
+
+        //! Fill an array with numbers uniformly distributed in a
+        //! given interval.
+        //! @param values output array.
+        //! @param count number of values to generate.
+        //! @param a value of a.
+        //! @param b value of b.
+        void
+        fillUniform(double* values, unsigned count, double a, double b);
+
         //! Generate gaussian number with mean 0 and std. dev 1.
         //! The number is generated using the Box-Muller method.
         //! @return number with gaussian distribution (0,1).
@@ -120,6 +138,25 @@ namespace DUNE
                  gaussian();
         }
 
+        //! Fill an array with numbers with gaussian distribution of
+        //! mean 0 and std. dev 1. Default implementation calls
+        //! gaussian() for each element, so the sequence is the same
+        //! as that of repeated calls; generators able to produce
+        //! values in blocks should override it with boxMuller().
+        //! @param values output array.
+        //! @param count number of values to generate.
+        virtual void
+        fillGaussian(double* values, unsigned count);
+
+        //! Fill an array with numbers with a gaussian distribution,
+        //! for a given mean and standard deviation.
+        //! @param values output array.
+        //! @param count number of values to generate.
+        //! @param mu mean of distribution.
+        //! @param sigma std. dev. of distribution.
+        void
+        fillGaussian(double* values, unsigned count, double mu, double sigma);
+
         // Generate coordinates (x,y) in relation to (0,0), such
         // that:
         // - Distance to (0,0) is uniformly distributed in [0,radius].
@@ -141,6 +178,17 @@ namespace DUNE
         // @param y output y coordinate.
         void
         ballG(double sigma, double* x, double* y);
+
+      protected:
+        //! Fill an array with numbers with gaussian distribution of
+        //! mean 0 and std. dev 1. Values are produced in pairs by the
+        //! trigonometric Box-Muller transform over blocks of uniform
+        //! numbers obtained with fillUniform(), which avoids the
+        //! rejection loop of gaussian().
+        //! @param values output array.
+        //! @param count number of values to generate.
+        void
+        boxMuller(double* values, unsigned count);
       };
     }
   }
@@ -0,0 +1,198 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Math/Random/Philox.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    namespace Random
+    {
+      //! Round multipliers.
+      static const uint32_t c_mul0 = 0xD2511F53U;
+      static const uint32_t c_mul1 = 0xCD9E8D57U;
+      //! Key schedule increments.
+      static const uint32_t c_weyl0 = 0x9E3779B9U;
+      static const uint32_t c_weyl1 = 0xBB67AE85U;
+      //! Number of rounds.
+      static const unsigned c_rounds = 10;
+      //! Scale factor from 32-bit word to (0,1).
+      static const double c_scale = 1.0 / 4294967296.0;
+
+      static inline double
+      toUniform(uint32_t word)
+      {
+        return (word + 0.5) * c_scale;
+      }
+
+      Philox::Philox(void)
+      {
+        m_key[1] = 0;
+        seed(arbitrarySeed());
+      }
+
+      Philox::Philox(int32_t seed_value, uint32_t stream)
+      {
+        m_key[1] = stream;
+        seed(seed_value);
+      }
+
+      Philox::~Philox(void)
+      { }
+
+      void
+      Philox::seed(int32_t value)
+      {
+        m_key[0] = (uint32_t)value;
+        setCounter(0);
+      }
+
+      void
+      Philox::setStream(uint32_t stream)
+      {
+        m_key[1] = stream;
+        setCounter(0);
+      }
+
+      void
+      Philox::setCounter(uint64_t block)
+      {
+        m_ctr[0] = (uint32_t)block;
+        m_ctr[1] = (uint32_t)(block >> 32);
+        m_ctr[2] = 0;
+        m_ctr[3] = 0;
+        m_pos = 4;
+      }
+
+      void
+      Philox::generate(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+      {
+        uint32_t c0 = ctr[0];
+        uint32_t c1 = ctr[1];
+        uint32_t c2 = ctr[2];
+        uint32_t c3 = ctr[3];
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+
+        for (unsigned i = 0; i < c_rounds; ++i)
+        {
+          uint64_t p0 = (uint64_t)c_mul0 * c0;
+          uint64_t p1 = (uint64_t)c_mul1 * c2;
+
+          uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+          uint32_t n1 = (uint32_t)p1;
+          uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+          uint32_t n3 = (uint32_t)p0;
+
+          c0 = n0;
+          c1 = n1;
+          c2 = n2;
+          c3 = n3;
+          k0 += c_weyl0;
+          k1 += c_weyl1;
+        }
+
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+      }
+
+      void
+      Philox::advance(uint32_t out[4])
+      {
+        generate(m_ctr, m_key, out);
+
+        // 128-bit increment.
+        for (unsigned i = 0; i < 4; ++i)
+        {
+          if (++m_ctr[i] != 0)
+            break;
+        }
+      }
+
+      uint32_t
+      Philox::next(void)
+      {
+        if (m_pos == 4)
+        {
+          advance(m_out);
+          m_pos = 0;
+        }
+
+        return m_out[m_pos++];
+      }
+
+      int32_t
+      Philox::random(void)
+      {
+        return (int32_t)(next() >> 1);
+      }
+
+      double
+      Philox::uniform(void)
+      {
+        return toUniform(next());
+      }
+
+      void
+      Philox::fillUniform(double* values, unsigned count)
+      {
+        unsigned i = 0;
+
+        // Drain current block.
+        for (; i < count && m_pos < 4; ++i)
+          values[i] = toUniform(m_out[m_pos++]);
+
+        // Whole blocks.
+        uint32_t block[4];
+        for (; i + 4 <= count; i += 4)
+        {
+          advance(block);
+          values[i + 0] = toUniform(block[0]);
+          values[i + 1] = toUniform(block[1]);
+          values[i + 2] = toUniform(block[2]);
+          values[i + 3] = toUniform(block[3]);
+        }
+
+        // Tail.
+        for (; i < count; ++i)
+          values[i] = uniform();
+      }
+
+      void
+      Philox::fillGaussian(double* values, unsigned count)
+      {
+        boxMuller(values, count);
+      }
+    }
+  }
+}
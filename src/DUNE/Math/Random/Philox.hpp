@@ -0,0 +1,130 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_MATH_RANDOM_PHILOX_HPP_INCLUDED_
+#define DUNE_MATH_RANDOM_PHILOX_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Math/Random/Generator.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    namespace Random
+    {
+      // Export DLL Symbol.
+      class DUNE_DLL_SYM Philox;
+
+      //! Philox4x32-10 counter-based generator (Salmon et al.,
+      //! "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11).
+      //!
+      //! Each output block of four 32-bit words is a pure function of
+      //! a 128-bit counter and a 64-bit key, so independent streams
+      //! are obtained by changing the key (seed and stream number)
+      //! and any position of a stream can be reached in constant time.
+      class Philox: public Generator
+      {
+      public:
+        using Generator::uniform;
+        using Generator::fillUniform;
+        using Generator::fillGaussian;
+
+        //! Create generator with an arbitrary seed.
+        Philox(void);
+
+        //! Create generator with a given seed.
+        //! @param seed_value seed.
+        //! @param stream stream number.
+        Philox(int32_t seed_value, uint32_t stream = 0);
+
+        ~Philox(void);
+
+        //! Re-initialize generator with given seed, keeping the
+        //! current stream number. The counter is reset.
+        //! @param value value for seed.
+        void
+        seed(int32_t value);
+
+        //! Select stream. The counter is reset.
+        //! @param stream stream number.
+        void
+        setStream(uint32_t stream);
+
+        //! Set position in the current stream.
+        //! @param block index of the next block of four words.
+        void
+        setCounter(uint64_t block);
+
+        int32_t
+        random(void);
+
+        //! Generate number uniformly distributed in (0,1), with 32
+        //! bits of resolution. Zero and one are never returned.
+        //! @return generated number.
+        double
+        uniform(void);
+
+        void
+        fillUniform(double* values, unsigned count);
+
+        void
+        fillGaussian(double* values, unsigned count);
+
+        //! Compute one block of the generator.
+        //! @param ctr counter.
+        //! @param key key.
+        //! @param out output block.
+        static void
+        generate(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4]);
+
+      private:
+        //! Key.
+        uint32_t m_key[2];
+        //! Counter of the next block.
+        uint32_t m_ctr[4];
+        //! Current block.
+        uint32_t m_out[4];
+        //! Index of the next word in the current block.
+        unsigned m_pos;
+
+        //! Get next 32-bit word.
+        uint32_t
+        next(void);
+
+        //! Compute current block and advance counter.
+        void
+        advance(uint32_t out[4]);
+      };
+    }
+  }
+}
+
+#endif
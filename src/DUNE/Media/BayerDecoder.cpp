@@ -29,6 +29,10 @@
 // Based on libdc1394.                                                      *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Media/BayerDecoder.hpp>
@@ -51,42 +55,50 @@ namespace DUNE
       {
         case METHOD_NEAREST:
           m_decoder = &BayerDecoder::decodeNearest;
+          m_border = 1;
+          m_border_top_left = false;
           break;
         case METHOD_HQLINEAR:
           m_decoder = &BayerDecoder::decodeHQLinear;
+          m_border = 2;
+          m_border_top_left = true;
           break;
         default:
           m_decoder = &BayerDecoder::decodeBilinear;
+          m_border = 1;
+          m_border_top_left = true;
           break;
       }
     }
 
     void
-    BayerDecoder::decodeNearest(const uint8_t* bayer, uint8_t* rgb, int sx, int sy) const
+    BayerDecoder::decodeToRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height, int first, int last) const
     {
+      clearBorders(rgb, width, height, first, last);
+
+      // Rows processed by decoders exclude the borders.
+      int top = m_border_top_left ? m_border : 0;
+      int begin = std::max(first, top) - top;
+      int end = std::min(last, height - m_border) - top;
+
+      if (begin < end)
+        ((*this).*(m_decoder))(bayer, rgb, width, height, begin, end);
+    }
+
+    void
+    BayerDecoder::decodeNearest(const uint8_t* bayer, uint8_t* rgb, int sx, int sy, int begin, int end) const
+    {
+      (void)sy;
       const int bayer_step = sx;
       const int rgb_step = 3 * sx;
       int width = sx;
-      int height = sy;
-      int blue = m_blue_line;
-      bool start_with_green = m_start_with_green;
-      int i;
-
-      int imax = sx * sy * 3;
-      for (i = sx * (sy - 1) * 3; i < imax; i++)
-        rgb[i] = 0;
-
-      int iinc = (sx - 1) * 3;
-      for (i = (sx - 1) * 3; i < imax; i += iinc)
-      {
-        rgb[i++] = 0;
-        rgb[i++] = 0;
-        rgb[i++] = 0;
-      }
+      int height = end - begin;
+      int blue = (begin % 2) ? -m_blue_line : m_blue_line;
+      bool start_with_green = (begin % 2) ? !m_start_with_green : m_start_with_green;
 
-      rgb += 1;
+      bayer += begin * bayer_step;
+      rgb += begin * rgb_step + 1;
       width -= 1;
-      height -= 1;
 
       for (; height--; bayer += bayer_step, rgb += rgb_step)
       {
@@ -146,18 +158,18 @@ namespace DUNE
     }
 
     void
-    BayerDecoder::decodeBilinear(const uint8_t* bayer, uint8_t* rgb, int sx, int sy) const
+    BayerDecoder::decodeBilinear(const uint8_t* bayer, uint8_t* rgb, int sx, int sy, int begin, int end) const
     {
+      (void)sy;
       const int bayer_step = sx;
       const int rgb_step = 3 * sx;
       int width = sx;
-      int height = sy;
-      int blue = m_blue_line;
-      bool start_with_green = m_start_with_green;
+      int height = end - begin;
+      int blue = (begin % 2) ? -m_blue_line : m_blue_line;
+      bool start_with_green = (begin % 2) ? !m_start_with_green : m_start_with_green;
 
-      clearBorders(rgb, sx, sy, 1);
-      rgb += rgb_step + 3 + 1;
-      height -= 2;
+      bayer += begin * bayer_step;
+      rgb += (begin + 1) * rgb_step + 3 + 1;
       width -= 2;
 
       for (; height--; bayer += bayer_step, rgb += rgb_step)
@@ -238,22 +250,20 @@ namespace DUNE
     }
 
     void
-    BayerDecoder::decodeHQLinear(const uint8_t* bayer, uint8_t* rgb, int sx, int sy) const
+    BayerDecoder::decodeHQLinear(const uint8_t* bayer, uint8_t* rgb, int sx, int sy, int begin, int end) const
     {
+      (void)sy;
       const int bayer_step = sx;
       const int rgb_step = 3 * sx;
       int width = sx;
-      int height = sy;
-      int blue = m_blue_line;
-      bool start_with_green = m_start_with_green;
+      int height = end - begin;
+      int blue = (begin % 2) ? m_blue_line : -m_blue_line;
+      bool start_with_green = (begin % 2) ? !m_start_with_green : m_start_with_green;
 
-      clearBorders(rgb, sx, sy, 2);
-      rgb += 2 * rgb_step + 6 + 1;
-      height -= 4;
+      bayer += begin * bayer_step;
+      rgb += (begin + 2) * rgb_step + 6 + 1;
       width -= 4;
 
-      blue = -blue;
-
       for (; height--; bayer += bayer_step, rgb += rgb_step)
       {
         int t0;
@@ -435,27 +445,26 @@ namespace DUNE
     }
 
     void
-    BayerDecoder::clearBorders(uint8_t* rgb, int sx, int sy, int w)
+    BayerDecoder::clearBorders(uint8_t* rgb, int sx, int sy, int first, int last) const
     {
-      int i = 3 * sx * w - 1;
-      int j = 3 * sx * sy - 1;
-      while (i >= 0)
-      {
-        rgb[i--] = 0;
-        rgb[j--] = 0;
-      }
+      int top = m_border_top_left ? m_border : 0;
+      int left = 3 * top;
+      int right = 3 * m_border;
+      int row_size = 3 * sx;
 
-      int low = sx * (w - 1) * 3 - 1 + w * 3;
-      i = low + sx * (sy - w * 2 + 1) * 3;
-      while (i > low)
+      for (int row = first; row < last; ++row)
       {
-        j = 6 * w;
-        while (j > 0)
+        uint8_t* ptr = rgb + row * row_size;
+
+        if (row < top || row >= sy - m_border)
+        {
+          std::memset(ptr, 0, row_size);
+        }
+        else
         {
-          rgb[i--] = 0;
-          j--;
+          std::memset(ptr, 0, left);
+          std::memset(ptr + row_size - right, 0, right);
         }
-        i -= (sx - 2 * w) * 3;
       }
     }
   }
@@ -83,14 +83,32 @@ namespace DUNE
       void
       decodeToRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height) const
       {
-        ((*this).*(m_decoder))(bayer, rgb, width, height);
+        decodeToRGB24(bayer, rgb, width, height, 0, height);
       }
 
+      //! Convert a horizontal stripe of a Bayer mosaic to RGB24.
+      //! Stripes only write their own rows of the output, so
+      //! disjoint stripes of the same image can be converted
+      //! concurrently.
+      //! @param[in] bayer bayer mosaic.
+      //! @param[out] rgb RGB24 image.
+      //! @param[in] width width of bayer mosaic.
+      //! @param[in] height height of bayer mosaic.
+      //! @param[in] first first row of the stripe.
+      //! @param[in] last row after the last row of the stripe.
+      void
+      decodeToRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height, int first, int last) const;
+
     private:
       //! Type of decoder functions.
-      typedef void (BayerDecoder::*Decoder)(const uint8_t*, uint8_t*, int, int) const;
+      typedef void (BayerDecoder::*Decoder)(const uint8_t*, uint8_t*, int, int, int, int) const;
       //! Pointer to decoder.
       Decoder m_decoder;
+      //! Width of the image border left undecoded by the decoder.
+      int m_border;
+      //! True if the decoder leaves the top and left borders
+      //! undecoded.
+      bool m_border_top_left;
       //! True if tile starts with a green pixel.
       bool m_start_with_green;
       int m_blue_line;
@@ -100,16 +118,20 @@ namespace DUNE
       //! @param[out] rgb RGB24 image.
       //! @param[in] width width of bayer mosaic.
       //! @param[in] height height of bayer mosaic.
+      //! @param[in] begin first row processed by the decoder.
+      //! @param[in] end row after the last row processed by the decoder.
       void
-      decodeNearest(const uint8_t* bayer, uint8_t* rgb, int width, int height) const;
+      decodeNearest(const uint8_t* bayer, uint8_t* rgb, int width, int height, int begin, int end) const;
 
       //! Convert Bayer mosaic to RGB24 using bilinear interpolation.
       //! @param[in] bayer bayer mosaic.
       //! @param[out] rgb RGB24 image.
       //! @param[in] width width of bayer mosaic.
       //! @param[in] height height of bayer mosaic.
+      //! @param[in] begin first row processed by the decoder.
+      //! @param[in] end row after the last row processed by the decoder.
       void
-      decodeBilinear(const uint8_t* bayer, uint8_t* rgb, int width, int height) const;
+      decodeBilinear(const uint8_t* bayer, uint8_t* rgb, int width, int height, int begin, int end) const;
 
       //! Convert Bayer mosaic to RGB24 using high-quality linear
       //! interpolation.
@@ -117,16 +139,19 @@ namespace DUNE
       //! @param[out] rgb RGB24 image.
       //! @param[in] width width of bayer mosaic.
       //! @param[in] height height of bayer mosaic.
+      //! @param[in] begin first row processed by the decoder.
+      //! @param[in] end row after the last row processed by the decoder.
       void
-      decodeHQLinear(const uint8_t* bayer, uint8_t* rgb, int width, int height) const;
+      decodeHQLinear(const uint8_t* bayer, uint8_t* rgb, int width, int height, int begin, int end) const;
 
-      //! Clear image borders.
+      //! Clear the image borders of a stripe.
       //! @param[in] rgb RGB24 image.
       //! @param[in] width image width.
       //! @param[in] height image height.
-      //! @param[in] w border width.
-      static void
-      clearBorders(uint8_t* rgb, int width, int height, int w);
+      //! @param[in] first first row of the stripe.
+      //! @param[in] last row after the last row of the stripe.
+      void
+      clearBorders(uint8_t* rgb, int width, int height, int first, int last) const;
 
       //! Clip value to fit in 8 bits.
       //! @param[in] in input value.
@@ -0,0 +1,323 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Media/ImagePipeline.hpp>
+#include <DUNE/Media/JPEGCompressor.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    //! Pipeline worker, with its own JPEG encoder.
+    class ImagePipeline::Worker: public Concurrency::Thread
+    {
+    public:
+      Worker(ImagePipeline& pipeline):
+        m_pipeline(pipeline)
+      {
+        m_jpeg.setInputDimensions(pipeline.m_width, pipeline.m_height);
+        m_jpeg.setInputColorSpace(JPEGCompressor::CS_RGB);
+        m_jpeg.setOutputColorSpace(JPEGCompressor::CS_YUV);
+      }
+
+    private:
+      //! Parent pipeline.
+      ImagePipeline& m_pipeline;
+      //! JPEG encoder.
+      JPEGCompressor m_jpeg;
+
+      void
+      run(void)
+      {
+        Job job;
+
+        while (m_pipeline.take(job))
+        {
+          Image* image = job.image;
+
+          if (job.stripe >= 0)
+          {
+            int first = 0;
+            int last = 0;
+            m_pipeline.getStripe(job.stripe, first, last);
+            m_pipeline.m_decoder->decodeToRGB24(&image->bayer[0], &image->rgb[0],
+                                                m_pipeline.m_width, m_pipeline.m_height,
+                                                first, last);
+          }
+          else
+          {
+            m_jpeg.compress(&image->rgb[0], job.quality);
+            image->jpeg.assign(m_jpeg.imageData(), m_jpeg.imageData() + m_jpeg.imageSize());
+          }
+
+          m_pipeline.finish(job);
+        }
+      }
+    };
+
+    ImagePipeline::ImagePipeline(unsigned width, unsigned height, unsigned buffers, unsigned workers):
+      m_width(width),
+      m_height(height),
+      m_stripes(workers == 0 ? 1 : workers),
+      m_decoder(NULL),
+      m_quality(90),
+      m_encoding(true),
+      m_next_submit(0),
+      m_next_deliver(0),
+      m_latency_sum(0),
+      m_stopping(false)
+    {
+      m_stats.submitted = 0;
+      m_stats.completed = 0;
+      m_stats.dropped = 0;
+      m_stats.latency_mean = 0;
+      m_stats.latency_max = 0;
+
+      for (unsigned i = 0; i < buffers; ++i)
+      {
+        Image* image = new Image;
+        image->rgb.resize(width * height * 3);
+        image->timestamp = 0;
+        image->submitted = 0;
+        image->sequence = 0;
+        image->stripes = 0;
+        m_images.push_back(image);
+        m_free.push_back(image);
+      }
+
+      for (unsigned i = 0; i < m_stripes; ++i)
+        m_workers.push_back(new Worker(*this));
+    }
+
+    ImagePipeline::~ImagePipeline(void)
+    {
+      m_cond.lock();
+      m_stopping = true;
+      m_cond.broadcast();
+      m_cond.unlock();
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+      {
+        if (m_workers[i]->isCreated())
+          m_workers[i]->join();
+        delete m_workers[i];
+      }
+
+      for (unsigned i = 0; i < m_images.size(); ++i)
+        delete m_images[i];
+
+      delete m_decoder;
+    }
+
+    void
+    ImagePipeline::setBayer(BayerDecoder::Tile tile, BayerDecoder::Method method)
+    {
+      delete m_decoder;
+      m_decoder = new BayerDecoder(tile, method);
+
+      for (unsigned i = 0; i < m_images.size(); ++i)
+        m_images[i]->bayer.resize(m_width * m_height);
+    }
+
+    void
+    ImagePipeline::setQuality(unsigned quality)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_quality = quality > 100 ? 100 : quality;
+    }
+
+    void
+    ImagePipeline::setEncoding(bool enabled)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_encoding = enabled;
+    }
+
+    void
+    ImagePipeline::start(void)
+    {
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+        m_workers[i]->start();
+    }
+
+    ImagePipeline::Image*
+    ImagePipeline::acquire(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (m_free.empty())
+      {
+        ++m_stats.dropped;
+        return NULL;
+      }
+
+      Image* image = m_free.back();
+      m_free.pop_back();
+      return image;
+    }
+
+    void
+    ImagePipeline::submit(Image* image, double timestamp)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      image->timestamp = timestamp;
+      image->submitted = Time::Clock::get();
+      image->sequence = m_next_submit++;
+      image->jpeg.clear();
+      ++m_stats.submitted;
+
+      Job job;
+      job.image = image;
+      job.quality = m_quality;
+
+      if (m_decoder != NULL)
+      {
+        image->stripes = m_stripes;
+        for (unsigned i = 0; i < m_stripes; ++i)
+        {
+          job.stripe = i;
+          m_jobs.push_back(job);
+        }
+      }
+      else
+      {
+        image->stripes = 0;
+        job.stripe = -1;
+        if (m_encoding)
+          m_jobs.push_back(job);
+        else
+          complete(image);
+      }
+
+      m_cond.broadcast();
+    }
+
+    ImagePipeline::Image*
+    ImagePipeline::wait(double timeout)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      double deadline = Time::Clock::get() + timeout;
+      while (m_done.empty() || m_done.begin()->first != m_next_deliver)
+      {
+        double remaining = deadline - Time::Clock::get();
+        if (remaining <= 0 || !m_cond.wait(remaining))
+          return NULL;
+      }
+
+      Image* image = m_done.begin()->second;
+      m_done.erase(m_done.begin());
+      ++m_next_deliver;
+      return image;
+    }
+
+    void
+    ImagePipeline::release(Image* image)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_free.push_back(image);
+    }
+
+    ImagePipeline::Statistics
+    ImagePipeline::getStatistics(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_stats;
+    }
+
+    bool
+    ImagePipeline::take(Job& job)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      while (m_jobs.empty() && !m_stopping)
+        m_cond.wait();
+
+      if (m_stopping)
+        return false;
+
+      job = m_jobs.front();
+      m_jobs.pop_front();
+      return true;
+    }
+
+    void
+    ImagePipeline::finish(const Job& job)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      Image* image = job.image;
+
+      // Encode once all stripes are done.
+      if (job.stripe >= 0 && --image->stripes > 0)
+        return;
+
+      if (job.stripe >= 0 && m_encoding)
+      {
+        Job encode = job;
+        encode.stripe = -1;
+        m_jobs.push_back(encode);
+        m_cond.broadcast();
+        return;
+      }
+
+      complete(image);
+    }
+
+    void
+    ImagePipeline::complete(Image* image)
+    {
+      double latency = Time::Clock::get() - image->submitted;
+      ++m_stats.completed;
+      m_latency_sum += latency;
+      m_stats.latency_mean = m_latency_sum / m_stats.completed;
+      if (latency > m_stats.latency_max)
+        m_stats.latency_max = latency;
+
+      m_done[image->sequence] = image;
+      m_cond.broadcast();
+    }
+
+    void
+    ImagePipeline::getStripe(int stripe, int& first, int& last) const
+    {
+      first = (int)((uint64_t)m_height * stripe / m_stripes);
+      last = (int)((uint64_t)m_height * (stripe + 1) / m_stripes);
+    }
+  }
+}
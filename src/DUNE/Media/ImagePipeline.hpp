@@ -0,0 +1,237 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_MEDIA_IMAGE_PIPELINE_HPP_INCLUDED_
+#define DUNE_MEDIA_IMAGE_PIPELINE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <deque>
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Media/BayerDecoder.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ImagePipeline;
+
+    //! Concurrent Bayer demosaicing and JPEG encoding of image
+    //! streams.
+    //!
+    //! Images go through preallocated, recycled buffers: the
+    //! producer acquires a free image, fills its input (Bayer mosaic
+    //! or RGB24), submits it and later receives it back, in
+    //! submission order, with the RGB24 and JPEG versions. A pool of
+    //! workers demosaics each image in horizontal stripes and then
+    //! encodes it, so the stripes of one image and the encoding of
+    //! consecutive images proceed concurrently. When no free image
+    //! is available the frame is counted as dropped.
+    class ImagePipeline
+    {
+    public:
+      //! Default number of workers.
+      static const unsigned c_workers = 4;
+
+      //! Image buffers.
+      struct Image
+      {
+        //! Bayer mosaic (width x height), when demosaicing.
+        std::vector<uint8_t> bayer;
+        //! RGB24 image (width x height x 3).
+        std::vector<uint8_t> rgb;
+        //! JPEG image.
+        std::vector<uint8_t> jpeg;
+        //! Timestamp set by the producer.
+        double timestamp;
+        //! Time of submission (monotonic clock).
+        double submitted;
+        //! Submission order.
+        uint64_t sequence;
+        //! Number of pending stripes.
+        unsigned stripes;
+      };
+
+      //! Pipeline statistics.
+      struct Statistics
+      {
+        //! Number of submitted images.
+        uint64_t submitted;
+        //! Number of completed images.
+        uint64_t completed;
+        //! Number of frames dropped for lack of free images.
+        uint64_t dropped;
+        //! Mean time from submission to completion (s).
+        double latency_mean;
+        //! Maximum time from submission to completion (s).
+        double latency_max;
+      };
+
+      //! Constructor.
+      //! @param[in] width image width.
+      //! @param[in] height image height.
+      //! @param[in] buffers number of image buffers.
+      //! @param[in] workers number of worker threads.
+      ImagePipeline(unsigned width, unsigned height, unsigned buffers = 8, unsigned workers = c_workers);
+
+      //! Destructor. Stops workers; images in flight are discarded.
+      ~ImagePipeline(void);
+
+      //! Demosaic images with the given tile format and method. Must
+      //! be called before starting; without it images are RGB24.
+      //! @param[in] tile tile format.
+      //! @param[in] method decoding method.
+      void
+      setBayer(BayerDecoder::Tile tile, BayerDecoder::Method method);
+
+      //! Set JPEG quality.
+      //! @param[in] quality quality (0 - 100).
+      void
+      setQuality(unsigned quality);
+
+      //! Enable or disable JPEG encoding.
+      //! @param[in] enabled true to encode images.
+      void
+      setEncoding(bool enabled);
+
+      //! Start the workers.
+      void
+      start(void);
+
+      //! Get a free image to fill.
+      //! @return image or NULL if none is free (counts as dropped).
+      Image*
+      acquire(void);
+
+      //! Queue a filled image for processing.
+      //! @param[in] image image obtained with acquire().
+      //! @param[in] timestamp image timestamp.
+      void
+      submit(Image* image, double timestamp);
+
+      //! Wait for the next processed image, in submission order.
+      //! @param[in] timeout maximum amount of time to wait (s).
+      //! @return image or NULL on timeout; must be given back with
+      //! release().
+      Image*
+      wait(double timeout);
+
+      //! Give back an image obtained from acquire() or wait().
+      //! @param[in] image image.
+      void
+      release(Image* image);
+
+      //! Get statistics.
+      //! @return statistics.
+      Statistics
+      getStatistics(void);
+
+    private:
+      class Worker;
+
+      //! Unit of work.
+      struct Job
+      {
+        //! Image.
+        Image* image;
+        //! Stripe to demosaic, or -1 to encode.
+        int stripe;
+        //! JPEG quality.
+        unsigned quality;
+      };
+
+      //! Image width.
+      unsigned m_width;
+      //! Image height.
+      unsigned m_height;
+      //! Number of stripes per image.
+      unsigned m_stripes;
+      //! Bayer decoder or NULL.
+      BayerDecoder* m_decoder;
+      //! JPEG quality.
+      unsigned m_quality;
+      //! True to encode images.
+      bool m_encoding;
+      //! All images.
+      std::vector<Image*> m_images;
+      //! Free images.
+      std::vector<Image*> m_free;
+      //! Pending jobs.
+      std::deque<Job> m_jobs;
+      //! Processed images waiting for earlier ones, by sequence.
+      std::map<uint64_t, Image*> m_done;
+      //! Sequence of the next image to submit.
+      uint64_t m_next_submit;
+      //! Sequence of the next image to deliver.
+      uint64_t m_next_deliver;
+      //! Statistics.
+      Statistics m_stats;
+      //! Sum of latencies (s).
+      double m_latency_sum;
+      //! Workers.
+      std::vector<Worker*> m_workers;
+      //! Lock and signal for jobs and completions.
+      Concurrency::Condition m_cond;
+      //! True when stopping.
+      bool m_stopping;
+
+      //! Take the next job, blocking until one is available.
+      //! @param[out] job job.
+      //! @return false when stopping.
+      bool
+      take(Job& job);
+
+      //! Mark a job done.
+      //! @param[in] job job.
+      void
+      finish(const Job& job);
+
+      //! Queue a processed image for delivery.
+      //! @param[in] image image.
+      void
+      complete(Image* image);
+
+      //! Get rows of a stripe.
+      void
+      getStripe(int stripe, int& first, int& last) const;
+
+      ImagePipeline(const ImagePipeline&);
+
+      ImagePipeline&
+      operator=(const ImagePipeline&);
+    };
+  }
+}
+
+#endif
@@ -191,12 +191,19 @@ namespace DUNE
       jpeg_set_quality(m_jcinfo, quality, TRUE);
       jpeg_start_compress(m_jcinfo, TRUE);
 
-      JSAMPROW row_pointer[1];
+      // Hand rows in batches, libjpeg consumes them in MCU rows.
+      JSAMPROW row_pointers[c_rows_per_write];
       int row_stride = m_jcinfo->image_width * m_jcinfo->input_components;
       while (m_jcinfo->next_scanline < m_jcinfo->image_height)
       {
-        row_pointer[0] = &raw[m_jcinfo->next_scanline * row_stride];
-        jpeg_write_scanlines(m_jcinfo, row_pointer, 1);
+        JDIMENSION count = m_jcinfo->image_height - m_jcinfo->next_scanline;
+        if (count > c_rows_per_write)
+          count = c_rows_per_write;
+
+        for (JDIMENSION i = 0; i < count; ++i)
+          row_pointers[i] = &raw[(m_jcinfo->next_scanline + i) * row_stride];
+
+        jpeg_write_scanlines(m_jcinfo, row_pointers, count);
       }
 
       jpeg_finish_compress(m_jcinfo);
@@ -122,6 +122,8 @@ namespace DUNE
       const static uint32_t c_default_width = 640;
       //! Default image height.
       const static uint32_t c_default_height = 480;
+      //! Number of rows handed to the encoder at once.
+      const static uint32_t c_rows_per_write = 16;
       //! Default compression quality.
       const static uint8_t c_default_quality = 90;
       //! Default input color space.
@@ -27,6 +27,9 @@
 // Author: Jose Pinto                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/Network/FragmentedMessage.hpp>
 
@@ -38,6 +41,9 @@ namespace DUNE
     {
       m_parent = NULL;
       m_src = m_uid = m_creation_time = m_num_frags = -1;
+      m_received = 0;
+      m_size = 0;
+      std::memset(m_bitmap, 0, sizeof(m_bitmap));
     }
 
     void
@@ -56,6 +62,7 @@ namespace DUNE
         m_uid = part->uid;
         m_src = part->getSource();
         m_creation_time = Time::Clock::get();
+        m_fragments.resize(m_num_frags);
       }
 
       // Check if this is a valid fragment
@@ -70,23 +77,27 @@ namespace DUNE
         return NULL;
       }
 
-      m_fragments[part->frag_number] = *part;
+      // Ignore duplicates.
+      if (!isFragmentMissing(part->frag_number))
+        return NULL;
+
+      m_bitmap[part->frag_number / 32] |= (1u << (part->frag_number % 32));
+      m_fragments[part->frag_number] = part->data;
+      m_size += part->data.size();
+      ++m_received;
 
       // Message is complete. Let's reassemble and return it.
       if (getFragmentsMissing() == 0)
       {
-        int i;
-        int total_length = 0;
         // concatenate all parts into a single array
         std::vector<char> data;
-        for (i = 0; i < m_num_frags; i++)
-        {
-          total_length += m_fragments[i].data.size();
-          data.insert(data.end(), m_fragments[i].data.begin(),
-                      m_fragments[i].data.end());
-        }
-
-        return IMC::Packet::deserialize((uint8_t*)&data[0], total_length);
+        data.reserve(m_size);
+
+        const std::vector<IMC::RawData>& frags = m_fragments;
+        for (int i = 0; i < m_num_frags; i++)
+          data.insert(data.end(), frags[i].begin(), frags[i].end());
+
+        return IMC::Packet::deserialize((uint8_t*)&data[0], data.size());
       }
       else
       {
@@ -94,6 +105,27 @@ namespace DUNE
       }
     }
 
+    bool
+    FragmentedMessage::isFragmentMissing(unsigned frag_number) const
+    {
+      if ((int)frag_number >= m_num_frags)
+        return false;
+
+      return (m_bitmap[frag_number / 32] & (1u << (frag_number % 32))) == 0;
+    }
+
+    void
+    FragmentedMessage::getMissingFragments(std::vector<unsigned>& list) const
+    {
+      list.clear();
+
+      for (int i = 0; i < m_num_frags; ++i)
+      {
+        if (isFragmentMissing(i))
+          list.push_back(i);
+      }
+    }
+
     double
     FragmentedMessage::getAge(void)
     {
@@ -106,7 +138,7 @@ namespace DUNE
     int
     FragmentedMessage::getFragmentsMissing(void)
     {
-      return m_num_frags - m_fragments.size();
+      return m_num_frags - m_received;
     }
 
     FragmentedMessage::~FragmentedMessage(void)
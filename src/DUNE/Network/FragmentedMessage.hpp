@@ -30,6 +30,9 @@
 #ifndef DUNE_NETWORK_FRAGMENTED_MESSAGE_HPP_INCLUDED_
 #define DUNE_NETWORK_FRAGMENTED_MESSAGE_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/IMC.hpp>
 #include <DUNE/Tasks.hpp>
@@ -39,6 +42,10 @@ namespace DUNE
 {
   namespace Network
   {
+    //! Reassembly of a message from its MessagePart fragments.
+    //! Received fragments are tracked with a bitmap and their data
+    //! is shared with the received MessagePart objects until the
+    //! message is complete.
     class FragmentedMessage
     {
     public:
@@ -50,6 +57,26 @@ namespace DUNE
       int
       getFragmentsMissing(void);
 
+      //! Test if a given fragment is still missing.
+      //! @param[in] frag_number fragment number.
+      //! @return true if the fragment was not received, false otherwise.
+      bool
+      isFragmentMissing(unsigned frag_number) const;
+
+      //! Retrieve the numbers of the fragments still missing, suitable
+      //! for a selective retransmission request.
+      //! @param[out] list fragment numbers.
+      void
+      getMissingFragments(std::vector<unsigned>& list) const;
+
+      //! Retrieve the number of fragment data bytes held.
+      //! @return number of bytes.
+      unsigned
+      getSize(void) const
+      {
+        return m_size;
+      }
+
       IMC::Message*
       setFragment(const IMC::MessagePart* part);
 
@@ -59,12 +86,20 @@ namespace DUNE
       ~FragmentedMessage(void);
 
     private:
+      //! Number of words of the reception bitmap.
+      static const unsigned c_bitmap_words = 8;
+
       int m_src;
       int m_uid;
       int m_num_frags;
+      int m_received;
+      unsigned m_size;
       double m_creation_time;
       DUNE::Tasks::Task* m_parent;
-      std::map<unsigned int, IMC::MessagePart> m_fragments;
+      //! Reception bitmap.
+      uint32_t m_bitmap[c_bitmap_words];
+      //! Fragment data.
+      std::vector<IMC::RawData> m_fragments;
     };
   }
 }
@@ -27,7 +27,11 @@
 // Author: Jose Pinto                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+
 // DUNE headers.
+#include <DUNE/Algorithms/CRC16.hpp>
 #include <DUNE/Network/Fragments.hpp>
 
 namespace DUNE
@@ -47,33 +51,93 @@ namespace DUNE
         return;
       }
 
-      Utils::ByteBuffer buff;
-      int size = IMC::Packet::serialize(msg, buff);
-      uint8_t* buffer = buff.getBuffer();
+      int size = IMC::Packet::serialize(msg, m_data);
+      int num_frags = (size + frag_size - 1) / frag_size;
+      if (num_frags > 255)
+      {
+        DUNE_ERR("Fragments", "MTU is too small for message size");
+        return;
+      }
 
-      int part = 0, pos = 0;
-      m_num_frags = (int)std::ceil((float)size / (float)frag_size);
+      m_header.timestamp = msg->getTimeStamp();
+      m_header.src = msg->getSource();
+      m_header.src_ent = msg->getSourceEntity();
+      m_header.dst = msg->getDestination();
+      m_header.dst_ent = msg->getDestinationEntity();
 
-      while (pos < size)
+      m_num_frags = num_frags;
+      m_slices.resize(m_num_frags);
+      m_fragments.resize(m_num_frags, NULL);
+
+      for (int i = 0; i < m_num_frags; ++i)
       {
-        int remaining = size - pos;
-        int cur_size = std::min(remaining, frag_size);
-        IMC::MessagePart* mpart = new IMC::MessagePart();
-        mpart->frag_number = part++;
-        mpart->num_frags = m_num_frags;
-        mpart->uid = m_uid;
-        mpart->data.assign(buffer + pos, buffer + pos + cur_size);
-        pos += cur_size;
-        m_fragments.push_back(mpart);
+        m_slices[i].offset = i * frag_size;
+        m_slices[i].size = std::min(size - i * frag_size, frag_size);
       }
     }
 
+    void
+    Fragments::fillFragment(unsigned frag_number, IMC::MessagePart& part) const
+    {
+      part.setTimeStamp(m_header.timestamp);
+      part.setSource(m_header.src);
+      part.setSourceEntity(m_header.src_ent);
+      part.setDestination(m_header.dst);
+      part.setDestinationEntity(m_header.dst_ent);
+      part.uid = m_uid;
+      part.frag_number = frag_number;
+      part.num_frags = m_num_frags;
+    }
+
     IMC::MessagePart*
     Fragments::getFragment(int frag_number)
     {
+      if (m_fragments[frag_number] == NULL)
+      {
+        m_fragments[frag_number] = new IMC::MessagePart;
+        getFragment(frag_number, *m_fragments[frag_number]);
+      }
+
       return m_fragments[frag_number];
     }
 
+    void
+    Fragments::getFragment(unsigned frag_number, IMC::MessagePart& part) const
+    {
+      const Slice& slice = m_slices[frag_number];
+      const char* data = (const char*)m_data.getBuffer() + slice.offset;
+
+      fillFragment(frag_number, part);
+      part.data.assign(data, data + slice.size);
+    }
+
+    uint16_t
+    Fragments::serializeFragment(unsigned frag_number, uint8_t* bfr, uint16_t size) const
+    {
+      const Slice& slice = m_slices[frag_number];
+
+      IMC::MessagePart part;
+      fillFragment(frag_number, part);
+
+      uint16_t payload = part.getPayloadSerializationSize() + slice.size;
+      uint16_t total = DUNE_IMC_CONST_HEADER_SIZE + payload + DUNE_IMC_CONST_FOOTER_SIZE;
+      if (size < total)
+        throw IMC::BufferTooShort();
+
+      uint8_t* ptr = bfr + IMC::Packet::serializeHeader(&part, payload, bfr, size);
+      ptr += IMC::serialize(part.uid, ptr);
+      ptr += IMC::serialize(part.frag_number, ptr);
+      ptr += IMC::serialize(part.num_frags, ptr);
+      ptr += IMC::serialize(slice.size, ptr);
+      std::memcpy(ptr, m_data.getBuffer() + slice.offset, slice.size);
+      ptr += slice.size;
+
+      uint16_t crc = Algorithms::CRC16::compute(bfr, ptr - bfr);
+      ptr += IMC::serialize(crc, ptr);
+
+      return ptr - bfr;
+    }
+
     int
     Fragments::getNumberOfFragments(void)
     {
@@ -82,8 +146,10 @@ namespace DUNE
 
     Fragments::~Fragments(void)
     {
+      for (unsigned i = 0; i < m_fragments.size(); ++i)
+        delete m_fragments[i];
+
       m_fragments.clear();
     }
-
   } /* namespace Fragments */
 } /* namespace Transports */
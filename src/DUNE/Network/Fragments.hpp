@@ -30,6 +30,9 @@
 #ifndef DUNE_NETWORK_FRAGMENTS_HPP_INCLUDED_
 #define DUNE_NETWORK_FRAGMENTS_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/IMC.hpp>
 #include <DUNE/Tasks.hpp>
@@ -38,26 +41,69 @@ namespace DUNE
 {
   namespace Network
   {
+    //! Split a message in MessagePart fragments. The message is
+    //! serialized once and fragments are views over that buffer,
+    //! so any fragment can be (re)transmitted individually.
     class Fragments
     {
     public:
       Fragments(IMC::Message* message, int mtu);
 
+      //! Retrieve a fragment. The returned object is owned by this
+      //! object and created on first request.
+      //! @param[in] frag_number fragment number.
+      //! @return fragment.
       IMC::MessagePart*
       getFragment(int frag_number);
 
+      //! Fill a MessagePart with a given fragment.
+      //! @param[in] frag_number fragment number.
+      //! @param[out] part message fragment.
+      void
+      getFragment(unsigned frag_number, IMC::MessagePart& part) const;
+
+      //! Serialize a fragment as a MessagePart packet, copying the
+      //! fragment data directly from the serialized message.
+      //! @param[in] frag_number fragment number.
+      //! @param[out] bfr destination buffer.
+      //! @param[in] size destination buffer size.
+      //! @return number of bytes written to the destination buffer.
+      uint16_t
+      serializeFragment(unsigned frag_number, uint8_t* bfr, uint16_t size) const;
+
       int
       getNumberOfFragments(void);
 
       ~Fragments(void);
 
     private:
+      //! Fragment view over the serialized message.
+      struct Slice
+      {
+        //! Offset in the serialized message.
+        unsigned offset;
+        //! Number of bytes.
+        uint16_t size;
+      };
+
       static int s_uid;
       int m_uid;
       int m_num_frags;
+      //! Header of the original message.
+      IMC::Header m_header;
+      //! Serialized message.
+      Utils::ByteBuffer m_data;
+      //! Fragment views.
+      std::vector<Slice> m_slices;
+      //! Fragments created on request.
       std::vector<IMC::MessagePart*> m_fragments;
-    };
 
+      //! Set the header and the fields of a fragment, except data.
+      //! @param[in] frag_number fragment number.
+      //! @param[out] part message fragment.
+      void
+      fillFragment(unsigned frag_number, IMC::MessagePart& part) const;
+    };
   }
 }
 
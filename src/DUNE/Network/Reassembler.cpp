@@ -0,0 +1,164 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Network/Reassembler.hpp>
+
+namespace DUNE
+{
+  namespace Network
+  {
+    Reassembler::Reassembler(unsigned budget):
+      m_budget(budget),
+      m_size(0),
+      m_evictions(0),
+      m_parent(NULL)
+    { }
+
+    void
+    Reassembler::setBudget(unsigned budget)
+    {
+      m_budget = budget;
+      enforceBudget(0);
+    }
+
+    IMC::Message*
+    Reassembler::add(const IMC::MessagePart* part)
+    {
+      uint32_t key = getKey(part->getSource(), part->uid);
+
+      EntryMap::iterator itr = m_entries.find(key);
+      if (itr == m_entries.end())
+      {
+        itr = m_entries.insert(std::make_pair(key, Entry())).first;
+        itr->second.message.setParentTask(m_parent);
+        itr->second.lru = m_lru.insert(m_lru.end(), key);
+      }
+      else
+      {
+        m_lru.splice(m_lru.end(), m_lru, itr->second.lru);
+      }
+
+      unsigned size = itr->second.message.getSize();
+      IMC::Message* msg = itr->second.message.setFragment(part);
+      m_size += itr->second.message.getSize() - size;
+
+      if (msg != NULL)
+      {
+        remove(itr);
+        return msg;
+      }
+
+      enforceBudget(key);
+      return NULL;
+    }
+
+    unsigned
+    Reassembler::expire(double max_age)
+    {
+      unsigned count = 0;
+      EntryMap::iterator itr = m_entries.begin();
+      while (itr != m_entries.end())
+      {
+        EntryMap::iterator next = itr;
+        ++next;
+
+        if (itr->second.message.getAge() > max_age)
+        {
+          if (m_parent != NULL)
+          {
+            m_parent->war(DTR("Removed incoming message from memory (%d fragments were still missing)."),
+                          itr->second.message.getFragmentsMissing());
+          }
+
+          remove(itr);
+          ++count;
+        }
+
+        itr = next;
+      }
+
+      return count;
+    }
+
+    bool
+    Reassembler::getMissingFragments(uint16_t src, uint8_t uid, std::vector<unsigned>& list) const
+    {
+      EntryMap::const_iterator itr = m_entries.find(getKey(src, uid));
+      if (itr == m_entries.end())
+        return false;
+
+      itr->second.message.getMissingFragments(list);
+      return true;
+    }
+
+    void
+    Reassembler::clear(void)
+    {
+      m_entries.clear();
+      m_lru.clear();
+      m_size = 0;
+    }
+
+    void
+    Reassembler::remove(EntryMap::iterator itr)
+    {
+      m_size -= itr->second.message.getSize();
+      m_lru.erase(itr->second.lru);
+      m_entries.erase(itr);
+    }
+
+    void
+    Reassembler::enforceBudget(uint32_t keep)
+    {
+      if (m_budget == 0)
+        return;
+
+      while (m_size > m_budget && !m_lru.empty())
+      {
+        uint32_t key = m_lru.front();
+
+        // Never evict the message being updated.
+        if (key == keep && m_lru.size() == 1)
+          break;
+
+        EntryMap::iterator itr = m_entries.find(key);
+
+        if (m_parent != NULL)
+        {
+          m_parent->war(DTR("memory budget exceeded, discarding incoming message (%d fragments were still missing)"),
+                        itr->second.message.getFragmentsMissing());
+        }
+
+        remove(itr);
+        ++m_evictions;
+      }
+    }
+  }
+}
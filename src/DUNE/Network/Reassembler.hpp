@@ -0,0 +1,164 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_NETWORK_REASSEMBLER_HPP_INCLUDED_
+#define DUNE_NETWORK_REASSEMBLER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <list>
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC.hpp>
+#include <DUNE/Tasks.hpp>
+#include <DUNE/Network/FragmentedMessage.hpp>
+
+namespace DUNE
+{
+  namespace Network
+  {
+    //! Reassembly of fragmented messages from multiple sources with a
+    //! bounded memory budget. When the budget is exceeded the least
+    //! recently updated incomplete messages are discarded.
+    class Reassembler
+    {
+    public:
+      //! Constructor.
+      //! @param[in] budget maximum number of bytes held by incomplete
+      //! messages (0 for unlimited).
+      Reassembler(unsigned budget = 0);
+
+      //! Set the memory budget.
+      //! @param[in] budget maximum number of bytes held by incomplete
+      //! messages (0 for unlimited).
+      void
+      setBudget(unsigned budget);
+
+      //! Set the task used to report errors.
+      //! @param[in] parent task.
+      void
+      setParentTask(Tasks::Task* parent)
+      {
+        m_parent = parent;
+      }
+
+      //! Add a fragment.
+      //! @param[in] part message fragment.
+      //! @return reassembled message (to be deleted by the caller) or
+      //! NULL if the message is not yet complete.
+      IMC::Message*
+      add(const IMC::MessagePart* part);
+
+      //! Discard incomplete messages older than a given age.
+      //! @param[in] max_age maximum age in seconds.
+      //! @return number of discarded messages.
+      unsigned
+      expire(double max_age);
+
+      //! Retrieve the fragments still missing from a message.
+      //! @param[in] src source system.
+      //! @param[in] uid transmission unique id.
+      //! @param[out] list missing fragment numbers.
+      //! @return true if the message is being reassembled, false otherwise.
+      bool
+      getMissingFragments(uint16_t src, uint8_t uid, std::vector<unsigned>& list) const;
+
+      //! Retrieve the number of incomplete messages.
+      //! @return number of messages.
+      unsigned
+      getCount(void) const
+      {
+        return m_entries.size();
+      }
+
+      //! Retrieve the number of bytes held by incomplete messages.
+      //! @return number of bytes.
+      unsigned
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Retrieve the number of messages discarded to honor the budget.
+      //! @return number of messages.
+      unsigned
+      getEvictions(void) const
+      {
+        return m_evictions;
+      }
+
+      //! Discard all incomplete messages.
+      void
+      clear(void);
+
+    private:
+      //! Least recently updated first.
+      typedef std::list<uint32_t> LRUList;
+
+      //! Incomplete message.
+      struct Entry
+      {
+        //! Fragments.
+        FragmentedMessage message;
+        //! Position in the LRU list.
+        LRUList::iterator lru;
+      };
+
+      typedef std::map<uint32_t, Entry> EntryMap;
+
+      //! Incomplete messages by key.
+      EntryMap m_entries;
+      //! Usage order.
+      LRUList m_lru;
+      //! Memory budget.
+      unsigned m_budget;
+      //! Bytes held.
+      unsigned m_size;
+      //! Evicted messages.
+      unsigned m_evictions;
+      //! Parent task.
+      Tasks::Task* m_parent;
+
+      static uint32_t
+      getKey(uint16_t src, uint8_t uid)
+      {
+        return ((uint32_t)uid << 16) | src;
+      }
+
+      void
+      remove(EntryMap::iterator itr);
+
+      void
+      enforceBudget(uint32_t keep);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,443 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_NETWORK_TX_QUEUE_HPP_INCLUDED_
+#define DUNE_NETWORK_TX_QUEUE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <deque>
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Network
+  {
+    //! Transmission scheduler for low-bandwidth links.
+    //!
+    //! Entries are served by priority class, then by earliest
+    //! deadline, then in arrival order. Entries pushed with the same
+    //! non-zero coalescing key replace each other, so only the newest
+    //! sample of periodic data (e.g., vehicle state) waits in the
+    //! queue. Several small entries can be popped together to fill a
+    //! frame of a given MTU. The queue also keeps the transmission
+    //! accounting of the link it serves.
+    //!
+    //! This class is not thread safe.
+    template <typename T>
+    class TxQueue
+    {
+    public:
+      //! Priority classes, most urgent first.
+      enum Priority
+      {
+        //! Safety related traffic (aborts, acknowledgements).
+        PRIORITY_CRITICAL = 0,
+        //! Commands and replies.
+        PRIORITY_HIGH = 1,
+        //! Default priority.
+        PRIORITY_NORMAL = 2,
+        //! Bulk and periodic telemetry.
+        PRIORITY_LOW = 3
+      };
+
+      //! Link accounting.
+      struct Statistics
+      {
+        //! Number of transmitted entries.
+        uint64_t tx_count;
+        //! Number of transmitted bytes.
+        uint64_t tx_bytes;
+        //! Number of entries that expired in the queue.
+        uint64_t expired;
+        //! Number of entries replaced by newer entries.
+        uint64_t coalesced;
+      };
+
+      //! Constructor.
+      TxQueue(void):
+        m_seq(0),
+        m_bytes(0),
+        m_rate_bps(0),
+        m_burst(0),
+        m_tokens(0),
+        m_last_fill(-1),
+        m_window(60.0)
+      {
+        clearStatistics();
+      }
+
+      //! Queue an entry.
+      //! @param value entry.
+      //! @param size number of bytes needed to transmit the entry.
+      //! @param priority priority class.
+      //! @param deadline absolute time after which the entry is
+      //! useless (s), negative for none.
+      void
+      push(const T& value, unsigned size, Priority priority, double deadline)
+      {
+        insert(value, size, priority, deadline, 0);
+      }
+
+      //! Queue an entry, replacing a queued entry with the same
+      //! coalescing key.
+      //! @param value entry.
+      //! @param size number of bytes needed to transmit the entry.
+      //! @param priority priority class.
+      //! @param deadline absolute time after which the entry is
+      //! useless (s), negative for none.
+      //! @param key coalescing key, zero to disable coalescing.
+      //! @param replaced entry removed from the queue.
+      //! @return true if an entry was replaced, false otherwise.
+      bool
+      push(const T& value, unsigned size, Priority priority, double deadline,
+           uint32_t key, T& replaced)
+      {
+        bool found = false;
+
+        if (key != 0)
+        {
+          typename std::map<uint32_t, Iterator>::iterator itr = m_keys.find(key);
+          if (itr != m_keys.end())
+          {
+            replaced = itr->second->second.value;
+            remove(itr->second);
+            ++m_stats.coalesced;
+            found = true;
+          }
+        }
+
+        insert(value, size, priority, deadline, key);
+        return found;
+      }
+
+      //! Remove expired entries.
+      //! @param now current time (s).
+      //! @param expired removed entries are appended here.
+      //! @return number of removed entries.
+      unsigned
+      expire(double now, std::vector<T>& expired)
+      {
+        unsigned count = 0;
+        Iterator itr = m_entries.begin();
+
+        while (itr != m_entries.end())
+        {
+          if (itr->first.deadline >= now)
+          {
+            // Skip to the next priority class.
+            Order next;
+            next.priority = itr->first.priority + 1;
+            next.deadline = -1;
+            next.seq = 0;
+            itr = m_entries.lower_bound(next);
+            continue;
+          }
+
+          expired.push_back(itr->second.value);
+          Iterator victim = itr++;
+          remove(victim);
+          ++m_stats.expired;
+          ++count;
+        }
+
+        return count;
+      }
+
+      //! Remove the most urgent entry and, if there is room left in
+      //! the frame, the next most urgent entries that fit.
+      //! @param mtu frame size, zero to remove a single entry.
+      //! @param values removed entries are appended here.
+      //! @return number of bytes of the removed entries.
+      unsigned
+      pop(unsigned mtu, std::vector<T>& values)
+      {
+        if (m_entries.empty())
+          return 0;
+
+        Iterator itr = m_entries.begin();
+        unsigned total = itr->second.size;
+        values.push_back(itr->second.value);
+        remove(itr++);
+
+        if (mtu == 0)
+          return total;
+
+        while (itr != m_entries.end() && total < mtu)
+        {
+          if (total + itr->second.size > mtu)
+          {
+            ++itr;
+            continue;
+          }
+
+          total += itr->second.size;
+          values.push_back(itr->second.value);
+          remove(itr++);
+        }
+
+        return total;
+      }
+
+      //! Remove all entries.
+      //! @param values removed entries are appended here.
+      void
+      clear(std::vector<T>& values)
+      {
+        for (Iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+          values.push_back(itr->second.value);
+
+        m_entries.clear();
+        m_keys.clear();
+        m_bytes = 0;
+      }
+
+      //! Test if the queue is empty.
+      //! @return true if the queue is empty, false otherwise.
+      bool
+      empty(void) const
+      {
+        return m_entries.empty();
+      }
+
+      //! Retrieve the number of queued entries.
+      //! @return number of entries.
+      unsigned
+      size(void) const
+      {
+        return m_entries.size();
+      }
+
+      //! Retrieve the number of queued bytes.
+      //! @return number of bytes.
+      unsigned
+      getBytes(void) const
+      {
+        return m_bytes;
+      }
+
+      //! Limit the transmission rate of the link.
+      //! @param rate average rate (bytes/s), zero for no limit.
+      //! @param burst largest amount of bytes that can be sent at
+      //! once after the link was idle.
+      void
+      setBandwidth(double rate, double burst)
+      {
+        m_rate_bps = rate;
+        m_burst = burst;
+        m_tokens = burst;
+        m_last_fill = -1;
+      }
+
+      //! Set the averaging window of the transmission rate.
+      //! @param window window length (s).
+      void
+      setRateWindow(double window)
+      {
+        m_window = window;
+      }
+
+      //! Test if the link bandwidth allows sending a frame.
+      //! @param size frame size.
+      //! @param now current time (s).
+      //! @return true if the frame can be sent, false otherwise.
+      bool
+      canSend(unsigned size, double now)
+      {
+        if (m_rate_bps <= 0)
+          return true;
+
+        fill(now);
+        return m_tokens >= size || (m_tokens >= m_burst && m_burst < size);
+      }
+
+      //! Account a transmission on the link.
+      //! @param count number of entries.
+      //! @param bytes number of bytes.
+      //! @param now current time (s).
+      void
+      account(unsigned count, unsigned bytes, double now)
+      {
+        m_stats.tx_count += count;
+        m_stats.tx_bytes += bytes;
+
+        if (m_rate_bps > 0)
+        {
+          fill(now);
+          m_tokens -= bytes;
+        }
+
+        m_history.push_back(std::make_pair(now, bytes));
+        while (!m_history.empty() && m_history.front().first < now - m_window)
+          m_history.pop_front();
+      }
+
+      //! Retrieve the average transmission rate.
+      //! @param now current time (s).
+      //! @return transmission rate over the averaging window (bytes/s).
+      double
+      getRate(double now) const
+      {
+        uint64_t bytes = 0;
+        for (unsigned i = 0; i < m_history.size(); ++i)
+        {
+          if (m_history[i].first >= now - m_window)
+            bytes += m_history[i].second;
+        }
+
+        return bytes / m_window;
+      }
+
+      //! Retrieve link accounting.
+      //! @return statistics.
+      const Statistics&
+      getStatistics(void) const
+      {
+        return m_stats;
+      }
+
+      //! Reset link accounting.
+      void
+      clearStatistics(void)
+      {
+        m_stats.tx_count = 0;
+        m_stats.tx_bytes = 0;
+        m_stats.expired = 0;
+        m_stats.coalesced = 0;
+        m_history.clear();
+      }
+
+    private:
+      //! Scheduling order.
+      struct Order
+      {
+        unsigned priority;
+        double deadline;
+        uint64_t seq;
+
+        bool
+        operator<(const Order& other) const
+        {
+          if (priority != other.priority)
+            return priority < other.priority;
+          if (deadline != other.deadline)
+            return deadline < other.deadline;
+          return seq < other.seq;
+        }
+      };
+
+      //! Queued entry.
+      struct Entry
+      {
+        T value;
+        unsigned size;
+        uint32_t key;
+      };
+
+      typedef typename std::map<Order, Entry>::iterator Iterator;
+
+      //! Queued entries in scheduling order.
+      std::map<Order, Entry> m_entries;
+      //! Entries by coalescing key.
+      std::map<uint32_t, Iterator> m_keys;
+      //! Arrival counter.
+      uint64_t m_seq;
+      //! Number of queued bytes.
+      unsigned m_bytes;
+      //! Rate limit (bytes/s).
+      double m_rate_bps;
+      //! Burst size (bytes).
+      double m_burst;
+      //! Available bytes.
+      double m_tokens;
+      //! Time of the last token refill.
+      double m_last_fill;
+      //! Rate averaging window (s).
+      double m_window;
+      //! Recent transmissions (time, bytes).
+      std::deque<std::pair<double, unsigned> > m_history;
+      //! Link accounting.
+      Statistics m_stats;
+
+      void
+      insert(const T& value, unsigned size, Priority priority, double deadline, uint32_t key)
+      {
+        Order order;
+        order.priority = priority;
+        // Entries without deadline are served after those with one.
+        order.deadline = (deadline < 0) ? c_no_deadline : deadline;
+        order.seq = m_seq++;
+
+        Entry entry;
+        entry.value = value;
+        entry.size = size;
+        entry.key = key;
+
+        Iterator itr = m_entries.insert(std::make_pair(order, entry)).first;
+        if (key != 0)
+          m_keys[key] = itr;
+
+        m_bytes += size;
+      }
+
+      void
+      remove(Iterator itr)
+      {
+        if (itr->second.key != 0)
+          m_keys.erase(itr->second.key);
+
+        m_bytes -= itr->second.size;
+        m_entries.erase(itr);
+      }
+
+      void
+      fill(double now)
+      {
+        if (m_last_fill >= 0)
+          m_tokens += (now - m_last_fill) * m_rate_bps;
+
+        if (m_tokens > m_burst)
+          m_tokens = m_burst;
+
+        m_last_fill = now;
+      }
+
+      //! Deadline of entries without deadline.
+      static const double c_no_deadline;
+    };
+
+    template <typename T>
+    const double TxQueue<T>::c_no_deadline = 1e300;
+  }
+}
+
+#endif
@@ -29,6 +29,7 @@
 
 // ISO C++ 98 headers.
 #include <cerrno>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -94,7 +95,8 @@ namespace DUNE
   namespace Network
   {
     UDPSocket::UDPSocket(void):
-      m_con_port(0)
+      m_con_port(0),
+      m_timestamps(false)
     {
       //  POSIX / Win32
 #if defined(DUNE_SYS_HAS_SOCKET)
@@ -143,6 +145,22 @@ namespace DUNE
       setsockopt(m_handle, SOL_SOCKET, SO_BROADCAST, (char*)&on, sizeof(int));
     }
 
+    void
+    UDPSocket::enableTimestamps(bool value)
+    {
+#if defined(SO_TIMESTAMPNS) || defined(SO_TIMESTAMP)
+      int on = value ? 1 : 0;
+#  if defined(SO_TIMESTAMPNS)
+      int rv = setsockopt(m_handle, SOL_SOCKET, SO_TIMESTAMPNS, (char*)&on, sizeof(int));
+#  else
+      int rv = setsockopt(m_handle, SOL_SOCKET, SO_TIMESTAMP, (char*)&on, sizeof(int));
+#  endif
+      m_timestamps = value && (rv == 0);
+#else
+      (void)value;
+#endif
+    }
+
     void
     UDPSocket::setMulticastTTL(uint8_t value)
     {
@@ -207,6 +225,63 @@ namespace DUNE
       return rv;
     }
 
+    size_t
+    UDPSocket::doReadTimestamped(uint8_t* data, size_t data_size, double& tstamp)
+    {
+#if defined(SO_TIMESTAMPNS) || defined(SO_TIMESTAMP)
+      if (!m_timestamps)
+        return read(data, data_size, NULL, NULL);
+
+      iovec iov;
+      iov.iov_base = data;
+      iov.iov_len = data_size;
+
+      union
+      {
+        cmsghdr align;
+        char data[CMSG_SPACE(sizeof(timespec))];
+      } control;
+
+      msghdr msg;
+      std::memset(&msg, 0, sizeof(msg));
+      msg.msg_iov = &iov;
+      msg.msg_iovlen = 1;
+      msg.msg_control = control.data;
+      msg.msg_controllen = sizeof(control.data);
+
+      ssize_t rv = recvmsg(m_handle, &msg, 0);
+      if (rv <= 0)
+        throw NetworkError(DTR("error receiving data"), DUNE_SOCKET_ERROR);
+
+      for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+      {
+        if (cmsg->cmsg_level != SOL_SOCKET)
+          continue;
+
+#  if defined(SO_TIMESTAMPNS)
+        if (cmsg->cmsg_type == SCM_TIMESTAMPNS)
+        {
+          timespec ts;
+          std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+          tstamp = ts.tv_sec + ts.tv_nsec * 1e-9;
+        }
+#  else
+        if (cmsg->cmsg_type == SCM_TIMESTAMP)
+        {
+          timeval tv;
+          std::memcpy(&tv, CMSG_DATA(cmsg), sizeof(tv));
+          tstamp = tv.tv_sec + tv.tv_usec * 1e-6;
+        }
+#  endif
+      }
+
+      return rv;
+#else
+      (void)tstamp;
+      return read(data, data_size, NULL, NULL);
+#endif
+    }
+
     size_t
     UDPSocket::write(const uint8_t* buffer, size_t size, const Address& host, uint16_t port)
     {
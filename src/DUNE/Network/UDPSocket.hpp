@@ -66,6 +66,12 @@ namespace DUNE
       void
       setMulticastLoop(bool loopback = true);
 
+      //! Enable or disable kernel receive timestamps, used by
+      //! readTimestamped().
+      //! @param[in] value true to enable, false to disable.
+      void
+      enableTimestamps(bool value);
+
       void
       joinMulticastGroup(Address group, Address itf = Address::Any);
 
@@ -110,6 +116,8 @@ namespace DUNE
       Address m_con_addr;
       //! Connected port.
       unsigned m_con_port;
+      //! True if kernel receive timestamps are enabled.
+      bool m_timestamps;
 
       IO::NativeHandle
       doGetNative(void) const
@@ -133,6 +141,9 @@ namespace DUNE
         return read(data, data_size, NULL, NULL);
       }
 
+      size_t
+      doReadTimestamped(uint8_t* data, size_t data_size, double& tstamp);
+
       void
       createEventHandle(void);
 
@@ -38,6 +38,7 @@ namespace DUNE
 }
 
 #include <DUNE/Parsers/Config.hpp>
+#include <DUNE/Parsers/ConfigSnapshot.hpp>
 #include <DUNE/Parsers/PD4.hpp>
 #include <DUNE/Parsers/NMEAReader.hpp>
 #include <DUNE/Parsers/NMEAWriter.hpp>
@@ -36,6 +36,7 @@
 #include <cstring>
 #include <cstdlib>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 
 // DUNE headers.
@@ -120,6 +121,7 @@ namespace DUNE
             catch (FileOpenError& e)
             {
               DUNE_WRN("Config", e.what());
+              m_optional.push_back(path.str());
             }
           }
           else if (std::strncmp(section, "Require ", 8) == 0)
@@ -195,18 +197,30 @@ namespace DUNE
       std::fclose(fd);
 
       m_files.push_back(fname);
+      m_text.clear();
     }
 
     void
     Config::writeToFile(const char* file)
     {
+      Concurrency::ScopedMutex l(m_mutex);
+
+      // Serialize only when the configuration changed.
+      if (m_text.empty())
+      {
+        std::ostringstream text;
+        text << *this;
+        m_text = text.str();
+      }
+
       std::ofstream os(file);
-      os << *this;
+      os << m_text;
     }
 
     std::vector<std::string>
     Config::sections(void)
     {
+      Concurrency::ScopedMutex l(m_mutex);
       std::vector<std::string> vec;
       for (Sections::iterator itr = m_data.begin(); itr != m_data.end(); ++itr)
         vec.push_back(itr->first);
@@ -216,6 +230,7 @@ namespace DUNE
     std::vector<std::string>
     Config::options(const std::string& section)
     {
+      Concurrency::ScopedMutex l(m_mutex);
       Sections::const_iterator sitr = m_data.find(section);
 
       if (sitr == m_data.end())
@@ -37,12 +37,15 @@
 #include <vector>
 #include <stdexcept>
 #include <cstring>
+#include <cstddef>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Utils/String.hpp>
 #include <DUNE/Streams/Terminal.hpp>
 #include <DUNE/Casts.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
 
 namespace DUNE
 {
@@ -51,6 +54,9 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM Config;
 
+    // Forward declaration.
+    class ConfigSnapshot;
+
     //! Microsoft Windows INI configuration file parser. The
     //! configuration file format consists of sections, led by a
     //! "[section]" header and followed by "option = value" entries,
@@ -58,7 +64,8 @@ namespace DUNE
     //! and trailing whitespaces are removed from values. Character
     //! case in "option" identifiers is discarded. Lines beginning
     //! with "#" or ";" are ignored and may be used to provide
-    //! comments.
+    //! comments. Accessors may be called concurrently from multiple
+    //! threads; lookups of missing entries do not create them.
     class Config
     {
     public:
@@ -82,7 +89,9 @@ namespace DUNE
       void
       set(const std::string& section, const std::string& option, const std::string& value)
       {
+        Concurrency::ScopedMutex l(m_mutex);
         m_data[section][option] = value;
+        m_text.clear();
       }
 
       //! Retrieve the value of an option in a given section.
@@ -92,7 +101,9 @@ namespace DUNE
       std::string
       get(const std::string& section, const std::string& option)
       {
-        return m_data[section][option];
+        Concurrency::ScopedMutex l(m_mutex);
+        const std::string* value = find(section, option);
+        return (value == NULL) ? std::string() : *value;
       }
 
       //! Set the option map of a given section.
@@ -101,7 +112,9 @@ namespace DUNE
       void
       setSection(const std::string& section, const std::map<std::string, std::string>& map)
       {
+        Concurrency::ScopedMutex l(m_mutex);
         m_data[section] = map;
+        m_text.clear();
       }
 
       //! Retrieve the option map of a given section.
@@ -110,7 +123,9 @@ namespace DUNE
       std::map<std::string, std::string>
       getSection(const std::string& section)
       {
-        return m_data[section];
+        Concurrency::ScopedMutex l(m_mutex);
+        Sections::const_iterator itr = m_data.find(section);
+        return (itr == m_data.end()) ? Section() : itr->second;
       }
 
       //! Retrieve the value of an option in a given section and perform type conversion.
@@ -122,15 +137,19 @@ namespace DUNE
       void
       get(const std::string& sec, const std::string& opt, const std::string& def, Type& var)
       {
-        if (m_data[sec].find(opt) != m_data[sec].end())
+        Concurrency::ScopedMutex l(m_mutex);
+
+        const std::string* value = find(sec, opt);
+        if (value != NULL)
         {
-          if (castLexical(m_data[sec][opt], var))
+          if (castLexical(*value, var))
             return;
         }
 
         if (castLexical(def, var))
         {
           m_data[sec][opt] = def;
+          m_text.clear();
           return;
         }
 
@@ -194,12 +213,38 @@ namespace DUNE
       operator<<(std::ostream& os, const Config& cfg);
 
     private:
+      friend class ConfigSnapshot;
+
       typedef std::map<std::string, std::string> Section;
       typedef std::map<std::string, Section> Sections;
       //! Representation of the configuration file as a map.
       Sections m_data;
       //! List of parsed files.
       std::vector<std::string> m_files;
+      //! List of optional included files that could not be opened.
+      std::vector<std::string> m_optional;
+      //! Text written by writeToFile(), empty if stale.
+      std::string m_text;
+      //! Lock protecting concurrent access to m_data.
+      Concurrency::Mutex m_mutex;
+
+      //! Find the value of an option without creating it.
+      //! @param section section.
+      //! @param option option.
+      //! @return pointer to the value or NULL if it does not exist.
+      const std::string*
+      find(const std::string& section, const std::string& option) const
+      {
+        Sections::const_iterator sitr = m_data.find(section);
+        if (sitr == m_data.end())
+          return NULL;
+
+        Section::const_iterator oitr = sitr->second.find(option);
+        if (oitr == sitr->second.end())
+          return NULL;
+
+        return &oitr->second;
+      }
 
       // Non - copyable.
       Config(const Config&);
@@ -0,0 +1,492 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Algorithms/XXHash.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+#include <DUNE/Parsers/Config.hpp>
+#include <DUNE/Parsers/ConfigSnapshot.hpp>
+#include <DUNE/Parsers/Exceptions.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    using Algorithms::XXHash;
+    using FileSystem::Path;
+    using Utils::ByteCopy;
+
+    //! Snapshot file magic ("DCSP").
+    static const uint32_t c_magic = 0x50534344;
+    //! Snapshot format version.
+    static const uint32_t c_version = 1;
+    //! Number of fields of the header.
+    static const uint32_t c_header_fields = 8;
+    //! Number of fields of a source record: path, size, modification time.
+    static const uint32_t c_source_fields = 5;
+    //! Number of fields of a section record: name, first option, option count.
+    static const uint32_t c_section_fields = 3;
+    //! Number of fields of an option record: hash, section, option, value.
+    static const uint32_t c_entry_fields = 4;
+
+    //! Compute the hash of an option.
+    //! @param[in] section section name.
+    //! @param[in] section_size section name size.
+    //! @param[in] option option name.
+    //! @param[in] option_size option name size.
+    //! @return hash.
+    static uint32_t
+    hashKey(const char* section, size_t section_size, const char* option, size_t option_size)
+    {
+      uint32_t seed = XXHash::compute((const uint8_t*)section, section_size);
+      return XXHash::compute((const uint8_t*)option, option_size, seed);
+    }
+
+    //! Append a field to a buffer.
+    //! @param[in] bfr buffer.
+    //! @param[in] value field value.
+    static void
+    append(std::vector<uint8_t>& bfr, uint32_t value)
+    {
+      uint8_t tmp[4];
+      ByteCopy::toLE(value, tmp);
+      bfr.insert(bfr.end(), tmp, tmp + 4);
+    }
+
+    //! Table of unique strings, each stored once as a size field
+    //! followed by the NUL terminated characters.
+    class StringPool
+    {
+    public:
+      //! Add a string to the pool.
+      //! @param[in] str string.
+      //! @return string offset.
+      uint32_t
+      intern(const std::string& str)
+      {
+        std::map<std::string, uint32_t>::iterator itr = m_index.find(str);
+        if (itr != m_index.end())
+          return itr->second;
+
+        uint32_t offset = m_data.size();
+        append(m_data, str.size());
+        m_data.insert(m_data.end(), str.begin(), str.end());
+        m_data.push_back(0);
+
+        // Keep the following strings aligned.
+        while (m_data.size() % 4)
+          m_data.push_back(0);
+
+        m_index[str] = offset;
+        return offset;
+      }
+
+      //! Retrieve the pool contents.
+      //! @return pool contents.
+      const std::vector<uint8_t>&
+      getData(void) const
+      {
+        return m_data;
+      }
+
+    private:
+      //! Offset of each string.
+      std::map<std::string, uint32_t> m_index;
+      //! Pool contents.
+      std::vector<uint8_t> m_data;
+    };
+
+    ConfigSnapshot::ConfigSnapshot(const std::string& path):
+      m_file(path)
+    {
+      const uint8_t* data = m_file.getData();
+      uint64_t size = m_file.getSize();
+
+      if (size < c_header_fields * 4)
+        throw InvalidSnapshot(path, "truncated header");
+
+      if (field(data, 0) != c_magic)
+        throw InvalidSnapshot(path, "bad magic");
+
+      if (field(data, 1) != c_version)
+        throw InvalidSnapshot(path, "unsupported version");
+
+      m_source_count = field(data, 2);
+      m_section_count = field(data, 3);
+      m_entry_count = field(data, 4);
+      m_bucket_count = field(data, 5);
+      m_pool_size = field(data, 6);
+
+      if (m_bucket_count == 0 || (m_bucket_count & (m_bucket_count - 1)) != 0
+          || m_bucket_count < m_entry_count)
+        throw InvalidSnapshot(path, "bad hash table");
+
+      uint64_t sources = c_header_fields * 4;
+      uint64_t sections = sources + (uint64_t)m_source_count * c_source_fields * 4;
+      uint64_t entries = sections + (uint64_t)m_section_count * c_section_fields * 4;
+      uint64_t buckets = entries + (uint64_t)m_entry_count * c_entry_fields * 4;
+      uint64_t pool = buckets + (uint64_t)m_bucket_count * 4;
+
+      if (pool + m_pool_size != size)
+        throw InvalidSnapshot(path, "bad size");
+
+      const uint8_t* body = data + c_header_fields * 4;
+      if (XXHash::compute(body, size - c_header_fields * 4) != field(data, 7))
+        throw InvalidSnapshot(path, "checksum mismatch");
+
+      m_sources = data + sources;
+      m_sections = data + sections;
+      m_entries = data + entries;
+      m_buckets = data + buckets;
+      m_pool = data + pool;
+
+      if (!validate())
+        throw InvalidSnapshot(path, "bad reference");
+    }
+
+    void
+    ConfigSnapshot::write(Config& cfg, const std::string& path)
+    {
+      StringPool pool;
+      std::vector<uint8_t> sources;
+      std::vector<uint8_t> sections;
+      std::vector<uint8_t> entries;
+      std::vector<uint32_t> hashes;
+
+      {
+        Concurrency::ScopedMutex l(cfg.m_mutex);
+
+        std::vector<std::string> files = cfg.m_files;
+        files.insert(files.end(), cfg.m_optional.begin(), cfg.m_optional.end());
+        for (unsigned i = 0; i < files.size(); ++i)
+        {
+          Path file(files[i]);
+          uint64_t fsize = (uint64_t)file.size();
+          uint64_t mtime = (uint64_t)file.getLastModifiedTime();
+          append(sources, pool.intern(files[i]));
+          append(sources, (uint32_t)fsize);
+          append(sources, (uint32_t)(fsize >> 32));
+          append(sources, (uint32_t)mtime);
+          append(sources, (uint32_t)(mtime >> 32));
+        }
+
+        Config::Sections::const_iterator sitr = cfg.m_data.begin();
+        for (uint32_t index = 0; sitr != cfg.m_data.end(); ++sitr, ++index)
+        {
+          append(sections, pool.intern(sitr->first));
+          append(sections, hashes.size());
+          append(sections, sitr->second.size());
+
+          Config::Section::const_iterator oitr = sitr->second.begin();
+          for (; oitr != sitr->second.end(); ++oitr)
+          {
+            uint32_t hash = hashKey(sitr->first.c_str(), sitr->first.size(),
+                                    oitr->first.c_str(), oitr->first.size());
+            hashes.push_back(hash);
+            append(entries, hash);
+            append(entries, index);
+            append(entries, pool.intern(oitr->first));
+            append(entries, pool.intern(oitr->second));
+          }
+        }
+      }
+
+      // Open addressing with linear probing, at most half full.
+      uint32_t bucket_count = 1;
+      while (bucket_count < hashes.size() * 2)
+        bucket_count <<= 1;
+
+      std::vector<uint32_t> table(bucket_count, 0);
+      for (uint32_t i = 0; i < hashes.size(); ++i)
+      {
+        uint32_t slot = hashes[i] & (bucket_count - 1);
+        while (table[slot] != 0)
+          slot = (slot + 1) & (bucket_count - 1);
+        table[slot] = i + 1;
+      }
+
+      std::vector<uint8_t> body;
+      body.reserve(sources.size() + sections.size() + entries.size()
+                   + bucket_count * 4 + pool.getData().size());
+      body.insert(body.end(), sources.begin(), sources.end());
+      body.insert(body.end(), sections.begin(), sections.end());
+      body.insert(body.end(), entries.begin(), entries.end());
+      for (uint32_t i = 0; i < bucket_count; ++i)
+        append(body, table[i]);
+      body.insert(body.end(), pool.getData().begin(), pool.getData().end());
+
+      std::vector<uint8_t> header;
+      append(header, c_magic);
+      append(header, c_version);
+      append(header, sources.size() / (c_source_fields * 4));
+      append(header, sections.size() / (c_section_fields * 4));
+      append(header, hashes.size());
+      append(header, bucket_count);
+      append(header, pool.getData().size());
+      append(header, XXHash::compute(&body[0], body.size()));
+
+      // Write a temporary file and move it into place.
+      std::string tmp = path + ".tmp";
+      std::ofstream ofs(tmp.c_str(), std::ios::binary);
+      ofs.write((const char*)&header[0], header.size());
+      ofs.write((const char*)&body[0], body.size());
+      ofs.close();
+
+      if (ofs.fail())
+      {
+        std::remove(tmp.c_str());
+        throw FileSystem::FileWriteError(tmp);
+      }
+
+      if (std::rename(tmp.c_str(), path.c_str()) != 0)
+      {
+        std::remove(path.c_str());
+        if (std::rename(tmp.c_str(), path.c_str()) != 0)
+        {
+          std::remove(tmp.c_str());
+          throw FileSystem::FileWriteError(path);
+        }
+      }
+    }
+
+    bool
+    ConfigSnapshot::isCurrent(void) const
+    {
+      if (m_source_count == 0)
+        return false;
+
+      for (uint32_t i = 0; i < m_source_count; ++i)
+      {
+        const uint8_t* source = m_sources + i * c_source_fields * 4;
+        uint32_t size = 0;
+        Path file(string(field(source, 0), size));
+
+        uint64_t fsize = field(source, 1) | ((uint64_t)field(source, 2) << 32);
+        uint64_t mtime = field(source, 3) | ((uint64_t)field(source, 4) << 32);
+
+        if ((uint64_t)file.size() != fsize)
+          return false;
+
+        if ((uint64_t)file.getLastModifiedTime() != mtime)
+          return false;
+      }
+
+      return true;
+    }
+
+    std::vector<std::string>
+    ConfigSnapshot::getSources(void) const
+    {
+      std::vector<std::string> files;
+      for (uint32_t i = 0; i < m_source_count; ++i)
+      {
+        const uint8_t* source = m_sources + i * c_source_fields * 4;
+        if (isMissing(source))
+          continue;
+
+        uint32_t size = 0;
+        const char* name = string(field(source, 0), size);
+        files.push_back(std::string(name, size));
+      }
+
+      return files;
+    }
+
+    const char*
+    ConfigSnapshot::find(const std::string& section, const std::string& option) const
+    {
+      uint32_t hash = hashKey(section.c_str(), section.size(), option.c_str(), option.size());
+      uint32_t mask = m_bucket_count - 1;
+      uint32_t slot = hash & mask;
+
+      for (uint32_t probes = 0; probes < m_bucket_count; ++probes, slot = (slot + 1) & mask)
+      {
+        uint32_t index = field(m_buckets, slot);
+        if (index == 0)
+          return NULL;
+
+        const uint8_t* entry = m_entries + (index - 1) * c_entry_fields * 4;
+        if (field(entry, 0) != hash)
+          continue;
+
+        uint32_t size = 0;
+        const uint8_t* sec = m_sections + field(entry, 1) * c_section_fields * 4;
+        const char* name = string(field(sec, 0), size);
+        if (size != section.size() || std::memcmp(name, section.c_str(), size) != 0)
+          continue;
+
+        name = string(field(entry, 2), size);
+        if (size != option.size() || std::memcmp(name, option.c_str(), size) != 0)
+          continue;
+
+        return string(field(entry, 3), size);
+      }
+
+      return NULL;
+    }
+
+    void
+    ConfigSnapshot::load(Config& cfg) const
+    {
+      Concurrency::ScopedMutex l(cfg.m_mutex);
+
+      for (uint32_t i = 0; i < m_section_count; ++i)
+      {
+        const uint8_t* sec = m_sections + i * c_section_fields * 4;
+        uint32_t size = 0;
+        const char* name = string(field(sec, 0), size);
+        Config::Section& section = cfg.m_data[std::string(name, size)];
+
+        // Options are stored in order: insert each one after the previous.
+        Config::Section::iterator itr = section.begin();
+        uint32_t first = field(sec, 1);
+        uint32_t count = field(sec, 2);
+        for (uint32_t j = first; j < first + count; ++j)
+        {
+          const uint8_t* entry = m_entries + j * c_entry_fields * 4;
+          const char* option = string(field(entry, 2), size);
+          itr = section.insert(itr, std::make_pair(std::string(option, size), std::string()));
+          const char* value = string(field(entry, 3), size);
+          itr->second.assign(value, size);
+        }
+      }
+
+      for (uint32_t i = 0; i < m_source_count; ++i)
+      {
+        const uint8_t* source = m_sources + i * c_source_fields * 4;
+        uint32_t size = 0;
+        const char* name = string(field(source, 0), size);
+        std::string file(name, size);
+
+        if (isMissing(source))
+          cfg.m_optional.push_back(file);
+        else
+          cfg.m_files.push_back(file);
+      }
+
+      cfg.m_text.clear();
+    }
+
+    uint32_t
+    ConfigSnapshot::field(const uint8_t* table, uint32_t index)
+    {
+      uint32_t value = 0;
+      ByteCopy::fromLE(value, table + index * 4);
+      return value;
+    }
+
+    bool
+    ConfigSnapshot::isMissing(const uint8_t* source)
+    {
+      // Missing files are recorded with an invalid size.
+      return field(source, 1) == 0xffffffff && field(source, 2) == 0xffffffff;
+    }
+
+    const char*
+    ConfigSnapshot::string(uint32_t offset, uint32_t& size) const
+    {
+      size = field(m_pool, offset / 4);
+      return (const char*)m_pool + offset + 4;
+    }
+
+    bool
+    ConfigSnapshot::validate(void) const
+    {
+      // Check the string pool first: every string must be aligned,
+      // within bounds and NUL terminated.
+      std::vector<bool> valid(m_pool_size / 4, false);
+      uint64_t offset = 0;
+      while (offset < m_pool_size)
+      {
+        if (offset + 4 > m_pool_size)
+          return false;
+
+        uint64_t size = field(m_pool, offset / 4);
+        uint64_t next = offset + 4 + size + 1;
+        if (next > m_pool_size || m_pool[next - 1] != 0)
+          return false;
+
+        valid[offset / 4] = true;
+        offset = (next + 3) & ~(uint64_t)3;
+      }
+
+      for (uint32_t i = 0; i < m_source_count; ++i)
+      {
+        uint32_t str = field(m_sources + i * c_source_fields * 4, 0);
+        if (str % 4 != 0 || str >= m_pool_size || !valid[str / 4])
+          return false;
+      }
+
+      for (uint32_t i = 0; i < m_section_count; ++i)
+      {
+        const uint8_t* sec = m_sections + i * c_section_fields * 4;
+        uint32_t str = field(sec, 0);
+        if (str % 4 != 0 || str >= m_pool_size || !valid[str / 4])
+          return false;
+
+        uint64_t end = (uint64_t)field(sec, 1) + field(sec, 2);
+        if (end > m_entry_count)
+          return false;
+      }
+
+      for (uint32_t i = 0; i < m_entry_count; ++i)
+      {
+        const uint8_t* entry = m_entries + i * c_entry_fields * 4;
+        if (field(entry, 1) >= m_section_count)
+          return false;
+
+        for (uint32_t j = 2; j < c_entry_fields; ++j)
+        {
+          uint32_t str = field(entry, j);
+          if (str % 4 != 0 || str >= m_pool_size || !valid[str / 4])
+            return false;
+        }
+      }
+
+      for (uint32_t i = 0; i < m_bucket_count; ++i)
+      {
+        if (field(m_buckets, i) > m_entry_count)
+          return false;
+      }
+
+      return true;
+    }
+  }
+}
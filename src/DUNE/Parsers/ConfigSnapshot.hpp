@@ -0,0 +1,166 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_PARSERS_CONFIG_SNAPSHOT_HPP_INCLUDED_
+#define DUNE_PARSERS_CONFIG_SNAPSHOT_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+#include <DUNE/Parsers/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ConfigSnapshot;
+
+    // Forward declaration.
+    class Config;
+
+    //! Compiled, memory-mapped image of a parsed configuration. The
+    //! snapshot holds every option after includes, appends and
+    //! references were resolved, with interned strings and a hash
+    //! table for constant time lookups. It also records the size and
+    //! modification time of the files it was compiled from, so that
+    //! stale snapshots can be detected and discarded.
+    class ConfigSnapshot
+    {
+    public:
+      //! Map a snapshot.
+      //! @param[in] path snapshot file.
+      //! @throw FileReadError if the file cannot be read.
+      //! @throw InvalidSnapshot if the file is not a valid snapshot.
+      ConfigSnapshot(const std::string& path);
+
+      //! Compile a configuration into a snapshot file. The file is
+      //! replaced atomically.
+      //! @param[in] cfg parsed configuration.
+      //! @param[in] path snapshot file.
+      //! @throw FileWriteError if the file cannot be written.
+      static void
+      write(Config& cfg, const std::string& path);
+
+      //! Test if the files the snapshot was compiled from are
+      //! unchanged.
+      //! @return true if no source file was modified, false otherwise.
+      bool
+      isCurrent(void) const;
+
+      //! Retrieve the files the snapshot was compiled from, in the
+      //! order their parsing finished: the main configuration file
+      //! is the last one.
+      //! @return list of files.
+      std::vector<std::string>
+      getSources(void) const;
+
+      //! Retrieve the number of options.
+      //! @return number of options.
+      unsigned
+      getOptionCount(void) const
+      {
+        return m_entry_count;
+      }
+
+      //! Find the value of an option.
+      //! @param[in] section section.
+      //! @param[in] option option.
+      //! @return NUL terminated value or NULL if the option does not exist.
+      const char*
+      find(const std::string& section, const std::string& option) const;
+
+      //! Copy every option to a configuration, replacing options
+      //! that already exist.
+      //! @param[in] cfg destination configuration.
+      void
+      load(Config& cfg) const;
+
+    private:
+      //! Mapped file.
+      FileSystem::MappedFile m_file;
+      //! Number of source files.
+      uint32_t m_source_count;
+      //! Number of sections.
+      uint32_t m_section_count;
+      //! Number of options.
+      uint32_t m_entry_count;
+      //! Number of hash table buckets.
+      uint32_t m_bucket_count;
+      //! Tables.
+      const uint8_t* m_sources;
+      const uint8_t* m_sections;
+      const uint8_t* m_entries;
+      const uint8_t* m_buckets;
+      //! String pool.
+      const uint8_t* m_pool;
+      //! String pool size.
+      uint32_t m_pool_size;
+
+      //! Read a field of a table.
+      //! @param[in] table table.
+      //! @param[in] index field index.
+      //! @return field value.
+      static uint32_t
+      field(const uint8_t* table, uint32_t index);
+
+      //! Test if a source record refers to an optional file that did
+      //! not exist.
+      //! @param[in] source source record.
+      //! @return true if the file did not exist, false otherwise.
+      static bool
+      isMissing(const uint8_t* source);
+
+      //! Retrieve an interned string.
+      //! @param[in] offset string offset.
+      //! @param[out] size string size.
+      //! @return NUL terminated string.
+      const char*
+      string(uint32_t offset, uint32_t& size) const;
+
+      //! Check that all offsets and indexes are within bounds.
+      //! @return true if the tables are consistent, false otherwise.
+      bool
+      validate(void) const;
+
+      //! Non-copyable.
+      ConfigSnapshot(const ConfigSnapshot&);
+
+      //! Non-assignable.
+      ConfigSnapshot&
+      operator=(const ConfigSnapshot&);
+    };
+  }
+}
+
+#endif
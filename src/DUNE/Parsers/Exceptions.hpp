@@ -132,6 +132,14 @@ namespace DUNE
         Error(Utils::String::str("error opening file %s: %s", file.c_str(), reason.c_str()))
       { }
     };
+
+    class InvalidSnapshot: public Error
+    {
+    public:
+      InvalidSnapshot(const std::string& file, const std::string& reason):
+        Error(Utils::String::str("invalid configuration snapshot %s: %s", file.c_str(), reason.c_str()))
+      { }
+    };
   }
 }
 
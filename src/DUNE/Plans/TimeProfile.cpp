@@ -27,7 +27,11 @@
 // Author: Pedro Calado                                                     *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+
 // DUNE headers.
+#include <DUNE/Algorithms/MD5.hpp>
 #include <DUNE/Plans/TimeProfile.hpp>
 
 namespace DUNE
@@ -266,7 +270,9 @@ namespace DUNE
       pos.z = maneuver->z;
       pos.z_units = maneuver->z_units;
 
-      return parseWorkerRowsStages(rstages, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
+      bool rv = parseWorkerRowsStages(rstages, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
+      delete rstages;
+      return rv;
     }
 
     bool
@@ -301,7 +307,9 @@ namespace DUNE
       pos.z = maneuver->z;
       pos.z_units = maneuver->z_units;
 
-      return parseWorkerRowsStages(rstages, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
+      bool rv = parseWorkerRowsStages(rstages, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
+      delete rstages;
+      return rv;
     }
 
     bool
@@ -455,10 +463,96 @@ namespace DUNE
       return true;
     }
 
+    std::string
+    TimeProfile::getKey(const IMC::Message* msg, const Position& pos)
+    {
+      std::vector<uint8_t> bfr(sizeof(uint16_t) + msg->getPayloadSerializationSize());
+      uint16_t id = msg->getId();
+      std::memcpy(&bfr[0], &id, sizeof(id));
+      msg->serializeFields(&bfr[sizeof(id)]);
+
+      uint8_t digest[16];
+      Algorithms::MD5::compute(&bfr[0], bfr.size(), digest);
+
+      std::string key((const char*)digest, sizeof(digest));
+      key.append((const char*)&pos.lat, sizeof(pos.lat));
+      key.append((const char*)&pos.lon, sizeof(pos.lon));
+      key.append((const char*)&pos.z, sizeof(pos.z));
+      key.append((const char*)&pos.z_units, sizeof(pos.z_units));
+      return key;
+    }
+
+    void
+    TimeProfile::parse(const IMC::Message* msg, const Position& pos, CacheEntry& entry)
+    {
+      Memory::clear(m_accum_dur);
+      m_accum_dur = new TimeProfile::AccumulatedDurations(-1.0);
+
+      Memory::clear(m_speed_vec);
+      m_speed_vec = new std::vector<SpeedProfile>();
+
+      entry.exit = pos;
+
+      switch (msg->getId())
+      {
+        case DUNE_IMC_GOTO:
+          entry.parsed = parse(static_cast<const IMC::Goto*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_STATIONKEEPING:
+          entry.parsed = parse(static_cast<const IMC::StationKeeping*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_LOITER:
+          entry.parsed = parse(static_cast<const IMC::Loiter*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_FOLLOWPATH:
+          entry.parsed = parse(static_cast<const IMC::FollowPath*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_ROWS:
+          entry.parsed = parse(static_cast<const IMC::Rows*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_YOYO:
+          entry.parsed = parse(static_cast<const IMC::YoYo*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_ELEVATOR:
+          entry.parsed = parse(static_cast<const IMC::Elevator*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_POPUP:
+          entry.parsed = parse(static_cast<const IMC::PopUp*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_COMPASSCALIBRATION:
+          entry.parsed = parse(static_cast<const IMC::CompassCalibration*>(msg), entry.exit);
+          break;
+
+        case DUNE_IMC_ROWSCOVERAGE:
+          entry.parsed = parse(static_cast<const IMC::RowsCoverage*>(msg), entry.exit);
+          break;
+
+        default:
+          entry.parsed = false;
+          break;
+      }
+
+      entry.steps.swap(m_accum_dur->steps);
+      entry.speeds.swap(*m_speed_vec);
+
+      Memory::clear(m_accum_dur);
+      Memory::clear(m_speed_vec);
+    }
+
     void
     TimeProfile::parse(const std::vector<IMC::PlanManeuver*>& nodes,
                        const IMC::EstimatedState* state)
     {
+      m_cache_hits = 0;
+
       if (!m_valid_model)
       {
         m_last_valid.clear();
@@ -468,6 +562,18 @@ namespace DUNE
       Position pos;
       extractPosition(state, pos);
 
+      // Keep only the maneuvers of this plan for the next parse.
+      Cache used;
+      parse(nodes, pos, used);
+      m_cache.swap(used);
+    }
+
+    void
+    TimeProfile::parse(const std::vector<IMC::PlanManeuver*>& nodes, Position& pos,
+                       Cache& used)
+    {
+      float last_duration = -1.0;
+
       std::vector<IMC::PlanManeuver*>::const_iterator itr = nodes.begin();
 
       for (; itr != nodes.end(); ++itr)
@@ -475,71 +581,37 @@ namespace DUNE
         if ((*itr)->data.isNull())
           return;
 
-        IMC::Message* msg = (*itr)->data.get();
+        const IMC::Message* msg = (*itr)->data.get();
+        std::string key = getKey(msg, pos);
 
-        float last_duration = -1.0;
-        if (m_accum_dur != NULL)
+        Cache::iterator entry = used.find(key);
+        if (entry == used.end())
         {
-          if (m_accum_dur->size())
-            last_duration = m_accum_dur->getLastDuration();
+          entry = used.insert(std::make_pair(key, CacheEntry())).first;
+
+          Cache::iterator cached = m_cache.find(key);
+          if (cached != m_cache.end())
+          {
+            entry->second.parsed = cached->second.parsed;
+            entry->second.steps.swap(cached->second.steps);
+            entry->second.speeds.swap(cached->second.speeds);
+            entry->second.exit = cached->second.exit;
+            m_cache.erase(cached);
+            ++m_cache_hits;
+          }
+          else
+          {
+            parse(msg, pos, entry->second);
+          }
         }
-
-        Memory::clear(m_accum_dur);
-        m_accum_dur = new TimeProfile::AccumulatedDurations(last_duration);
-
-        Memory::clear(m_speed_vec);
-        m_speed_vec = new std::vector<SpeedProfile>();
-
-        bool parsed = false;
-
-        switch (msg->getId())
+        else
         {
-          case DUNE_IMC_GOTO:
-            parsed = parse(static_cast<IMC::Goto*>(msg), pos);
-            break;
-
-          case DUNE_IMC_STATIONKEEPING:
-            parsed = parse(static_cast<IMC::StationKeeping*>(msg), pos);
-            break;
-
-          case DUNE_IMC_LOITER:
-            parsed = parse(static_cast<IMC::Loiter*>(msg), pos);
-            break;
-
-          case DUNE_IMC_FOLLOWPATH:
-            parsed = parse(static_cast<IMC::FollowPath*>(msg), pos);
-            break;
-
-          case DUNE_IMC_ROWS:
-            parsed = parse(static_cast<IMC::Rows*>(msg), pos);
-            break;
-
-          case DUNE_IMC_YOYO:
-            parsed = parse(static_cast<IMC::YoYo*>(msg), pos);
-            break;
-
-          case DUNE_IMC_ELEVATOR:
-            parsed = parse(static_cast<IMC::Elevator*>(msg), pos);
-            break;
-
-          case DUNE_IMC_POPUP:
-            parsed = parse(static_cast<IMC::PopUp*>(msg), pos);
-            break;
-
-          case DUNE_IMC_COMPASSCALIBRATION:
-            parsed = parse(static_cast<IMC::CompassCalibration*>(msg), pos);
-            break;
-
-          case DUNE_IMC_ROWSCOVERAGE:
-            parsed = parse(static_cast<IMC::RowsCoverage*>(msg), pos);
-            break;
-
-          default:
-            parsed = false;
-            break;
+          ++m_cache_hits;
         }
 
-        if (!parsed)
+        const CacheEntry& result = entry->second;
+
+        if (!result.parsed)
         {
           if (m_profiles.empty() || itr == nodes.begin())
             return;
@@ -555,18 +627,24 @@ namespace DUNE
           return;
         }
 
+        pos = result.exit;
+
+        // Accumulate durations from the previous maneuver's.
+        AccumulatedDurations accum(last_duration);
+        for (size_t i = 0; i < result.steps.size(); ++i)
+          accum.addDuration(result.steps[i]);
+
+        last_duration = accum.size() ? accum.getLastDuration() : -1.0;
+
         // Update speeds and durations
         Profile prof;
-        prof.durations = m_accum_dur->vec;
-        prof.speeds = *m_speed_vec;
+        prof.durations.swap(accum.vec);
+        prof.speeds = result.speeds;
 
         std::pair<std::string, Profile > p_pair((*itr)->maneuver_id, prof);
         m_profiles.insert(p_pair);
       }
 
-      Memory::clear(m_accum_dur);
-      Memory::clear(m_speed_vec);
-
       m_last_valid = nodes.back()->maneuver_id;
       m_finite_duration = true;
       return;
@@ -30,6 +30,11 @@
 #ifndef DUNE_PLANS_TIME_PROFILE_HPP_INCLUDED_
 #define DUNE_PLANS_TIME_PROFILE_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Coordinates.hpp>
 #include <DUNE/IMC.hpp>
@@ -109,7 +114,8 @@ namespace DUNE
         m_speed_model(speed_model),
         m_speed_vec(NULL),
         m_valid_model(true),
-        m_finite_duration(false)
+        m_finite_duration(false),
+        m_cache_hits(0)
       {
         if (m_speed_model == NULL)
           m_valid_model = false;
@@ -122,12 +128,24 @@ namespace DUNE
         Memory::clear(m_speed_vec);
       }
 
-      //! Parse plan duration and speeds from vector of plan maneuver nodes
+      //! Parse plan duration and speeds from vector of plan maneuver nodes.
+      //! Results of each maneuver are cached by maneuver contents
+      //! and starting position, and reused by the next parse if the
+      //! maneuver is unchanged and starts at the same position.
       //! @param[in] nodes vector of plan maneuver nodes
       //! @param[in] state current estimated state
       void
       parse(const std::vector<IMC::PlanManeuver*>& nodes, const IMC::EstimatedState* state);
 
+      //! Get number of maneuvers whose profile was reused from the
+      //! cache in the last parse.
+      //! @return number of reused profiles.
+      inline size_t
+      getCacheHits(void) const
+      {
+        return m_cache_hits;
+      }
+
       //! Clear the vector
       inline void
       clear(void)
@@ -233,6 +251,7 @@ namespace DUNE
         addDuration(float value)
         {
           vec.push_back(value + getLastDuration());
+          steps.push_back(value);
         }
 
         //! Get the last computed duration
@@ -261,10 +280,49 @@ namespace DUNE
 
         //! Vector of durations
         std::vector<float> vec;
+        //! Vector of added (not accumulated) durations
+        std::vector<float> steps;
         //! Last duration
         float last_duration;
       };
 
+      //! Cached result of a maneuver's parse
+      struct CacheEntry
+      {
+        //! True if the maneuver was parsed
+        bool parsed;
+        //! Added durations (not accumulated)
+        std::vector<float> steps;
+        //! Speed profiles
+        std::vector<SpeedProfile> speeds;
+        //! Position at the end of the maneuver
+        Position exit;
+      };
+
+      //! Mapping between maneuver keys and cached results
+      typedef std::map<std::string, CacheEntry> Cache;
+
+      //! Parse plan maneuvers from a given starting position
+      //! @param[in] nodes vector of plan maneuver nodes
+      //! @param[in,out] pos starting position
+      //! @param[out] used cache entries used by this plan
+      void
+      parse(const std::vector<IMC::PlanManeuver*>& nodes, Position& pos, Cache& used);
+
+      //! Parse a maneuver into a cache entry
+      //! @param[in] msg maneuver message
+      //! @param[in] pos starting position
+      //! @param[out] entry parse results
+      void
+      parse(const IMC::Message* msg, const Position& pos, CacheEntry& entry);
+
+      //! Get the cache key of a maneuver
+      //! @param[in] msg maneuver message
+      //! @param[in] pos starting position
+      //! @return key
+      static std::string
+      getKey(const IMC::Message* msg, const Position& pos);
+
       //! Find 2D distance between two positions
       //! @param[in] new_pos object where the new position info will be stored
       //! @param[in] last_pos last position to consider when computing duration
@@ -489,6 +547,10 @@ namespace DUNE
       bool m_valid_model;
       //! Has finite duration
       bool m_finite_duration;
+      //! Parse results of the last plan's maneuvers
+      Cache m_cache;
+      //! Number of profiles reused in the last parse
+      size_t m_cache_hits;
     };
   }
 }
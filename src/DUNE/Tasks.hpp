@@ -49,6 +49,7 @@ namespace DUNE
 #include <DUNE/Tasks/Recipient.hpp>
 #include <DUNE/Tasks/AbstractCreator.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
+#include <DUNE/Tasks/ParameterCell.hpp>
 #include <DUNE/Tasks/SimpleTransport.hpp>
 #include <DUNE/Tasks/MessageFilter.hpp>
 #include <DUNE/Tasks/SourceFilter.hpp>
@@ -35,6 +35,11 @@
 #include <cstddef>
 
 // DUNE headers.
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Counter.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/Context.hpp>
@@ -62,11 +67,113 @@ namespace DUNE
       }
     };
 
+    //! Default number of threads used to read task configurations.
+    static const char* c_default_workers = "4";
+    //! Maximum amount of time to wait for dependencies of a task.
+    static const double c_boot_timeout = 30.0;
+    //! Period between checks of task dependencies.
+    static const double c_boot_period = 0.05;
+
+    //! Outcome of the creation of a single task.
+    struct CreationSlot
+    {
+      //! Configuration section.
+      std::string section;
+      //! Task object.
+      Task* task;
+      //! Error raised while producing the task.
+      std::string fatal;
+      //! Error raised while reading configuration.
+      std::string error;
+      //! Instant at which the task was created.
+      double created;
+      //! Instant at which configuration was applied.
+      double configured;
+    };
+
+    //! Shared list of tasks whose configuration is to be read. Slots
+    //! are handed out to worker threads in configuration order.
+    class ConfigurationQueue
+    {
+    public:
+      ConfigurationQueue(std::vector<CreationSlot>& slots):
+        m_slots(slots),
+        m_next(0)
+      { }
+
+      //! Read configurations until the list is exhausted.
+      void
+      process(void)
+      {
+        while (true)
+        {
+          size_t index = 0;
+          {
+            Concurrency::ScopedMutex l(m_mutex);
+            if (m_next >= m_slots.size())
+              return;
+            index = m_next++;
+          }
+
+          configure(m_slots[index]);
+        }
+      }
+
+    private:
+      //! Creation slots.
+      std::vector<CreationSlot>& m_slots;
+      //! Index of next slot.
+      size_t m_next;
+      //! Lock protecting m_next.
+      Concurrency::Mutex m_mutex;
+
+      void
+      configure(CreationSlot& slot)
+      {
+        if (slot.task == NULL)
+          return;
+
+        try
+        {
+          slot.task->readConfig();
+        }
+        catch (std::exception& e)
+        {
+          slot.error = e.what();
+        }
+        catch (...)
+        {
+          slot.error = DTR("unknown exception");
+        }
+      }
+    };
+
+    //! Worker thread consuming a configuration queue.
+    class ConfigurationWorker: public Concurrency::Thread
+    {
+    public:
+      ConfigurationWorker(ConfigurationQueue& queue):
+        m_queue(queue)
+      { }
+
+    private:
+      //! Configuration queue.
+      ConfigurationQueue& m_queue;
+
+      void
+      run(void)
+      {
+        m_queue.process();
+      }
+    };
+
     Manager::Manager(Context& ctx):
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_epoch(Time::Clock::get())
     {
       // Get all sections.
       std::vector<std::string> vec = m_ctx.config.sections();
+      std::vector<std::string> enabled;
 
       for (unsigned int i = 0; i < vec.size(); ++i)
       {
@@ -80,36 +187,130 @@ namespace DUNE
         m_ctx.config.get(vec[i], "Enabled", "Never", profiles);
 
         if (ctx.profiles.isSelected(profiles))
-          createTask(vec[i]);
+          enabled.push_back(vec[i]);
+      }
+
+      unsigned workers = 1;
+      m_ctx.config.get("General", "Task Initialization Threads", c_default_workers, workers);
+      createTasks(enabled, workers);
+
+      // Discard dependencies that will never be satisfied.
+      std::map<std::string, BootRecord>::iterator itr = m_boot.begin();
+      for (; itr != m_boot.end(); ++itr)
+      {
+        std::vector<std::string>& deps = itr->second.depends;
+        for (unsigned int i = 0; i < deps.size(); )
+        {
+          if (deps[i] != itr->first && m_tasks.find(deps[i]) != m_tasks.end())
+          {
+            ++i;
+            continue;
+          }
+
+          m_tasks[itr->first]->war(DTR("ignoring dependency on '%s'"), deps[i].c_str());
+          deps.erase(deps.begin() + i);
+        }
       }
     }
 
     void
-    Manager::createTask(const std::string& section)
+    Manager::createTasks(const std::vector<std::string>& sections, unsigned workers)
     {
-      std::string task_name = getTaskName(section);
+      std::vector<CreationSlot> slots(sections.size());
+      for (unsigned int i = 0; i < sections.size(); ++i)
+      {
+        slots[i].section = sections[i];
+        slots[i].task = NULL;
+        slots[i].created = -1.0;
+        slots[i].configured = -1.0;
+      }
 
-      if (!Factory::exists(task_name))
-        throw InvalidTaskName(task_name);
+      // Task constructors register consumers and may touch any
+      // global state, so tasks are produced serially in configuration
+      // order.
+      for (unsigned int i = 0; i < slots.size(); ++i)
+      {
+        CreationSlot& slot = slots[i];
 
-      Task* task = Factory::produce(task_name, section, m_ctx);
-      if (task == NULL)
-        throw InvalidTaskName(task_name);
+        try
+        {
+          slot.task = Factory::produce(getTaskName(slot.section), slot.section, m_ctx);
+        }
+        catch (std::exception& e)
+        {
+          slot.fatal = e.what();
+          break;
+        }
+        catch (...)
+        {
+          slot.fatal = DTR("unknown exception");
+          break;
+        }
 
-      try
+        slot.created = Time::Clock::get();
+      }
+
+      // Reading configuration only parses the task's own parameters
+      // from the synchronized configuration, so it is spread among the
+      // calling thread and (workers - 1) threads.
+      ConfigurationQueue queue(slots);
+      std::vector<ConfigurationWorker*> threads;
+      for (unsigned int i = 1; i < workers && i < slots.size(); ++i)
       {
-        task->loadConfig();
-        task->reserveEntities();
-        m_tasks[section] = task;
-        m_list.push_back(section);
+        threads.push_back(new ConfigurationWorker(queue));
+        threads.back()->start();
       }
-      catch (std::exception& e)
+
+      queue.process();
+
+      for (unsigned int i = 0; i < threads.size(); ++i)
       {
-        task->err("%s", e.what());
+        threads[i]->join();
+        delete threads[i];
       }
-      catch (...)
+
+      // Parameters are applied and entities reserved serially, in
+      // configuration order, since onUpdateParameters() may touch any
+      // global state.
+      for (unsigned int i = 0; i < slots.size(); ++i)
       {
-        task->err("%s", DTR("unknown exception"));
+        CreationSlot& slot = slots[i];
+
+        if (!slot.fatal.empty())
+          throw std::runtime_error(slot.fatal);
+
+        if (slot.task == NULL)
+          throw InvalidTaskName(getTaskName(slot.section));
+
+        try
+        {
+          if (!slot.error.empty())
+            throw std::runtime_error(slot.error);
+
+          slot.task->updateParameters(false);
+          slot.configured = Time::Clock::get();
+          slot.task->reserveEntities();
+        }
+        catch (std::exception& e)
+        {
+          slot.task->err("%s", e.what());
+          delete slot.task;
+          continue;
+        }
+        catch (...)
+        {
+          slot.task->err("%s", DTR("unknown exception"));
+          delete slot.task;
+          continue;
+        }
+
+        m_tasks[slot.section] = slot.task;
+        m_list.push_back(slot.section);
+
+        BootRecord& record = m_boot[slot.section];
+        record.created = slot.created - m_epoch;
+        record.configured = slot.configured - m_epoch;
+        m_ctx.config.get(slot.section, "Depends On", "", record.depends);
       }
     }
 
@@ -161,10 +362,48 @@ namespace DUNE
     void
     Manager::start(void)
     {
+      std::vector<std::string> pending;
       std::map<std::string, Task*>::iterator itr;
 
       for (itr = m_tasks.begin(); itr != m_tasks.end(); ++itr)
-        start(itr->first);
+      {
+        if (m_boot[itr->first].depends.empty())
+          start(itr->first);
+        else
+          pending.push_back(itr->first);
+      }
+
+      Time::Counter<double> timer(c_boot_timeout);
+      while (!pending.empty())
+      {
+        for (unsigned int i = 0; i < pending.size(); )
+        {
+          if (dependenciesReady(m_boot[pending[i]]))
+          {
+            start(pending[i]);
+            pending.erase(pending.begin() + i);
+          }
+          else
+          {
+            ++i;
+          }
+        }
+
+        if (pending.empty())
+          break;
+
+        if (timer.overflow())
+        {
+          for (unsigned int i = 0; i < pending.size(); ++i)
+          {
+            m_tasks[pending[i]]->war(DTR("dependencies are not ready, starting anyway"));
+            start(pending[i]);
+          }
+          break;
+        }
+
+        Time::Delay::wait(c_boot_period);
+      }
     }
 
     void
@@ -179,6 +418,7 @@ namespace DUNE
       try
       {
         task->inf(DTR("starting"));
+        m_boot[section].started = Time::Clock::get() - m_epoch;
         task->start();
       }
       catch (std::exception& e)
@@ -191,6 +431,58 @@ namespace DUNE
       }
     }
 
+    bool
+    Manager::dependenciesReady(const BootRecord& record)
+    {
+      for (unsigned int i = 0; i < record.depends.size(); ++i)
+      {
+        if (m_tasks[record.depends[i]]->getReadyTime() < 0)
+          return false;
+      }
+
+      return true;
+    }
+
+    bool
+    Manager::isReady(void)
+    {
+      std::map<std::string, Task*>::iterator itr = m_tasks.begin();
+      for (; itr != m_tasks.end(); ++itr)
+      {
+        if (itr->second->getReadyTime() < 0)
+          return false;
+      }
+
+      return true;
+    }
+
+    double
+    Manager::reportBootTimeline(void)
+    {
+      double last = 0.0;
+
+      std::map<std::string, Task*>::iterator itr = m_tasks.begin();
+      for (; itr != m_tasks.end(); ++itr)
+      {
+        const BootRecord& record = m_boot[itr->first];
+        double ready = itr->second->getReadyTime();
+
+        if (ready < 0)
+        {
+          itr->second->inf(DTR("boot: created %0.3f s, configured %0.3f s, started %0.3f s, not ready"),
+                           record.created, record.configured, record.started);
+          continue;
+        }
+
+        ready -= m_epoch;
+        last = std::max(last, ready);
+        itr->second->inf(DTR("boot: created %0.3f s, configured %0.3f s, started %0.3f s, ready %0.3f s"),
+                         record.created, record.configured, record.started, ready);
+      }
+
+      return last;
+    }
+
     std::string
     Manager::getTaskName(const std::string& str)
     {
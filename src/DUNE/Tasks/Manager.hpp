@@ -49,6 +49,12 @@ namespace DUNE
     struct Context;
     class Task;
 
+    //! The task manager creates every enabled task and configures it
+    //! using a pool of worker threads. Entities are reserved serially
+    //! in configuration order, so identifiers do not depend on thread
+    //! scheduling. Tasks listing other tasks in the 'Depends On'
+    //! section option are only started after those tasks have
+    //! initialized their resources.
     class Manager
     {
     public:
@@ -59,7 +65,9 @@ namespace DUNE
       //! Destructor.
       ~Manager(void);
 
-      //! Start all tasks.
+      //! Start all tasks. Tasks without dependencies are started
+      //! immediately, the remaining ones as soon as their
+      //! dependencies are ready or the boot timeout expires.
       void
       start(void);
 
@@ -104,6 +112,18 @@ namespace DUNE
         return m_tasks[name];
       }
 
+      //! Check if all tasks have initialized their resources.
+      //! @return true if all tasks are ready, false otherwise.
+      bool
+      isReady(void);
+
+      //! Log the boot timeline of every task, i.e., the instants
+      //! (relative to the creation of the manager) at which each
+      //! task was created, configured, started and became ready.
+      //! @return time elapsed until the last task became ready.
+      double
+      reportBootTimeline(void);
+
       void
       measureCpuUsage(void);
 
@@ -125,19 +145,45 @@ namespace DUNE
         }
       };
 
+      //! Boot timeline and dependencies of a task.
+      struct BootRecord
+      {
+        //! Instant at which the task was created.
+        double created;
+        //! Instant at which configuration was loaded.
+        double configured;
+        //! Instant at which the task was started.
+        double started;
+        //! Sections that must be ready before starting.
+        std::vector<std::string> depends;
+
+        BootRecord(void):
+          created(-1.0),
+          configured(-1.0),
+          started(-1.0)
+        { }
+      };
+
       //! Task list.
       std::vector<std::string> m_list;
+      //! Boot records, indexed by section.
+      std::map<std::string, BootRecord> m_boot;
       //! Running tasks.
       std::map<std::string, Task*> m_tasks;
       //! Task context.
       Context& m_ctx;
+      //! Instant at which the manager was created.
+      double m_epoch;
       //! Task CPU usage queue.
       std::priority_queue<TaskCpuUsage> m_cpu_usage_hogs;
       //! Buffer message to dispatch CPU usage of tasks.
       IMC::CpuUsage m_task_cpu_usage;
 
       void
-      createTask(const std::string& section);
+      createTasks(const std::vector<std::string>& sections, unsigned workers);
+
+      bool
+      dependenciesReady(const BootRecord& record);
 
       void
       lowerHogPriority(Task* task, int cpu_usage);
@@ -106,7 +106,8 @@ namespace DUNE
       m_reader(NULL),
       m_changed(true),
       m_visibility(VISIBILITY_DEVELOPER),
-      m_scope(SCOPE_GLOBAL)
+      m_scope(SCOPE_GLOBAL),
+      m_callback(NULL)
     { }
 
     Parameter::~Parameter(void)
@@ -116,6 +117,9 @@ namespace DUNE
 
       for (unsigned i = 0; i < m_values_if.size(); ++i)
         delete m_values_if[i];
+
+      if (m_callback != NULL)
+        delete m_callback;
     }
 
     void
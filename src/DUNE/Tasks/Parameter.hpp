@@ -41,6 +41,7 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Units.hpp>
 #include <DUNE/Tasks/AbstractParameterParser.hpp>
+#include <DUNE/Tasks/ParameterCallback.hpp>
 
 namespace DUNE
 {
@@ -265,6 +266,48 @@ namespace DUNE
         m_changed = enabled;
       }
 
+      //! Test if the value of this parameter changed without
+      //! clearing the changed flag.
+      //! @return true if the value changed, false otherwise.
+      bool
+      isChanged(void) const
+      {
+        return m_changed;
+      }
+
+      //! Register a routine to be called when the value of this
+      //! parameter changes. Tasks apply changes to parameters with
+      //! callbacks without going through onUpdateParameters().
+      //! @param[in] obj object.
+      //! @param[in] fun member function of object.
+      //! @return parameter.
+      template <typename T>
+      Parameter&
+      callback(T* obj, void (T::* fun)(void))
+      {
+        if (m_callback != NULL)
+          delete m_callback;
+
+        m_callback = new ParameterCallback<T>(*obj, fun);
+        return *this;
+      }
+
+      //! Test if this parameter has a callback.
+      //! @return true if a callback was registered, false otherwise.
+      bool
+      hasCallback(void) const
+      {
+        return m_callback != NULL;
+      }
+
+      //! Call the callback of this parameter, if any.
+      void
+      runCallback(void)
+      {
+        if (m_callback != NULL)
+          m_callback->call();
+      }
+
       Visibility
       getVisibility(void) const
       {
@@ -310,6 +353,8 @@ namespace DUNE
       Visibility m_visibility;
       //! Parameter scope.
       Scope m_scope;
+      //! Routine called when the value changes.
+      AbstractParameterCallback* m_callback;
     };
   }
 }
@@ -27,96 +27,40 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-#ifndef SENSORS_GPS_READER_HPP_INCLUDED_
-#define SENSORS_GPS_READER_HPP_INCLUDED_
+#ifndef DUNE_TASKS_PARAMETER_CALLBACK_HPP_INCLUDED_
+#define DUNE_TASKS_PARAMETER_CALLBACK_HPP_INCLUDED_
 
 // DUNE headers.
-#include <DUNE/DUNE.hpp>
+#include <DUNE/Tasks/AbstractParameterCallback.hpp>
 
-namespace Sensors
+namespace DUNE
 {
-  namespace GPS
+  namespace Tasks
   {
-    using DUNE_NAMESPACES;
-
-    //! Read buffer size.
-    static const size_t c_read_buffer_size = 4096;
-    //! Line termination character.
-    static const char c_line_term = '\n';
-
-    class Reader: public Concurrency::Thread
+    template <typename T>
+    class ParameterCallback: public AbstractParameterCallback
     {
     public:
-      //! Constructor.
-      //! @param[in] task parent task.
-      //! @param[in] handle I/O handle.
-      Reader(Tasks::Task* task, IO::Handle* handle):
-        m_task(task),
-        m_handle(handle)
-      {
-        m_buffer.resize(c_read_buffer_size);
-      }
+      typedef void (T::* Routine)(void);
 
-    private:
-      //! Parent task.
-      Tasks::Task* m_task;
-      //! I/O handle.
-      IO::Handle* m_handle;
-      //! Internal read buffer.
-      std::vector<char> m_buffer;
-      //! Current line.
-      std::string m_line;
+      //! Constructor.
+      ParameterCallback(T& o, Routine f):
+        m_obj(o),
+        m_fun(f)
+      { }
 
       void
-      dispatch(IMC::Message& msg)
+      call(void)
       {
-        msg.setDestination(m_task->getSystemId());
-        msg.setDestinationEntity(m_task->getEntityId());
-        m_task->dispatch(msg, DF_LOOP_BACK);
+        ((m_obj).*(m_fun))();
       }
 
-      void
-      read(void)
-      {
-        if (!Poll::poll(*m_handle, 1.0))
-          return;
-
-        size_t rv = m_handle->read(&m_buffer[0], m_buffer.size());
-        if (rv == 0)
-          throw std::runtime_error(DTR("invalid read size"));
-
-        for (size_t i = 0; i < rv; ++i)
-        {
-          m_line.push_back(m_buffer[i]);
-          if (m_buffer[i] == c_line_term)
-          {
-            IMC::DevDataText line;
-            line.value = m_line;
-            dispatch(line);
-            m_line.clear();
-          }
-        }
-      }
+      ~ParameterCallback(void)
+      { }
 
-      void
-      run(void)
-      {
-        while (!isStopping())
-        {
-          try
-          {
-            read();
-          }
-          catch (std::runtime_error& e)
-          {
-            IMC::IoEvent evt;
-            evt.type = IMC::IoEvent::IOV_TYPE_INPUT_ERROR;
-            evt.error = e.what();
-            dispatch(evt);
-            break;
-          }
-        }
-      }
+    private:
+      T& m_obj;
+      Routine m_fun;
     };
   }
 }
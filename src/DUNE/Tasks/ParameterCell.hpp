@@ -0,0 +1,205 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_PARAMETER_CELL_HPP_INCLUDED_
+#define DUNE_TASKS_PARAMETER_CELL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Tasks/BasicParameterParser.hpp>
+
+#if defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+#  define DUNE_TASKS_PARAMETER_CELL_GCC_ATOMIC
+#endif
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Parameter value that can be read by other threads without
+    //! locking, e.g., by a control loop running in its own thread
+    //! while the task thread applies new values. There must be a
+    //! single writer. The value type must be copyable with memcpy
+    //! (numbers, booleans or plain structures of those). Declaring a
+    //! task parameter with a cell as the destination variable is
+    //! enough to have new values published to it.
+    template <typename T>
+    class ParameterCell
+    {
+    public:
+      //! Constructor.
+      //! @param[in] value initial value.
+      ParameterCell(const T& value = T()):
+        m_seq(0),
+        m_value(value)
+      { }
+
+      //! Retrieve the current value.
+      //! @return value.
+      T
+      load(void) const
+      {
+#if defined(DUNE_TASKS_PARAMETER_CELL_GCC_ATOMIC)
+        T value;
+
+        while (true)
+        {
+          unsigned seq = __atomic_load_n(&m_seq, __ATOMIC_ACQUIRE);
+
+          // Writer in progress.
+          if (seq & 1)
+            continue;
+
+          std::memcpy(&value, (const void*)&m_value, sizeof(T));
+          __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+          if (__atomic_load_n(&m_seq, __ATOMIC_RELAXED) == seq)
+            return value;
+        }
+#else
+        Concurrency::ScopedMutex l(m_lock);
+        return m_value;
+#endif
+      }
+
+      //! Publish a new value.
+      //! @param[in] value value.
+      void
+      store(const T& value)
+      {
+#if defined(DUNE_TASKS_PARAMETER_CELL_GCC_ATOMIC)
+        unsigned seq = __atomic_load_n(&m_seq, __ATOMIC_RELAXED);
+        __atomic_store_n(&m_seq, seq + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        std::memcpy((void*)&m_value, &value, sizeof(T));
+        __atomic_store_n(&m_seq, seq + 2, __ATOMIC_RELEASE);
+#else
+        Concurrency::ScopedMutex l(m_lock);
+        m_value = value;
+#endif
+      }
+
+    private:
+      //! Sequence number, odd while a value is being written.
+      unsigned m_seq;
+      //! Value.
+      T m_value;
+
+#if !defined(DUNE_TASKS_PARAMETER_CELL_GCC_ATOMIC)
+      //! Lock used when there are no atomic primitives.
+      mutable Concurrency::Mutex m_lock;
+#endif
+
+      //! Non-copyable.
+      ParameterCell(const ParameterCell&);
+
+      //! Non-assignable.
+      ParameterCell&
+      operator=(const ParameterCell&);
+    };
+
+    //! Parameter parser publishing committed values to a cell.
+    template <typename T>
+    class BasicParameterParser<ParameterCell<T> >: public AbstractParameterParser
+    {
+    public:
+      BasicParameterParser(ParameterCell<T>& cell):
+        m_cell(cell),
+        m_value(T()),
+        m_parser(m_value)
+      {
+        m_cell.store(m_value);
+      }
+
+      ~BasicParameterParser(void)
+      { }
+
+      std::string
+      getTypeName(void)
+      {
+        return m_parser.getTypeName();
+      }
+
+      void
+      read(const std::string& value)
+      {
+        m_parser.read(value);
+      }
+
+      bool
+      commit(void)
+      {
+        if (!m_parser.commit())
+          return false;
+
+        m_cell.store(m_value);
+        return true;
+      }
+
+      void
+      values(const std::string& list)
+      {
+        m_parser.values(list);
+      }
+
+      void
+      minimumValue(const std::string& value)
+      {
+        m_parser.minimumValue(value);
+      }
+
+      void
+      maximumValue(const std::string& value)
+      {
+        m_parser.maximumValue(value);
+      }
+
+      void
+      validate(void)
+      {
+        m_parser.validate();
+      }
+
+    private:
+      //! Destination cell.
+      ParameterCell<T>& m_cell;
+      //! Last committed value.
+      T m_value;
+      //! Parser of the underlying type.
+      BasicParameterParser<T> m_parser;
+    };
+  }
+}
+
+#endif
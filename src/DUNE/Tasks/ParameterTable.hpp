@@ -92,6 +92,33 @@ namespace DUNE
           itr->second->setChanged(enabled);
       }
 
+      //! Test if any changed parameter must be applied by a full
+      //! parameter update, i.e., it has no callback.
+      //! @return true if a full update is required, false otherwise.
+      bool
+      requiresUpdate(void) const
+      {
+        for (unsigned i = 0; i < m_params.size(); ++i)
+        {
+          if (m_params[i]->isChanged() && !m_params[i]->hasCallback())
+            return true;
+        }
+
+        return false;
+      }
+
+      //! Call the callbacks of all changed parameters. Changed flags
+      //! are left untouched.
+      void
+      runCallbacks(void)
+      {
+        for (unsigned i = 0; i < m_params.size(); ++i)
+        {
+          if (m_params[i]->isChanged())
+            m_params[i]->runCallback();
+        }
+      }
+
       //! Retrieve the list of registered parameters.
       //! @return list with the labels of registered parameters.
       std::vector<std::string>
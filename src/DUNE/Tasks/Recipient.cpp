@@ -29,10 +29,12 @@
 
 // ISO C++ 98 headers.
 #include <cstddef>
+#include <stdexcept>
 
 // DUNE headers.
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Factory.hpp>
+#include <DUNE/I18N.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
 
@@ -71,16 +73,47 @@ namespace DUNE
 
         itr->second.clear();
       }
+
+      std::map<uint32_t, IMC::BusPredicate*>::iterator pitr = m_predicates.begin();
+      for (; pitr != m_predicates.end(); ++pitr)
+        delete pitr->second;
+
+      m_predicates.clear();
     }
 
-    void
-    Recipient::bind(uint32_t id, AbstractConsumer* consumer)
+    IMC::BusPredicate*
+    Recipient::bind(uint32_t id, AbstractConsumer* consumer, const IMC::BusPredicate* predicate)
     {
+      std::map<uint32_t, IMC::BusPredicate*>::iterator pitr = m_predicates.find(id);
+      IMC::BusPredicate* current = (pitr == m_predicates.end()) ? NULL : pitr->second;
+
       std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.find(id);
-      if (itr == m_cbacks.end())
-        m_ctx.mbus.registerRecipient(m_task, id);
+      if (itr == m_cbacks.end() || itr->second.empty())
+      {
+        delete current;
+        current = NULL;
+        m_predicates.erase(id);
+
+        if (predicate != NULL)
+        {
+          current = new IMC::BusPredicate(*predicate);
+          m_predicates[id] = current;
+        }
+
+        m_ctx.mbus.registerRecipient(m_task, id, current);
+      }
+      else
+      {
+        bool same = (current == NULL) ? (predicate == NULL) : (predicate != NULL && *current == *predicate);
+        if (!same)
+        {
+          delete consumer;
+          throw std::runtime_error(DTR("message already bound with a different predicate"));
+        }
+      }
 
       m_cbacks[id].push_back(consumer);
+      return current;
     }
 
     void
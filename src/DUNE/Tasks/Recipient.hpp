@@ -38,6 +38,7 @@
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
+#include <DUNE/IMC/BusPredicate.hpp>
 
 namespace DUNE
 {
@@ -64,8 +65,16 @@ namespace DUNE
       void
       put(const IMC::Message*);
 
-      void
-      bind(uint32_t id, AbstractConsumer* c);
+      //! Bind a consumer to a message identifier.
+      //! @param id message identifier.
+      //! @param c consumer (ownership is transferred).
+      //! @param predicate bus predicate (copied) or NULL. All
+      //! consumers of the same message share the same predicate.
+      //! @return bound predicate or NULL.
+      //! @throw std::runtime_error if the message is already bound
+      //! with a different predicate.
+      IMC::BusPredicate*
+      bind(uint32_t id, AbstractConsumer* c, const IMC::BusPredicate* predicate = NULL);
 
       void
       waitForMessages(double timeout);
@@ -80,6 +89,8 @@ namespace DUNE
       Context& m_ctx;
       //! Callbacks.
       std::map<uint32_t, std::vector<AbstractConsumer*> > m_cbacks;
+      //! Bus predicates.
+      std::map<uint32_t, IMC::BusPredicate*> m_predicates;
       //! Message queue.
       Concurrency::TSQueue<IMC::Message*> m_mqueue;
     };
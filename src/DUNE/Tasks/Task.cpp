@@ -38,6 +38,7 @@
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/PeriodicDelay.hpp>
 #include <DUNE/Time/Counter.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Status/Messages.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Exceptions.hpp>
@@ -63,7 +64,9 @@ namespace DUNE
       m_name(n),
       m_entity(NULL),
       m_debug_level(DEBUG_LEVEL_NONE),
-      m_honours_active(false)
+      m_honours_active(false),
+      m_params_pending(false),
+      m_ready_time(-1.0)
     {
       m_args.priority = 10;
       m_args.act_time = 0;
@@ -184,6 +187,10 @@ namespace DUNE
         try
         {
           onResourceInitialization();
+
+          Concurrency::ScopedMutex l(m_ready_lock);
+          if (m_ready_time < 0)
+            m_ready_time = Time::Clock::get();
           return;
         }
         catch (std::exception& e)
@@ -239,6 +246,8 @@ namespace DUNE
       else
         m_debug_level = DEBUG_LEVEL_NONE;
 
+      m_params_pending = false;
+      m_params.runCallbacks();
       onUpdateParameters();
 
       if (m_honours_active)
@@ -491,7 +500,27 @@ namespace DUNE
         }
       }
 
-      updateParameters();
+      m_params_pending = true;
+    }
+
+    void
+    Task::applyParameters(void)
+    {
+      if (!m_params_pending)
+        return;
+
+      if (m_params.requiresUpdate())
+      {
+        updateParameters();
+        return;
+      }
+
+      m_params_pending = false;
+      m_params.runCallbacks();
+      m_params.setChanged(false);
+
+      if (m_honours_active)
+        m_entity->reportActivationState();
     }
 
     void
@@ -690,26 +719,34 @@ namespace DUNE
     void
     Task::loadConfig(void)
     {
+      readConfig();
+      updateParameters(false);
+    }
+
+    void
+    Task::readConfig(void)
+    {
+      // Fetch the whole section once instead of looking up each option.
+      std::map<std::string, std::string> options = m_ctx.config.getSection(getName());
+      std::map<std::string, std::string>::const_iterator pitr;
+
       std::map<std::string, Parameter*>::const_iterator itr = m_params.begin();
       for (; itr != m_params.end(); ++itr)
       {
-        std::string value = m_ctx.config.get(getName(), itr->second->name());
-        m_params.set(itr->second->name(), value);
+        pitr = options.find(itr->second->name());
+        m_params.set(itr->second->name(), (pitr == options.end()) ? std::string() : pitr->second);
       }
 
       // Check for invalid parameter names.
-      std::map<std::string, std::string> options = m_ctx.config.getSection(getName());
-      std::map<std::string, std::string>::const_iterator pitr = options.begin();
+      pitr = options.begin();
       for (; pitr != options.end(); ++pitr)
       {
-        if (pitr->first == "Enabled")
+        if (pitr->first == "Enabled" || pitr->first == "Depends On")
           continue;
 
         if (m_params.find(pitr->first) == m_params.end())
           err(DTR("invalid parameter '%s'"), pitr->first.c_str());
       }
-
-      updateParameters(false);
     }
   }
 }
@@ -41,6 +41,7 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/IMC/Constants.hpp>
@@ -54,6 +55,7 @@
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/BasicParameterParser.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
+#include <DUNE/Tasks/ParameterCell.hpp>
 #include <DUNE/Entities/BasicEntity.hpp>
 #include <DUNE/Entities/StatefulEntity.hpp>
 
@@ -227,6 +229,23 @@ namespace DUNE
       void
       loadConfig(void);
 
+      //! Read parameters from context's configuration without
+      //! applying them. Only the task's own parameters are touched,
+      //! call updateParameters() afterwards to apply them.
+      void
+      readConfig(void);
+
+      //! Retrieve the time at which the task finished initializing
+      //! its resources for the first time.
+      //! @return time in seconds or a negative value if the task
+      //! has not yet initialized its resources.
+      double
+      getReadyTime(void)
+      {
+        Concurrency::ScopedMutex l(m_ready_lock);
+        return m_ready_time;
+      }
+
       //! Set scheduling priority programatically. The priority of a
       //! task might change when configuration parameters are updated.
       //! @param[in] value desired scheduling priority.
@@ -488,20 +507,24 @@ namespace DUNE
 
       //! Wait for the receiving queue to contain at least one message
       //! and then call the consumer functions for all the messages
-      //! currently in it.
+      //! currently in it. Parameter changes received in the meantime
+      //! are applied afterwards.
       //! @param[in] timeout wait for timeout seconds.
       void
       waitForMessages(double timeout)
       {
         m_recipient->waitForMessages(timeout);
+        applyParameters();
       }
 
       //! Call the consumers of all messages currently in the
-      //! receiving queue.
+      //! receiving queue. Parameter changes received in the meantime
+      //! are applied afterwards.
       void
       consumeMessages(void)
       {
         m_recipient->runCallBacks();
+        applyParameters();
       }
 
       //! Declare a configuration parameter that can be parsed using
@@ -570,6 +593,22 @@ namespace DUNE
         bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer));
       }
 
+      //! Bind a message to a consumer method. Messages are filtered
+      //! by the bus before being queued to the task, so rejected
+      //! messages are never copied.
+      //! @param task_obj consumer task.
+      //! @param predicate bus predicate (copied).
+      //! @param consumer consumer method.
+      //! @return bound predicate, which may be extended later and
+      //! holds hit/miss counters.
+      template <typename M, typename T>
+      IMC::BusPredicate*
+      bind(T* task_obj, const IMC::BusPredicate& predicate,
+           void (T::* consumer)(const M*) = &T::consume)
+      {
+        return bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer), &predicate);
+      }
+
       //! Bind multiple messages to a default consumer method.
       //! @param task_obj consumer object.
       //! @param list list of message identifiers.
@@ -794,8 +833,14 @@ namespace DUNE
       std::stack<std::map<std::string, std::string> > m_params_stack;
       //! True if task honours changes to 'Active' parameter.
       bool m_honours_active;
+      //! True if parameter changes are waiting to be applied.
+      bool m_params_pending;
       //! Name of parameter section editor.
       std::string m_param_editor;
+      //! Time of first resource initialization.
+      double m_ready_time;
+      //! Lock protecting m_ready_time.
+      Concurrency::Mutex m_ready_lock;
 
       //! Report current entity states by dispatching EntityState
       //! messages. This function will at least report the state of
@@ -809,15 +854,24 @@ namespace DUNE
       void
       run(void);
 
+      //! Apply parameter changes received since the last call. When
+      //! all changed parameters have callbacks only those are called,
+      //! otherwise a full parameter update is performed.
+      void
+      applyParameters(void);
+
       //! Register a consumer for a given message identifier.
       //! @param[in] message_id message identifier.
       //! @param[in] consumer consumer object.
-      void
-      bind(unsigned int message_id, AbstractConsumer* consumer)
+      //! @param[in] predicate bus predicate or NULL.
+      //! @return bound predicate or NULL.
+      IMC::BusPredicate*
+      bind(unsigned int message_id, AbstractConsumer* consumer,
+           const IMC::BusPredicate* predicate = NULL)
       {
         spew("registering consumer for '%s'",
              IMC::Factory::getAbbrevFromId(message_id).c_str());
-        m_recipient->bind(message_id, consumer);
+        return m_recipient->bind(message_id, consumer, predicate);
       }
 
       //! Consume QueryEntityState messages and reply accordingly.
@@ -114,6 +114,12 @@ namespace DUNE
         return m_buffer;
       }
 
+      inline const uint8_t*
+      getBuffer(void) const
+      {
+        return m_buffer;
+      }
+
       inline char*
       getBufferSigned(void)
       {
@@ -141,6 +141,40 @@ setDaemonSignalHandlers(void)
 #endif
 }
 
+//! Load a configuration file. A compiled snapshot of the file is
+//! used if none of its sources changed, and refreshed otherwise.
+//! @param[in] cfg configuration.
+//! @param[in] file configuration file.
+//! @param[in] snapshot snapshot file.
+void
+loadConfig(Parsers::Config& cfg, const Path& file, const Path& snapshot)
+{
+  try
+  {
+    Parsers::ConfigSnapshot snap(snapshot.str());
+    std::vector<std::string> sources = snap.getSources();
+    if (!sources.empty() && sources.back() == file.str() && snap.isCurrent())
+    {
+      snap.load(cfg);
+      return;
+    }
+  }
+  catch (std::runtime_error&)
+  { }
+
+  cfg.parseFile(file.c_str());
+
+  try
+  {
+    snapshot.dirname().create();
+    Parsers::ConfigSnapshot::write(cfg, snapshot.str());
+  }
+  catch (std::runtime_error& e)
+  {
+    DUNE_WRN("Daemon", e.what());
+  }
+}
+
 int
 runDaemon(DUNE::Daemon& daemon)
 {
@@ -257,16 +291,17 @@ main(int argc, char** argv)
   }
 
   Path cfg_file = context.dir_cfg / options.value("--config-file") + ".ini";
+  Path cfg_snap = context.dir_db / ("config-" + String::replace(options.value("--config-file"), '/', "_") + ".snap");
   try
   {
-    context.config.parseFile(cfg_file.c_str());
+    loadConfig(context.config, cfg_file, cfg_snap);
   }
   catch (std::runtime_error& e)
   {
     try
     {
       cfg_file = context.dir_usr_cfg / options.value("--config-file") + ".ini";
-      context.config.parseFile(cfg_file.c_str());
+      loadConfig(context.config, cfg_file, cfg_snap);
       context.dir_cfg = context.dir_usr_cfg;
     }
     catch (std::runtime_error& e2)
@@ -0,0 +1,424 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "PairTerms.hpp"
+
+namespace Maneuver
+{
+  namespace VehicleFormation
+  {
+    namespace FormCollAvoid
+    {
+      using DUNE_NAMESPACES;
+
+      //! Minimum number of pairs handled by each thread.
+      static const unsigned c_min_pairs_per_thread = 16;
+
+      void
+      TeamState::load(const Matrix& state, const Matrix& accel, const Matrix& form)
+      {
+        unsigned cols = state.columns();
+        x.resize(cols);
+        y.resize(cols);
+        vx.resize(cols);
+        vy.resize(cols);
+        ax.resize(cols);
+        ay.resize(cols);
+
+        for (unsigned i = 0; i < cols; ++i)
+        {
+          x[i] = state(0, i);
+          y[i] = state(1, i);
+          vx[i] = state(3, i);
+          vy[i] = state(4, i);
+          ax[i] = accel(0, i);
+          ay[i] = accel(1, i);
+        }
+
+        unsigned n = form.columns();
+        fx.resize(n);
+        fy.resize(n);
+
+        for (unsigned i = 0; i < n; ++i)
+        {
+          fx[i] = form(0, i);
+          fy[i] = form(1, i);
+        }
+      }
+
+      void
+      computePair(const PairContext& ctx, const TeamState& team, unsigned other,
+                  bool full, PairTerms& terms)
+      {
+        const unsigned a = ctx.own + 1;
+        const unsigned b = other + 1;
+
+        // Relative state, from the controlled vehicle to the other.
+        double px = team.x[b] - team.x[a];
+        double py = team.y[b] - team.y[a];
+        double vx = team.vx[b] - team.vx[a];
+        double vy = team.vy[b] - team.vy[a];
+        double dist = std::sqrt(px * px + py * py);
+
+        // Inter-vehicle frame axes.
+        double angle = std::atan2(py, px);
+        double xx = std::cos(angle);
+        double xy = std::sin(angle);
+        double yx = -xy;
+        double yy = xx;
+
+        // Desired relative position, velocity and acceleration.
+        double des_px;
+        double des_py;
+        double des_vx = 0;
+        double des_vy = 0;
+        double des_ax = 0;
+        double des_ay = 0;
+
+        if (ctx.earth_fixed)
+        {
+          des_px = team.fx[ctx.own] - team.fx[other];
+          des_py = team.fy[ctx.own] - team.fy[other];
+        }
+        else
+        {
+          double form_x;
+          double form_y;
+
+          if (ctx.curved)
+          {
+            double turn_rad = ctx.turn_rad - team.fy[other];
+            double gamma = team.fx[other] / ctx.turn_rad;
+            form_x = turn_rad * std::sin(gamma);
+            form_y = turn_rad * (1 - std::cos(gamma)) + team.fy[ctx.own];
+          }
+          else
+          {
+            form_x = team.fx[other];
+            form_y = team.fy[other];
+          }
+
+          double dx = ctx.form_pos[0] - form_x;
+          double dy = ctx.form_pos[1] - form_y;
+          des_px = ctx.rot_cos * dx - ctx.rot_sin * dy;
+          des_py = ctx.rot_sin * dx + ctx.rot_cos * dy;
+          des_vx = py * ctx.turn_rate;
+          des_vy = -px * ctx.turn_rate;
+          des_ax = px * ctx.turn_rate * ctx.turn_rate;
+          des_ay = py * ctx.turn_rate * ctx.turn_rate;
+        }
+
+        // Relative position and velocity errors.
+        double err_gx = -px - des_px;
+        double err_gy = -py - des_py;
+        double err_x = err_gx * xx + err_gy * xy;
+        double err_y = err_gx * yx + err_gy * yy;
+        double derr_gx = -vx - des_vx;
+        double derr_gy = -vy - des_vy;
+        double derr_x = derr_gx * xx + derr_gy * xy;
+        double derr_y = derr_gx * yx + derr_gy * yy;
+
+        // Maneuvering constraints projected onto the inter-vehicle frame.
+        double wvx = team.vx[b] - ctx.wind[0];
+        double wvy = team.vy[b] - ctx.wind[1];
+        double vel_proj_x = wvx * xx + wvy * xy;
+        double vel_proj_y = wvx * yx + wvy * yy;
+        double accel_proj_x = std::abs(ctx.accel_lim_x[0] * xx + ctx.accel_lim_x[1] * xy) +
+          std::abs(ctx.accel_lim_y[0] * xx + ctx.accel_lim_y[1] * xy);
+        double accel_proj_y = std::abs(ctx.accel_lim_x[0] * yx + ctx.accel_lim_x[1] * yy) +
+          std::abs(ctx.accel_lim_y[0] * yx + ctx.accel_lim_y[1] * yy);
+
+        // Pair weight, from the distance predicted with current closing speed.
+        double des_dist = std::sqrt(des_px * des_px + des_py * des_py);
+        double pred_dist = dist + std::min(0.0, derr_x * std::abs(derr_x) *
+                                           (1 + ctx.acc_safety_marg) / accel_proj_x);
+        double dist2confl = pred_dist - ctx.deconfl_dist;
+
+        if (dist2confl < 0)
+        {
+          terms.weight = 1 + dist2confl / ctx.deconfl_offset *
+            dist2confl / ctx.deconfl_offset * ctx.k_deconfl;
+        }
+        else if (pred_dist <= des_dist * ctx.k_long1)
+        {
+          terms.weight = 1;
+        }
+        else if (pred_dist < des_dist * ctx.k_long2)
+        {
+          double gain = (pred_dist - des_dist * ctx.k_long1) / (des_dist * (ctx.k_long2 - ctx.k_long1));
+          terms.weight = 1 - gain * gain;
+        }
+        else
+        {
+          terms.weight = 0;
+        }
+
+        // A pair without weight does not contribute to the control law.
+        if (terms.weight == 0 && !full)
+        {
+          terms.surf[0] = 0;
+          terms.surf[1] = 0;
+          terms.virt_err[0] = 0;
+          terms.virt_err[1] = 0;
+          return;
+        }
+
+        // Target point across the other vehicle.
+        bool across = false;
+        if (err_x < ctx.deconfl_dist - dist)
+        {
+          across = true;
+          err_x = ctx.deconfl_dist - dist;
+        }
+
+        // Sliding surface parameters - inter-vehicle x axis.
+        double c1 = std::max(ctx.speed_max - vel_proj_x, ctx.rel_vel_lim);
+        double c2 = ctx.deconfl_offset * (2 * ctx.speed_max / (ctx.speed_max + vel_proj_x));
+        if (err_x < 0)
+          c2 = std::max(4 * (1 + ctx.acc_safety_marg) * c1 * c1 / (27 * accel_proj_x), c2);
+
+        // Limitation of the sliding surface.
+        err_x = std::min(err_x, c2 * 0.5);
+        double err_x_conv = err_x;
+        if (dist < ctx.deconfl_dist && derr_x <= 0)
+          err_x_conv = std::min(err_x, 0.0);
+
+        // Follow a point on the safety rim of the other vehicle.
+        if (across)
+        {
+          double rim = 2 * ctx.deconfl_dist;
+          if (rim > std::abs(err_y))
+            err_y = (err_y < 0) ? -rim : rim;
+        }
+
+        // Sliding surface parameters - inter-vehicle y axis.
+        double c3;
+        double c4;
+        if (err_y < 0)
+        {
+          c3 = std::max(ctx.speed_max - vel_proj_y, ctx.rel_vel_lim);
+          c4 = 4 * (1 + ctx.acc_safety_marg) * c3 * c3 / (27 * accel_proj_y);
+        }
+        else
+        {
+          c3 = std::min(-ctx.speed_max - vel_proj_y, -ctx.rel_vel_lim);
+          c4 = -4 * (1 + ctx.acc_safety_marg) * c3 * c3 / (27 * accel_proj_y);
+        }
+
+        // Sliding surface deviation.
+        double surf_x = c1 * err_x / (err_x - c2);
+        double surf_y = c3 * err_y / (err_y - c4);
+        terms.surf[0] = derr_gx - surf_x * xx - surf_y * yx;
+        terms.surf[1] = derr_gy - surf_x * xy - surf_y * yy;
+
+        // Virtual error and feedback linearization.
+        double angle_dot = vx * (yx / dist) + vy * (yy / dist);
+        double sd_x = c1 * c2 * derr_x / ((err_x_conv - c2) * (err_x_conv - c2)) + surf_y * angle_dot;
+        double sd_y = c3 * c4 * derr_y / ((err_y - c4) * (err_y - c4)) - surf_x * angle_dot;
+        terms.virt_err[0] = team.ax[b] + des_ax - (xx * sd_x + yx * sd_y);
+        terms.virt_err[1] = team.ay[b] + des_ay - (xy * sd_x + yy * sd_y);
+
+        if (!full)
+          return;
+
+        // Monitoring data.
+        double err_rx = xx * err_x + yx * err_y;
+        double err_ry = xy * err_x + yy * err_y;
+
+        terms.dist = dist;
+        terms.err = std::sqrt(err_gx * err_gx + err_gy * err_gy);
+        terms.dir[0] = xx;
+        terms.dir[1] = xy;
+        terms.err_g[0] = err_rx;
+        terms.err_g[1] = err_ry;
+        terms.err_r[0] = err_rx * xx + err_ry * xy;
+        terms.err_r[1] = err_rx * yx + err_ry * yy;
+        terms.err_v[0] = derr_x;
+        terms.err_v[1] = derr_y;
+        terms.surf_r[0] = terms.surf[0] * xx + terms.surf[1] * xy;
+        terms.surf_r[1] = terms.surf[0] * yx + terms.surf[1] * yy;
+      }
+
+      //! Pair solver worker, computes one slice of the pairs.
+      class PairSolver::Worker: public Concurrency::Thread
+      {
+      public:
+        Worker(PairSolver& solver, unsigned slice):
+          m_solver(solver),
+          m_slice(slice),
+          m_job(solver.m_job)
+        { }
+
+      private:
+        //! Parent solver.
+        PairSolver& m_solver;
+        //! Slice index.
+        unsigned m_slice;
+        //! Last job sequence number seen.
+        unsigned m_job;
+
+        void
+        run(void)
+        {
+          while (m_solver.take(m_job))
+          {
+            m_solver.run(m_slice);
+            m_solver.done();
+          }
+        }
+      };
+
+      PairSolver::PairSolver(void):
+        m_ctx(NULL),
+        m_team(NULL),
+        m_terms(NULL),
+        m_full(false),
+        m_job(0),
+        m_pending(0),
+        m_stopping(false)
+      { }
+
+      PairSolver::~PairSolver(void)
+      {
+        stopWorkers();
+      }
+
+      void
+      PairSolver::setThreads(unsigned count)
+      {
+        if (count == m_workers.size())
+          return;
+
+        stopWorkers();
+
+        m_stopping = false;
+        for (unsigned i = 0; i < count; ++i)
+        {
+          m_workers.push_back(new Worker(*this, i + 1));
+          m_workers.back()->start();
+        }
+      }
+
+      void
+      PairSolver::compute(const PairContext& ctx, const TeamState& team, bool full,
+                          std::vector<PairTerms>& terms)
+      {
+        terms.resize(team.size());
+
+        m_ctx = &ctx;
+        m_team = &team;
+        m_terms = &terms;
+        m_full = full;
+
+        if (m_workers.empty() || team.size() < c_min_pairs_per_thread * (m_workers.size() + 1))
+        {
+          for (unsigned i = 0; i < team.size(); ++i)
+          {
+            if (i != ctx.own)
+              computePair(ctx, team, i, full, terms[i]);
+          }
+          return;
+        }
+
+        m_cond.lock();
+        ++m_job;
+        m_pending = m_workers.size();
+        m_cond.broadcast();
+        m_cond.unlock();
+
+        run(0);
+
+        m_cond.lock();
+        while (m_pending > 0)
+          m_cond.wait();
+        m_cond.unlock();
+      }
+
+      void
+      PairSolver::run(unsigned slice)
+      {
+        unsigned stride = m_workers.size() + 1;
+
+        for (unsigned i = slice; i < m_team->size(); i += stride)
+        {
+          if (i != m_ctx->own)
+            computePair(*m_ctx, *m_team, i, m_full, (*m_terms)[i]);
+        }
+      }
+
+      bool
+      PairSolver::take(unsigned& job)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+
+        while (m_job == job && !m_stopping)
+          m_cond.wait();
+
+        job = m_job;
+        return !m_stopping;
+      }
+
+      void
+      PairSolver::done(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+
+        if (--m_pending == 0)
+          m_cond.broadcast();
+      }
+
+      void
+      PairSolver::stopWorkers(void)
+      {
+        m_cond.lock();
+        m_stopping = true;
+        m_cond.broadcast();
+        m_cond.unlock();
+
+        for (unsigned i = 0; i < m_workers.size(); ++i)
+        {
+          if (m_workers[i]->isCreated())
+            m_workers[i]->join();
+          delete m_workers[i];
+        }
+
+        m_workers.clear();
+      }
+    }
+  }
+}
@@ -0,0 +1,219 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef MANEUVER_VEHICLE_FORMATION_FORM_COLL_AVOID_PAIR_TERMS_HPP_INCLUDED_
+#define MANEUVER_VEHICLE_FORMATION_FORM_COLL_AVOID_PAIR_TERMS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Maneuver
+{
+  namespace VehicleFormation
+  {
+    namespace FormCollAvoid
+    {
+      using DUNE_NAMESPACES;
+
+      //! Horizontal team state in structure-of-arrays layout. Index 0
+      //! is the leader, index i + 1 is formation vehicle i.
+      struct TeamState
+      {
+        //! Position.
+        std::vector<double> x, y;
+        //! Velocity.
+        std::vector<double> vx, vy;
+        //! Acceleration.
+        std::vector<double> ax, ay;
+        //! Formation position of each formation vehicle (no leader).
+        std::vector<double> fx, fy;
+
+        //! Copy team state from the controller matrices.
+        //! @param state vehicle state (12 x n+1).
+        //! @param accel vehicle acceleration (3 x n+1).
+        //! @param form formation positions (3 x n).
+        void
+        load(const Matrix& state, const Matrix& accel, const Matrix& form);
+
+        //! Get number of formation vehicles.
+        //! @return number of vehicles, excluding the leader.
+        unsigned
+        size(void) const
+        {
+          return fx.size();
+        }
+      };
+
+      //! Controller quantities shared by all pairs of one control
+      //! computation.
+      struct PairContext
+      {
+        //! Index of the vehicle being controlled.
+        unsigned own;
+        //! True if the formation is earth fixed.
+        bool earth_fixed;
+        //! True if the formation shape follows the path curvature.
+        bool curved;
+        //! Formation turn radius and rate.
+        double turn_rad;
+        double turn_rate;
+        //! Formation rotation (cosine and sine of course).
+        double rot_cos;
+        double rot_sin;
+        //! Formation position of the controlled vehicle (path frame).
+        double form_pos[2];
+        //! Body acceleration limits, ground frame.
+        double accel_lim_x[2];
+        double accel_lim_y[2];
+        //! Wind velocity.
+        double wind[2];
+        //! Deconfliction distance.
+        double deconfl_dist;
+        //! Deconfliction offset.
+        double deconfl_offset;
+        //! Deconfliction weight gain.
+        double k_deconfl;
+        //! Long distance weight thresholds.
+        double k_long1;
+        double k_long2;
+        //! Maximum speed.
+        double speed_max;
+        //! Acceleration safety margin.
+        double acc_safety_marg;
+        //! Minimum magnitude of the relative velocity bounds.
+        double rel_vel_lim;
+      };
+
+      //! Formation and deconfliction terms of one pair of vehicles.
+      struct PairTerms
+      {
+        //! Control weight gain.
+        double weight;
+        //! Sliding surface deviation.
+        double surf[2];
+        //! Virtual error.
+        double virt_err[2];
+        //! Distance between vehicles.
+        double dist;
+        //! Relative position error norm.
+        double err;
+        //! Inter-vehicle direction vector.
+        double dir[2];
+        //! Relative position error - ground frame.
+        double err_g[2];
+        //! Relative position error - inter-vehicle frame.
+        double err_r[2];
+        //! Relative velocity error - inter-vehicle frame.
+        double err_v[2];
+        //! Sliding surface deviation - inter-vehicle frame.
+        double surf_r[2];
+      };
+
+      //! Compute the terms of a pair of vehicles. When 'full' is false
+      //! and the pair has no weight in the control law (vehicles far
+      //! apart), only the weight is computed and the remaining terms
+      //! are set to zero.
+      //! @param ctx controller context.
+      //! @param team team state.
+      //! @param other index of the other vehicle.
+      //! @param full true to compute every term, including monitoring.
+      //! @param terms pair terms.
+      void
+      computePair(const PairContext& ctx, const TeamState& team, unsigned other,
+                  bool full, PairTerms& terms);
+
+      //! Computes the pair terms of one vehicle against the rest of the
+      //! team, optionally splitting the pairs across worker threads.
+      class PairSolver
+      {
+      public:
+        PairSolver(void);
+
+        ~PairSolver(void);
+
+        //! Set number of worker threads. Zero computes every pair in
+        //! the calling thread.
+        //! @param count number of worker threads.
+        void
+        setThreads(unsigned count);
+
+        //! Compute terms of all pairs of the controlled vehicle.
+        //! @param ctx controller context.
+        //! @param team team state.
+        //! @param full true to compute every term of every pair.
+        //! @param terms output terms, indexed by vehicle.
+        void
+        compute(const PairContext& ctx, const TeamState& team, bool full,
+                std::vector<PairTerms>& terms);
+
+      private:
+        class Worker;
+
+        //! Worker threads.
+        std::vector<Worker*> m_workers;
+        //! Lock and signal for jobs and completions.
+        Concurrency::Condition m_cond;
+        //! Current job.
+        const PairContext* m_ctx;
+        const TeamState* m_team;
+        std::vector<PairTerms>* m_terms;
+        bool m_full;
+        //! Job sequence number.
+        unsigned m_job;
+        //! Number of workers yet to finish the current job.
+        unsigned m_pending;
+        //! True to stop workers.
+        bool m_stopping;
+
+        //! Compute one slice of the pairs.
+        //! @param slice slice index.
+        void
+        run(unsigned slice);
+
+        //! Wait for a new job.
+        //! @param job last job sequence number seen.
+        //! @return false if the workers must stop.
+        bool
+        take(unsigned& job);
+
+        //! Mark a slice as done.
+        void
+        done(void);
+
+        void
+        stopWorkers(void);
+      };
+    }
+  }
+}
+
+#endif
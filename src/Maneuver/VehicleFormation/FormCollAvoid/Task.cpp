@@ -37,6 +37,9 @@
 #include <DUNE/DUNE.hpp>
 #include <DUNE/Simulation/UAV.hpp>
 
+// Local headers.
+#include "PairTerms.hpp"
+
 #define vel_lim 0.5
 
 namespace Maneuver
@@ -99,6 +102,8 @@ namespace Maneuver
         unsigned int wind_average_window;
         // Debug flag
         bool debug;
+        //! Number of worker threads for the vehicle pair terms
+        unsigned pair_threads;
       };
 
       struct RelState
@@ -346,6 +351,13 @@ namespace Maneuver
         // Debug variables
         bool m_debug;
         FormMonitor* m_form_monitor;
+
+        //! Team state, in vehicle pair computation layout
+        TeamState m_team;
+        //! Vehicle pair terms
+        std::vector<PairTerms> m_pair_terms;
+        //! Vehicle pair terms solver
+        PairSolver m_pair_solver;
         //std::vector<RelState*> m_rel_state;
 
         //! List of systems allowed to define a command.
@@ -577,6 +589,10 @@ namespace Maneuver
           .defaultValue("false")
           .description("Controller in debug mode");
 
+          param("Pair Worker Threads", m_args.pair_threads)
+          .defaultValue("0")
+          .description("Number of worker threads used to compute the vehicle pair terms of large formations (0 to compute them in the task thread)");
+
           // Message binding
           bind<IMC::LeaderState>(this);
           bind<IMC::Formation>(this);
@@ -600,6 +616,8 @@ namespace Maneuver
           //==========================================
           // Debug flag - for control performance monitoring
           m_debug = m_args.debug;
+          // Vehicle pair terms computation
+          m_pair_solver.setThreads(m_args.pair_threads);
           // Task update frequency
           m_frequency = this->getFrequency();
           // Simulation frequency
@@ -2472,7 +2490,6 @@ namespace Maneuver
           double k_deconfliction_dist = m_k_deconfliction*k_form_ref;
           double k_long_dist1 = 1.5;
           double k_long_dist2 = 4;
-          double k_long_dist3 = k_long_dist2-k_long_dist1;
 
           // Reference frame and axes rotation (Ground to Yaw)
           double d_cos_heading = std::cos(md_uav_state(8, ind_uav+1));
@@ -2493,7 +2510,6 @@ namespace Maneuver
           double t_sin_gamma;
           double vt_form_dir[2];
           Matrix vd_form_pos1 = Matrix(2, 1, 0.0);
-          double t_dist_gain;
 
           Matrix vd_inter_uav_state = Matrix(6, 1);
           Matrix vd_inter_uav_pos = Matrix(2, 1);
@@ -2506,26 +2522,17 @@ namespace Maneuver
           Matrix vd_inter_uav_x = Matrix(2, 1);
           Matrix vd_inter_uav_y = Matrix(2, 1);
 
-          double vt_form_pos2[2] = {0, 0};
-          Matrix vd_form_pos2 = Matrix(2, 1, 0.0);
           Matrix vd_inter_uav_des_pos = Matrix(2, 1, 0.0);
           Matrix vd_inter_uav_des_vel = Matrix(2, 1, 0.0);
           Matrix vd_inter_uav_des_acc = Matrix(2, 1, 0.0);
 
           Matrix vd_err = Matrix(2, 1);
-          Matrix vd_orig_err = Matrix(2, 1);
-          double t_err_y;
           double d_err_x;
           double d_err_y;
-          double d_err_x_s_conv;
-          // double d_err_y_s_conv;
-          int int_Max;
           Matrix vd_deriv_err = Matrix(2, 1);
           double d_deriv_err_x;
           double d_deriv_err_y;
 
-          double d_vel_proj_x;
-          double d_vel_proj_y;
           double d_accel_max_proj_x;
           double d_accel_max_proj_y;
 
@@ -2533,17 +2540,6 @@ namespace Maneuver
           double d_c2;
           double d_c3;
           double d_c4;
-          double t_ctrl_marg_mult;
-
-          double d_des_dist;
-          double d_dist2confl;
-          double d_predicted_dist;
-
-          double t_surf_x;
-          double t_surf_y;
-
-          double d_inter_uav_angle_dot;
-          Matrix vt_surf_deriv =  Matrix(2, 1, 0.0);
 
           Matrix vd_surf_uav = Matrix(2, m_uav_n+1, 0.0);
           Matrix vt_virt_err_uav = Matrix(2, m_uav_n+1, 0.0);
@@ -2647,261 +2643,52 @@ namespace Maneuver
           //! Formation UAV sweep
           //-------------------------------------------
 
-          // ToDo - check - verificar inclusão do líder como elemento 0 dos vectores e matrizes
-          // da formação, em vez de elemento m_uav_n em apenas algumas
+          PairContext pair_ctx;
+          pair_ctx.own = ind_uav;
+          pair_ctx.earth_fixed = (m_formation_frame == IMC::Formation::OP_EARTH_FIXED);
+          pair_ctx.curved = (m_formation_frame == IMC::Formation::OP_PATH_CURVED) &&
+              (md_uav_state(6, 0) != 0);
+          pair_ctx.turn_rad = d_form_turnrad;
+          pair_ctx.turn_rate = d_form_turnrate;
+          pair_ctx.rot_cos = d_cos_form_course;
+          pair_ctx.rot_sin = d_sin_form_course;
+          pair_ctx.form_pos[0] = vd_form_pos1(0);
+          pair_ctx.form_pos[1] = vd_form_pos1(1);
+          pair_ctx.accel_lim_x[0] = vd_body_accel_lim_x(0);
+          pair_ctx.accel_lim_x[1] = vd_body_accel_lim_x(1);
+          pair_ctx.accel_lim_y[0] = vd_body_accel_lim_y(0);
+          pair_ctx.accel_lim_y[1] = vd_body_accel_lim_y(1);
+          pair_ctx.wind[0] = m_wind(0);
+          pair_ctx.wind[1] = m_wind(1);
+          pair_ctx.deconfl_dist = d_deconfliction_dist;
+          pair_ctx.deconfl_offset = m_deconfliction_offset;
+          pair_ctx.k_deconfl = k_deconfliction_dist;
+          pair_ctx.k_long1 = k_long_dist1;
+          pair_ctx.k_long2 = k_long_dist2;
+          pair_ctx.speed_max = m_speed_max;
+          pair_ctx.acc_safety_marg = m_acc_safety_marg;
+          pair_ctx.rel_vel_lim = vel_lim;
+
+          //! Pairs without weight are only fully computed for monitoring
+          m_team.load(md_uav_state, md_vehicle_accel, m_formation_pos);
+          m_pair_solver.compute(pair_ctx, m_team, b_debug, m_pair_terms);
+
           for (unsigned int ind_uav2 = 0; ind_uav2 < m_uav_n; ind_uav2++)
           {
             // Skipping the current UAV index
             if (ind_uav == ind_uav2)
               continue;
 
-            //debug("formationControl - 2.1");
-            //! Computing relative state, from current UAV to "ind_uav2" UAV
-            vd_inter_uav_state = md_uav_state.get(0, 5, ind_uav2+1, ind_uav2+1) -
-                md_uav_state.get(0, 5, ind_uav+1, ind_uav+1);
-            vd_inter_uav_pos = vd_inter_uav_state.get(0, 1, 0, 0);
-            d_inter_uav_dist = vd_inter_uav_pos.norm_2();
-            //! Computing the rotation matrix - From inter-UAV frame to ground frame
-            d_inter_uav_angle = std::atan2(vd_inter_uav_pos(1),
-                vd_inter_uav_pos(0));
-            d_cos_inter_uav_angle = std::cos(d_inter_uav_angle);
-            d_sin_inter_uav_angle = std::sin(d_inter_uav_angle);
-            mt_rot[0] = d_cos_inter_uav_angle;
-            mt_rot[1] = -d_sin_inter_uav_angle;
-            mt_rot[2] = d_sin_inter_uav_angle;
-            mt_rot[3] = d_cos_inter_uav_angle;
-            md_rot = Matrix(mt_rot, 2, 2);
-            vd_inter_uav_x = md_rot.column(0);
-            vd_inter_uav_y = md_rot.column(1);
-
-            //debug("formationControl - 2.2");
-            //! Computation of the desired formation state:
-            //! - Position vector
-            //! - Velocity vector
-            //! - Acceleration vector
-            if (m_formation_frame == IMC::Formation::OP_EARTH_FIXED)
-            {
-              //! Ground reference frame
-              //! - Position
-              vd_inter_uav_des_pos = m_formation_pos.get(0, 1, ind_uav, ind_uav) -
-                  m_formation_pos.get(0, 1, ind_uav2, ind_uav2);
-              //! - Velocity
-              vd_inter_uav_des_vel = Matrix(2, 1, 0.0);
-              //! - Acceleration
-              vd_inter_uav_des_acc = Matrix(2, 1, 0.0);
-              /* Alternative computation
-            vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
-            //! - Velocity
-            vd_inter_uav_des_vel = [-vd_err(1); vd_err(0)] * d_form_turnrate;
-            //! - Acceleration
-            vd_inter_uav_des_acc = -vd_err * d_form_turnrate*d_form_turnrate;
-               */
-            }
-            else
-            {
-              //! Path reference frame
-              if ((m_formation_frame == IMC::Formation::OP_PATH_CURVED) &&
-                  (md_uav_state(6, 0) != 0))
-              {
-                //! Curved shape - Formation shape adjustment to path curvature
-                t_uav_turnrad = d_form_turnrad - m_formation_pos(1, ind_uav2);
-                t_cos_gamma = std::cos(m_formation_pos(0, ind_uav2)/d_form_turnrad);
-                t_sin_gamma = std::sin(m_formation_pos(0, ind_uav2)/d_form_turnrad);
-                // - Position
-                vt_form_dir[0] = t_sin_gamma;
-                vt_form_dir[1] = 1 - t_cos_gamma;
-                vt_form_pos2[0] = 0;
-                vt_form_pos2[1] = m_formation_pos(1, ind_uav);
-                vd_form_pos2 = t_uav_turnrad * Matrix(vt_form_dir, 2, 1) +
-                    Matrix(vt_form_pos2, 2, 1);
-                /*
-              //! - Velocity
-              vd_form_vel2 = [-vd_form_pos2(2); vd_form_pos2(1)] * d_form_turnrate;
-              //! - Acceleration
-              vd_form_acc2 = -vd_form_pos2 * d_form_turnrate*d_form_turnrate;
-                 */
-              }
-              else
-              {
-                //! Original shape - Simpler formation shape rotation (below)
-                vd_form_pos2 = m_formation_pos.get(0, 1, ind_uav2, ind_uav2);
-                /*
-              vd_form_vel2 = [-vd_form_pos2(2); vd_form_pos2(1)] * d_form_turnrate;
-              vd_form_acc2 = -vd_form_pos2 * d_form_turnrate*d_form_turnrate;
-                 */
-              }
-
-              vd_inter_uav_des_pos = md_rot_formation * (vd_form_pos1 - vd_form_pos2);
-              //vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
-              //! - Velocity
-              vd_inter_uav_des_vel(0) = vd_inter_uav_state(1) * d_form_turnrate;
-              vd_inter_uav_des_vel(1) = -vd_inter_uav_state(0) * d_form_turnrate;
-              //vd_inter_uav_des_vel = md_rot_formation * (vd_form_vel1 - vd_form_vel2);
-              //! - Acceleration
-              vd_inter_uav_des_acc = vd_inter_uav_state.get(0, 1, 0, 0)  * d_form_turnrate*d_form_turnrate;
-              //vd_inter_uav_des_acc = md_rot_formation * (vd_form_acc1 - vd_form_acc2);
-            }
-
-            //debug("formationControl - 2.3");
-            //! Relative position error vector
-            vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
-            d_err_y = Matrix::dot(vd_err, vd_inter_uav_y);
-            d_err_x = Matrix::dot(vd_err, vd_inter_uav_x);
-            // verificar uso de "Booleano" como alternativa a "int_Max",
-            // para optimização do código e da facilidade de interpretação deste
-            if (d_err_x < d_deconfliction_dist - d_inter_uav_dist)
-            {
-              int_Max = 2;
-              d_err_x = d_deconfliction_dist - d_inter_uav_dist;
-            }
-            else
-            {
-              int_Max = 1;
-            }
-            // Original positional error vector, only used for controller performance evaluation
-            vd_orig_err = vd_err;
-
-            //debug("formationControl - 2.4");
-            //! Relative velocity error vector
-            vd_deriv_err = -vd_inter_uav_state.get(3, 4, 0, 0) - vd_inter_uav_des_vel;
-            d_deriv_err_x = Matrix::dot(vd_deriv_err, vd_inter_uav_x);
-            d_deriv_err_y = Matrix::dot(vd_deriv_err, vd_inter_uav_y);
-
-            //! Maneuvering constrains - Projection onto the inter-UAV reference frame
-            d_vel_proj_x = Matrix::dot((md_uav_state.get(3, 4, ind_uav2+1, ind_uav2+1) - m_wind.get(0, 1, 0, 0)),
-                vd_inter_uav_x);
-            //debug("formationControl - 2.4.1");
-            d_accel_max_proj_x = std::abs(Matrix::dot(vd_body_accel_lim_x, vd_inter_uav_x)) +
-                std::abs(Matrix::dot(vd_body_accel_lim_y, vd_inter_uav_x));
-            //debug("formationControl - 2.4.2");
-            d_vel_proj_y = Matrix::dot((md_uav_state.get(3, 4, ind_uav2+1, ind_uav2+1) - m_wind.get(0, 1, 0, 0)),
-                vd_inter_uav_y);
-            //debug("formationControl - 2.4.3");
-            d_accel_max_proj_y = std::abs(Matrix::dot(vd_body_accel_lim_x, vd_inter_uav_y)) +
-                std::abs(Matrix::dot(vd_body_accel_lim_y, vd_inter_uav_y));
-
-            //debug("formationControl - 2.5");
-            //! Sliding Surface parameters - Inter-UAV X axis
-            //! Avoid negative maximum relative velocities - Minimum is hard-coded with "vel_lim"
-            d_c1 = std::max(m_speed_max - d_vel_proj_x, vel_lim);
-            t_ctrl_marg_mult = 2 * m_speed_max/(m_speed_max + d_vel_proj_x);
-            d_c2 = m_deconfliction_offset * t_ctrl_marg_mult;
-            if (d_err_x < 0)
-            {
-              d_c2 = std::max(4 * (1+m_acc_safety_marg) * d_c1*d_c1/(27 * d_accel_max_proj_x), d_c2);
-              /*
-            t_CtrlMarg = d_c2/t_ctrl_marg_mult;
-            d_deconfliction_dist = m_safe_dist + t_CtrlMarg;
-            if (t_CtrlMarg > m_deconfliction_offset*1.1)
-              spew('Control margin: %1.1f m; UAV%d & UAV%d\n', t_CtrlMarg, ind_uav, ind_uav2);
-               */
-            }
-
-            //debug("formationControl - 2.6");
-            //! Limitation of the sliding surface (before reaching negative infinite)
-            if (d_inter_uav_dist < d_deconfliction_dist)
-            {
-              d_err_x = std::min(d_err_x, d_c2*0.5);
-              if (d_deriv_err_x > 0)
-                d_err_x_s_conv = d_err_x;
-              else
-                d_err_x_s_conv = std::min(d_err_x, 0.0);
-            }
-            else
-            {
-              d_err_x = std::min(d_err_x, d_c2*0.5);
-              d_err_x_s_conv = d_err_x;
-            }
-            // d_err_x = std::min(d_err_x, d_c2*0.5);
-
-            //debug("formationControl - 2.7");
-            //! Y projection adjustment, if target is beyond the other UAV
-            if (int_Max == 2)
-            {
-              //! Target point across another UAV position - Define a point
-              //! on the safety rim of the other UAV to follow
-              t_err_y = 2 * d_deconfliction_dist;
-              /*
-            if (d_err_x > 0)
-              t_err_y = 2 * d_deconfliction_dist;
-            else
-              t_err_y = 0.5 * d_deconfliction_dist;
-               */
-              if (t_err_y > std::abs(d_err_y))
-              {
-                if (d_err_y < 0)
-                  d_err_y = -t_err_y;
-                else
-                  d_err_y = t_err_y;
-              }
-            }
-            vd_err(0) = d_err_x;
-            vd_err(1) = d_err_y;
-            vd_err = md_rot*vd_err;
-
-            //debug("formationControl - 2.8");
+            const PairTerms& pair = m_pair_terms[ind_uav2];
             //! UAV-pair - Regulation of control importance
-            d_des_dist = vd_inter_uav_des_pos.norm_2();
-            // Inter-UAV distance compensated for the current inter-UAV velocity
-            // Takes into account the vehicle acceleration limitations
-            d_predicted_dist = d_inter_uav_dist + std::min(0.0, d_deriv_err_x*std::abs(d_deriv_err_x)*
-                (1+m_acc_safety_marg)/d_accel_max_proj_x);
-            d_dist2confl = d_predicted_dist-d_deconfliction_dist;
-            if (d_dist2confl < 0)
-              // Control weight increment if the predicted distance is shorter than the deconfliction distance
-              vd_weight_gain(ind_uav2+1) = 1 + d_dist2confl/m_deconfliction_offset *
-                  d_dist2confl/m_deconfliction_offset * k_deconfliction_dist;
-            else if (d_predicted_dist <= d_des_dist*k_long_dist1)
-              vd_weight_gain(ind_uav2+1) = 1;
-            else if (d_predicted_dist < d_des_dist*k_long_dist2)
-            {
-              // Control weight reduction if the predicted distance is larger than
-              // the desired distance by "k_long_dist1"
-              t_dist_gain = (d_predicted_dist-d_des_dist*k_long_dist1)/(d_des_dist*k_long_dist3);
-              vd_weight_gain(ind_uav2+1) = 1 - t_dist_gain*t_dist_gain;
-            }
-            else
-              // Control weight anulation if the predicted distance is larger than
-              // the desired distance multiplied by "k_long_dist2"
-              vd_weight_gain(ind_uav2+1) = 0;
-
-            //debug("formationControl - 2.9");
-            //! Sliding Surface parameters - Inter-UAV Y axis
-            if (d_err_y < 0)
-            {
-              //! Avoid negative maximum relative velocities - Minimum is hard-coded with "vel_lim" m/s
-              d_c3 = std::max(m_speed_max - d_vel_proj_y, vel_lim);
-              d_c4 = 4 * (1+m_acc_safety_marg) * d_c3*d_c3/(27 * d_accel_max_proj_y);
-            }
-            else
-            {
-              //! Avoid positive minimum relative velocities - Maximum is hard-coded with -"vel_lim" m/s
-              d_c3 = std::min(- m_speed_max - d_vel_proj_y, -vel_lim);
-              d_c4 = - 4 * (1+m_acc_safety_marg) * d_c3*d_c3/(27 * d_accel_max_proj_y);
-            }
-
-            //! ======= Sliding surface ==============
-
-            //debug("formationControl - 2.10");
-            t_surf_x = d_c1 * d_err_x/(d_err_x - d_c2);
-            t_surf_y = d_c3 * d_err_y/(d_err_y - d_c4);
+            vd_weight_gain(ind_uav2+1) = pair.weight;
             //! Sliding surface deviation
-            vd_surf_uav.set(0, 1, ind_uav2+1, ind_uav2+1,
-                            vd_deriv_err - t_surf_x * vd_inter_uav_x - t_surf_y * vd_inter_uav_y);
-
-            //! ======= Virtual error and feedback linearization ================
-            d_inter_uav_angle_dot = Matrix::dot(vd_inter_uav_state.get(3, 4, 0, 0),
-                vd_inter_uav_y/d_inter_uav_dist);
-            // d_inter_uav_angle_dot = 0;
-            vt_surf_deriv(0) = d_c1*d_c2*d_deriv_err_x/((d_err_x_s_conv - d_c2)*(d_err_x_s_conv - d_c2)) +
-                t_surf_y * d_inter_uav_angle_dot;
-            vt_surf_deriv(1) = d_c3 * d_c4 * d_deriv_err_y/((d_err_y - d_c4)*(d_err_y - d_c4)) -
-                t_surf_x * d_inter_uav_angle_dot;
-            vt_virt_err_uav.set(0, 1, ind_uav2+1, ind_uav2+1,
-                                md_vehicle_accel.get(0, 1, ind_uav2+1, ind_uav2+1) +
-                                vd_inter_uav_des_acc - md_rot * vt_surf_deriv);
-
-            //debug("formationControl - 2.11");
+            vd_surf_uav(0, ind_uav2+1) = pair.surf[0];
+            vd_surf_uav(1, ind_uav2+1) = pair.surf[1];
+            //! Virtual error
+            vt_virt_err_uav(0, ind_uav2+1) = pair.virt_err[0];
+            vt_virt_err_uav(1, ind_uav2+1) = pair.virt_err[1];
+
             //! Tracking output
             if (b_debug)
             {
@@ -2909,43 +2696,27 @@ namespace Maneuver
               //! Vehicle identifier;
               rel_state->s_id = m_formation_systems[ind_uav2];
               //! Distance between vehicles
-              rel_state->dist = d_inter_uav_dist;
-              // // ======== Formation perturbation test - Mesh stability =======
-              // if (ind_uav == 1)
-              //   vd_orig_err += vd_Pert;
-              // end
-              // // ======== Formation perturbation test - Mesh stability =======
+              rel_state->dist = pair.dist;
               //! Relative position error norm
-              rel_state->err =  vd_orig_err.norm_2();
+              rel_state->err = pair.err;
               //! Inter-vehicle direction vector
-              rel_state->rel_dir_x = vd_inter_uav_x(0);
-              rel_state->rel_dir_y = vd_inter_uav_x(1);
-              //rel_state->rel_dir_z = vd_inter_uav_x(2);
+              rel_state->rel_dir_x = pair.dir[0];
+              rel_state->rel_dir_y = pair.dir[1];
               //! Relative position error - Ground reference frame
-              // // ======== Formation perturbation test - Mesh stability =======
-              // if ind_UAV == 1
-              //   vd_err = vd_err + vd_Pert;
-              // end
-              // // ======== Formation perturbation test - Mesh stability =======
-              rel_state->err_x = vd_err(0);
-              rel_state->err_y = vd_err(1);
-              //rel_state->err_z = vd_err(2);
+              rel_state->err_x = pair.err_g[0];
+              rel_state->err_y = pair.err_g[1];
               //! Relative position error - Inter-vehicle reference frame
-              rel_state->rf_err_x = Matrix::dot(vd_err ,vd_inter_uav_x);
-              rel_state->rf_err_y = Matrix::dot(vd_err, vd_inter_uav_y);
-              //rel_state->rf_err_z = Matrix::dot(vd_err, vd_inter_uav_z);
+              rel_state->rf_err_x = pair.err_r[0];
+              rel_state->rf_err_y = pair.err_r[1];
               //! Relative velocity error - Inter-vehicle reference frame
-              rel_state->rf_err_vx = Matrix::dot(vd_deriv_err, vd_inter_uav_x);
-              rel_state->rf_err_vy = Matrix::dot(vd_deriv_err, vd_inter_uav_y);
-              //rel_state->rf_err_vz = Matrix::dot(vd_deriv_err, vd_inter_uav_z);
+              rel_state->rf_err_vx = pair.err_v[0];
+              rel_state->rf_err_vy = pair.err_v[1];
               //! Deviation from convergence (sliding surface) - Inter-vehicle reference frame
-              rel_state->ss_x = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav2+1, ind_uav2+1), vd_inter_uav_x);
-              rel_state->ss_y = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav2+1, ind_uav2+1), vd_inter_uav_y);
-              //rel_state->ss_z = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav2+1, ind_uav2+1), vd_inter_uav_z);
+              rel_state->ss_x = pair.surf_r[0];
+              rel_state->ss_y = pair.surf_r[1];
               //! Inter-vehicle virtual error - Ground reference frame
-              rel_state->virt_err_x = vt_virt_err_uav(0, ind_uav2+1);
-              rel_state->virt_err_y = vt_virt_err_uav(1, ind_uav2+1);
-              //rel_state->virt_err_z = vt_virt_err_uav(2, ind_uav2+1);
+              rel_state->virt_err_x = pair.virt_err[0];
+              rel_state->virt_err_y = pair.virt_err[1];
             }
           }
 
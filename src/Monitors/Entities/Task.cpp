@@ -127,7 +127,7 @@ namespace Monitors
         .minimumValue("0")
         .description("Maximum number of consecutive transitions before starting to ignore");
 
-        bind<IMC::EntityState>(this);
+        bind<IMC::EntityState>(this, IMC::BusPredicate().source(getSystemId()));
         bind<IMC::MonitorEntityState>(this);
       }
 
@@ -188,9 +188,6 @@ namespace Monitors
       void
       consume(const IMC::EntityState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         if (msg->getSourceEntity() == DUNE_IMC_CONST_UNK_EID)
         {
           err(DTR("EntityState message without source entity"));
@@ -96,6 +96,8 @@ namespace Monitors
       float m_gndspeed;
       //! Medium Sensor entity id.
       unsigned m_medium_eid;
+      //! Bus predicate of EntityState messages.
+      IMC::BusPredicate* m_medium_filter;
       //! Vehicle Altitude
       float m_altitude;
       //! Task arguments.
@@ -178,7 +180,7 @@ namespace Monitors
         m_wet_devs.setTop(c_water_presence);
 
         // Register consumers.
-        bind<IMC::EntityState>(this);
+        m_medium_filter = bind<IMC::EntityState>(this, IMC::BusPredicate().source(getSystemId()));
         bind<IMC::EstimatedState>(this);
         bind<IMC::GpsFix>(this);
         bind<IMC::Salinity>(this);
@@ -192,6 +194,7 @@ namespace Monitors
         try
         {
           m_medium_eid = resolveEntity(m_args.label_medium);
+          m_medium_filter->sourceEntity(m_medium_eid);
         }
         catch (...)
         {
@@ -210,9 +213,6 @@ namespace Monitors
       void
       consume(const IMC::EntityState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         if (msg->getSourceEntity() != m_medium_eid)
           return;
 
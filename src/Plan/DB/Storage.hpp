@@ -0,0 +1,166 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef PLAN_DB_STORAGE_HPP_INCLUDED_
+#define PLAN_DB_STORAGE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Plan
+{
+  namespace DB
+  {
+    using DUNE_NAMESPACES;
+
+    static const char* c_plan_table_stmt =
+    "create table if not exists Plan ( "
+    " plan_id varchar2 primary key,"
+    " change_time real not null,"
+    " change_sid integer not null,"
+    " change_sname varchar2 not null,"
+    " md5 blob not null,"
+    " data blob not null"
+    " )"
+    ;
+    static const char* c_insert_plan_stmt = "insert or replace into Plan values(?,?,?,?,?,?)";
+    static const char* c_delete_plan_stmt = "delete from Plan where plan_id=?";
+    static const char* c_plan_iterator_stmt =
+    "select plan_id, change_time, change_sid, change_sname, md5, length(data)"
+    "from Plan order by plan_id";
+    static const char* c_get_plan_stmt = "select data from Plan where plan_id=?";
+    static const char* c_delete_all_plans_stmt = "delete from Plan";
+
+    static const char* c_lastchange_table_stmt =
+    "create table if not exists LastChange ("
+    " change_time real not null,"
+    " change_sid integer not null,"
+    " change_sname varchar2 not null )";
+
+    static const char* c_lastchange_insert_stmt
+    = "insert into LastChange values(?,?,?)";
+
+    static const char* c_lastchange_update_stmt
+    = "update LastChange set change_time=?, change_sid=?, change_sname=?";
+
+    static const char* c_lastchange_query_stmt
+    = "select change_time, change_sid, change_sname from LastChange";
+
+    //! Origin and time of a change to the database.
+    struct Change
+    {
+      //! Time of change.
+      double time;
+      //! Source system id.
+      uint16_t sid;
+      //! Source system name.
+      std::string sname;
+    };
+
+    //! Update LastChange table information.
+    //! @param[in] conn database connection.
+    //! @param[in] change change.
+    inline void
+    updateLastChange(Database::Connection& conn, const Change& change)
+    {
+      int count = 0;
+
+      Database::Statement& stmt = conn.prepare(c_lastchange_update_stmt);
+      stmt << change.time << change.sid << change.sname;
+      stmt.execute(&count);
+
+      if (count != 1)
+        throw std::runtime_error(DTR("database is corrupt"));
+    }
+
+    //! Store (insert or replace) a plan.
+    struct StorePlan: public Database::Queue::Operation
+    {
+      //! Plan information.
+      IMC::PlanDBInformation info;
+      //! Serialized plan specification.
+      Database::Blob data;
+
+      void
+      execute(Database::Connection& conn)
+      {
+        Database::Statement& stmt = conn.prepare(c_insert_plan_stmt);
+        stmt << info.plan_id
+             << info.change_time
+             << info.change_sid
+             << info.change_sname
+             << info.md5
+             << data;
+        stmt.execute();
+
+        Change change = {info.change_time, info.change_sid, info.change_sname};
+        updateLastChange(conn, change);
+      }
+    };
+
+    //! Delete a plan.
+    struct DeletePlan: public Database::Queue::Operation
+    {
+      //! Plan identifier.
+      std::string plan_id;
+      //! Change information.
+      Change change;
+
+      void
+      execute(Database::Connection& conn)
+      {
+        Database::Statement& stmt = conn.prepare(c_delete_plan_stmt);
+        stmt << plan_id;
+        stmt.execute();
+
+        updateLastChange(conn, change);
+      }
+    };
+
+    //! Delete all plans.
+    struct ClearPlans: public Database::Queue::Operation
+    {
+      //! Change information.
+      Change change;
+
+      void
+      execute(Database::Connection& conn)
+      {
+        conn.prepare(c_delete_all_plans_stmt).execute();
+        updateLastChange(conn, change);
+      }
+    };
+  }
+}
+
+#endif
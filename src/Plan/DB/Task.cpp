@@ -29,49 +29,22 @@
 
 // ISO C++ 98 headers.
 #include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Storage.hpp"
+
 namespace Plan
 {
   namespace DB
   {
     using DUNE_NAMESPACES;
 
-    static const char* c_plan_table_stmt =
-    "create table if not exists Plan ( "
-    " plan_id varchar2 primary key,"
-    " change_time real not null,"
-    " change_sid integer not null,"
-    " change_sname varchar2 not null,"
-    " md5 blob not null,"
-    " data blob not null"
-    " )"
-    ;
-    static const char* c_insert_plan_stmt = "insert into Plan values(?,?,?,?,?,?)";
-    static const char* c_delete_plan_stmt = "delete from Plan where plan_id=?";
-    static const char* c_plan_iterator_stmt =
-    "select plan_id, change_time, change_sid, change_sname, md5, length(data)"
-    "from Plan order by plan_id";
-    static const char* c_query_plan_stmt =
-    "select change_time, change_sid, change_sname, md5, length(data)"
-    "from Plan where plan_id=?";
-    static const char* c_get_plan_stmt = "select data from Plan where plan_id=?";
-    static const char* c_delete_all_plans_stmt = "delete from Plan";
-
-    static const char* c_lastchange_table_stmt =
-    "create table if not exists LastChange ("
-    " change_time real not null,"
-    " change_sid integer not null,"
-    " change_sname varchar2 not null )";
-
-    static const char* c_lastchange_update_stmt
-    = "update LastChange set change_time=?, change_sid=?, change_sname=?";
-
-    static const char* c_lastchange_query_stmt
-    = "select change_time, change_sid, change_sname from LastChange";
-
     static const char* c_op_desc[] = {DTR_RT("set plan"), DTR_RT("delete plan"),
                                       DTR_RT("get plan"), DTR_RT("get plan info"),
                                       DTR_RT("clear database"), DTR_RT("database state"),
@@ -83,31 +56,43 @@ namespace Plan
       std::string db_path;
     };
 
+    //! Plan information by plan id.
+    typedef std::map<std::string, IMC::PlanDBInformation> Index;
+
+    //! Reply to a request waiting for its write to be committed.
+    struct PendingReply
+    {
+      //! Queue ticket of the write, zero if there is none.
+      unsigned ticket;
+      //! Reply message.
+      IMC::PlanDB reply;
+      //! Description of success.
+      std::string success;
+    };
+
     struct Task: public DUNE::Tasks::Task
     {
       // Task arguments
       Arguments m_args;
       // Database handle.
       Database::Connection* m_db;
+      // Write queue.
+      Database::Queue* m_queue;
+      // Replies waiting for queued writes, in request order.
+      std::vector<PendingReply> m_pending;
+      // Information of stored plans, ordered by plan id.
+      Index m_index;
+      // Last change to the database.
+      Change m_last_change;
       // In progress reply message.
       IMC::PlanDB m_reply;
-      // In progress reply message.
-      IMC::PlanDBInformation m_plan_info;
-      // Statements
-      Database::Statement* m_insert_plan_stmt;
-      Database::Statement* m_delete_plan_stmt;
-      Database::Statement* m_plan_iterator_stmt;
-      Database::Statement* m_query_plan_stmt;
-      Database::Statement* m_get_plan_stmt;
-      Database::Statement* m_delete_all_plans_stmt;
-      Database::Statement* m_lastchange_update_stmt;
-      Database::Statement* m_lastchange_query_stmt;
       // Local request counter
       uint16_t m_local_reqid;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
         m_db(NULL),
+        m_queue(NULL),
         m_local_reqid(0)
       {
         param("DB Path", m_args.db_path)
@@ -140,31 +125,25 @@ namespace Plan
 
         inf(DTR("database file: '%s'"), db_file.c_str());
 
-        m_db = new Database::Connection(db_file.c_str(), Database::Connection::CF_CREATE);
+        m_db = new Database::Connection(db_file.c_str(), Database::Connection::CF_CREATE
+                                        | Database::Connection::CF_WAL);
 
-        // Create Plan table and initialize associated statements
         m_db->execute(c_plan_table_stmt);
-        m_insert_plan_stmt = new Database::Statement(c_insert_plan_stmt, *m_db);
-        m_delete_plan_stmt = new Database::Statement(c_delete_plan_stmt, *m_db);
-        m_plan_iterator_stmt = new Database::Statement(c_plan_iterator_stmt, *m_db);
-        m_query_plan_stmt = new Database::Statement(c_query_plan_stmt, *m_db);
-        m_get_plan_stmt = new Database::Statement(c_get_plan_stmt, *m_db);
-        m_delete_all_plans_stmt = new Database::Statement(c_delete_all_plans_stmt, *m_db);
-
-        // Create Plan table and initialize associated statements
         m_db->execute(c_lastchange_table_stmt);
-        m_lastchange_update_stmt = new Database::Statement(c_lastchange_update_stmt, *m_db);
-        m_lastchange_query_stmt = new Database::Statement(c_lastchange_query_stmt, *m_db);
 
-        if (!m_lastchange_query_stmt->execute())
+        Database::Statement& query = m_db->prepare(c_lastchange_query_stmt);
+        if (!query.execute())
         {
-          Database::Statement initial_insert("insert into LastChange values(?,?,?)", *m_db);
+          Database::Statement& initial_insert = m_db->prepare(c_lastchange_insert_stmt);
           double now = Clock::getSinceEpoch();
           initial_insert << now << getSystemId() << getSystemName();
           initial_insert.execute();
         }
 
-        m_lastchange_query_stmt->reset();
+        loadIndex();
+
+        m_queue = new Database::Queue(*m_db);
+        m_queue->start();
 
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
 
@@ -177,17 +156,133 @@ namespace Plan
         if (m_db == NULL)
           return;
 
-        delete m_insert_plan_stmt;
-        delete m_delete_plan_stmt;
-        delete m_plan_iterator_stmt;
-        delete m_query_plan_stmt;
-        delete m_get_plan_stmt;
-        delete m_delete_all_plans_stmt;
-        delete m_lastchange_update_stmt;
-        delete m_lastchange_query_stmt;
-        delete m_db;
+        if (m_queue != NULL)
+        {
+          commit();
+          m_queue->stopAndJoin();
+          delete m_queue;
+          m_queue = NULL;
+        }
 
+        delete m_db;
         m_db = NULL;
+        m_index.clear();
+      }
+
+      //! Load plan information and last change from the database.
+      void
+      loadIndex(void)
+      {
+        m_index.clear();
+
+        Database::Statement& iter = m_db->prepare(c_plan_iterator_stmt);
+        while (iter.execute())
+        {
+          IMC::PlanDBInformation info;
+
+          iter >> info.plan_id
+               >> info.change_time
+               >> info.change_sid
+               >> info.change_sname
+               >> info.md5
+               >> info.plan_size;
+
+          m_index[info.plan_id] = info;
+        }
+
+        Database::Statement& query = m_db->prepare(c_lastchange_query_stmt);
+        query.execute();
+        query >> m_last_change.time
+              >> m_last_change.sid
+              >> m_last_change.sname;
+        query.reset();
+
+        debug("loaded %u plans", (unsigned)m_index.size());
+      }
+
+      //! Queue a write. The request is answered by commit(), once
+      //! the write is committed.
+      //! @param op write operation.
+      //! @param success description of success.
+      void
+      write(Database::Queue::Operation* op, const char* success)
+      {
+        defer(m_queue->push(op), success);
+      }
+
+      //! Answer the current request with success, after any pending
+      //! replies.
+      //! @param success description of success.
+      void
+      succeed(const char* success)
+      {
+        if (m_pending.empty())
+          onSuccess(success);
+        else
+          defer(0, success);
+      }
+
+      //! Keep the current reply until pending writes are committed.
+      //! @param ticket queue ticket of the write, zero if none.
+      //! @param success description of success.
+      void
+      defer(unsigned ticket, const char* success)
+      {
+        m_pending.push_back(PendingReply());
+        m_pending.back().ticket = ticket;
+        m_pending.back().reply = m_reply;
+        m_pending.back().success = success;
+      }
+
+      //! Wait for queued writes, which are committed in as few
+      //! transactions as possible, and answer their requests. Other
+      //! connections to the database (e.g., the plan engine) see the
+      //! changes by the time the requests are answered. On failure
+      //! the index no longer matches the database, so it is reloaded.
+      void
+      commit(void)
+      {
+        if (m_pending.empty())
+          return;
+
+        m_queue->flush();
+
+        std::map<unsigned, std::string> errors;
+        std::string error;
+        unsigned ticket = 0;
+        while (m_queue->popError(error, &ticket))
+          errors[ticket] = error;
+
+        if (!errors.empty())
+        {
+          try
+          {
+            loadIndex();
+          }
+          catch (std::runtime_error& e)
+          {
+            err("%s", e.what());
+          }
+        }
+
+        for (size_t i = 0; i < m_pending.size(); ++i)
+        {
+          m_reply = m_pending[i].reply;
+
+          std::map<unsigned, std::string>::const_iterator itr = errors.find(m_pending[i].ticket);
+          if (itr == errors.end())
+          {
+            onSuccess(m_pending[i].success.c_str());
+            continue;
+          }
+
+          m_reply.arg.clear();
+          onFailure(String::str(DTR("failed to write to the database: %s"),
+                                itr->second.c_str()).c_str());
+        }
+
+        m_pending.clear();
+        m_reply.arg.clear();
       }
 
       void
@@ -216,6 +311,9 @@ namespace Plan
         if (ps->plan_id != pc->plan_id)
           return;
 
+        if (!m_db)
+          return;
+
         m_reply.clear();
         m_reply.op = IMC::PlanDB::DBOP_SET;
         m_reply.plan_id = pc->plan_id;
@@ -225,6 +323,9 @@ namespace Plan
         war(DTR("storing plan '%s' issued through a PlanControl request"), ps->plan_id.c_str());
 
         storeInDB(ps);
+
+        // Cleanup 'arg' field
+        m_reply.arg.clear();
       }
 
       void
@@ -256,6 +357,11 @@ namespace Plan
           return;
         }
 
+        // Reads see committed data and are answered after earlier writes.
+        if (req->op != IMC::PlanDB::DBOP_SET && req->op != IMC::PlanDB::DBOP_DEL
+            && req->op != IMC::PlanDB::DBOP_CLEAR && m_queue != NULL)
+          commit();
+
         // Setup fields to echo in reply message
         m_reply.setDestination(req->getSource());
         m_reply.setDestinationEntity(req->getSourceEntity());
@@ -311,20 +417,9 @@ namespace Plan
       onChange(const IMC::PlanDB& req)
       {
         uint16_t sid = req.getSource();
-        onChange(Clock::getSinceEpoch(), sid, resolveSystemId(sid));
-      }
-
-      void
-      onChange(double time, uint16_t sid, const std::string& sname)
-      {
-        // Update LastChange table information.
-        int count = 0;
-
-        *m_lastchange_update_stmt << time << sid << sname;
-        m_lastchange_update_stmt->execute(&count);
-
-        if (count != 1)
-          throw std::runtime_error(DTR("database is corrupt"));
+        m_last_change.time = Clock::getSinceEpoch();
+        m_last_change.sid = sid;
+        m_last_change.sname = resolveSystemId(sid);
       }
 
       void
@@ -358,46 +453,39 @@ namespace Plan
       void
       storeInDB(const IMC::PlanSpecification* spec)
       {
-        m_plan_info.plan_size = spec->getPayloadSerializationSize();
-        m_plan_info.plan_id = spec->plan_id;
-        m_plan_info.change_time = Clock::getSinceEpoch();
-        m_plan_info.change_sid = spec->getSource();
-        m_plan_info.change_sname = resolveSystemId(m_plan_info.change_sid);
+        StorePlan* op = new StorePlan;
+        IMC::PlanDBInformation& info = op->info;
 
-        Database::Blob plan_data(m_plan_info.plan_size);
-        spec->serializeFields((uint8_t*)&plan_data[0]);
+        info.plan_size = spec->getPayloadSerializationSize();
+        info.plan_id = spec->plan_id;
+        op->data.resize(info.plan_size);
+        spec->serializeFields((uint8_t*)&op->data[0]);
 
-        m_plan_info.md5.resize(16);
-        MD5::compute((uint8_t*)&plan_data[0], m_plan_info.plan_size, (uint8_t*)&m_plan_info.md5[0]);
+        info.md5.resize(16);
+        MD5::compute((uint8_t*)&op->data[0], info.plan_size, (uint8_t*)&info.md5[0]);
 
-        m_db->beginTransaction();
-
-        int count = 0;
-        try
-        {
-          *m_delete_plan_stmt << m_plan_info.plan_id;
-          m_delete_plan_stmt->execute(&count);
-          m_delete_plan_stmt->reset();
-
-          *m_insert_plan_stmt << m_plan_info.plan_id
-                              << m_plan_info.change_time
-                              << m_plan_info.change_sid
-                              << m_plan_info.change_sname
-                              << m_plan_info.md5
-                              << plan_data;
-          m_insert_plan_stmt->execute();
-          onChange(m_plan_info.change_time, m_plan_info.change_sid, m_plan_info.change_sname);
-        }
-        catch (std::runtime_error& e)
+        // Plans are often sent again unchanged when synchronizing.
+        Index::iterator itr = m_index.find(info.plan_id);
+        if (itr != m_index.end() && itr->second.md5 == info.md5)
         {
-          onFailure(e.what());
-          m_db->rollback();
+          delete op;
+          m_reply.arg.set(itr->second);
+          succeed(DTR("OK (unchanged)"));
+          return;
         }
 
-        m_db->commit();
+        info.change_time = Clock::getSinceEpoch();
+        info.change_sid = spec->getSource();
+        info.change_sname = resolveSystemId(info.change_sid);
 
-        m_reply.arg.set(m_plan_info);
-        onSuccess(count ? DTR("OK (updated)") : DTR("OK (new entry)"));
+        bool updated = itr != m_index.end();
+        m_index[info.plan_id] = info;
+        m_last_change.time = info.change_time;
+        m_last_change.sid = info.change_sid;
+        m_last_change.sname = info.change_sname;
+        m_reply.arg.set(info);
+
+        write(op, updated ? DTR("OK (updated)") : DTR("OK (new entry)"));
       }
 
       void
@@ -410,29 +498,20 @@ namespace Plan
         }
 
         inProgress();
-        m_db->beginTransaction();
 
-        int count = 0;
-        try
+        if (m_index.erase(req.plan_id) == 0)
         {
-          *m_delete_plan_stmt << req.plan_id;
-          m_delete_plan_stmt->execute(&count);
-          if (count)
-            onChange(req);
-        }
-        catch (std::runtime_error& e)
-        {
-          onFailure(e.what());
-          m_db->rollback();
+          onFailure(DTR("undefined plan"));
           return;
         }
 
-        m_db->commit();
+        onChange(req);
 
-        if (!count)
-          onFailure(DTR("undefined plan"));
-        else
-          onSuccess();
+        DeletePlan* op = new DeletePlan;
+        op->plan_id = req.plan_id;
+        op->change = m_last_change;
+
+        write(op, DTR("OK"));
       }
 
       void
@@ -444,26 +523,30 @@ namespace Plan
           return;
         }
 
-        *m_get_plan_stmt << req.plan_id;
+        if (m_index.find(req.plan_id) == m_index.end())
+        {
+          onFailure(DTR("undefined plan"));
+          return;
+        }
 
-        bool found = m_get_plan_stmt->execute();
+        Database::Statement& stmt = m_db->prepare(c_get_plan_stmt);
+        stmt << req.plan_id;
 
-        if (!found)
+        if (!stmt.execute())
         {
           onFailure(DTR("undefined plan"));
+          return;
         }
-        else
-        {
-          Database::Blob data;
-          *m_get_plan_stmt >> data;
 
-          IMC::PlanSpecification spec;
-          spec.deserializeFields((const uint8_t*)&data[0], data.size());
-          m_reply.arg.set(&spec);
+        Database::Blob data;
+        stmt >> data;
+        stmt.reset();
 
-          onSuccess();
-        }
-        m_get_plan_stmt->reset();
+        IMC::PlanSpecification spec;
+        spec.deserializeFields((const uint8_t*)&data[0], data.size());
+        m_reply.arg.set(&spec);
+
+        onSuccess();
       }
 
       void
@@ -475,26 +558,14 @@ namespace Plan
           return;
         }
 
-        *m_query_plan_stmt << req.plan_id;
-
-        bool found = m_query_plan_stmt->execute();
-
-        if (!found)
+        Index::const_iterator itr = m_index.find(req.plan_id);
+        if (itr == m_index.end())
         {
           onFailure(DTR("undefined plan"));
           return;
         }
 
-        m_plan_info.plan_id = req.plan_id;
-        *m_query_plan_stmt >> m_plan_info.change_time
-                           >> m_plan_info.change_sid
-                           >> m_plan_info.change_sname
-                           >> m_plan_info.md5
-                           >> m_plan_info.plan_size;
-
-        m_reply.arg.set(m_plan_info);
-        m_query_plan_stmt->reset();
-
+        m_reply.arg.set(itr->second);
         onSuccess();
       }
 
@@ -502,72 +573,48 @@ namespace Plan
       clearDatabase(const IMC::PlanDB& req)
       {
         inProgress();
-        m_db->beginTransaction();
 
-        try
-        {
-          m_delete_all_plans_stmt->execute();
-          onChange(req);
-        }
-        catch (std::runtime_error& e)
-        {
-          onFailure(e.what());
-          m_db->rollback();
-          return;
-        }
+        m_index.clear();
+        onChange(req);
 
-        m_db->commit();
-        onSuccess();
+        ClearPlans* op = new ClearPlans;
+        op->change = m_last_change;
+
+        write(op, DTR("OK"));
       }
 
       void
       getDatabaseState(const IMC::PlanDB& req)
       {
         (void)req;
-        IMC::PlanDBState* state = new IMC::PlanDBState;
+        IMC::PlanDBState state;
 
-        state->plan_size = 0;
-        state->plan_count = 0;
+        state.plan_size = 0;
+        state.plan_count = 0;
 
         MD5 md5sum;
 
-        IMC::MessageList<PlanDBInformation>* plandbinfo = &state->plans_info;
-
-        while (m_plan_iterator_stmt->execute())
+        Index::const_iterator itr = m_index.begin();
+        for (; itr != m_index.end(); ++itr)
         {
-          IMC::PlanDBInformation* pinfo = new IMC::PlanDBInformation;
-
-          *m_plan_iterator_stmt >> pinfo->plan_id
-                                >> pinfo->change_time
-                                >> pinfo->change_sid
-                                >> pinfo->change_sname
-                                >> pinfo->md5
-                                >> pinfo->plan_size;
-
-          md5sum.update((const uint8_t*)&pinfo->md5[0], 16); // the MD5 of all MD5s ordered by plan_id
-          state->plan_size += pinfo->plan_size;
-          state->plan_count++;
+          // the MD5 of all MD5s ordered by plan_id
+          md5sum.update((const uint8_t*)&itr->second.md5[0], 16);
+          state.plan_size += itr->second.plan_size;
+          state.plan_count++;
 
-          plandbinfo->push_back(*pinfo);
-
-          delete pinfo;
+          state.plans_info.push_back(itr->second);
         }
-        m_plan_iterator_stmt->reset();
 
         // Finalized MD5 digest
-        state->md5.resize(16);
-        md5sum.finalize((uint8_t*)&state->md5[0]);
+        state.md5.resize(16);
+        md5sum.finalize((uint8_t*)&state.md5[0]);
 
-        m_lastchange_query_stmt->execute();
-        *m_lastchange_query_stmt >> state->change_time
-                                 >> state->change_sid
-                                 >> state->change_sname;
-        m_lastchange_query_stmt->reset();
+        state.change_time = m_last_change.time;
+        state.change_sid = m_last_change.sid;
+        state.change_sname = m_last_change.sname;
 
-        m_reply.arg.set(*state);
+        m_reply.arg.set(state);
         onSuccess();
-
-        delete state;
       }
 
       void
@@ -619,7 +666,12 @@ namespace Plan
       {
         while (!stopping())
         {
+          // Writes requested while draining the message queue are
+          // committed together.
           waitForMessages(1.0);
+
+          if (m_queue != NULL)
+            commit();
         }
       }
     };
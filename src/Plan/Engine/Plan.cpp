@@ -48,6 +48,7 @@ namespace Plan
       m_progress(0.0),
       m_est_cal_time(0),
       m_profiles(NULL),
+      m_exec_duration(-1.0),
       m_beyond_dur(false),
       m_sched(NULL),
       m_started_maneuver(false),
@@ -105,6 +106,7 @@ namespace Plan
       m_curr_node = NULL;
       m_seq_nodes.clear();
       m_progress = -1.0;
+      m_exec_duration = -1.0;
       m_beyond_dur = false;
       m_started_maneuver = false;
       m_est_cal_time = m_min_cal_time;
@@ -331,8 +333,15 @@ namespace Plan
     // Private
 
     float
-    Plan::getExecutionDuration(void) const
+    Plan::computeDurations(void)
     {
+      for (size_t i = 0; i < m_seq_nodes.size(); ++i)
+      {
+        TimeProfile::const_iterator itr = m_profiles->find(m_seq_nodes[i]->maneuver_id);
+        if (itr != m_profiles->end())
+          m_graph[m_seq_nodes[i]->maneuver_id].durations = &itr->second.durations;
+      }
+
       if (!isLinear() || !m_profiles->size())
         return -1.0;
 
@@ -416,6 +425,7 @@ namespace Plan
         bool matched = false;
 
         node.pman = (*mitr);
+        node.durations = NULL;
 
         IMC::MessageList<IMC::PlanTransition>::const_iterator tritr;
         tritr = m_spec->transitions.begin();
@@ -465,6 +475,11 @@ namespace Plan
         if (isLinear() && state != NULL)
         {
           m_profiles->parse(m_seq_nodes, state);
+          m_exec_duration = computeDurations();
+
+          if (m_profiles->getCacheHits())
+            m_task->debug("plan: reused %u maneuver profiles",
+                          (unsigned)m_profiles->getCacheHits());
 
           Timeline tline;
           fillTimeline(tline);
@@ -591,11 +606,8 @@ namespace Plan
           mcs->eta == 0)
         return m_progress;
 
-      TimeProfile::const_iterator itr;
-      itr = m_profiles->find(getCurrentId());
-
       // If not found
-      if (itr == m_profiles->end())
+      if (m_curr_node == NULL || m_curr_node->durations == NULL)
       {
         // If beyond the last maneuver with valid duration
         if (m_beyond_dur)
@@ -610,13 +622,13 @@ namespace Plan
       }
 
       // If durations vector for this maneuver is empty
-      if (!itr->second.durations.size())
+      if (!m_curr_node->durations->size())
         return m_progress;
 
-      IMC::Message* man = m_graph.find(getCurrentId())->second.pman->data.get();
+      IMC::Message* man = m_curr_node->pman->data.get();
 
       // Get execution progress
-      float exec_prog = Progress::compute(man, mcs, itr->second.durations, exec_duration);
+      float exec_prog = Progress::compute(man, mcs, *m_curr_node->durations, exec_duration);
 
       float prog = 100.0 - getExecutionPercentage() * (1.0 - exec_prog / 100.0);
 
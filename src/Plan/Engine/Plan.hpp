@@ -208,8 +208,17 @@ namespace Plan
       //! Get duration of the execution phase of the plan
       //! (total of maneuver accumulated duration)
       //! @return duration of the execution phase of the plan
+      inline float
+      getExecutionDuration(void) const
+      {
+        return m_exec_duration;
+      }
+
+      //! Compute duration of the execution phase of the plan and
+      //! link graph nodes to their durations
+      //! @return duration of the execution phase of the plan
       float
-      getExecutionDuration(void) const;
+      computeDurations(void);
 
       //! Get total duration of the plan
       //! @return total duration of the plan
@@ -309,6 +318,8 @@ namespace Plan
         IMC::PlanManeuver* pman;
         //! Vector of pointers to plan transitions
         std::vector<IMC::PlanTransition*> trans;
+        //! Accumulated durations of the maneuver or NULL if unknown
+        const std::vector<float>* durations;
       };
 
       //! Mapping between maneuver IDs and graph nodes
@@ -336,6 +347,8 @@ namespace Plan
       std::vector<IMC::PlanManeuver*> m_seq_nodes;
       //! Pointer to maneuver durations
       Plans::TimeProfile* m_profiles;
+      //! Duration of the execution phase of the plan
+      float m_exec_duration;
       //! Flag to signal that the plan is past the last maneuver with a valid duration
       bool m_beyond_dur;
       //! Schedule for actions to take during plan
@@ -256,6 +256,12 @@ namespace Sensors
         return c_max_size - c_header_size;
       }
 
+      static unsigned
+      getMaximumSize(void)
+      {
+        return c_max_size;
+      }
+
       void
       dump(void) const
       {
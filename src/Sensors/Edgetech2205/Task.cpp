@@ -38,7 +38,6 @@
 #include "Parser.hpp"
 #include "CommandLink.hpp"
 #include "SubsystemData.hpp"
-#include "Log.hpp"
 
 namespace Sensors
 {
@@ -114,6 +113,8 @@ namespace Sensors
       double time_delta_init_tout;
       //! Number of samples for initial time delta estimatiom.
       unsigned time_delta_init_samples;
+      //! Number of packets buffered for the log.
+      unsigned log_packets;
     };
 
     struct Task: public Tasks::Task
@@ -128,8 +129,12 @@ namespace Sensors
       Parser m_parser;
       //! Command link.
       CommandLink* m_cmd;
-      //! Log file.
-      Log* m_log;
+      //! Log writer.
+      Hardware::PayloadLog* m_log;
+      //! Current log path.
+      Path m_log_path;
+      //! Number of log packets dropped when the log was last closed.
+      uint64_t m_log_dropped;
       //! Watchdog timer.
       Counter<double> m_wdog;
       //! Timer for time delta estimation.
@@ -152,6 +157,7 @@ namespace Sensors
         m_sock_dat(NULL),
         m_cmd(NULL),
         m_log(NULL),
+        m_log_dropped(0),
         m_sm_state(SM_IDLE),
         m_powered(false),
         m_packet(NULL)
@@ -252,6 +258,11 @@ namespace Sensors
         .defaultValue("10")
         .description("Number of valid samples for initial time delta estimation");
 
+        param("Log Buffer Size", m_args.log_packets)
+        .defaultValue("32")
+        .minimumValue("2")
+        .description("Number of packets buffered while waiting to be written to disk");
+
         m_bfr.resize(c_buffer_size);
 
         bind<IMC::EstimatedState>(this);
@@ -304,10 +315,26 @@ namespace Sensors
           setPing(SUBSYS_SSL, m_args.channels_lf);
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        m_packet = new Packet();
+        m_log = new Hardware::PayloadLog(m_args.log_packets, Packet::getMaximumSize());
+        m_log->start();
+      }
+
       void
       onResourceRelease(void)
       {
         closeLog();
+
+        if (m_log != NULL)
+        {
+          m_log->stopAndJoin();
+          Memory::clear(m_log);
+        }
+
+        Memory::clear(m_packet);
       }
 
       void
@@ -603,7 +630,7 @@ namespace Sensors
       void
       handleSonarData(void)
       {
-        if (m_log == NULL || m_packet == NULL)
+        if (m_log_path.empty())
           return;
 
         int subsys_idx = getSubsysIndex(m_packet->getSubsystemNumber());
@@ -781,7 +808,7 @@ namespace Sensors
           return false;
 
         consumeMessages();
-        if (m_sock_dat == NULL || m_packet == NULL)
+        if (m_sock_dat == NULL || m_log_path.empty())
           return false;
 
         size_t rv = m_sock_dat->read(&m_bfr[0], m_bfr.size());
@@ -831,41 +858,45 @@ namespace Sensors
         if (!isActive() && !isActivating())
           return;
 
-        if (m_log != NULL)
-        {
-          if (m_log->getPath() == path)
-            return;
-        }
+        if (m_log_path == path)
+          return;
 
         closeLog();
 
-        m_log = new Log(this, path);
-        m_log->start();
-        m_packet = m_log->get();
+        if (!m_log->open(path.str()))
+        {
+          war(DTR("failed to open log: %s"), path.c_str());
+          return;
+        }
+
+        m_log_path = path;
         debug("opened: %s", path.c_str());
       }
 
       void
       logPacket(void)
       {
-        if (m_log != NULL)
-        {
-          m_log->put(m_packet);
-          m_packet = m_log->get();
-        }
+        if (!m_log_path.empty())
+          m_log->write(m_packet->getData(), m_packet->getSize());
       }
 
       void
       closeLog(void)
       {
-        if (m_log == NULL)
+        if (m_log_path.empty())
           return;
 
-        m_log->stopAndJoin();
-        debug("closed: %s", m_log->getPath().c_str());
+        m_log->close();
+        debug("closed: %s", m_log_path.c_str());
+        m_log_path = Path();
 
-        Memory::clear(m_packet);
-        Memory::clear(m_log);
+        uint64_t dropped = m_log->getDropped();
+        if (dropped != m_log_dropped)
+        {
+          war(DTR("dropped %llu log packets"),
+              (unsigned long long)(dropped - m_log_dropped));
+          m_log_dropped = dropped;
+        }
       }
 
       void
@@ -966,7 +997,7 @@ namespace Sensors
 
             // Wait for log name.
           case SM_ACT_LOG_WAIT:
-            if (m_log != NULL)
+            if (!m_log_path.empty())
               queueState(SM_ACT_DONE);
             break;
 
@@ -35,9 +35,6 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
-// Local headers.
-#include "Reader.hpp"
-
 namespace Sensors
 {
   //! Device driver for NMEA capable %GPS devices.
@@ -67,6 +64,8 @@ namespace Sensors
     static const unsigned c_psathpr_fields = 7;
     //! Power on delay.
     static const double c_pwr_on_delay = 5.0;
+    //! Line termination character.
+    static const char c_line_term = '\n';
 
     struct Arguments
     {
@@ -86,7 +85,7 @@ namespace Sensors
       std::vector<std::string> pwr_channels;
     };
 
-    struct Task: public Tasks::Task
+    struct Task: public Tasks::Task, public IO::Reactor::Listener
     {
       //! Serial port handle.
       IO::Handle* m_handle;
@@ -106,15 +105,18 @@ namespace Sensors
       bool m_has_euler;
       //! Last initialization line read.
       std::string m_init_line;
-      //! Reader thread.
-      Reader* m_reader;
+      //! Sentence framer.
+      IO::Reactor::LineFramer m_framer;
+      //! Input channel.
+      IO::Reactor::Channel* m_channel;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_handle(NULL),
         m_has_agvel(false),
         m_has_euler(false),
-        m_reader(NULL)
+        m_framer(c_line_term),
+        m_channel(NULL)
       {
         // Define configuration parameters.
         param("Serial Port - Device", m_args.uart_dev)
@@ -180,8 +182,7 @@ namespace Sensors
           if (!openSocket())
             m_handle = new SerialPort(m_args.uart_dev, m_args.uart_baud);
 
-          m_reader = new Reader(this, m_handle);
-          m_reader->start();
+          m_channel = IO::Reactor::get().add(*m_handle, &m_framer, this);
         }
         catch (...)
         {
@@ -207,11 +208,10 @@ namespace Sensors
       void
       onResourceRelease(void)
       {
-        if (m_reader != NULL)
+        if (m_channel != NULL)
         {
-          m_reader->stopAndJoin();
-          delete m_reader;
-          m_reader = NULL;
+          IO::Reactor::get().remove(m_channel);
+          m_channel = NULL;
         }
 
         Memory::clear(m_handle);
@@ -257,7 +257,7 @@ namespace Sensors
         if (getEntityState() == IMC::EntityState::ESTA_BOOT)
           m_init_line = msg->value;
         else
-          processSentence(msg->value);
+          processSentence(msg->value, msg->getTimeStamp());
       }
 
       void
@@ -394,10 +394,41 @@ namespace Sensors
         return castLexical(str, dst);
       }
 
+      //! Called from the I/O reactor with new sentences, which are
+      //! handed to the task through the bus.
+      //! @param[in] channel input channel.
+      void
+      onInput(IO::Reactor::Channel& channel)
+      {
+        std::vector<uint8_t> frame;
+        double tstamp = 0;
+
+        while (channel.pop(frame, tstamp))
+        {
+          IMC::DevDataText line;
+          line.value.assign(frame.begin(), frame.end());
+          line.setTimeStamp(tstamp);
+          line.setDestination(getSystemId());
+          line.setDestinationEntity(getEntityId());
+          dispatch(line, DF_KEEP_TIME | DF_LOOP_BACK);
+        }
+
+        if (channel.hasError())
+        {
+          IMC::IoEvent evt;
+          evt.type = IMC::IoEvent::IOV_TYPE_INPUT_ERROR;
+          evt.error = channel.getError();
+          evt.setDestination(getSystemId());
+          evt.setDestinationEntity(getEntityId());
+          dispatch(evt, DF_LOOP_BACK);
+        }
+      }
+
       //! Process sentence.
       //! @param[in] line line.
+      //! @param[in] tstamp time of arrival of the sentence.
       void
-      processSentence(const std::string& line)
+      processSentence(const std::string& line, double tstamp)
       {
         // Discard leading noise.
         size_t sidx = 0;
@@ -433,18 +464,19 @@ namespace Sensors
         String::split(line.substr(sidx + 1, eidx - sidx - 1), ",", parts);
 
         if (std::find(m_args.stn_order.begin(), m_args.stn_order.end(), parts[0]) != m_args.stn_order.end())
-          interpretSentence(parts);
+          interpretSentence(parts, tstamp);
       }
 
       //! Interpret given sentence.
       //! @param[in] parts vector of strings from sentence.
+      //! @param[in] tstamp time of arrival of the sentence.
       void
-      interpretSentence(std::vector<std::string>& parts)
+      interpretSentence(std::vector<std::string>& parts, double tstamp)
       {
         if (parts[0] == m_args.stn_order.front())
         {
           clearMessages();
-          m_fix.setTimeStamp();
+          m_fix.setTimeStamp(tstamp);
           m_euler.setTimeStamp(m_fix.getTimeStamp());
           m_agvel.setTimeStamp(m_fix.getTimeStamp());
         }
@@ -487,17 +519,17 @@ namespace Sensors
         if (parts[0] == m_args.stn_order.back())
         {
           m_wdog.reset();
-          dispatch(m_fix);
+          dispatch(m_fix, DF_KEEP_TIME);
 
           if (m_has_euler)
           {
-            dispatch(m_euler);
+            dispatch(m_euler, DF_KEEP_TIME);
             m_has_euler = false;
           }
 
           if (m_has_agvel)
           {
-            dispatch(m_agvel);
+            dispatch(m_agvel, DF_KEEP_TIME);
             m_has_agvel = false;
           }
 
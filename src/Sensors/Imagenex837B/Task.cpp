@@ -162,6 +162,12 @@ namespace Sensors
       std::string file_name;
       //! Number of seconds without data before reporting an error.
       double timeout_error;
+      //! Number of frames buffered for the 837/83P log.
+      unsigned log_frames;
+      //! Publish one in every N pings to the bus.
+      unsigned publish_divisor;
+      //! Maximum rate of pings published to the bus.
+      double publish_rate;
     };
 
     //! List of available ranges.
@@ -186,6 +192,8 @@ namespace Sensors
     static const float c_beam_height = 120.0;
     //! Minimum altitude for dynamic range modifier.
     static const float c_min_alt = 0.3;
+    //! Maximum size of a 837/83P frame.
+    static const unsigned c_log_frame_size = 16384;
 
     //! %Task.
     struct Task: public Tasks::Task
@@ -210,10 +218,14 @@ namespace Sensors
       uint8_t m_rdata_ftr[c_rdata_ftr_size];
       //! Estimated state.
       IMC::EstimatedState m_estate;
-      //! Log file.
-      std::ofstream m_log_file;
+      //! Log writer.
+      Hardware::PayloadLog* m_log;
       //! Log filename
       Path m_log_path;
+      //! Number of log frames dropped when the log was last closed.
+      uint64_t m_log_dropped;
+      //! Selects pings published to the bus.
+      Hardware::Decimator m_decimator;
       //! Power channel control.
       IMC::PowerChannelControl m_power_channel_control;
       //! Activation/deactivation timer.
@@ -233,7 +245,9 @@ namespace Sensors
         m_frame837(NULL),
         m_frame83P(NULL),
         m_data(NULL),
-        m_ec(NULL)
+        m_ec(NULL),
+        m_log(NULL),
+        m_log_dropped(0)
       {
         // Define configuration parameters.
         paramActive(Tasks::Parameter::SCOPE_MANEUVER,
@@ -367,6 +381,25 @@ namespace Sensors
         .units(Units::Second)
         .description("Number of seconds without data before reporting an error");
 
+        param("Log Buffer Size", m_args.log_frames)
+        .defaultValue("256")
+        .minimumValue("2")
+        .description("Number of 837/83P frames buffered while waiting to be"
+                     " written to disk");
+
+        param("Bus Publishing Divisor", m_args.publish_divisor)
+        .defaultValue("1")
+        .minimumValue("1")
+        .description("Publish one in every N pings to the message bus."
+                     " All pings are written to the 837/83P log");
+
+        param("Bus Publishing Maximum Rate", m_args.publish_rate)
+        .defaultValue("0")
+        .minimumValue("0")
+        .units(Units::Hertz)
+        .description("Maximum rate of pings published to the message bus,"
+                     " 0 for unlimited");
+
         // Initialize switch data.
         std::memset(m_sdata, 0, sizeof(m_sdata));
         m_sdata[0] = 0xfe;
@@ -492,6 +525,9 @@ namespace Sensors
 
         if (paramChanged(m_args.timeout_error))
           m_wdog.setTop(m_args.timeout_error);
+
+        m_decimator.setDivisor(m_args.publish_divisor);
+        m_decimator.setMaximumRate(m_args.publish_rate);
       }
 
       //! Initialize IMC sonar data holder.
@@ -516,6 +552,13 @@ namespace Sensors
         m_data->data.resize(data_size);
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        m_log = new Hardware::PayloadLog(m_args.log_frames, c_log_frame_size);
+        m_log->start();
+      }
+
       void
       onResourceInitialization(void)
       {
@@ -532,6 +575,13 @@ namespace Sensors
         Memory::clear(m_data);
         Memory::clear(m_ec);
         requestDeactivation();
+
+        if (m_log != NULL)
+        {
+          m_log->stopAndJoin();
+          Memory::clear(m_log);
+          m_log_path = Path();
+        }
       }
 
       void
@@ -607,30 +657,38 @@ namespace Sensors
       void
       openLog(const Path& path)
       {
-        if (path == m_log_path)
+        if (m_log == NULL || path == m_log_path)
           return;
 
         closeLog();
 
+        if (!m_log->open(path.str()))
+        {
+          war(DTR("failed to open log: %s"), path.c_str());
+          return;
+        }
+
         m_log_path = path;
-        m_log_file.open(m_log_path.c_str(), std::ofstream::app | std::ios::binary);
         debug("opening %s", m_log_path.c_str());
       }
 
-      //! Close current log file.
+      //! Close current log file. Empty logs are removed by the
+      //! log writer.
       void
       closeLog(void)
       {
-        if (m_log_file.is_open())
+        if (m_log == NULL || m_log_path.empty())
+          return;
+
+        m_log->close();
+        m_log_path = Path();
+
+        uint64_t dropped = m_log->getDropped();
+        if (dropped != m_log_dropped)
         {
-          m_log_file.close();
-          int64_t size = m_log_path.size();
-          if (size == 0)
-          {
-            debug("removing empty log '%s'", m_log_path.c_str());
-            m_log_path.remove();
-          }
-          m_log_path = Path();
+          war(DTR("dropped %llu log frames"),
+              (unsigned long long)(dropped - m_log_dropped));
+          m_log_dropped = dropped;
         }
       }
 
@@ -935,13 +993,13 @@ namespace Sensors
           m_frame837->setRepRate();
         }
 
-        if (m_log_file.is_open())
+        if (!m_log_path.empty())
         {
           if (m_frame837 != NULL)
-            m_log_file.write((const char*)m_frame837->getData(), m_frame837->getSize());
+            m_log->write(m_frame837->getData(), m_frame837->getSize());
 
           if (m_frame83P != NULL)
-            m_log_file.write((const char*)m_frame83P->getData(), m_frame83P->getSize());
+            m_log->write(m_frame83P->getData(), m_frame83P->getSize());
         }
       }
 
@@ -1028,7 +1086,7 @@ namespace Sensors
         if (m_frame837 != NULL || m_frame83P != NULL)
           writeToFile();
 
-        if (m_data != NULL)
+        if (m_data != NULL && m_decimator.check(Clock::get()))
           dispatch(m_data);
 
         m_wdog.reset();
@@ -44,7 +44,7 @@ namespace Sensors
     {
     public:
       //! Constructor.
-      Parser(std::vector<char>& data_point_buffer):
+      Parser(IMC::RawData& data_point_buffer):
         m_data_points(data_point_buffer)
       {
         clear();
@@ -218,7 +218,7 @@ namespace Sensors
       //! Current parser state.
       State m_state;
       //! Return data.
-      std::vector<char>& m_data_points;
+      IMC::RawData& m_data_points;
       //! Number of data points .
       unsigned m_data_points_max;
       //! Number of data points seen so far.
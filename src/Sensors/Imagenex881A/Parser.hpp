@@ -44,7 +44,7 @@ namespace Sensors
     {
     public:
       //! Constructor.
-      Parser(std::vector<char>& data_point_buffer):
+      Parser(IMC::RawData& data_point_buffer):
         m_data(data_point_buffer)
       {
         clear();
@@ -267,7 +267,7 @@ namespace Sensors
       //! Current parser state.
       State m_state;
       //! Return data.
-      std::vector<char>& m_data;
+      IMC::RawData& m_data;
       //! Number of data points .
       uint16_t m_data_points;
       //! Number of data points seen so far.
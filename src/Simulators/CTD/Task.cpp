@@ -164,14 +164,17 @@ namespace Simulators
         if (!isActive())
           return;
 
+        double noise[3];
+        m_prng->fillGaussian(noise, 3);
+
         m_temp.setTimeStamp();
-        m_temp.value = m_args.mean_temp + m_prng->gaussian() * m_args.std_dev_temp;
+        m_temp.value = m_args.mean_temp + noise[0] * m_args.std_dev_temp;
 
         m_cond.setTimeStamp(m_temp.getTimeStamp());
-        m_cond.value = m_args.mean_cond + m_prng->gaussian() * m_args.std_dev_cond;
+        m_cond.value = m_args.mean_cond + noise[1] * m_args.std_dev_cond;
 
         m_depth.setTimeStamp(m_temp.getTimeStamp());
-        m_depth.value = std::max(m_sstate.z + m_prng->gaussian() * m_args.std_dev_depth, 0.0);
+        m_depth.value = std::max(m_sstate.z + noise[2] * m_args.std_dev_depth, 0.0);
 
         // Compute pressure.
         m_pressure.setTimeStamp(m_temp.getTimeStamp());
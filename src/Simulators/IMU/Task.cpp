@@ -188,12 +188,16 @@ namespace Simulators
         if (tstep <= 0)
           return;
 
+        double noise[3];
+
         // Define Euler Angles variables and add gaussian noise component.
         if (m_args.euler)
         {
-          m_euler.phi = Angles::normalizeRadian(msg->phi + m_prng->gaussian() * Angles::radians(m_args.stdev_euler));
-          m_euler.theta = Angles::normalizeRadian(msg->theta + m_prng->gaussian() * Angles::radians(m_args.stdev_euler));
-          m_euler.psi_magnetic = Angles::normalizeRadian(msg->psi + m_prng->gaussian() * Angles::radians(m_args.stdev_euler));
+          m_prng->fillGaussian(noise, 3);
+          double stdev = Angles::radians(m_args.stdev_euler);
+          m_euler.phi = Angles::normalizeRadian(msg->phi + noise[0] * stdev);
+          m_euler.theta = Angles::normalizeRadian(msg->theta + noise[1] * stdev);
+          m_euler.psi_magnetic = Angles::normalizeRadian(msg->psi + noise[2] * stdev);
           m_euler.psi = Angles::normalizeRadian(m_euler.psi_magnetic + m_heading_offset);
 
           // Heading offset will increment through time according with gyro rate bias.
@@ -204,9 +208,11 @@ namespace Simulators
         }
 
         // Define Angular Velocity variables and add gaussian noise component.
-        m_agvel.x = Angles::normalizeRadian(msg->p + m_prng->gaussian() * Angles::radians(m_args.stdev_agvel));
-        m_agvel.y = Angles::normalizeRadian(msg->q + m_prng->gaussian() * Angles::radians(m_args.stdev_agvel));
-        m_agvel.z = Angles::normalizeRadian(msg->r + m_prng->gaussian() * Angles::radians(m_args.stdev_agvel));
+        m_prng->fillGaussian(noise, 3);
+        double stdev_agvel = Angles::radians(m_args.stdev_agvel);
+        m_agvel.x = Angles::normalizeRadian(msg->p + noise[0] * stdev_agvel);
+        m_agvel.y = Angles::normalizeRadian(msg->q + noise[1] * stdev_agvel);
+        m_agvel.z = Angles::normalizeRadian(msg->r + noise[2] * stdev_agvel);
 
         // Compute acceleration values using simulated state velocity fields.
         m_accel.x = (msg->u - m_vel[0]) / tstep;
@@ -241,18 +241,21 @@ namespace Simulators
         // to turn it into the relative bearing
         real_bearing = Angles::normalizeRadian(m_args.usbl_heading - real_bearing);
 
+        double noise[3];
+        m_prng->fillGaussian(noise, 3);
+
         // Adding noise to bearing
-        msg->bearing = Angles::normalizeRadian(real_bearing + m_prng->gaussian() * m_args.usbl_bearing_res);
+        msg->bearing = Angles::normalizeRadian(real_bearing + noise[0] * m_args.usbl_bearing_res);
 
         // Computing elevation angle
         msg->elevation = std::atan2(m_sstate.z - m_args.usbl_depth, real_range_2d);
         // Adding noise using the same stdev as bearing's
-        msg->elevation = Angles::normalizeRadian(msg->elevation + m_prng->gaussian() * m_args.usbl_bearing_res);
+        msg->elevation = Angles::normalizeRadian(msg->elevation + noise[1] * m_args.usbl_bearing_res);
 
         // actual range in 3d
         msg->range = norm(real_range_2d, m_sstate.z - m_args.usbl_depth);
         // Adding noise
-        msg->range += m_prng->gaussian() * m_args.usbl_slant_acc / 2;
+        msg->range += noise[2] * m_args.usbl_slant_acc / 2;
       }
 
       //! Compute actual bearing angle and range from USBL transducer to vehicle
@@ -29,7 +29,7 @@
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
-#include <DUNE/Network/FragmentedMessage.hpp>
+#include <DUNE/Network/Reassembler.hpp>
 
 namespace Transports
 {
@@ -41,11 +41,13 @@ namespace Transports
     {
       // Reception timeout.
       float max_age_secs;
+      // Memory budget for incomplete messages.
+      unsigned budget;
     };
 
     struct Task: public DUNE::Tasks::Task
     {
-      std::map<uint32_t, FragmentedMessage> m_incoming;
+      Reassembler m_incoming;
       Time::Counter<float> m_gc_counter;
       Arguments m_args;
 
@@ -56,11 +58,24 @@ namespace Transports
         .defaultValue("1800")
         .description("Maximum amount of seconds to wait for missing fragments in incoming messages");
 
+        param("Memory Budget", m_args.budget)
+        .defaultValue("4096")
+        .units(Units::Kibibyte)
+        .description("Maximum amount of memory used by incomplete messages, "
+                     "least recently updated messages are discarded first");
+
         bind<IMC::MessagePart>(this);
         m_gc_counter.setTop(120);
+        m_incoming.setParentTask(this);
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      void
+      onUpdateParameters(void)
+      {
+        m_incoming.setBudget(m_args.budget * 1024);
+      }
+
       void
       onResourceRelease(void)
       {
@@ -70,23 +85,19 @@ namespace Transports
       void
       consume(const IMC::MessagePart* msg)
       {
-        int hash = (msg->uid << 16) | msg->getSource();
-
-        if (m_incoming.find(hash) == m_incoming.end())
+        IMC::Message* res = m_incoming.add(msg);
+        if (res != NULL)
         {
-          FragmentedMessage incMsg;
-          incMsg.setParentTask(this);
-          m_incoming[hash] = incMsg;
+          dispatch(res);
+          delete res;
+          return;
         }
 
-        debug("Incoming message fragment (%d still missing)",
-              m_incoming[hash].getFragmentsMissing());
-
-        IMC::Message * res = m_incoming[hash].setFragment(msg);
-        if (res != NULL)
+        if (getDebugLevel() >= DEBUG_LEVEL_DEBUG)
         {
-          dispatch(res);
-          m_incoming.erase(hash);
+          std::vector<unsigned> missing;
+          m_incoming.getMissingFragments(msg->getSource(), msg->uid, missing);
+          debug("Incoming message fragment (%u still missing)", (unsigned)missing.size());
         }
       }
 
@@ -94,23 +105,7 @@ namespace Transports
       messageRipper(void)
       {
         debug("ripping old messages");
-
-        std::map<uint32_t, FragmentedMessage>::iterator it = m_incoming.begin();
-        std::vector<uint32_t> remove;
-        for ( ; it != m_incoming.end(); ++it)
-        {
-          if (it->second.getAge() > m_args.max_age_secs)
-          {
-            remove.push_back(it->first);
-
-            // message has died of natural causes...
-            war(DTR("Removed incoming message from memory (%d fragments were still missing)."),
-                it->second.getFragmentsMissing());
-          }
-        }
-
-        for (size_t i = 0; i < remove.size(); ++i)
-          m_incoming.erase(remove[i]);
+        m_incoming.expire(m_args.max_age_secs);
       }
 
       void
@@ -43,7 +43,8 @@ namespace Transports
       m_uid(uid),
       m_last_msgs_json(0),
       m_last_logbook_json(0),
-      m_log_entry(100)
+      m_log_entry(100),
+      m_json(true)
     {
       // Initialize meta information.
       std::ostringstream os;
@@ -120,19 +121,19 @@ namespace Transports
       os << "  'dune_messages': [\n";
 
       std::map<unsigned, IMC::Message*>::iterator itr = m_msgs.begin();
-      itr->second->toJSON(os);
+      writeJSON(os, itr->second);
       ++itr;
 
       for (; itr != m_msgs.end(); ++itr)
       {
         os << ",\n";
-        itr->second->toJSON(os);
+        writeJSON(os, itr->second);
       }
 
       for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
       {
         os << ",\n";
-        pitr->second->toJSON(os);
+        writeJSON(os, pitr->second);
       }
 
       os << "\n]"
@@ -183,13 +184,13 @@ namespace Transports
 
       os << "var logbook = {\n"
          <<"'dune_logbook': [\n";
-      m_logbook[itr]->toJSON(os);
+      writeJSON(os, m_logbook[itr]);
       ++itr;
 
       for (; itr != m_logbook.size(); ++itr)
       {
         os << ",\n";
-        m_logbook[itr]->toJSON(os);
+        writeJSON(os, m_logbook[itr]);
       }
 
       os << "\n]"
@@ -223,5 +224,13 @@ namespace Transports
       else
         m_power_channels[msg->name] = new IMC::PowerChannelState(*msg);
     }
+
+    void
+    MessageMonitor::writeJSON(std::ostream& os, const IMC::Message* msg)
+    {
+      m_json.clear();
+      m_json.write(msg);
+      os << m_json.str();
+    }
   }
 }
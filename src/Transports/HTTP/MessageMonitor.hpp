@@ -104,9 +104,14 @@ namespace Transports
       uint64_t m_last_logbook_json;
       // Number of logbook messages to show.
       unsigned int m_log_entry;
+      // Message to JSON encoder.
+      DUNE::IMC::JSONWriter m_json;
 
       void
       updatePowerChannel(const DUNE::IMC::PowerChannelState* msg);
+
+      void
+      writeJSON(std::ostream& os, const DUNE::IMC::Message* msg);
     };
   }
 }
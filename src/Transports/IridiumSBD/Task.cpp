@@ -66,8 +66,8 @@ namespace Transports
       SerialPort* m_uart;
       //! Driver handler.
       Driver* m_driver;
-      //! List of transmission requests.
-      std::list<TxRequest*> m_tx_requests;
+      //! Queue of transmission requests.
+      Network::TxQueue<TxRequest*> m_tx_requests;
       //! Number of MT messages queued at the GSS.
       unsigned m_queued_mt;
       //! Mailbox check timer.
@@ -119,13 +119,13 @@ namespace Transports
       {
         Memory::clear(m_tx_request);
 
-        while (!m_tx_requests.empty())
+        std::vector<TxRequest*> requests;
+        m_tx_requests.clear(requests);
+        for (unsigned i = 0; i < requests.size(); ++i)
         {
-          TxRequest* req = m_tx_requests.front();
-          m_tx_requests.pop_front();
-          sendTxRequestStatus(req, IMC::IridiumTxStatus::TXSTATUS_ERROR,
+          sendTxRequestStatus(requests[i], IMC::IridiumTxStatus::TXSTATUS_ERROR,
                               DTR("task is shutting down"));
-          delete req;
+          delete requests[i];
         }
       }
 
@@ -239,17 +239,9 @@ namespace Transports
       void
       enqueueTxRequest(TxRequest* request)
       {
-        std::list<TxRequest*>::iterator itr = m_tx_requests.begin();
-        for ( ; itr != m_tx_requests.end(); ++itr)
-        {
-          if (request->getExpiration() < (*itr)->getExpiration())
-          {
-            m_tx_requests.insert(itr, request);
-            return;
-          }
-        }
-
-        m_tx_requests.insert(m_tx_requests.end(), request);
+        m_tx_requests.push(request, request->getData().size(),
+                           Network::TxQueue<TxRequest*>::PRIORITY_NORMAL,
+                           request->getExpiration());
       }
 
       void
@@ -262,6 +254,9 @@ namespace Transports
           return;
 
         debug("dequeing message");
+        m_tx_requests.account(1, m_tx_request->getData().size(), Clock::get());
+        debug("average transmission rate: %0.2f bytes/s",
+              m_tx_requests.getRate(Clock::get()));
         m_driver->clearBufferMO();
         sendTxRequestStatus(m_tx_request, IMC::IridiumTxStatus::TXSTATUS_OK);
         Memory::clear(m_tx_request);
@@ -331,16 +326,14 @@ namespace Transports
       void
       cleanExpired(void)
       {
-        std::list<TxRequest*>::iterator itr = m_tx_requests.begin();
-        while (itr != m_tx_requests.end())
-        {
-          if (!(*itr)->hasExpired())
-            break;
+        std::vector<TxRequest*> expired;
+        m_tx_requests.expire(Clock::get(), expired);
 
+        for (unsigned i = 0; i < expired.size(); ++i)
+        {
           spew("removing expired");
-          sendTxRequestStatus(*itr, IMC::IridiumTxStatus::TXSTATUS_EXPIRED);
-          delete *itr;
-          itr = m_tx_requests.erase(itr);
+          sendTxRequestStatus(expired[i], IMC::IridiumTxStatus::TXSTATUS_EXPIRED);
+          delete expired[i];
         }
       }
 
@@ -379,8 +372,9 @@ namespace Transports
         }
         else
         {
-          m_tx_request = m_tx_requests.front();
-          m_tx_requests.pop_front();
+          std::vector<TxRequest*> requests;
+          m_tx_requests.pop(0, requests);
+          m_tx_request = requests.front();
         }
       }
 
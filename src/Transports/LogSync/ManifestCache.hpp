@@ -0,0 +1,117 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_LOG_SYNC_MANIFEST_CACHE_HPP_INCLUDED_
+#define TRANSPORTS_LOG_SYNC_MANIFEST_CACHE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <ctime>
+#include <map>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace LogSync
+  {
+    //! Manifests of previously hashed files, shared by all sessions.
+    //! Entries are reused while the size and modification time of
+    //! the file remain unchanged.
+    class ManifestCache
+    {
+    public:
+      //! Constructor.
+      //! @param[in] chunk_size chunk size of manifests.
+      //! @param[in] capacity maximum number of cached manifests.
+      ManifestCache(unsigned chunk_size, unsigned capacity = 1024):
+        m_chunk_size(chunk_size),
+        m_capacity(capacity)
+      { }
+
+      //! Retrieve the manifest of a file.
+      //! @param[in] path file path.
+      //! @param[out] manifest file manifest.
+      //! @throw FileReadError if the file cannot be read.
+      void
+      get(const DUNE::FileSystem::Path& path, DUNE::FileSystem::ChunkManifest& manifest)
+      {
+        int64_t size = path.size();
+        time_t mtime = path.getLastModifiedTime();
+
+        {
+          DUNE::Concurrency::ScopedMutex l(m_mutex);
+          std::map<std::string, Entry>::iterator itr = m_entries.find(path.str());
+          if (itr != m_entries.end() && itr->second.size == size && itr->second.mtime == mtime)
+          {
+            manifest = itr->second.manifest;
+            return;
+          }
+        }
+
+        // Hash outside the lock, other sessions may proceed.
+        manifest = DUNE::FileSystem::ChunkManifest(m_chunk_size);
+        manifest.compute(path.str());
+
+        DUNE::Concurrency::ScopedMutex l(m_mutex);
+        if (m_entries.size() >= m_capacity)
+          m_entries.clear();
+
+        Entry& entry = m_entries[path.str()];
+        entry.size = manifest.getSize();
+        entry.mtime = mtime;
+        entry.manifest = manifest;
+      }
+
+    private:
+      //! Cache entry.
+      struct Entry
+      {
+        //! File size when hashed.
+        int64_t size;
+        //! Modification time when hashed.
+        time_t mtime;
+        //! File manifest.
+        DUNE::FileSystem::ChunkManifest manifest;
+      };
+
+      //! Chunk size.
+      unsigned m_chunk_size;
+      //! Maximum number of entries.
+      unsigned m_capacity;
+      //! Cached manifests by path.
+      std::map<std::string, Entry> m_entries;
+      //! Entries lock.
+      DUNE::Concurrency::Mutex m_mutex;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,332 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Session.hpp"
+
+namespace Transports
+{
+  namespace LogSync
+  {
+    using DUNE_NAMESPACES;
+
+    //! Maximum length of a request line.
+    static const size_t c_max_line = 4096;
+    //! Maximum number of chunks per GET request.
+    static const unsigned c_max_run = 1024;
+    //! Extensions of files that are not worth compressing.
+    static const char* c_packed_exts[] = {".gz", ".bz2", ".xz", ".lz4", ".zip", ".jpg", ".png"};
+
+    //! Check if a file is already compressed.
+    static bool
+    isPacked(const std::string& path)
+    {
+      for (unsigned i = 0; i < sizeof(c_packed_exts) / sizeof(c_packed_exts[0]); ++i)
+      {
+        if (String::endsWith(path, c_packed_exts[i]))
+          return true;
+      }
+
+      return false;
+    }
+
+    Session::Session(Tasks::Task* task, const Path& root, TCPSocket* sock,
+                     ManifestCache& cache, unsigned chunk_size, int level, double timeout):
+      m_task(task),
+      m_root(root),
+      m_sock(sock),
+      m_cache(cache),
+      m_chunk_size(chunk_size),
+      m_compress(level > 0),
+      m_zlib(level),
+      m_timer(timeout),
+      m_sent_raw(0),
+      m_sent_encoded(0)
+    {
+      m_raw.resize(m_chunk_size);
+      m_packed.resize(m_chunk_size);
+
+      m_sock->setNoDelay(true);
+      m_sock->setReceiveTimeout(5);
+      m_sock->setSendTimeout(30);
+    }
+
+    Session::~Session(void)
+    {
+      delete m_sock;
+    }
+
+    bool
+    Session::resolve(const std::string& path, Path& abs)
+    {
+      if (path.empty() || path[0] == '/' || path[0] == '\\')
+        return false;
+
+      std::vector<std::string> parts;
+      String::split(path, "/", parts);
+      for (unsigned i = 0; i < parts.size(); ++i)
+      {
+        if (parts[i] == "..")
+          return false;
+      }
+
+      abs = m_root / path;
+      return abs.isFile();
+    }
+
+    void
+    Session::send(const uint8_t* data, size_t size)
+    {
+      while (size > 0)
+      {
+        size_t rv = m_sock->write(data, size);
+        data += rv;
+        size -= rv;
+      }
+    }
+
+    void
+    Session::sendLine(const std::string& line)
+    {
+      std::string text = line + "\n";
+      send((const uint8_t*)text.c_str(), text.size());
+    }
+
+    void
+    Session::sendPayload(const std::string& payload)
+    {
+      sendLine(String::str("OK %u", (unsigned)payload.size()));
+      send((const uint8_t*)payload.c_str(), payload.size());
+    }
+
+    void
+    Session::listFolder(const Path& folder, const std::string& prefix, std::ostringstream& os)
+    {
+      Directory dir(folder);
+      const char* entry = NULL;
+      while ((entry = dir.readEntry(Directory::RD_FILE_NAME)))
+      {
+        std::string name = prefix + entry;
+        Path path = folder / entry;
+
+        if (path.isDirectory())
+          listFolder(path, name + "/", os);
+        else if (path.isFile())
+          os << path.size() << ' ' << (long long)path.getLastModifiedTime() << ' ' << name << '\n';
+      }
+    }
+
+    void
+    Session::handleList(void)
+    {
+      std::ostringstream os;
+      listFolder(m_root, "", os);
+      sendPayload(os.str());
+    }
+
+    void
+    Session::handleManifest(const std::string& path)
+    {
+      Path abs;
+      if (!resolve(path, abs))
+      {
+        sendLine("ERR no such file");
+        return;
+      }
+
+      ChunkManifest manifest(m_chunk_size);
+      try
+      {
+        m_cache.get(abs, manifest);
+      }
+      catch (std::exception& e)
+      {
+        sendLine(String::str("ERR %s", e.what()));
+        return;
+      }
+
+      sendPayload(manifest.serialize());
+    }
+
+    void
+    Session::handleGet(const std::string& args)
+    {
+      unsigned first = 0;
+      unsigned count = 0;
+      char encoding[16] = {0};
+      int offset = 0;
+      if (std::sscanf(args.c_str(), "%u %u %15s %n", &first, &count, encoding, &offset) < 3
+          || offset <= 0)
+      {
+        sendLine("ERR invalid request");
+        return;
+      }
+
+      std::string path = args.substr(offset);
+      bool zlib = m_compress && (std::strcmp(encoding, "zlib") == 0) && !isPacked(path);
+      count = std::min(count, c_max_run);
+
+      Path abs;
+      if (!resolve(path, abs))
+      {
+        sendLine("ERR no such file");
+        return;
+      }
+
+      std::ifstream ifs(abs.c_str(), std::ios::binary);
+      if (!ifs || !ifs.seekg((int64_t)first * m_chunk_size))
+      {
+        sendLine("ERR failed to read file");
+        return;
+      }
+
+      for (unsigned i = first; i < first + count; ++i)
+      {
+        ifs.read((char*)&m_raw[0], m_chunk_size);
+        unsigned size = ifs.gcount();
+        if (size == 0)
+          break;
+
+        uint64_t hash = ChunkManifest::hash(&m_raw[0], size);
+        const uint8_t* data = &m_raw[0];
+        unsigned length = size;
+        const char* enc = "raw";
+
+        if (zlib)
+        {
+          try
+          {
+            // A destination smaller than the chunk rejects
+            // compression that does not pay off.
+            m_zlib.compress((char*)&m_packed[0], size - 1, (char*)&m_raw[0], size);
+            data = &m_packed[0];
+            length = m_zlib.compressed();
+            enc = "zlib";
+          }
+          catch (std::exception&)
+          { }
+        }
+
+        sendLine(String::str("CHUNK %u %u %016llx %s %u", i, size,
+                             (unsigned long long)hash, enc, length));
+        send(data, length);
+
+        m_sent_raw += size;
+        m_sent_encoded += length;
+        m_timer.reset();
+
+        if (size < m_chunk_size)
+          break;
+      }
+
+      sendLine("END");
+    }
+
+    bool
+    Session::handleRequest(const std::string& line)
+    {
+      std::string cmd = line;
+      std::string args;
+      size_t sep = line.find(' ');
+      if (sep != std::string::npos)
+      {
+        cmd = line.substr(0, sep);
+        args = line.substr(sep + 1);
+      }
+
+      if (cmd == "LIST")
+        handleList();
+      else if (cmd == "MANIFEST")
+        handleManifest(args);
+      else if (cmd == "GET")
+        handleGet(args);
+      else if (cmd == "QUIT")
+        return false;
+      else
+        sendLine("ERR unknown request");
+
+      return true;
+    }
+
+    void
+    Session::run(void)
+    {
+      char bfr[1024];
+      bool active = true;
+
+      while (active && !isStopping())
+      {
+        if (m_timer.overflow())
+          break;
+
+        try
+        {
+          if (!Poll::poll(*m_sock, 1.0))
+            continue;
+
+          size_t rv = m_sock->read(bfr, sizeof(bfr));
+          for (size_t i = 0; i < rv && active; ++i)
+          {
+            if (bfr[i] == '\r')
+              continue;
+
+            if (bfr[i] != '\n')
+            {
+              if (m_line.size() < c_max_line)
+                m_line.push_back(bfr[i]);
+              continue;
+            }
+
+            active = handleRequest(m_line);
+            m_line.clear();
+            m_timer.reset();
+          }
+        }
+        catch (std::exception& e)
+        {
+          m_task->debug("session error: %s", e.what());
+          break;
+        }
+      }
+
+      m_task->debug("session closed: sent %llu bytes of data as %llu bytes",
+                    (unsigned long long)m_sent_raw, (unsigned long long)m_sent_encoded);
+    }
+  }
+}
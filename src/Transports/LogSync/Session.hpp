@@ -0,0 +1,150 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_LOG_SYNC_SESSION_HPP_INCLUDED_
+#define TRANSPORTS_LOG_SYNC_SESSION_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "ManifestCache.hpp"
+
+namespace Transports
+{
+  namespace LogSync
+  {
+    //! Synchronization session with one client. Requests are text
+    //! lines; file paths are relative to the log folder:
+    //!
+    //! - LIST: list all files as "<size> <mtime> <path>" lines.
+    //! - MANIFEST <path>: retrieve the chunk manifest of a file.
+    //! - GET <first> <count> <encoding> <path>: retrieve a run of
+    //!   chunks, encoding is "raw" or "zlib".
+    //! - QUIT: close the session.
+    //!
+    //! Replies are either "OK <length>" or "ERR <message>" lines;
+    //! OK is followed by length bytes of payload. GET replies with one
+    //! "CHUNK <index> <size> <hash> <encoding> <length>" line per
+    //! chunk, followed by the encoded chunk. Chunks requested as
+    //! "zlib" are only compressed if that makes them smaller.
+    class Session: public DUNE::Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] task parent task.
+      //! @param[in] root log folder.
+      //! @param[in] sock client socket (owned by the session).
+      //! @param[in] cache shared manifest cache.
+      //! @param[in] chunk_size chunk size.
+      //! @param[in] level compression level, 0 to disable compression.
+      //! @param[in] timeout idle timeout (s).
+      Session(DUNE::Tasks::Task* task, const DUNE::FileSystem::Path& root,
+              DUNE::Network::TCPSocket* sock, ManifestCache& cache,
+              unsigned chunk_size, int level, double timeout);
+
+      ~Session(void);
+
+    private:
+      //! Parent task.
+      DUNE::Tasks::Task* m_task;
+      //! Log folder.
+      DUNE::FileSystem::Path m_root;
+      //! Client socket.
+      DUNE::Network::TCPSocket* m_sock;
+      //! Manifest cache.
+      ManifestCache& m_cache;
+      //! Chunk size.
+      unsigned m_chunk_size;
+      //! True if chunks may be compressed.
+      bool m_compress;
+      //! Chunk compressor.
+      DUNE::Compression::ZlibCompressor m_zlib;
+      //! Raw chunk buffer.
+      std::vector<uint8_t> m_raw;
+      //! Compressed chunk buffer.
+      std::vector<uint8_t> m_packed;
+      //! Partial request line.
+      std::string m_line;
+      //! Idle timer.
+      DUNE::Time::Counter<double> m_timer;
+      //! Bytes of file data sent.
+      uint64_t m_sent_raw;
+      //! Bytes of encoded data sent.
+      uint64_t m_sent_encoded;
+
+      //! Resolve a client supplied path.
+      //! @param[in] path relative path.
+      //! @param[out] abs absolute path.
+      //! @return true if the path is a file inside the log folder.
+      bool
+      resolve(const std::string& path, DUNE::FileSystem::Path& abs);
+
+      //! Send data, blocking until everything is sent.
+      void
+      send(const uint8_t* data, size_t size);
+
+      //! Send a reply line.
+      void
+      sendLine(const std::string& line);
+
+      //! Send an OK reply with payload.
+      void
+      sendPayload(const std::string& payload);
+
+      void
+      listFolder(const DUNE::FileSystem::Path& folder, const std::string& prefix,
+                 std::ostringstream& os);
+
+      void
+      handleList(void);
+
+      void
+      handleManifest(const std::string& path);
+
+      void
+      handleGet(const std::string& args);
+
+      //! Handle a request line.
+      //! @return false if the session should end.
+      bool
+      handleRequest(const std::string& line);
+
+      void
+      run(void);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,249 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <list>
+#include <set>
+#include <sstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "ManifestCache.hpp"
+#include "Session.hpp"
+
+namespace Transports
+{
+  //! Log synchronization server.
+  //!
+  //! Serves the log folder in chunks identified by their hashes,
+  //! so that clients fetch only the chunks they are missing and
+  //! interrupted downloads resume where they stopped. Chunks of
+  //! uncompressed files are compressed on the fly. See
+  //! dune-logsync for the client side.
+  namespace LogSync
+  {
+    using DUNE_NAMESPACES;
+
+    //! %Task arguments.
+    struct Arguments
+    {
+      //! TCP port.
+      uint16_t port;
+      //! Chunk size.
+      unsigned chunk_size;
+      //! Compression level.
+      int level;
+      //! Session timeout.
+      double session_tout;
+    };
+
+    struct Task: public Tasks::Task
+    {
+      //! Task arguments.
+      Arguments m_args;
+      //! Listening sockets.
+      std::list<TCPSocket*> m_sockets;
+      //! I/O selector.
+      Poll m_poll;
+      //! Active sessions.
+      std::list<Session*> m_sessions;
+      //! Manifest cache.
+      ManifestCache* m_cache;
+
+      Task(const std::string& name, Tasks::Context& ctx):
+        Tasks::Task(name, ctx),
+        m_cache(NULL)
+      {
+        param("Port", m_args.port)
+        .defaultValue("30022")
+        .description("TCP port of the synchronization server");
+
+        param("Chunk Size", m_args.chunk_size)
+        .defaultValue("262144")
+        .minimumValue("4096")
+        .units(Units::Byte)
+        .description("Size of the chunks in which files are hashed and transferred");
+
+        param("Compression Level", m_args.level)
+        .defaultValue("1")
+        .minimumValue("0")
+        .maximumValue("9")
+        .description("Compression level of uncompressed files, 0 to disable");
+
+        param("Session Timeout", m_args.session_tout)
+        .defaultValue("60")
+        .units(Units::Second)
+        .description("Amount of time after which idle sessions are closed");
+      }
+
+      ~Task(void)
+      {
+        onResourceRelease();
+      }
+
+      void
+      onResourceAcquisition(void)
+      {
+        m_cache = new ManifestCache(m_args.chunk_size);
+
+        std::vector<Interface> itfs = Interface::get();
+        std::set<Address> addrs;
+        for (unsigned i = 0; i < itfs.size(); ++i)
+        {
+          Address addr = itfs[i].address();
+          if (addrs.find(addr) != addrs.end())
+            continue;
+
+          addrs.insert(addr);
+
+          TCPSocket* sock = new TCPSocket;
+          try
+          {
+            sock->bind(m_args.port, addr);
+            sock->listen(5);
+          }
+          catch (std::exception& e)
+          {
+            delete sock;
+            war(DTR("failed to listen on %s:%u: %s"), addr.c_str(), m_args.port, e.what());
+            continue;
+          }
+
+          m_poll.add(*sock);
+          m_sockets.push_back(sock);
+          debug("listening on %s:%u", addr.c_str(), m_args.port);
+
+          std::ostringstream os;
+          os << "logsync://" << addr.str() << ":" << m_args.port << "/";
+
+          IMC::AnnounceService announce;
+          announce.service = os.str();
+          if (addr.isLoopback())
+            announce.service_type = IMC::AnnounceService::SRV_TYPE_LOCAL;
+          else
+            announce.service_type = IMC::AnnounceService::SRV_TYPE_EXTERNAL;
+
+          dispatch(announce);
+        }
+
+        if (m_sockets.empty())
+          throw RestartNeeded(DTR("failed to bind port"), 10);
+
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        while (!m_sessions.empty())
+        {
+          Session* session = m_sessions.front();
+          m_sessions.pop_front();
+          session->stopAndJoin();
+          delete session;
+        }
+
+        while (!m_sockets.empty())
+        {
+          TCPSocket* sock = m_sockets.front();
+          m_sockets.pop_front();
+          m_poll.remove(*sock);
+          delete sock;
+        }
+
+        Memory::clear(m_cache);
+      }
+
+      void
+      acceptClient(TCPSocket* sock)
+      {
+        try
+        {
+          Address addr;
+          TCPSocket* client = sock->accept(&addr);
+          debug("accepted connection from '%s'", addr.c_str());
+
+          Session* session = new Session(this, m_ctx.dir_log, client, *m_cache,
+                                         m_args.chunk_size, m_args.level,
+                                         m_args.session_tout);
+          session->start();
+          m_sessions.push_back(session);
+        }
+        catch (std::exception& e)
+        {
+          err(DTR("error accepting new client connection: %s"), e.what());
+        }
+      }
+
+      void
+      cleanSessions(void)
+      {
+        std::list<Session*>::iterator itr = m_sessions.begin();
+        while (itr != m_sessions.end())
+        {
+          if ((*itr)->isDead())
+          {
+            (*itr)->stopAndJoin();
+            delete *itr;
+            itr = m_sessions.erase(itr);
+          }
+          else
+          {
+            ++itr;
+          }
+        }
+      }
+
+      void
+      onMain(void)
+      {
+        while (!stopping())
+        {
+          consumeMessages();
+          cleanSessions();
+
+          if (!m_poll.poll(1.0))
+            continue;
+
+          std::list<TCPSocket*>::iterator itr = m_sockets.begin();
+          for (; itr != m_sockets.end(); ++itr)
+          {
+            if (m_poll.wasTriggered(*(*itr)))
+              acceptClient(*itr);
+          }
+        }
+      }
+    };
+  }
+}
+
+DUNE_TASK
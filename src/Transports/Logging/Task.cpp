@@ -424,8 +424,7 @@ namespace Transports
         if (m_lsf == NULL)
           return;
 
-        IMC::Packet::serialize(msg, m_buffer);
-        m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        IMC::Packet::serialize(msg, m_buffer, *m_lsf);
       }
 
       void
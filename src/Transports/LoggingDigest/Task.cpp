@@ -271,8 +271,7 @@ namespace Transports
         if (m_log == NULL)
           return;
 
-        IMC::Packet::serialize(msg, m_buffer);
-        m_log->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        IMC::Packet::serialize(msg, m_buffer, *m_log);
       }
 
       //! Main loop.
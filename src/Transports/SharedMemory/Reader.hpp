@@ -0,0 +1,139 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_SHARED_MEMORY_READER_HPP_INCLUDED_
+#define TRANSPORTS_SHARED_MEMORY_READER_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! Read timeout (s).
+    static const double c_read_timeout = 1.0;
+    //! Period of dropped frames reports (s).
+    static const double c_report_period = 10.0;
+
+    //! Thread reading frames from the shared ring and dispatching
+    //! them to the local bus.
+    class Reader: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] task parent task.
+      //! @param[in] ring shared ring.
+      //! @param[in] origin identifier of frames written by this instance.
+      //! @param[in] trace true to print incoming messages.
+      Reader(Tasks::Task& task, SharedRing& ring, uint32_t origin, bool trace = false):
+        m_task(task),
+        m_ring(ring),
+        m_origin(origin),
+        m_trace(trace)
+      { }
+
+    private:
+      //! Parent task.
+      Tasks::Task& m_task;
+      //! Shared ring.
+      SharedRing& m_ring;
+      //! Identifier of frames written by this instance.
+      uint32_t m_origin;
+      //! True to print incoming messages.
+      bool m_trace;
+
+      void
+      run(void)
+      {
+        std::vector<uint8_t> bfr(m_ring.getSlotSize());
+        Time::Counter<double> report(c_report_period);
+        uint64_t dropped = 0;
+        uint32_t generation = m_ring.getGeneration();
+
+        while (!isStopping())
+        {
+          if (report.overflow())
+          {
+            report.reset();
+            if (m_ring.getDropped() != dropped)
+            {
+              m_task.war(DTR("lost %llu frames"),
+                         (unsigned long long)(m_ring.getDropped() - dropped));
+              dropped = m_ring.getDropped();
+            }
+          }
+
+          uint32_t origin = 0;
+          unsigned rv = 0;
+
+          try
+          {
+            rv = m_ring.read(&bfr[0], origin, c_read_timeout);
+          }
+          catch (std::exception& e)
+          {
+            m_task.err(DTR("segment was removed: %s"), e.what());
+            Time::Delay::wait(c_read_timeout);
+            continue;
+          }
+
+          if (m_ring.getGeneration() != generation)
+          {
+            generation = m_ring.getGeneration();
+            m_task.war(DTR("segment was created again, attached to generation %u"),
+                       generation);
+          }
+
+          if (rv == 0 || origin == m_origin)
+            continue;
+
+          try
+          {
+            IMC::Message* msg = IMC::Packet::deserialize(&bfr[0], rv);
+            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+
+            if (m_trace)
+              msg->toText(std::cerr);
+
+            delete msg;
+          }
+          catch (std::exception& e)
+          {
+            m_task.debug("error while unpacking message: %s", e.what());
+          }
+        }
+      }
+    };
+  }
+}
+
+#endif
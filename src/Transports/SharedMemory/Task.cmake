@@ -0,0 +1,4 @@
+# This task requires POSIX shared memory.
+if(NOT DUNE_SYS_HAS_SHM_OPEN)
+  set(TASK_ENABLED FALSE)
+endif(NOT DUNE_SYS_HAS_SHM_OPEN)
@@ -0,0 +1,232 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+// Local headers.
+#include "Reader.hpp"
+
+namespace Transports
+{
+  //! Transport of IMC messages between DUNE instances running on the
+  //! same computer, using a ring of frames in shared memory instead of
+  //! loopback sockets.
+  //!
+  //! One instance creates the ring (see 'Create Segment') and the
+  //! others attach to it, using the same 'Segment Name' and 'Slot
+  //! Count'. Every instance receives the frames written by all the
+  //! others. If the ring is created again, e.g., when its creator
+  //! restarts, attached instances move to the new ring.
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! %Task arguments.
+    struct Arguments
+    {
+      //! Name of the shared memory segment.
+      std::string name;
+      //! True to create the segment.
+      bool create;
+      //! Number of slots in the ring.
+      unsigned slots;
+      //! List of messages to transport.
+      std::vector<std::string> messages;
+      //! Rate limits.
+      std::vector<std::string> rate_lims;
+      //! Filtered entities.
+      std::vector<std::string> entities_flt;
+      //! Only transmit messages from local system.
+      bool only_local;
+      //! Trace incoming messages.
+      bool trace_in;
+      //! Trace outgoing messages.
+      bool trace_out;
+    };
+
+    //! Maximum size of a serialized message.
+    static const unsigned c_slot_size = 65535;
+
+    struct Task: public DUNE::Tasks::Task
+    {
+      //! Serialization buffer.
+      std::vector<uint8_t> m_bfr;
+      //! Shared ring.
+      SharedRing* m_ring;
+      //! Reader thread.
+      Reader* m_reader;
+      //! Identifier of frames written by this instance.
+      uint32_t m_origin;
+      //! Message filter.
+      MessageFilter m_filter;
+      //! Task arguments.
+      Arguments m_args;
+
+      Task(const std::string& name, Tasks::Context& ctx):
+        DUNE::Tasks::Task(name, ctx),
+        m_bfr(c_slot_size),
+        m_ring(NULL),
+        m_reader(NULL),
+        m_origin(static_cast<uint32_t>(getpid()))
+      {
+        param("Segment Name", m_args.name)
+        .defaultValue("imc")
+        .description("Name of the shared memory segment");
+
+        param("Create Segment", m_args.create)
+        .defaultValue("false")
+        .description("Create the segment instead of attaching to an existing one."
+                     " Only one instance should create a given segment");
+
+        param("Slot Count", m_args.slots)
+        .defaultValue("64")
+        .minimumValue("2")
+        .description("Number of messages buffered in the segment");
+
+        param("Print Outgoing Messages", m_args.trace_out)
+        .defaultValue("false")
+        .description("Print outgoing messages (Debug)");
+
+        param("Print Incoming Messages", m_args.trace_in)
+        .defaultValue("false")
+        .description("Print incoming messages (Debug)");
+
+        param("Rate Limiters", m_args.rate_lims)
+        .description("List of <Message>:<Frequency>");
+
+        param("Filtered Entities", m_args.entities_flt)
+        .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
+
+        param("Transports", m_args.messages)
+        .defaultValue("")
+        .description("List of messages to transport");
+
+        param("Local Messages Only", m_args.only_local)
+        .defaultValue("false")
+        .description("Only transmit messsages from local system.");
+      }
+
+      void
+      onUpdateParameters(void)
+      {
+        // Process rate limiters.
+        m_filter.setupRates(m_args.rate_lims);
+        // Process filtered entities.
+        m_filter.setupEntities(m_args.entities_flt, this);
+
+        // Register normal messages.
+        bind(this, m_args.messages);
+      }
+
+      void
+      onResourceAcquisition(void)
+      {
+        m_ring = new SharedRing(m_args.name.c_str(), m_args.slots, c_slot_size);
+
+        try
+        {
+          if (m_args.create)
+            m_ring->create();
+          else
+            m_ring->open();
+        }
+        catch (std::exception& e)
+        {
+          Memory::clear(m_ring);
+          throw RestartNeeded(e.what(), 5);
+        }
+
+        inf(DTR("%s segment '%s'"), m_args.create ? DTR("created") : DTR("attached to"),
+            m_args.name.c_str());
+
+        m_reader = new Reader(*this, *m_ring, m_origin, m_args.trace_in);
+        m_reader->start();
+
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        if (m_reader != NULL)
+        {
+          m_reader->stopAndJoin();
+          delete m_reader;
+          m_reader = NULL;
+        }
+
+        Memory::clear(m_ring);
+      }
+
+      void
+      consume(const IMC::Message* msg)
+      {
+        if (m_ring == NULL)
+          return;
+
+        if (m_args.only_local && msg->getSource() != getSystemId())
+          return;
+
+        if (m_filter.filter(msg))
+          return;
+
+        if (m_args.trace_out)
+          msg->toText(std::cerr);
+
+        try
+        {
+          uint16_t rv = IMC::Packet::serialize(msg, &m_bfr[0], m_bfr.size());
+          m_ring->write(&m_bfr[0], rv, m_origin);
+        }
+        catch (std::exception& e)
+        {
+          debug("error while packing message: %s", e.what());
+        }
+      }
+
+      void
+      onMain(void)
+      {
+        while (!stopping())
+          waitForMessages(1.0);
+      }
+    };
+  }
+}
+
+DUNE_TASK
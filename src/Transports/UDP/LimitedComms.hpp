@@ -58,6 +58,9 @@ namespace Transports
       {
         m_last_calc.setTop(SECONDS_BETWEEN_CALCULATIONS);
         std::memset(m_position, 0, sizeof(m_position));
+
+        for (unsigned i = 0; i < c_visible_words; ++i)
+          m_visible[i] = 0;
       }
 
       void
@@ -97,6 +100,7 @@ namespace Transports
         m_node_positions[id].lon = lon;
         m_node_positions[id].hae = alt;
         m_node_positions[id].visible = within_range;
+        setVisible(id, within_range);
       }
 
       void
@@ -119,13 +123,7 @@ namespace Transports
         if (message_id == DUNE_IMC_SIMULATEDSTATE || message_id == DUNE_IMC_ABORT)
           return true;
 
-        ScopedRWLock l(m_positions_lock);
-        if (m_node_positions.find(id) == m_node_positions.end())
-        {
-          return false;
-        }
-
-        return m_node_positions[id].visible;
+        return isVisible(id);
       }
 
       bool
@@ -181,6 +179,9 @@ namespace Transports
         bool visible;
       };
 
+      //! Number of words of the visibility bitmap.
+      static const unsigned c_visible_words = 65536 / 32;
+
       //! Recorded node positions.
       std::map<unsigned, NodePosition> m_node_positions;
       //! My own position
@@ -189,6 +190,9 @@ namespace Transports
       double m_comm_range;
       // Lock to serialize access to m_node_positions.
       RWLock m_positions_lock;
+      // Visibility of nodes indexed by system identifier. Updated
+      // while holding m_positions_lock and read without locking.
+      volatile uint32_t m_visible[c_visible_words];
       // Time for last visibility computation
       Counter<float> m_last_calc;
       // local IMC id
@@ -220,10 +224,29 @@ namespace Transports
 
           //std::cerr << itr->first << " is visible: " << pos.visible << "\n";
           m_node_positions[itr->first] = pos;
+          setVisible(itr->first, pos.visible);
         }
         m_last_calc.reset();
       }
 
+      void
+      setVisible(unsigned id, bool visible)
+      {
+        uint32_t mask = 1U << (id % 32);
+        unsigned word = (id / 32) % c_visible_words;
+
+        if (visible)
+          __sync_fetch_and_or(&m_visible[word], mask);
+        else
+          __sync_fetch_and_and(&m_visible[word], ~mask);
+      }
+
+      bool
+      isVisible(unsigned id) const
+      {
+        return (m_visible[(id / 32) % c_visible_words] >> (id % 32)) & 1;
+      }
+
       bool
       isReachable(double lat, double lon, double hae)
       {
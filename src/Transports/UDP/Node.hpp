@@ -137,22 +137,19 @@ namespace Transports
         return true;
       }
 
-      //! Send data to node.
-      //! @param[in] sock UDP destination socket.
-      //! @param[in] data data to be transmitted.
-      //! @param[in] data_len length of data to be transmitted.
-      void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len)
+      //! Retrieve the active address of the node.
+      //! @param[out] addr node address.
+      //! @param[out] port node port.
+      //! @return true if the node is active, false otherwise.
+      bool
+      getActive(Address& addr, unsigned& port) const
       {
         if (m_active == m_addrs.end())
-          return;
+          return false;
 
-        try
-        {
-          sock.write(data, data_len, m_active->first, m_active->second);
-        }
-        catch (...)
-        { }
+        addr = m_active->first;
+        port = m_active->second;
+        return true;
       }
 
     private:
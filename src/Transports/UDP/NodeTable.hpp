@@ -33,7 +33,10 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <map>
+#include <vector>
 #include <cstdio>
+#include <algorithm>
+#include <stdexcept>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -41,6 +44,7 @@
 // Local headers.
 #include "Node.hpp"
 #include "LimitedComms.hpp"
+#include "TokenBucket.hpp"
 
 namespace Transports
 {
@@ -48,18 +52,26 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    //! Table of dynamic destinations. Nodes are kept in a map, which
+    //! is only used when nodes are added, activated or deactivated.
+    //! Active nodes are flattened into an array of addresses sorted
+    //! by priority, and for each message identifier the list of
+    //! destinations (and their rate limiters) is computed once and
+    //! reused for every message.
     class NodeTable
     {
     public:
       NodeTable(void):
         m_active_count(0),
-        m_lcomms(NULL)
+        m_lcomms(NULL),
+        m_dirty(true)
       { }
 
       void
       addNode(unsigned id, const std::string& name, const std::string& services)
       {
-        m_table.insert(std::pair<unsigned, Node>(id, Node(name, services)));
+        if (m_table.insert(std::pair<unsigned, Node>(id, Node(name, services))).second)
+          m_dirty = true;
       }
 
       bool
@@ -73,6 +85,7 @@ namespace Transports
           return false;
 
         ++m_active_count;
+        m_dirty = true;
         return true;
       }
 
@@ -87,6 +100,7 @@ namespace Transports
           return false;
 
         --m_active_count;
+        m_dirty = true;
         return true;
       }
 
@@ -96,25 +110,92 @@ namespace Transports
         return m_active_count;
       }
 
+      //! Configure per destination rate limits.
+      //! @param[in] spec list of <System>:<Message>:<Frequency>. A
+      //! frequency of zero prevents the message from being sent to
+      //! that system.
       void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len, unsigned msgid)
+      setRateLimits(const std::vector<std::string>& spec)
       {
-        if (m_lcomms != NULL)
+        m_limits.clear();
+        m_buckets.clear();
+        m_dirty = true;
+
+        for (unsigned i = 0; i < spec.size(); ++i)
         {
-          if (m_lcomms->isActive())
+          std::vector<std::string> parts;
+          String::split(spec[i], ":", parts);
+
+          if (parts.size() == 3)
           {
-            for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+            uint32_t id = IMC::Factory::getIdFromAbbrev(parts[1]);
+            double rate = 0;
+            if (std::sscanf(parts[2].c_str(), "%lf", &rate) == 1 && rate >= 0)
             {
-              if (m_lcomms->isNodeWithinRange(itr->first, msgid))
-                itr->second.send(sock, data, data_len);
+              m_limits[parts[0]][id] = rate;
+              continue;
             }
+          }
+
+          throw std::runtime_error(String::str(DTR("invalid destination rate limiter: %s"), spec[i].c_str()));
+        }
+      }
+
+      //! Configure destination priorities. Destinations with higher
+      //! priority are sent messages first; the default is zero.
+      //! @param[in] spec list of <System>:<Priority>.
+      void
+      setPriorities(const std::vector<std::string>& spec)
+      {
+        m_priorities.clear();
+        m_dirty = true;
+
+        for (unsigned i = 0; i < spec.size(); ++i)
+        {
+          std::vector<std::string> parts;
+          String::split(spec[i], ":", parts);
 
-            return;
+          int priority = 0;
+          if (parts.size() == 2 && std::sscanf(parts[1].c_str(), "%d", &priority) == 1)
+          {
+            m_priorities[parts[0]] = priority;
+            continue;
           }
+
+          throw std::runtime_error(String::str(DTR("invalid destination priority: %s"), spec[i].c_str()));
         }
+      }
 
-        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-          itr->second.send(sock, data, data_len);
+      void
+      send(UDPSocket& sock, const uint8_t* data, unsigned data_len, unsigned msgid)
+      {
+        if (m_dirty)
+          rebuild();
+
+        const Fanout& fanout = getFanout(msgid);
+        if (fanout.empty())
+          return;
+
+        bool limited = (m_lcomms != NULL) && m_lcomms->isActive();
+        double now = Clock::get();
+
+        for (Fanout::const_iterator itr = fanout.begin(); itr != fanout.end(); ++itr)
+        {
+          const Destination& dst = m_dsts[itr->destination];
+
+          if (limited && !m_lcomms->isNodeWithinRange(dst.id, msgid))
+            continue;
+
+          if (itr->bucket != NULL && !itr->bucket->take(now))
+            continue;
+
+          try
+          {
+            sock.write(data, data_len, dst.addr, dst.port);
+          }
+          catch (...)
+          { }
+        }
       }
 
       void
@@ -124,13 +205,127 @@ namespace Transports
       }
 
     private:
+      //! Active destination.
+      struct Destination
+      {
+        //! System identifier.
+        unsigned id;
+        //! System name.
+        std::string name;
+        //! Address.
+        Address addr;
+        //! Port.
+        unsigned port;
+        //! Priority.
+        int priority;
+
+        bool
+        operator<(const Destination& other) const
+        {
+          return priority > other.priority;
+        }
+      };
+
+      //! Destination of a given message.
+      struct Route
+      {
+        //! Index of destination.
+        unsigned destination;
+        //! Rate limiter or NULL.
+        TokenBucket* bucket;
+      };
+
       typedef std::map<unsigned, Node> Table;
+      typedef std::vector<Route> Fanout;
+      typedef std::pair<unsigned, unsigned> BucketKey;
+
       // Number of active nodes.
       unsigned m_active_count;
       // Node table.
       Table m_table;
       // Limited Comms object
       LimitedComms* m_lcomms;
+      // Active destinations, sorted by priority.
+      std::vector<Destination> m_dsts;
+      // Destinations indexed by message identifier.
+      std::vector<Fanout> m_fanouts;
+      // Message identifiers whose fanout was computed.
+      std::vector<bool> m_fanout_valid;
+      // True if destinations must be recomputed.
+      bool m_dirty;
+      // Rate limits indexed by system name and message identifier.
+      std::map<std::string, std::map<unsigned, double> > m_limits;
+      // Priorities indexed by system name.
+      std::map<std::string, int> m_priorities;
+      // Rate limiters indexed by system identifier and message identifier.
+      std::map<BucketKey, TokenBucket> m_buckets;
+
+      void
+      rebuild(void)
+      {
+        m_dsts.clear();
+        m_fanouts.clear();
+        m_fanout_valid.clear();
+
+        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+        {
+          Destination dst;
+          if (!itr->second.getActive(dst.addr, dst.port))
+            continue;
+
+          dst.id = itr->first;
+          dst.name = itr->second.getName();
+          std::map<std::string, int>::const_iterator pitr = m_priorities.find(dst.name);
+          dst.priority = (pitr == m_priorities.end()) ? 0 : pitr->second;
+          m_dsts.push_back(dst);
+        }
+
+        std::stable_sort(m_dsts.begin(), m_dsts.end());
+        m_dirty = false;
+      }
+
+      const Fanout&
+      getFanout(unsigned msgid)
+      {
+        if (msgid >= m_fanouts.size())
+        {
+          m_fanouts.resize(msgid + 1);
+          m_fanout_valid.resize(msgid + 1, false);
+        }
+
+        Fanout& fanout = m_fanouts[msgid];
+        if (m_fanout_valid[msgid])
+          return fanout;
+
+        for (unsigned i = 0; i < m_dsts.size(); ++i)
+        {
+          Route route;
+          route.destination = i;
+          route.bucket = NULL;
+
+          std::map<std::string, std::map<unsigned, double> >::const_iterator litr = m_limits.find(m_dsts[i].name);
+          if (litr != m_limits.end())
+          {
+            std::map<unsigned, double>::const_iterator ritr = litr->second.find(msgid);
+            if (ritr != litr->second.end())
+            {
+              if (ritr->second <= 0)
+                continue;
+
+              BucketKey key(m_dsts[i].id, msgid);
+              std::map<BucketKey, TokenBucket>::iterator bitr = m_buckets.find(key);
+              if (bitr == m_buckets.end())
+                bitr = m_buckets.insert(std::make_pair(key, TokenBucket(ritr->second))).first;
+              route.bucket = &bitr->second;
+            }
+          }
+
+          fanout.push_back(route);
+        }
+
+        m_fanout_valid[msgid] = true;
+        return fanout;
+      }
     };
   }
 }
@@ -66,6 +66,10 @@ namespace Transports
       bool trace_out;
       // Rate limits.
       std::vector<std::string> rate_lims;
+      // Rate limits per destination.
+      std::vector<std::string> dst_rate_lims;
+      // Destination priorities.
+      std::vector<std::string> dst_priorities;
       // Filtered entities.
       std::vector<std::string> entities_flt;
       // List of messages to publish.
@@ -146,6 +150,13 @@ namespace Transports
         param("Rate Limiters", m_args.rate_lims)
         .description("List of <Message>:<Frequency>");
 
+        param("Destination Rate Limiters", m_args.dst_rate_lims)
+        .description("List of <System>:<Message>:<Frequency> limiting the rate of messages "
+                     "sent to a given dynamic node (a frequency of zero blocks the message)");
+
+        param("Destination Priorities", m_args.dst_priorities)
+        .description("List of <System>:<Priority>. Dynamic nodes with higher priority are served first");
+
         param("Filtered Entities", m_args.entities_flt)
         .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
 
@@ -206,6 +217,9 @@ namespace Transports
         m_filter.setupRates(m_args.rate_lims);
         // Process filtered entities.
         m_filter.setupEntities(m_args.entities_flt, this);
+        // Process per destination rate limiters and priorities.
+        m_node_table.setRateLimits(m_args.dst_rate_lims);
+        m_node_table.setPriorities(m_args.dst_priorities);
 
         m_underwater_comms = m_args.underwater_comms;
 
@@ -0,0 +1,88 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_UDP_TOKEN_BUCKET_HPP_INCLUDED_
+#define TRANSPORTS_UDP_TOKEN_BUCKET_HPP_INCLUDED_
+
+namespace Transports
+{
+  namespace UDP
+  {
+    //! Token bucket used to limit the rate of messages sent to a
+    //! destination. Tokens accumulate at a fixed rate up to the
+    //! bucket capacity; each message consumes one token.
+    class TokenBucket
+    {
+    public:
+      //! Constructor.
+      //! @param[in] rate token rate (Hz).
+      //! @param[in] capacity maximum number of tokens.
+      TokenBucket(double rate = 0.0, double capacity = 1.0):
+        m_rate(rate),
+        m_capacity(capacity),
+        m_tokens(capacity),
+        m_last(-1.0)
+      { }
+
+      //! Take one token, if available.
+      //! @param[in] now current time (s).
+      //! @return true if a token was taken, false otherwise.
+      bool
+      take(double now)
+      {
+        if (m_last >= 0 && now > m_last)
+        {
+          m_tokens += (now - m_last) * m_rate;
+          if (m_tokens > m_capacity)
+            m_tokens = m_capacity;
+        }
+
+        m_last = now;
+
+        if (m_tokens < 1.0)
+          return false;
+
+        m_tokens -= 1.0;
+        return true;
+      }
+
+    private:
+      //! Token rate (Hz).
+      double m_rate;
+      //! Maximum number of tokens.
+      double m_capacity;
+      //! Available tokens.
+      double m_tokens;
+      //! Time of last update.
+      double m_last;
+    };
+  }
+}
+
+#endif
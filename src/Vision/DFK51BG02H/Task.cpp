@@ -29,6 +29,7 @@
 
 // ISO C++ 98 headers.
 #include <queue>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -120,6 +121,10 @@ namespace Vision
       unsigned jpeg_quality;
       //! Number of frame buffers.
       unsigned buffer_count;
+      //! Number of image buffers.
+      unsigned image_count;
+      //! Number of image processing threads.
+      unsigned workers;
       //! Exposure time (or maximum value if auto).
       double exposure_time;
       //! Automatic Exposure.
@@ -161,8 +166,6 @@ namespace Vision
       GVCP* m_gvcp;
       //! %GVSP.
       GVSP* m_gvsp;
-      //! RGB24 buffer.
-      uint8_t* m_rgb24_bfr;
       //! Keep-alive counter.
       Counter<double> m_kalive;
       //! %Destination log folder.
@@ -171,10 +174,12 @@ namespace Vision
       std::queue<Frame*> m_frames;
       //! PGM header.
       std::string m_pgm_header;
-      //! Compressor.
-      JPEGCompressor m_jpeg;
-      //! Bayer decoder.
-      BayerDecoder m_debayer;
+      //! Demosaicing and compression pipeline.
+      ImagePipeline* m_pipeline;
+      //! Pipeline statistics report timer.
+      Counter<double> m_report;
+      //! Number of dropped images at the last report.
+      uint64_t m_dropped;
       // White-balance filter.
       WhiteBalance m_white;
       // Exposure time.
@@ -188,7 +193,9 @@ namespace Vision
         m_gvsp(NULL),
         m_kalive(0.5),
         m_log_dir(ctx.dir_log),
-        m_debayer(BayerDecoder::TILE_GBRG),
+        m_pipeline(NULL),
+        m_report(10.0),
+        m_dropped(0),
         m_white(c_width, c_height)
       {
         // Retrieve configuration values.
@@ -264,6 +271,17 @@ namespace Vision
         .defaultValue("25")
         .description("Number of buffers");
 
+        param("Number of Image Buffers", m_args.image_count)
+        .defaultValue("4")
+        .minimumValue("1")
+        .description("Number of images being demosaiced and compressed"
+                     " at the same time");
+
+        param("Image Processing Threads", m_args.workers)
+        .defaultValue("4")
+        .minimumValue("1")
+        .description("Number of threads used to demosaic and compress images");
+
         param("JPEG Quality", m_args.jpeg_quality)
         .defaultValue("80")
         .units(Units::Percentage)
@@ -281,20 +299,12 @@ namespace Vision
         param("White Balance - R Factor", m_args.r_factor)
         .defaultValue("1.0");
 
-        m_rgb24_bfr = new uint8_t[c_width * c_height * 3];
-
         // Initialize PGM header.
         m_pgm_header = String::str("P5 %u %u 255\n", c_width, c_height);
 
         bind<IMC::LoggingControl>(this);
       }
 
-      //! Destructor.
-      ~Task(void)
-      {
-        delete [] m_rgb24_bfr;
-      }
-
       //! Update internal parameters.
       void
       onUpdateParameters(void)
@@ -303,18 +313,20 @@ namespace Vision
         m_white.setRFactor(m_args.r_factor);
         m_white.setBFactor(m_args.b_factor);
 
-        // Bayer decoder.
-        m_debayer.setMethod(BayerDecoder::METHOD_BILINEAR);
+        if (m_pipeline != NULL)
+          m_pipeline->setQuality(m_args.jpeg_quality);
       }
 
       //! Acquire resources and buffers.
       void
       onResourceAcquisition(void)
       {
-        // Initialize JPEG compressor.
-        m_jpeg.setInputDimensions(c_width, c_height);
-        m_jpeg.setInputColorSpace(JPEGCompressor::CS_RGB);
-        m_jpeg.setOutputColorSpace(JPEGCompressor::CS_YUV);
+        // Initialize image pipeline.
+        m_pipeline = new ImagePipeline(c_width, c_height, m_args.image_count, m_args.workers);
+        m_pipeline->setBayer(BayerDecoder::TILE_GBRG, BayerDecoder::METHOD_BILINEAR);
+        m_pipeline->setQuality(m_args.jpeg_quality);
+        m_pipeline->start();
+        m_dropped = 0;
 
         m_gvcp = new GVCP(m_args.raddr);
         m_gvsp = new GVSP(this, m_args.port);
@@ -341,6 +353,8 @@ namespace Vision
           m_gvsp = NULL;
         }
 
+        Memory::clear(m_pipeline);
+
         while (!m_frames.empty())
         {
           Frame* frame = m_frames.front();
@@ -438,6 +452,56 @@ namespace Vision
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
       }
 
+      //! Write a processed image and update automatic exposure.
+      //! @param[in] image processed image.
+      void
+      onImage(ImagePipeline::Image* image)
+      {
+        Path file = m_log_dir / String::str("%0.4f.jpg", image->timestamp);
+        std::ofstream jpg(file.c_str(), std::ios::binary);
+        jpg.write((const char*)&image->jpeg[0], image->jpeg.size());
+
+        if (m_args.ae)
+        {
+          float correction = m_ae.exposureCorrection(&image->rgb[0], c_width * c_height);
+          // Smooth out the exposure (make it slower varying), halve the deltaEV
+          correction = std::sqrt(correction);
+          m_exposure = Math::trimValue(m_exposure * correction, 0.0001, m_args.exposure_time);
+
+          if (m_exposure >= m_args.ae_min)
+            m_gvcp->setExposureTime(m_exposure);
+          else
+            m_gvcp->setExposureTime(m_args.ae_min);
+        }
+      }
+
+      //! Collect processed images and report pipeline statistics.
+      void
+      drainPipeline(void)
+      {
+        ImagePipeline::Image* image = NULL;
+        while ((image = m_pipeline->wait(0)) != NULL)
+        {
+          onImage(image);
+          m_pipeline->release(image);
+        }
+
+        if (!m_report.overflow())
+          return;
+
+        m_report.reset();
+
+        ImagePipeline::Statistics stats = m_pipeline->getStatistics();
+        if (stats.dropped != m_dropped)
+        {
+          war(DTR("dropped %u images"), (unsigned)(stats.dropped - m_dropped));
+          m_dropped = stats.dropped;
+        }
+
+        debug("images: %u | latency: %0.3f s (mean) %0.3f s (max)",
+              (unsigned)stats.completed, stats.latency_mean, stats.latency_max);
+      }
+
       void
       onMain(void)
       {
@@ -460,6 +524,7 @@ namespace Vision
           }
 
           consumeMessages();
+          drainPipeline();
 
           frame = m_gvsp->dequeueDirty();
           if (frame == NULL)
@@ -476,35 +541,21 @@ namespace Vision
           {
             m_white.filter(frame->getData());
             double timestamp = frame->getTimeStamp();
-            Path file = m_log_dir / String::str("%0.4f.jpg", timestamp);
 
+            ImagePipeline::Image* image = m_pipeline->acquire();
+            if (image != NULL)
             {
-              m_debayer.decodeToRGB24(frame->getData(), m_rgb24_bfr, c_width, c_height);
-              m_jpeg.compress(m_rgb24_bfr, m_args.jpeg_quality);
-              std::ofstream jpg(file.c_str(), std::ios::binary);
-              jpg.write((char*)m_jpeg.imageData(), m_jpeg.imageSize());
+              std::memcpy(&image->bayer[0], frame->getData(), c_width * c_height);
+              m_pipeline->submit(image, timestamp);
             }
 
             if (m_args.store_raw)
             {
-              file = m_log_dir / String::str("%0.4f.pgm", timestamp);
+              Path file = m_log_dir / String::str("%0.4f.pgm", timestamp);
               std::ofstream pgm(file.c_str(), std::ios::binary);
               pgm.write(m_pgm_header.c_str(), m_pgm_header.size());
               pgm.write((char*)frame->getData(), c_width * c_height);
             }
-
-            if (m_args.ae)
-            {
-              float correction = m_ae.exposureCorrection(m_rgb24_bfr, c_width * c_height);
-              // Smooth out the exposure (make it slower varying), halve the deltaEV
-              correction = std::sqrt(correction);
-              m_exposure = Math::trimValue(m_exposure * correction, 0.0001, m_args.exposure_time);
-
-              if (m_exposure >= m_args.ae_min)
-                m_gvcp->setExposureTime(m_exposure);
-              else
-                m_gvcp->setExposureTime(m_args.ae_min);
-            }
           }
 
           m_gvsp->enqueueClean(frame);
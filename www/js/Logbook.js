@@ -28,20 +28,20 @@ Logbook.prototype.update = function() {
 // Returns the string format of a LogBookEntry's type
 function typeAsString(typeInt) {
     var typeStr = "";
-    switch (typeInt) {
-    case '0':
+    switch (Number(typeInt)) {
+    case 0:
 	typeStr = "INFO";
 	break;
-    case '1':
+    case 1:
 	typeStr = "WARNING";
 	break;
-    case '2':
+    case 2:
 	typeStr = "ERROR";
 	break;
-    case '3':
+    case 3:
 	typeStr = "CRITICAL";
 	break;
-    case '4':
+    case 4:
 	typeStr = "DEBUG";
 	break;
     }